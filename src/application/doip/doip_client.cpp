@@ -3,7 +3,6 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include <algorithm>
-#include <thread>
 #include <doiplib/diag_message.h>
 #include <doiplib/diag_message_ack.h>
 #include <doiplib/vehicle_id_request.h>
@@ -98,12 +97,11 @@ namespace application
 
         void DoipClient::onSend()
         {
-            while (!mSendQueue.Empty())
+            // Drain everything that is queued so far.
+            std::vector<uint8_t> _serializedMessageVec;
+            while (mSendQueue.TryDequeue(_serializedMessageVec))
             {
-                std::vector<uint8_t> _serializedMessageVec;
-                const bool cDequeued{mSendQueue.TryDequeue(_serializedMessageVec)};
-
-                if (cDequeued && _serializedMessageVec.size() <= cDoipPacketSize)
+                if (_serializedMessageVec.size() <= cDoipPacketSize)
                 {
                     auto _moveItr{
                         std::make_move_iterator(_serializedMessageVec.begin())};
@@ -116,8 +114,6 @@ namespace application
 
                     mClient.Send(_serializedMessageArr);
                 }
-
-                std::this_thread::yield();
             }
         }
 
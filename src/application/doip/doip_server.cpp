@@ -102,12 +102,11 @@ namespace application
 
         void DoipServer::onSend()
         {
-            while (!mSendQueue.Empty())
+            // Drain everything that is queued so far.
+            std::vector<uint8_t> _sendData;
+            while (mSendQueue.TryDequeue(_sendData))
             {
-                std::vector<uint8_t> _sendData;
-                const bool cDequeued{mSendQueue.TryDequeue(_sendData)};
-
-                if (cDequeued && _sendData.size() <= cDoipPacketSize)
+                if (_sendData.size() <= cDoipPacketSize)
                 {
                     std::array<uint8_t, cDoipPacketSize> _sendBuffer;
                     std::copy_n(
@@ -117,8 +116,6 @@ namespace application
 
                     mListener.Send(_sendBuffer);
                 }
-
-                std::this_thread::yield();
             }
         }
 
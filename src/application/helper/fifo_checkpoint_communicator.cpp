@@ -3,7 +3,6 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include <algorithm>
-#include <thread>
 #include "../../ara/com/helper/payload_helper.h"
 #include "./fifo_checkpoint_communicator.h"
 
@@ -53,12 +52,11 @@ namespace application
 
         void FifoCheckpointCommunicator::onCheckpointSend()
         {
-            while (!mSendQueue.Empty())
+            // Drain everything that is queued so far.
+            std::vector<uint8_t> _payload;
+            while (mSendQueue.TryDequeue(_payload))
             {
-                std::vector<uint8_t> _payload;
-                const bool cDequeued{mSendQueue.TryDequeue(_payload)};
-
-                if (cDequeued && _payload.size() <= cBufferSize)
+                if (_payload.size() <= cBufferSize)
                 {
                     auto _moveItr{
                         std::make_move_iterator(_payload.begin())};
@@ -71,8 +69,6 @@ namespace application
 
                     mClient.Send(_buffer);
                 }
-
-                std::this_thread::yield();
             }
         }
 
@@ -0,0 +1,189 @@
+/// @file src/ara/com/e2e/crc.cpp
+/// @brief Implementation for the hardware kernels of the E2E CRC engine.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include "./crc.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ARA_E2E_CRC_CLMUL 1
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__linux__) && (defined(__GNUC__) || defined(__clang__))
+#define ARA_E2E_CRC_ARMV8 1
+#include <arm_acle.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+
+namespace ara
+{
+    namespace com
+    {
+        namespace e2e
+        {
+            namespace detail
+            {
+#if defined(ARA_E2E_CRC_CLMUL)
+                namespace
+                {
+                    /// @brief Fold a block over the distance its constants encode
+                    __attribute__((target("pclmul,sse2"))) inline __m128i fold(
+                        __m128i block, __m128i constants) noexcept
+                    {
+                        return _mm_xor_si128(
+                            _mm_clmulepi64_si128(block, constants, 0x00),
+                            _mm_clmulepi64_si128(block, constants, 0x11));
+                    }
+
+                    __attribute__((target("pclmul,sse2"))) inline __m128i load(
+                        const std::uint8_t *data) noexcept
+                    {
+                        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+                    }
+
+                    __attribute__((target("pclmul,sse2"))) inline __m128i constantsFor(
+                        const CrcFoldConstants &constants, std::size_t blocks) noexcept
+                    {
+                        // Low lane multiplies the block's first 8 bytes.
+                        const std::size_t cIndex{2U * (blocks - 1U)};
+                        return _mm_set_epi64x(
+                            static_cast<long long>(constants.Data[cIndex + 1U]),
+                            static_cast<long long>(constants.Data[cIndex]));
+                    }
+                }
+
+                bool ClmulAvailable() noexcept
+                {
+                    static const bool cAvailable{
+                        __builtin_cpu_supports("pclmul") != 0 &&
+                        __builtin_cpu_supports("sse2") != 0};
+                    return cAvailable;
+                }
+
+                __attribute__((target("pclmul,sse2"))) std::size_t ClmulFold(
+                    const std::uint8_t *data,
+                    std::size_t length,
+                    std::uint64_t seed,
+                    const CrcFoldConstants &constants,
+                    std::uint8_t *folded) noexcept
+                {
+                    const std::size_t cBlockSize{16U};
+                    const std::size_t cLanes{4U};
+
+                    __m128i _accumulator{_mm_xor_si128(
+                        load(data),
+                        _mm_cvtsi64_si128(static_cast<long long>(seed)))};
+                    std::size_t _offset{cBlockSize};
+
+                    if (length >= cLanes * cBlockSize * 2U)
+                    {
+                        // Four independent lanes hide the multiply latency.
+                        const __m128i cFold4{constantsFor(constants, 4U)};
+                        __m128i _lane1{load(data + cBlockSize)};
+                        __m128i _lane2{load(data + 2U * cBlockSize)};
+                        __m128i _lane3{load(data + 3U * cBlockSize)};
+                        _offset = cLanes * cBlockSize;
+
+                        while (length - _offset >= cLanes * cBlockSize)
+                        {
+                            _accumulator = _mm_xor_si128(
+                                fold(_accumulator, cFold4), load(data + _offset));
+                            _lane1 = _mm_xor_si128(
+                                fold(_lane1, cFold4), load(data + _offset + cBlockSize));
+                            _lane2 = _mm_xor_si128(
+                                fold(_lane2, cFold4), load(data + _offset + 2U * cBlockSize));
+                            _lane3 = _mm_xor_si128(
+                                fold(_lane3, cFold4), load(data + _offset + 3U * cBlockSize));
+                            _offset += cLanes * cBlockSize;
+                        }
+
+                        _accumulator = _mm_xor_si128(
+                            _mm_xor_si128(
+                                fold(_accumulator, constantsFor(constants, 3U)),
+                                fold(_lane1, constantsFor(constants, 2U))),
+                            _mm_xor_si128(
+                                fold(_lane2, constantsFor(constants, 1U)),
+                                _lane3));
+                    }
+
+                    const __m128i cFold1{constantsFor(constants, 1U)};
+                    while (length - _offset >= cBlockSize)
+                    {
+                        _accumulator = _mm_xor_si128(
+                            fold(_accumulator, cFold1), load(data + _offset));
+                        _offset += cBlockSize;
+                    }
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(folded), _accumulator);
+                    return _offset;
+                }
+#else
+                bool ClmulAvailable() noexcept
+                {
+                    return false;
+                }
+
+                std::size_t ClmulFold(
+                    const std::uint8_t *data,
+                    std::size_t length,
+                    std::uint64_t seed,
+                    const CrcFoldConstants &constants,
+                    std::uint8_t *folded) noexcept
+                {
+                    (void)data;
+                    (void)length;
+                    (void)seed;
+                    (void)constants;
+                    (void)folded;
+                    return 0U;
+                }
+#endif
+
+#if defined(ARA_E2E_CRC_ARMV8)
+                bool ArmCrc32Available() noexcept
+                {
+                    static const bool cAvailable{
+                        (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0U};
+                    return cAvailable;
+                }
+
+                __attribute__((target("arch=armv8-a+crc"))) std::uint32_t ArmCrc32Update(
+                    std::uint32_t crc,
+                    const std::uint8_t *data,
+                    std::size_t length) noexcept
+                {
+                    while (length >= 8U)
+                    {
+                        crc = __crc32d(crc, LoadLittleEndian64(data));
+                        data += 8U;
+                        length -= 8U;
+                    }
+                    while (length > 0U)
+                    {
+                        crc = __crc32b(crc, *data);
+                        ++data;
+                        --length;
+                    }
+                    return crc;
+                }
+#else
+                bool ArmCrc32Available() noexcept
+                {
+                    return false;
+                }
+
+                std::uint32_t ArmCrc32Update(
+                    std::uint32_t crc,
+                    const std::uint8_t *data,
+                    std::size_t length) noexcept
+                {
+                    (void)data;
+                    (void)length;
+                    return crc;
+                }
+#endif
+            }
+        }
+    }
+}
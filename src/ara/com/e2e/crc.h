@@ -0,0 +1,358 @@
+/// @file src/ara/com/e2e/crc.h
+/// @brief Declarations for the CRC engine shared by the E2E profiles.
+/// @details Every E2E profile CRC is an instance of CrcAlgorithm, a
+///          table-driven engine parameterized by register width, polynomial
+///          and bit order:
+///          - the 8 x 256 lookup tables are generated at compile time;
+///          - the software kernel consumes 8 bytes per step (slicing-by-8);
+///          - reflected CRCs fold 16-byte blocks with carry-less multiply
+///            (PCLMULQDQ) on x86-64, and CRC-32 uses the ARMv8 CRC32
+///            instructions on AArch64, when the CPU supports them at runtime.
+///
+///          All kernels return bit-identical results. Update() is a raw
+///          register update: initial values and final XORs stay with the
+///          profile, as they differ between profiles that share a polynomial.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_E2E_CRC_H
+#define ARA_COM_E2E_CRC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace e2e
+        {
+            namespace detail
+            {
+                /// @brief Slicing-by-8 tables; Data[k][n] is the CRC register
+                ///        after byte n followed by k zero bytes.
+                template <typename T>
+                struct CrcTables
+                {
+                    T Data[8][256];
+                };
+
+                /// @brief Carry-less multiply fold constants (see MakeFoldConstants)
+                struct CrcFoldConstants
+                {
+                    std::uint64_t Data[8];
+                };
+
+                template <typename T>
+                constexpr T CrcStep(T crc, T poly, bool reflected) noexcept
+                {
+                    constexpr unsigned cWidth{std::numeric_limits<T>::digits};
+                    for (unsigned bit = 0U; bit < 8U; ++bit)
+                    {
+                        if (reflected)
+                        {
+                            crc = (crc & 1U)
+                                      ? static_cast<T>((crc >> 1) ^ poly)
+                                      : static_cast<T>(crc >> 1);
+                        }
+                        else
+                        {
+                            crc = ((crc >> (cWidth - 1U)) & 1U)
+                                      ? static_cast<T>(static_cast<T>(crc << 1) ^ poly)
+                                      : static_cast<T>(crc << 1);
+                        }
+                    }
+                    return crc;
+                }
+
+                template <typename T>
+                constexpr CrcTables<T> MakeCrcTables(T poly, bool reflected) noexcept
+                {
+                    constexpr unsigned cWidth{std::numeric_limits<T>::digits};
+                    CrcTables<T> _tables{};
+                    for (unsigned n = 0U; n < 256U; ++n)
+                    {
+                        const T cIndex{
+                            reflected ? static_cast<T>(n)
+                                      : static_cast<T>(static_cast<T>(n) << (cWidth - 8U))};
+                        _tables.Data[0][n] = CrcStep<T>(cIndex, poly, reflected);
+                    }
+                    for (unsigned k = 1U; k < 8U; ++k)
+                    {
+                        for (unsigned n = 0U; n < 256U; ++n)
+                        {
+                            // One more zero byte: a plain bytewise step.
+                            const T cPrevious{_tables.Data[k - 1U][n]};
+                            _tables.Data[k][n] =
+                                reflected
+                                    ? static_cast<T>(
+                                          (cPrevious >> 8) ^
+                                          _tables.Data[0][cPrevious & 0xFFU])
+                                    : static_cast<T>(
+                                          static_cast<T>(cPrevious << 8) ^
+                                          _tables.Data[0][(cPrevious >> (cWidth - 8U)) & 0xFFU]);
+                        }
+                    }
+                    return _tables;
+                }
+
+                constexpr std::uint64_t Reflect(std::uint64_t value, unsigned width) noexcept
+                {
+                    std::uint64_t _result{0U};
+                    for (unsigned bit = 0U; bit < width; ++bit)
+                    {
+                        _result |= ((value >> bit) & 1U) << (width - 1U - bit);
+                    }
+                    return _result;
+                }
+
+                /// @brief x^n mod P(x), bit-reversed into 64 bits (bit i <-> x^(63-i))
+                constexpr std::uint64_t XPowModP(
+                    unsigned n, std::uint64_t reflectedPoly, unsigned width) noexcept
+                {
+                    const std::uint64_t cPoly{Reflect(reflectedPoly, width)};
+                    const std::uint64_t cMask{
+                        width == 64U ? ~std::uint64_t{0U}
+                                     : (std::uint64_t{1U} << width) - 1U};
+                    std::uint64_t _remainder{1U};
+                    for (unsigned i = 0U; i < n; ++i)
+                    {
+                        const bool cCarry{((_remainder >> (width - 1U)) & 1U) != 0U};
+                        _remainder = (_remainder << 1) & cMask;
+                        if (cCarry)
+                        {
+                            _remainder ^= cPoly;
+                        }
+                    }
+                    return Reflect(_remainder, 64U);
+                }
+
+                /// @brief Constants to fold a 128-bit block over D bits: pairs
+                ///        (x^(D+63) mod P, x^(D-1) mod P) for D = 128 ... 512.
+                /// @note The exponents are one less than the fold distance
+                ///       because a reflected carry-less product comes out
+                ///       shifted by one bit.
+                constexpr CrcFoldConstants MakeFoldConstants(
+                    std::uint64_t reflectedPoly, unsigned width) noexcept
+                {
+                    CrcFoldConstants _constants{};
+                    for (unsigned i = 0U; i < 4U; ++i)
+                    {
+                        const unsigned cDistance{128U * (i + 1U)};
+                        _constants.Data[2U * i] =
+                            XPowModP(cDistance + 63U, reflectedPoly, width);
+                        _constants.Data[2U * i + 1U] =
+                            XPowModP(cDistance - 1U, reflectedPoly, width);
+                    }
+                    return _constants;
+                }
+
+                inline std::uint64_t LoadLittleEndian64(const std::uint8_t *data) noexcept
+                {
+                    std::uint64_t _value;
+                    std::memcpy(&_value, data, sizeof(_value));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                    _value = __builtin_bswap64(_value);
+#endif
+                    return _value;
+                }
+
+                inline std::uint64_t LoadBigEndian64(const std::uint8_t *data) noexcept
+                {
+                    std::uint64_t _value;
+                    std::memcpy(&_value, data, sizeof(_value));
+#if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+                    _value = __builtin_bswap64(_value);
+#endif
+                    return _value;
+                }
+
+                /// @brief True if the carry-less multiply fold can run on this CPU
+                bool ClmulAvailable() noexcept;
+
+                /// @brief Fold all whole 16-byte blocks of a reflected CRC input
+                /// @param data Input, at least 16 bytes
+                /// @param length Input length
+                /// @param seed CRC register, XORed into the first bytes
+                /// @param constants Fold constants of the polynomial
+                /// @param[out] folded 16-byte block congruent to the consumed input
+                /// @returns Number of bytes consumed (a multiple of 16)
+                std::size_t ClmulFold(
+                    const std::uint8_t *data,
+                    std::size_t length,
+                    std::uint64_t seed,
+                    const CrcFoldConstants &constants,
+                    std::uint8_t *folded) noexcept;
+
+                /// @brief True if the ARMv8 CRC32 instructions are available
+                bool ArmCrc32Available() noexcept;
+
+                /// @brief Reflected CRC-32 (0x04C11DB7) register update in hardware
+                std::uint32_t ArmCrc32Update(
+                    std::uint32_t crc,
+                    const std::uint8_t *data,
+                    std::size_t length) noexcept;
+            }
+
+            /// @brief Table-driven CRC with optional hardware acceleration
+            /// @tparam T CRC register type; its width is the CRC width
+            /// @tparam cPoly Generator polynomial without the x^width term,
+            ///         bit-reversed for reflected CRCs
+            /// @tparam cReflected True for LSB-first (reflected) CRCs
+            template <typename T, T cPoly, bool cReflected>
+            class CrcAlgorithm
+            {
+            private:
+                static constexpr unsigned cWidth{std::numeric_limits<T>::digits};
+                /// @brief Shortest input worth the hardware setup cost
+                static constexpr std::size_t cAcceleratedMinLength{64U};
+                static constexpr bool cIsCrc32{
+                    cReflected && cWidth == 32U &&
+                    static_cast<std::uint64_t>(cPoly) == 0xEDB88320U};
+
+                static constexpr detail::CrcTables<T> cTables{
+                    detail::MakeCrcTables<T>(cPoly, cReflected)};
+                static constexpr detail::CrcFoldConstants cFoldConstants{
+                    detail::MakeFoldConstants(cPoly, cWidth)};
+
+            public:
+                /// @brief CRC register type
+                using ValueType = T;
+
+                /// @brief Feed bytes into a CRC register using the fastest kernel
+                /// @param crc Current register value (the start value on first call)
+                /// @param data Input bytes
+                /// @param length Number of input bytes
+                /// @returns Updated register value, without final XOR
+                static T Update(T crc, const std::uint8_t *data, std::size_t length) noexcept
+                {
+                    if (cReflected && length >= cAcceleratedMinLength)
+                    {
+                        if (cIsCrc32 && detail::ArmCrc32Available())
+                        {
+                            return static_cast<T>(detail::ArmCrc32Update(
+                                static_cast<std::uint32_t>(crc), data, length));
+                        }
+
+                        if (detail::ClmulAvailable())
+                        {
+                            std::uint8_t _folded[16];
+                            const std::size_t cConsumed{detail::ClmulFold(
+                                data, length, static_cast<std::uint64_t>(crc),
+                                cFoldConstants, _folded)};
+                            crc = UpdateSlicingBy8(0U, _folded, sizeof(_folded));
+                            data += cConsumed;
+                            length -= cConsumed;
+                        }
+                    }
+
+                    return UpdateSlicingBy8(crc, data, length);
+                }
+
+                /// @brief Software kernel consuming 8 bytes per table step
+                static T UpdateSlicingBy8(
+                    T crc, const std::uint8_t *data, std::size_t length) noexcept
+                {
+                    const auto &cTable{cTables.Data};
+                    while (length >= 8U)
+                    {
+                        std::uint64_t _block;
+                        if (cReflected)
+                        {
+                            _block = detail::LoadLittleEndian64(data) ^
+                                     static_cast<std::uint64_t>(crc);
+                            crc = static_cast<T>(
+                                cTable[7][_block & 0xFFU] ^
+                                cTable[6][(_block >> 8) & 0xFFU] ^
+                                cTable[5][(_block >> 16) & 0xFFU] ^
+                                cTable[4][(_block >> 24) & 0xFFU] ^
+                                cTable[3][(_block >> 32) & 0xFFU] ^
+                                cTable[2][(_block >> 40) & 0xFFU] ^
+                                cTable[1][(_block >> 48) & 0xFFU] ^
+                                cTable[0][_block >> 56]);
+                        }
+                        else
+                        {
+                            _block = detail::LoadBigEndian64(data) ^
+                                     (static_cast<std::uint64_t>(crc) << (64U - cWidth));
+                            crc = static_cast<T>(
+                                cTable[7][_block >> 56] ^
+                                cTable[6][(_block >> 48) & 0xFFU] ^
+                                cTable[5][(_block >> 40) & 0xFFU] ^
+                                cTable[4][(_block >> 32) & 0xFFU] ^
+                                cTable[3][(_block >> 24) & 0xFFU] ^
+                                cTable[2][(_block >> 16) & 0xFFU] ^
+                                cTable[1][(_block >> 8) & 0xFFU] ^
+                                cTable[0][_block & 0xFFU]);
+                        }
+                        data += 8U;
+                        length -= 8U;
+                    }
+
+                    return UpdateBytewise(crc, data, length);
+                }
+
+                /// @brief Reference kernel consuming one byte per table step
+                static T UpdateBytewise(
+                    T crc, const std::uint8_t *data, std::size_t length) noexcept
+                {
+                    const auto &cTable{cTables.Data[0]};
+                    for (std::size_t i = 0U; i < length; ++i)
+                    {
+                        if (cReflected)
+                        {
+                            crc = static_cast<T>(
+                                (crc >> 8) ^ cTable[(crc ^ data[i]) & 0xFFU]);
+                        }
+                        else
+                        {
+                            crc = static_cast<T>(
+                                static_cast<T>(crc << 8) ^
+                                cTable[((crc >> (cWidth - 8U)) ^ data[i]) & 0xFFU]);
+                        }
+                    }
+                    return crc;
+                }
+
+                /// @brief Whether Update() uses a hardware kernel on this CPU
+                static bool IsAccelerated() noexcept
+                {
+                    return cReflected &&
+                           ((cIsCrc32 && detail::ArmCrc32Available()) ||
+                            detail::ClmulAvailable());
+                }
+            };
+
+            template <typename T, T cPoly, bool cReflected>
+            constexpr detail::CrcTables<T> CrcAlgorithm<T, cPoly, cReflected>::cTables;
+
+            template <typename T, T cPoly, bool cReflected>
+            constexpr detail::CrcFoldConstants CrcAlgorithm<T, cPoly, cReflected>::cFoldConstants;
+
+            /// @brief CRC-8 SAE-J1850 (polynomial 0x1D), Profiles 01 and 11
+            using Crc8 = CrcAlgorithm<std::uint8_t, 0x1DU, false>;
+
+            /// @brief CRC-8H2F (polynomial 0x2F), Profile 02
+            using Crc8H2F = CrcAlgorithm<std::uint8_t, 0x2FU, false>;
+
+            /// @brief CRC-16/CCITT (polynomial 0x1021), Profile 03
+            using Crc16 = CrcAlgorithm<std::uint16_t, 0x1021U, false>;
+
+            /// @brief CRC-16/ARC (polynomial 0x8005, reflected), Profile 05
+            using Crc16Arc = CrcAlgorithm<std::uint16_t, 0xA001U, true>;
+
+            /// @brief CRC-32 (polynomial 0x04C11DB7, reflected), Profile 06
+            using Crc32 = CrcAlgorithm<std::uint32_t, 0xEDB88320U, true>;
+
+            /// @brief CRC-32P4 (polynomial 0xF4ACFB13, reflected), Profile 04
+            using Crc32P4 = CrcAlgorithm<std::uint32_t, 0xC8DF352FU, true>;
+
+            /// @brief CRC-64/XZ (polynomial 0x42F0E1EBA9EA3693, reflected), Profile 07
+            using Crc64 = CrcAlgorithm<std::uint64_t, 0xC96C5795D7870F42ULL, true>;
+        }
+    }
+}
+
+#endif
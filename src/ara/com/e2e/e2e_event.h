@@ -5,8 +5,12 @@
 #ifndef ARA_COM_E2E_EVENT_H
 #define ARA_COM_E2E_EVENT_H
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include "./profile.h"
 #include "../internal/event_binding.h"
@@ -39,6 +43,33 @@ namespace ara
             private:
                 std::unique_ptr<internal::SkeletonEventBinding> mInner;
                 Profile *mProfile;
+                /// @brief Serializes protection and hand-off, so concurrent
+                ///        senders neither share mFrame nor reorder counters.
+                std::mutex mSendMutex;
+                /// @brief Reused frame buffer of the copying Send() path.
+                std::vector<std::uint8_t> mFrame;
+
+                /// @brief Bytes in front of the header that align a sample
+                /// @details Zero whenever the header length is a multiple of
+                ///          the alignment, so the frame starts at the inner
+                ///          buffer and is published without moving it.
+                std::size_t padding(std::size_t alignment) const noexcept
+                {
+                    const std::size_t cRemainder{mProfile->HeaderLength() % alignment};
+                    return cRemainder == 0U ? 0U : alignment - cRemainder;
+                }
+
+                /// @brief Inner buffer that an allocated sample lies in
+                /// @details Inner buffers are aligned for any fundamental
+                ///          type, so the padding in front of the header is
+                ///          the misalignment of the header itself.
+                std::uint8_t *buffer(void *data) const noexcept
+                {
+                    std::uint8_t *_header{
+                        static_cast<std::uint8_t *>(data) - mProfile->HeaderLength()};
+                    return _header - reinterpret_cast<std::uintptr_t>(_header) %
+                                         alignof(std::max_align_t);
+                }
 
             public:
                 /// @brief Construct the E2E decorator
@@ -65,10 +96,12 @@ namespace ara
                 core::Result<void> Send(
                     const std::vector<std::uint8_t> &payload) override
                 {
-                    std::vector<std::uint8_t> protectedPayload;
-                    if (mProfile->TryProtect(payload, protectedPayload))
+                    // The frame keeps its capacity, so steady-state sends do
+                    // not allocate before the inner binding copies it out.
+                    std::lock_guard<std::mutex> lock(mSendMutex);
+                    if (mProfile->TryProtect(payload, mFrame))
                     {
-                        return mInner->Send(protectedPayload);
+                        return mInner->Send(mFrame);
                     }
                     return core::Result<void>::FromError(
                         MakeErrorCode(ComErrc::kCommunicationStackError));
@@ -76,20 +109,63 @@ namespace ara
 
                 core::Result<void *> Allocate(std::size_t size) override
                 {
-                    return mInner->Allocate(size);
+                    return AllocateAligned(size, alignof(std::max_align_t));
+                }
+
+                /// @brief Allocate a sample behind room for the E2E header
+                /// @param size Sample size in bytes
+                /// @param alignment Alignment of the sample type
+                /// @returns Pointer to the sample, padding(alignment) plus the
+                ///          header length into the inner buffer
+                core::Result<void *> AllocateAligned(
+                    std::size_t size, std::size_t alignment) override
+                {
+                    const std::size_t cMaxAlignment{alignof(std::max_align_t)};
+                    const std::size_t cOffset{
+                        padding(std::min(std::max<std::size_t>(1U, alignment), cMaxAlignment)) +
+                        mProfile->HeaderLength()};
+                    auto _buffer = mInner->Allocate(cOffset + size);
+                    if (!_buffer.HasValue())
+                    {
+                        return _buffer;
+                    }
+                    return core::Result<void *>::FromValue(
+                        static_cast<std::uint8_t *>(_buffer.Value()) + cOffset);
                 }
 
                 core::Result<void> SendAllocated(
                     void *data, std::size_t size) override
                 {
-                    // For allocated (zero-copy) sends, we need to copy out,
-                    // protect, and send via the normal path
-                    std::vector<std::uint8_t> payload(
-                        static_cast<std::uint8_t *>(data),
-                        static_cast<std::uint8_t *>(data) + size);
-                    std::free(data);
+                    if (data == nullptr)
+                    {
+                        return core::Result<void>::FromError(
+                            MakeErrorCode(ComErrc::kFieldValueIsNotValid));
+                    }
 
-                    return Send(payload);
+                    // Write the header right before the sample and hand the
+                    // frame to the inner binding at its offset in the buffer.
+                    const std::size_t cHeaderLength{mProfile->HeaderLength()};
+                    std::uint8_t *_buffer{buffer(data)};
+                    std::uint8_t *_frame{static_cast<std::uint8_t *>(data) - cHeaderLength};
+                    std::lock_guard<std::mutex> lock(mSendMutex);
+                    if (!mProfile->TryProtectInPlace(_frame, cHeaderLength + size))
+                    {
+                        mInner->Deallocate(_buffer);
+                        return core::Result<void>::FromError(
+                            MakeErrorCode(ComErrc::kCommunicationStackError));
+                    }
+                    return mInner->SendAllocatedFrame(
+                        _buffer,
+                        static_cast<std::size_t>(_frame - _buffer),
+                        cHeaderLength + size);
+                }
+
+                void Deallocate(void *data) override
+                {
+                    if (data != nullptr)
+                    {
+                        mInner->Deallocate(buffer(data));
+                    }
                 }
             };
 
@@ -134,6 +210,17 @@ namespace ara
                 }
 
             public:
+                /// @brief Construct the E2E decorator with the profile's own header length
+                /// @param inner The underlying proxy event binding
+                /// @param profile E2E profile instance (must outlive this object)
+                E2EProxyEventBindingDecorator(
+                    std::unique_ptr<internal::ProxyEventBinding> inner,
+                    Profile &profile) noexcept
+                    : E2EProxyEventBindingDecorator(
+                          std::move(inner), profile, profile.HeaderLength())
+                {
+                }
+
                 /// @brief Construct the E2E decorator
                 /// @param inner The underlying proxy event binding
                 /// @param profile E2E profile instance (must outlive this object)
@@ -178,10 +265,10 @@ namespace ara
                         [profile, headerSize, &handler, &statuses](
                             const std::uint8_t *data, std::size_t size)
                         {
-                            std::vector<std::uint8_t> protectedData(
-                                data, data + size);
+                            // Checked where the inner binding delivered it
+                            // (e.g. the iceoryx chunk): no per-sample copy.
                             CheckStatusType status =
-                                profile->Check(protectedData);
+                                profile->Check(data, size);
                             statuses.push_back(MapStatus(status));
 
                             if (size > headerSize)
@@ -202,6 +289,22 @@ namespace ara
                     return mLastSampleStatuses;
                 }
 
+                bool SetQosProfile(const EventQosProfile &qos) override
+                {
+                    return mInner->SetQosProfile(qos);
+                }
+
+                void SetDeadlineMissedHandler(
+                    DeadlineMissedHandler handler) override
+                {
+                    mInner->SetDeadlineMissedHandler(std::move(handler));
+                }
+
+                void UnsetDeadlineMissedHandler() override
+                {
+                    mInner->UnsetDeadlineMissedHandler();
+                }
+
                 void SetReceiveHandler(
                     std::function<void()> handler) override
                 {
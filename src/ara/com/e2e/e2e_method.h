@@ -52,11 +52,12 @@ namespace ara
 
                     return mInner->Register(
                         [profile, hdrSize, h = std::move(handler)](
-                            const std::vector<std::uint8_t> &request)
+                            core::Span<const std::uint8_t> request)
                             -> core::Result<std::vector<std::uint8_t>>
                         {
                             // -- check incoming request --
-                            std::vector<std::uint8_t> protReq(request);
+                            std::vector<std::uint8_t> protReq(
+                                request.begin(), request.end());
                             CheckStatusType reqStatus =
                                 profile->Check(protReq);
 
@@ -70,12 +71,7 @@ namespace ara
                             }
 
                             // Strip E2E header before passing to handler
-                            std::vector<std::uint8_t> stripped(
-                                request.begin() +
-                                    static_cast<std::ptrdiff_t>(hdrSize),
-                                request.end());
-
-                            auto result = h(stripped);
+                            auto result = h(request.subspan(hdrSize));
                             if (!result.HasValue())
                             {
                                 return result;
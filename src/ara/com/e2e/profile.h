@@ -5,7 +5,9 @@
 #ifndef PROFILE_H
 #define PROFILE_H
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <vector>
 
 namespace ara
@@ -27,6 +29,11 @@ namespace ara
             };
 
             /// @brief E2E protection profile abstract class
+            /// @details Profiles place their header in front of the payload. The
+            ///          buffer-based primitives work on that layout in place, so a
+            ///          caller can reserve HeaderLength() bytes of headroom in a
+            ///          loaned or reused buffer and protect/check it without copying.
+            ///          The vector overloads are thin wrappers around them.
             class Profile
             {
             protected:
@@ -35,15 +42,48 @@ namespace ara
             public:
                 virtual ~Profile() noexcept = default;
 
+                /// @brief Get the number of header bytes preceding the payload
+                /// @returns Size of the E2E header in bytes
+                virtual std::size_t HeaderLength() const noexcept = 0;
+
+                /// @brief Try to protect a message payload in place
+                /// @param[in,out] buffer Buffer holding HeaderLength() bytes of headroom followed by the payload
+                /// @param size Total buffer size including the headroom
+                /// @returns True if the header is written successfully; otherwise false
+                /// @remarks Only the headroom is written, the payload bytes are left untouched.
+                /// @remarks The profile internal state (e.g., counter) can be changed in case of getting 'true' as the return value.
+                virtual bool TryProtectInPlace(
+                    std::uint8_t *buffer, std::size_t size) = 0;
+
+                /// @brief Try to protect a message payload in place while replicating the E2E status
+                /// @param[in,out] buffer Buffer holding HeaderLength() bytes of headroom followed by the payload
+                /// @param size Total buffer size including the headroom
+                /// @returns True if the header is written successfully; otherwise false
+                /// @see TryProtectInPlace
+                virtual bool TryForwardInPlace(
+                    std::uint8_t *buffer, std::size_t size) = 0;
+
+                /// @brief Check whether a message is received correctly or not
+                /// @param protectedData Pointer to the header followed by the payload
+                /// @param size Total message size in bytes
+                /// @returns The result of checking the message protection
+                /// @remarks The profile internal state (e.g., counter delta) can be changed after calling the function.
+                virtual CheckStatusType Check(
+                    const std::uint8_t *protectedData, std::size_t size) = 0;
+
                 /// @brief Try to protect a message payload by inserting a CRC header
                 /// @param[in] unprotectedData Message payload without any protection
                 /// @param[out] protectedData Message payload containing the CRC protection
                 /// @returns True if the protected data is generated successfully; otherwise false
                 /// @remarks The 'protectedData' should be ignored in case of getting 'false' as the return value.
                 /// @remarks The profile internal state (e.g., counter) can be changed in case of getting 'true' as the return value.
-                virtual bool TryProtect(
+                bool TryProtect(
                     const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) = 0;
+                    std::vector<uint8_t> &protectedData)
+                {
+                    return copyBehindHeader(unprotectedData, protectedData) &&
+                           TryProtectInPlace(protectedData.data(), protectedData.size());
+                }
 
                 /// @brief Try to protect a message payload by inserting a CRC header while replicating the E2E status
                 /// @param[in] unprotectedData Message payload without any protection
@@ -52,16 +92,40 @@ namespace ara
                 /// @remarks The 'protectedData' should be ignored in case of getting 'false' as the return value.
                 /// @remarks The profile internal state (e.g., counter) can be changed in case of getting 'true' as the return value.
                 /// @see TryProtect
-                virtual bool TryForward(
+                bool TryForward(
                     const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) = 0;
+                    std::vector<uint8_t> &protectedData)
+                {
+                    return copyBehindHeader(unprotectedData, protectedData) &&
+                           TryForwardInPlace(protectedData.data(), protectedData.size());
+                }
 
                 /// @brief Check whether a message is received correctly or not
                 /// @param protectedData Message payload containing the CRC protection to be checked
                 /// @returns The result of checking the message protection
                 /// @remarks The profile internal state (e.g., counter delta) can be changed after calling the function.
-                virtual CheckStatusType Check(
-                    const std::vector<uint8_t> &protectedData) = 0;
+                CheckStatusType Check(const std::vector<uint8_t> &protectedData)
+                {
+                    return Check(protectedData.data(), protectedData.size());
+                }
+
+            private:
+                bool copyBehindHeader(
+                    const std::vector<uint8_t> &unprotectedData,
+                    std::vector<uint8_t> &protectedData) const
+                {
+                    if (unprotectedData.empty())
+                    {
+                        return false;
+                    }
+
+                    const std::size_t cHeaderLength{HeaderLength()};
+                    protectedData.resize(cHeaderLength + unprotectedData.size());
+                    std::memcpy(protectedData.data() + cHeaderLength,
+                                unprotectedData.data(),
+                                unprotectedData.size());
+                    return true;
+                }
             };
         }
     }
@@ -3,6 +3,7 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include "./profile01.h"
+#include "./crc.h"
 #include <cstddef>
 
 namespace ara
@@ -12,38 +13,10 @@ namespace ara
         namespace e2e
         {
             // Static member definitions
-            constexpr std::size_t Profile01::cTableSize;
-            constexpr uint8_t Profile01::cCrcPoly;
             constexpr uint8_t Profile01::cCrcInitial;
             constexpr uint8_t Profile01::cCounterMax;
             constexpr std::size_t Profile01::cHeaderLength;
 
-            volatile std::atomic_bool Profile01::mCrcTableInitialized{false};
-            std::array<uint8_t, Profile01::cTableSize> Profile01::mCrcTable{};
-
-            // -----------------------------------------------------------------------
-            // CRC table initialization (SAE-J1850, polynomial 0x1D, MSB-first)
-            // -----------------------------------------------------------------------
-            void Profile01::initializeCrcTable() noexcept
-            {
-                const uint8_t cMsb{0x80};
-                for (uint16_t i = 0; i < cTableSize; ++i)
-                {
-                    auto crc = static_cast<uint8_t>(i);
-                    for (uint8_t bit = 0; bit < 8; ++bit)
-                    {
-                        crc = (crc & cMsb) ? static_cast<uint8_t>((crc << 1) ^ cCrcPoly)
-                                           : static_cast<uint8_t>(crc << 1);
-                    }
-                    mCrcTable[i] = crc;
-                }
-            }
-
-            uint8_t Profile01::crcStep(uint8_t crc, uint8_t byte) noexcept
-            {
-                return mCrcTable[static_cast<std::size_t>(crc ^ byte)];
-            }
-
             // -----------------------------------------------------------------------
             // CRC computation
             // Header layout per AUTOSAR E2E Profile 01:
@@ -54,20 +27,17 @@ namespace ara
             //   DataID high byte, DataID low byte, controlByte, payload bytes...
             // -----------------------------------------------------------------------
             uint8_t Profile01::computeCrc(
-                const std::vector<uint8_t> &data,
+                const uint8_t *data,
+                std::size_t length,
                 uint8_t controlByte) const noexcept
             {
-                uint8_t crc = cCrcInitial;
-                // Include DataID in CRC
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId >> 8));
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId & 0xFF));
-                // Include control byte (header byte[1])
-                crc = crcStep(crc, controlByte);
-                // Include payload
-                for (uint8_t byte : data)
-                {
-                    crc = crcStep(crc, byte);
-                }
+                const uint8_t cHeader[]{
+                    static_cast<uint8_t>(mConfig.dataId >> 8),
+                    static_cast<uint8_t>(mConfig.dataId & 0xFF),
+                    controlByte};
+                // DataID, control byte (header byte[1]), then the payload
+                uint8_t crc = Crc8::Update(cCrcInitial, cHeader, sizeof(cHeader));
+                crc = Crc8::Update(crc, data, length);
                 return static_cast<uint8_t>(~crc);
             }
 
@@ -76,31 +46,25 @@ namespace ara
             // -----------------------------------------------------------------------
             Profile01::Profile01() noexcept : mConfig{}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
             }
 
             Profile01::Profile01(const Profile01Config &config) noexcept
                 : mConfig{config}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
+            }
+
+            std::size_t Profile01::HeaderLength() const noexcept
+            {
+                return cHeaderLength;
             }
 
             // -----------------------------------------------------------------------
-            // TryProtect — increment counter, build 2-byte header, prepend to data
+            // TryProtectInPlace — increment counter, build 2-byte header, prepend to data
             // -----------------------------------------------------------------------
-            bool Profile01::TryProtect(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile01::TryProtectInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
-                if (unprotectedData.empty())
+                if (buffer == nullptr || size <= cHeaderLength)
                 {
                     return false;
                 }
@@ -116,25 +80,21 @@ namespace ara
                 const uint8_t controlByte =
                     static_cast<uint8_t>(dataIdNibble | (mProtectingCounter & 0x0F));
 
-                const uint8_t crc = computeCrc(unprotectedData, controlByte);
+                const uint8_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, controlByte);
 
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
-                protectedData.push_back(crc);
-                protectedData.push_back(controlByte);
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                buffer[0] = crc;
+                buffer[1] = controlByte;
                 return true;
             }
 
             // -----------------------------------------------------------------------
-            // TryForward — use last checked counter (gateway / bridge use case)
+            // TryForwardInPlace — use last checked counter (gateway / bridge use case)
             // -----------------------------------------------------------------------
-            bool Profile01::TryForward(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile01::TryForwardInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
-                if (unprotectedData.empty())
+                if (buffer == nullptr || size <= cHeaderLength)
                 {
                     return false;
                 }
@@ -144,14 +104,11 @@ namespace ara
                 const uint8_t controlByte =
                     static_cast<uint8_t>(dataIdNibble | (mCheckingCounter & 0x0F));
 
-                const uint8_t crc = computeCrc(unprotectedData, controlByte);
+                const uint8_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, controlByte);
 
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
-                protectedData.push_back(crc);
-                protectedData.push_back(controlByte);
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                buffer[0] = crc;
+                buffer[1] = controlByte;
 
                 // Keep protect counter aligned with check counter for forwarding nodes.
                 mProtectingCounter = mCheckingCounter;
@@ -162,10 +119,10 @@ namespace ara
             // Check — verify CRC and counter sequence
             // -----------------------------------------------------------------------
             CheckStatusType Profile01::Check(
-                const std::vector<uint8_t> &protectedData)
+                const std::uint8_t *protectedData, std::size_t size)
             {
                 // Minimum: CRC byte + control byte + at least 1 payload byte
-                if (protectedData.size() < cHeaderLength + 1)
+                if (protectedData == nullptr || size < cHeaderLength + 1)
                 {
                     return CheckStatusType::kNoNewData;
                 }
@@ -173,11 +130,8 @@ namespace ara
                 const uint8_t receivedCrc = protectedData[0];
                 const uint8_t controlByte = protectedData[1];
 
-                // Reconstruct payload view
-                const std::vector<uint8_t> payload(protectedData.begin() + cHeaderLength,
-                                                   protectedData.end());
-
-                const uint8_t computedCrc = computeCrc(payload, controlByte);
+                const uint8_t computedCrc = computeCrc(
+                    protectedData + cHeaderLength, size - cHeaderLength, controlByte);
                 if (receivedCrc != computedCrc)
                 {
                     return CheckStatusType::kWrongCrc;
@@ -14,8 +14,6 @@
 #ifndef PROFILE01_H
 #define PROFILE01_H
 
-#include <array>
-#include <atomic>
 #include <cstdint>
 #include "./profile.h"
 
@@ -44,24 +42,16 @@ namespace ara
             class Profile01 : public Profile
             {
             private:
-                static constexpr std::size_t cTableSize{256};
-                static constexpr uint8_t cCrcPoly{0x1d};     ///< SAE-J1850 polynomial
                 static constexpr uint8_t cCrcInitial{0xff};
                 static constexpr uint8_t cCounterMax{0x0e};  ///< counter wraps 0..14
                 static constexpr std::size_t cHeaderLength{2};
 
-                static volatile std::atomic_bool mCrcTableInitialized;
-                static std::array<uint8_t, cTableSize> mCrcTable;
-
                 Profile01Config mConfig;
                 uint8_t mProtectingCounter{0};
                 uint8_t mCheckingCounter{0};
 
-                static void initializeCrcTable() noexcept;
-                static uint8_t crcStep(uint8_t crc, uint8_t byte) noexcept;
-
                 /// @brief Compute CRC-8 over DataID bytes + header control byte + payload
-                uint8_t computeCrc(const std::vector<uint8_t> &data,
+                uint8_t computeCrc(const uint8_t *data, std::size_t length,
                                    uint8_t controlByte) const noexcept;
 
             public:
@@ -72,16 +62,18 @@ namespace ara
                 /// @param config Profile 01 configuration (DataID, maxDeltaCounter)
                 explicit Profile01(const Profile01Config &config) noexcept;
 
-                bool TryProtect(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                std::size_t HeaderLength() const noexcept override;
+
+                bool TryProtectInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
+
+                bool TryForwardInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
 
-                bool TryForward(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                using Profile::Check;
 
                 CheckStatusType Check(
-                    const std::vector<uint8_t> &protectedData) override;
+                    const std::uint8_t *protectedData, std::size_t size) override;
             };
         }
     }
@@ -21,8 +21,6 @@
 #ifndef PROFILE02_H
 #define PROFILE02_H
 
-#include <array>
-#include <atomic>
 #include <cstdint>
 #include "./profile.h"
 
@@ -54,24 +52,16 @@ namespace ara
             class Profile02 : public Profile
             {
             private:
-                static constexpr std::size_t cTableSize{256};
-                static constexpr uint8_t cCrcPoly{0x2f};     ///< CRC-8H2F polynomial
                 static constexpr uint8_t cCrcInitial{0xff};
                 static constexpr uint8_t cCounterMax{0x0f};  ///< counter wraps 0..15
                 static constexpr std::size_t cHeaderLength{3};
 
-                static volatile std::atomic_bool mCrcTableInitialized;
-                static std::array<uint8_t, cTableSize> mCrcTable;
-
                 Profile02Config mConfig;
                 uint8_t mProtectingCounter{0};
                 uint8_t mCheckingCounter{0};
 
-                static void initializeCrcTable() noexcept;
-                static uint8_t crcStep(uint8_t crc, uint8_t byte) noexcept;
-
                 /// @brief Compute CRC-8H2F over DataID bytes + control bytes + payload
-                uint8_t computeCrc(const std::vector<uint8_t> &payload,
+                uint8_t computeCrc(const uint8_t *payload, std::size_t length,
                                    uint8_t controlByte1,
                                    uint8_t controlByte2) const noexcept;
 
@@ -83,16 +73,18 @@ namespace ara
                 /// @param config Profile 02 configuration (DataID, maxDeltaCounter)
                 explicit Profile02(const Profile02Config &config) noexcept;
 
-                bool TryProtect(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                std::size_t HeaderLength() const noexcept override;
+
+                bool TryProtectInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
+
+                bool TryForwardInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
 
-                bool TryForward(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                using Profile::Check;
 
                 CheckStatusType Check(
-                    const std::vector<uint8_t> &protectedData) override;
+                    const std::uint8_t *protectedData, std::size_t size) override;
             };
         }
     }
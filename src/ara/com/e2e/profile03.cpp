@@ -2,6 +2,7 @@
 /// @brief Implementation for E2E Profile 03 (CRC-16/CCITT, polynomial 0x1021).
 
 #include "./profile03.h"
+#include "./crc.h"
 #include <cstddef>
 
 namespace ara
@@ -10,76 +11,42 @@ namespace ara
     {
         namespace e2e
         {
-            constexpr std::size_t Profile03::cTableSize;
-            constexpr uint16_t Profile03::cCrcPoly;
             constexpr uint16_t Profile03::cCrcInitial;
             constexpr uint8_t Profile03::cCounterMax;
             constexpr std::size_t Profile03::cHeaderLength;
 
-            volatile std::atomic_bool Profile03::mCrcTableInitialized{false};
-            std::array<uint16_t, Profile03::cTableSize> Profile03::mCrcTable{};
-
-            void Profile03::initializeCrcTable() noexcept
-            {
-                for (uint16_t i = 0; i < cTableSize; ++i)
-                {
-                    uint16_t crc = static_cast<uint16_t>(i << 8);
-                    for (uint8_t bit = 0; bit < 8; ++bit)
-                    {
-                        crc = (crc & 0x8000U)
-                                  ? static_cast<uint16_t>((crc << 1) ^ cCrcPoly)
-                                  : static_cast<uint16_t>(crc << 1);
-                    }
-                    mCrcTable[i] = crc;
-                }
-            }
-
-            uint16_t Profile03::crcStep(uint16_t crc, uint8_t byte) noexcept
-            {
-                uint8_t idx = static_cast<uint8_t>((crc >> 8) ^ byte);
-                return static_cast<uint16_t>((crc << 8) ^ mCrcTable[idx]);
-            }
-
             uint16_t Profile03::computeCrc(
-                const std::vector<uint8_t> &payload,
+                const uint8_t *payload,
+                std::size_t length,
                 uint8_t counterByte) const noexcept
             {
-                uint16_t crc = cCrcInitial;
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId >> 8));
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId & 0xFF));
-                crc = crcStep(crc, counterByte);
-                for (uint8_t b : payload)
-                {
-                    crc = crcStep(crc, b);
-                }
-                return crc;
+                const uint8_t cHeader[]{
+                    static_cast<uint8_t>(mConfig.dataId >> 8),
+                    static_cast<uint8_t>(mConfig.dataId & 0xFF),
+                    counterByte};
+                uint16_t crc = Crc16::Update(cCrcInitial, cHeader, sizeof(cHeader));
+                return Crc16::Update(crc, payload, length);
             }
 
             Profile03::Profile03() noexcept
                 : mConfig{}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
             }
 
             Profile03::Profile03(const Profile03Config &config) noexcept
                 : mConfig{config}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
             }
 
-            bool Profile03::TryProtect(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            std::size_t Profile03::HeaderLength() const noexcept
             {
-                if (unprotectedData.empty())
+                return cHeaderLength;
+            }
+
+            bool Profile03::TryProtectInPlace(
+                std::uint8_t *buffer, std::size_t size)
+            {
+                if (buffer == nullptr || size <= cHeaderLength)
                 {
                     return false;
                 }
@@ -89,48 +56,41 @@ namespace ara
                                          : 0;
 
                 const uint8_t counterByte = mProtectingCounter;
-                const uint16_t crc = computeCrc(unprotectedData, counterByte);
-
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
-                protectedData.push_back(static_cast<uint8_t>(crc >> 8));
-                protectedData.push_back(static_cast<uint8_t>(crc & 0xFF));
-                protectedData.push_back(counterByte);
-                protectedData.push_back(static_cast<uint8_t>(mConfig.dataId & 0xFF));
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                const uint16_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, counterByte);
+
+                buffer[0] = static_cast<uint8_t>(crc >> 8);
+                buffer[1] = static_cast<uint8_t>(crc & 0xFF);
+                buffer[2] = counterByte;
+                buffer[3] = static_cast<uint8_t>(mConfig.dataId & 0xFF);
                 return true;
             }
 
-            bool Profile03::TryForward(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile03::TryForwardInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
-                if (unprotectedData.empty())
+                if (buffer == nullptr || size <= cHeaderLength)
                 {
                     return false;
                 }
 
                 const uint8_t counterByte = mCheckingCounter;
-                const uint16_t crc = computeCrc(unprotectedData, counterByte);
+                const uint16_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, counterByte);
 
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
-                protectedData.push_back(static_cast<uint8_t>(crc >> 8));
-                protectedData.push_back(static_cast<uint8_t>(crc & 0xFF));
-                protectedData.push_back(counterByte);
-                protectedData.push_back(static_cast<uint8_t>(mConfig.dataId & 0xFF));
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                buffer[0] = static_cast<uint8_t>(crc >> 8);
+                buffer[1] = static_cast<uint8_t>(crc & 0xFF);
+                buffer[2] = counterByte;
+                buffer[3] = static_cast<uint8_t>(mConfig.dataId & 0xFF);
 
                 mProtectingCounter = mCheckingCounter;
                 return true;
             }
 
             CheckStatusType Profile03::Check(
-                const std::vector<uint8_t> &protectedData)
+                const std::uint8_t *protectedData, std::size_t size)
             {
-                if (protectedData.size() < cHeaderLength + 1)
+                if (protectedData == nullptr || size < cHeaderLength + 1)
                 {
                     return CheckStatusType::kNoNewData;
                 }
@@ -141,11 +101,8 @@ namespace ara
                         protectedData[1]);
                 const uint8_t receivedCounter = protectedData[2];
 
-                std::vector<uint8_t> payload(
-                    protectedData.begin() + static_cast<std::ptrdiff_t>(cHeaderLength),
-                    protectedData.end());
-
-                const uint16_t expectedCrc = computeCrc(payload, receivedCounter);
+                const uint16_t expectedCrc = computeCrc(
+                    protectedData + cHeaderLength, size - cHeaderLength, receivedCounter);
 
                 if (receivedCrc != expectedCrc)
                 {
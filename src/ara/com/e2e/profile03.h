@@ -17,8 +17,6 @@
 #ifndef PROFILE03_H
 #define PROFILE03_H
 
-#include <array>
-#include <atomic>
 #include <cstdint>
 #include "./profile.h"
 
@@ -39,38 +37,33 @@ namespace ara
             class Profile03 : public Profile
             {
             private:
-                static constexpr std::size_t cTableSize{256};
-                static constexpr uint16_t cCrcPoly{0x1021};
                 static constexpr uint16_t cCrcInitial{0xFFFF};
                 static constexpr uint8_t cCounterMax{0x0F};
                 static constexpr std::size_t cHeaderLength{4};
 
-                static volatile std::atomic_bool mCrcTableInitialized;
-                static std::array<uint16_t, cTableSize> mCrcTable;
-
                 Profile03Config mConfig;
                 uint8_t mProtectingCounter{0};
                 uint8_t mCheckingCounter{0};
 
-                static void initializeCrcTable() noexcept;
-                static uint16_t crcStep(uint16_t crc, uint8_t byte) noexcept;
-                uint16_t computeCrc(const std::vector<uint8_t> &payload,
+                uint16_t computeCrc(const uint8_t *payload, std::size_t length,
                                     uint8_t counterByte) const noexcept;
 
             public:
                 Profile03() noexcept;
                 explicit Profile03(const Profile03Config &config) noexcept;
 
-                bool TryProtect(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                std::size_t HeaderLength() const noexcept override;
+
+                bool TryProtectInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
+
+                bool TryForwardInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
 
-                bool TryForward(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                using Profile::Check;
 
                 CheckStatusType Check(
-                    const std::vector<uint8_t> &protectedData) override;
+                    const std::uint8_t *protectedData, std::size_t size) override;
             };
         }
     }
@@ -3,6 +3,7 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include "./profile04.h"
+#include "./crc.h"
 #include <algorithm>
 
 namespace ara
@@ -11,65 +12,28 @@ namespace ara
     {
         namespace e2e
         {
-            constexpr std::size_t Profile04::cTableSize;
-            constexpr uint32_t Profile04::cReflectedPoly;
             constexpr uint8_t Profile04::cCounterMax;
             constexpr std::size_t Profile04::cHeaderLength;
 
-            volatile std::atomic_bool Profile04::mCrcTableInitialized{false};
-            std::array<uint32_t, Profile04::cTableSize> Profile04::mCrcTable{};
-
-            // -----------------------------------------------------------------------
-            // CRC-32/AUTOSAR table (reflected polynomial 0xF4ACFB13)
-            // Reflected polynomial: 0xC8DF352F (LSB-first processing)
-            // -----------------------------------------------------------------------
-            void Profile04::initializeCrcTable() noexcept
-            {
-                for (uint32_t i = 0; i < cTableSize; ++i)
-                {
-                    uint32_t crc = i;
-                    for (uint8_t bit = 0; bit < 8; ++bit)
-                    {
-                        if (crc & 0x00000001U)
-                        {
-                            crc = (crc >> 1) ^ cReflectedPoly;
-                        }
-                        else
-                        {
-                            crc >>= 1;
-                        }
-                    }
-                    mCrcTable[i] = crc;
-                }
-            }
-
-            uint32_t Profile04::crcStep(uint32_t crc, uint8_t byte) noexcept
-            {
-                const auto idx = static_cast<uint8_t>((crc ^ byte) & 0xFF);
-                return static_cast<uint32_t>((crc >> 8) ^ mCrcTable[idx]);
-            }
-
             // -----------------------------------------------------------------------
             // Compute CRC-32/AUTOSAR over DataID(2B big-endian) + counterByte + payload
             // Initial value: 0xFFFFFFFF, final XOR: 0xFFFFFFFF
             // -----------------------------------------------------------------------
             uint32_t Profile04::computeCrc(
-                const std::vector<uint8_t> &payload,
+                const uint8_t *payload,
+                std::size_t length,
                 uint8_t counterByte) const noexcept
             {
+                // DataID big-endian, counter byte, DataID low byte (additional
+                // input per AUTOSAR profile 04), then the payload
+                const uint8_t cHeader[]{
+                    static_cast<uint8_t>(mConfig.dataId >> 8),
+                    static_cast<uint8_t>(mConfig.dataId & 0xFF),
+                    counterByte,
+                    static_cast<uint8_t>(mConfig.dataId & 0xFF)};
                 uint32_t crc = 0xFFFFFFFFU; // CRC-32/AUTOSAR initial value
-                // DataID big-endian
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId >> 8));
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId & 0xFF));
-                // Counter byte
-                crc = crcStep(crc, counterByte);
-                // DataID low byte (additional input per AUTOSAR profile 04)
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId & 0xFF));
-                // Payload
-                for (uint8_t b : payload)
-                {
-                    crc = crcStep(crc, b);
-                }
+                crc = Crc32P4::Update(crc, cHeader, sizeof(cHeader));
+                crc = Crc32P4::Update(crc, payload, length);
                 // CRC-32/AUTOSAR: final XOR with 0xFFFFFFFF
                 return crc ^ 0xFFFFFFFFU;
             }
@@ -80,78 +44,64 @@ namespace ara
             Profile04::Profile04() noexcept
                 : mConfig{}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
             }
 
             Profile04::Profile04(const Profile04Config &config) noexcept
                 : mConfig{config}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
+            }
+
+            std::size_t Profile04::HeaderLength() const noexcept
+            {
+                return cHeaderLength;
             }
 
             // -----------------------------------------------------------------------
-            // TryProtect — build 6-byte header
+            // TryProtectInPlace — build 6-byte header
             //   byte[0-3] = CRC32 (LE), byte[4] = counter, byte[5] = DataID_low
             // -----------------------------------------------------------------------
-            bool Profile04::TryProtect(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile04::TryProtectInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
-                if (unprotectedData.empty()) return false;
+                if (buffer == nullptr || size <= cHeaderLength) return false;
 
                 mProtectingCounter = (mProtectingCounter < cCounterMax)
                                          ? static_cast<uint8_t>(mProtectingCounter + 1)
                                          : 0;
 
                 const uint8_t counterByte = static_cast<uint8_t>(mProtectingCounter & 0x0F);
-                const uint32_t crc = computeCrc(unprotectedData, counterByte);
+                const uint32_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, counterByte);
 
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
                 // CRC-32 little-endian (4 bytes)
-                protectedData.push_back(static_cast<uint8_t>(crc & 0xFF));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 16) & 0xFF));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 24) & 0xFF));
+                buffer[0] = static_cast<uint8_t>(crc & 0xFF);
+                buffer[1] = static_cast<uint8_t>((crc >> 8) & 0xFF);
+                buffer[2] = static_cast<uint8_t>((crc >> 16) & 0xFF);
+                buffer[3] = static_cast<uint8_t>((crc >> 24) & 0xFF);
                 // Counter and DataID low
-                protectedData.push_back(counterByte);
-                protectedData.push_back(static_cast<uint8_t>(mConfig.dataId & 0xFF));
-                // Payload
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                buffer[4] = counterByte;
+                buffer[5] = static_cast<uint8_t>(mConfig.dataId & 0xFF);
                 return true;
             }
 
             // -----------------------------------------------------------------------
-            // TryForward — gateway mode: reuse last checked counter
+            // TryForwardInPlace — gateway mode: reuse last checked counter
             // -----------------------------------------------------------------------
-            bool Profile04::TryForward(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile04::TryForwardInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
-                if (unprotectedData.empty()) return false;
+                if (buffer == nullptr || size <= cHeaderLength) return false;
 
                 const uint8_t counterByte = static_cast<uint8_t>(mCheckingCounter & 0x0F);
-                const uint32_t crc = computeCrc(unprotectedData, counterByte);
-
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
-                protectedData.push_back(static_cast<uint8_t>(crc & 0xFF));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 16) & 0xFF));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 24) & 0xFF));
-                protectedData.push_back(counterByte);
-                protectedData.push_back(static_cast<uint8_t>(mConfig.dataId & 0xFF));
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                const uint32_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, counterByte);
+
+                buffer[0] = static_cast<uint8_t>(crc & 0xFF);
+                buffer[1] = static_cast<uint8_t>((crc >> 8) & 0xFF);
+                buffer[2] = static_cast<uint8_t>((crc >> 16) & 0xFF);
+                buffer[3] = static_cast<uint8_t>((crc >> 24) & 0xFF);
+                buffer[4] = counterByte;
+                buffer[5] = static_cast<uint8_t>(mConfig.dataId & 0xFF);
 
                 mProtectingCounter = mCheckingCounter;
                 return true;
@@ -161,9 +111,9 @@ namespace ara
             // Check — verify CRC-32/AUTOSAR and counter
             // -----------------------------------------------------------------------
             CheckStatusType Profile04::Check(
-                const std::vector<uint8_t> &protectedData)
+                const std::uint8_t *protectedData, std::size_t size)
             {
-                if (protectedData.size() < cHeaderLength + 1)
+                if (protectedData == nullptr || size < cHeaderLength + 1)
                 {
                     return CheckStatusType::kNoNewData;
                 }
@@ -177,11 +127,8 @@ namespace ara
                 const uint8_t counterByte = protectedData[4];
                 // byte[5] = DataID low (not checked separately; used in CRC computation)
 
-                const std::vector<uint8_t> payload(
-                    protectedData.begin() + static_cast<std::ptrdiff_t>(cHeaderLength),
-                    protectedData.end());
-
-                const uint32_t computedCrc = computeCrc(payload, counterByte);
+                const uint32_t computedCrc = computeCrc(
+                    protectedData + cHeaderLength, size - cHeaderLength, counterByte);
                 if (receivedCrc != computedCrc)
                 {
                     return CheckStatusType::kWrongCrc;
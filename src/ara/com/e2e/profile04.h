@@ -21,8 +21,6 @@
 #ifndef PROFILE04_H
 #define PROFILE04_H
 
-#include <array>
-#include <atomic>
 #include <cstdint>
 #include "./profile.h"
 
@@ -54,38 +52,32 @@ namespace ara
             class Profile04 : public Profile
             {
             private:
-                static constexpr std::size_t cTableSize{256};
-                /// @brief Reflected polynomial of CRC-32/AUTOSAR (0xF4ACFB13 reflected)
-                static constexpr uint32_t cReflectedPoly{0xC8DF352FU};
                 static constexpr uint8_t cCounterMax{0x0e};
                 static constexpr std::size_t cHeaderLength{6};
 
-                static volatile std::atomic_bool mCrcTableInitialized;
-                static std::array<uint32_t, cTableSize> mCrcTable;
-
                 Profile04Config mConfig;
                 uint8_t mProtectingCounter{0};
                 uint8_t mCheckingCounter{0};
 
-                static void initializeCrcTable() noexcept;
-                static uint32_t crcStep(uint32_t crc, uint8_t byte) noexcept;
-                uint32_t computeCrc(const std::vector<uint8_t> &payload,
+                uint32_t computeCrc(const uint8_t *payload, std::size_t length,
                                     uint8_t counterByte) const noexcept;
 
             public:
                 Profile04() noexcept;
                 explicit Profile04(const Profile04Config &config) noexcept;
 
-                bool TryProtect(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                std::size_t HeaderLength() const noexcept override;
+
+                bool TryProtectInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
+
+                bool TryForwardInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
 
-                bool TryForward(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                using Profile::Check;
 
                 CheckStatusType Check(
-                    const std::vector<uint8_t> &protectedData) override;
+                    const std::uint8_t *protectedData, std::size_t size) override;
             };
         }
     }
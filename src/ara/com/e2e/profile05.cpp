@@ -3,6 +3,7 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include "./profile05.h"
+#include "./crc.h"
 #include <algorithm>
 
 namespace ara
@@ -11,63 +12,25 @@ namespace ara
     {
         namespace e2e
         {
-            constexpr std::size_t Profile05::cTableSize;
-            constexpr uint16_t Profile05::cCrcPoly;
             constexpr uint8_t Profile05::cCounterMax;
             constexpr std::size_t Profile05::cHeaderLength;
 
-            volatile std::atomic_bool Profile05::mCrcTableInitialized{false};
-            std::array<uint16_t, Profile05::cTableSize> Profile05::mCrcTable{};
-
-            // -----------------------------------------------------------------------
-            // CRC-16/ARC table (reflected polynomial, LSB-first)
-            // -----------------------------------------------------------------------
-            void Profile05::initializeCrcTable() noexcept
-            {
-                // Reflected polynomial 0x8005: reflect(0x8005) = 0xA001
-                const uint16_t reflectedPoly = 0xA001U;
-                for (uint16_t i = 0; i < cTableSize; ++i)
-                {
-                    uint16_t crc = i;
-                    for (uint8_t bit = 0; bit < 8; ++bit)
-                    {
-                        if (crc & 0x0001U)
-                        {
-                            crc = static_cast<uint16_t>((crc >> 1) ^ reflectedPoly);
-                        }
-                        else
-                        {
-                            crc >>= 1;
-                        }
-                    }
-                    mCrcTable[i] = crc;
-                }
-            }
-
-            uint16_t Profile05::crcStep(uint16_t crc, uint8_t byte) noexcept
-            {
-                const auto idx = static_cast<uint8_t>((crc ^ byte) & 0xFF);
-                return static_cast<uint16_t>((crc >> 8) ^ mCrcTable[idx]);
-            }
-
             // -----------------------------------------------------------------------
             // Compute CRC-16/ARC over DataID(2B big-endian) + counterByte + payload
             // -----------------------------------------------------------------------
             uint16_t Profile05::computeCrc(
-                const std::vector<uint8_t> &payload,
+                const uint8_t *payload,
+                std::size_t length,
                 uint8_t counterByte) const noexcept
             {
+                // DataID big-endian, counter byte, then the payload
+                const uint8_t cHeader[]{
+                    static_cast<uint8_t>(mConfig.dataId >> 8),
+                    static_cast<uint8_t>(mConfig.dataId & 0xFF),
+                    counterByte};
                 uint16_t crc = 0xFFFF; // CRC-16/ARC initial value
-                // DataID big-endian
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId >> 8));
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId & 0xFF));
-                // Counter byte
-                crc = crcStep(crc, counterByte);
-                // Payload
-                for (uint8_t b : payload)
-                {
-                    crc = crcStep(crc, b);
-                }
+                crc = Crc16Arc::Update(crc, cHeader, sizeof(cHeader));
+                crc = Crc16Arc::Update(crc, payload, length);
                 // CRC-16/ARC: no final XOR (XOR value = 0x0000)
                 return crc;
             }
@@ -78,69 +41,56 @@ namespace ara
             Profile05::Profile05() noexcept
                 : mConfig{}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
             }
 
             Profile05::Profile05(const Profile05Config &config) noexcept
                 : mConfig{config}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
+            }
+
+            std::size_t Profile05::HeaderLength() const noexcept
+            {
+                return cHeaderLength;
             }
 
             // -----------------------------------------------------------------------
-            // TryProtect — build 3-byte header
+            // TryProtectInPlace — build 3-byte header
             //   byte[0] = CRC16_L, byte[1] = CRC16_H, byte[2] = counter
             // -----------------------------------------------------------------------
-            bool Profile05::TryProtect(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile05::TryProtectInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
-                if (unprotectedData.empty()) return false;
+                if (buffer == nullptr || size <= cHeaderLength) return false;
 
                 mProtectingCounter = (mProtectingCounter < cCounterMax)
                                          ? static_cast<uint8_t>(mProtectingCounter + 1)
                                          : 0;
 
                 const uint8_t counterByte = static_cast<uint8_t>(mProtectingCounter & 0x0F);
-                const uint16_t crc = computeCrc(unprotectedData, counterByte);
-
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
-                protectedData.push_back(static_cast<uint8_t>(crc & 0xFF));        // CRC16_L
-                protectedData.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF)); // CRC16_H
-                protectedData.push_back(counterByte);
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                const uint16_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, counterByte);
+
+                buffer[0] = static_cast<uint8_t>(crc & 0xFF);        // CRC16_L
+                buffer[1] = static_cast<uint8_t>((crc >> 8) & 0xFF); // CRC16_H
+                buffer[2] = counterByte;
                 return true;
             }
 
             // -----------------------------------------------------------------------
-            // TryForward — use last checked counter (gateway mode)
+            // TryForwardInPlace — use last checked counter (gateway mode)
             // -----------------------------------------------------------------------
-            bool Profile05::TryForward(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile05::TryForwardInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
-                if (unprotectedData.empty()) return false;
+                if (buffer == nullptr || size <= cHeaderLength) return false;
 
                 const uint8_t counterByte = static_cast<uint8_t>(mCheckingCounter & 0x0F);
-                const uint16_t crc = computeCrc(unprotectedData, counterByte);
+                const uint16_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, counterByte);
 
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
-                protectedData.push_back(static_cast<uint8_t>(crc & 0xFF));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 8) & 0xFF));
-                protectedData.push_back(counterByte);
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                buffer[0] = static_cast<uint8_t>(crc & 0xFF);
+                buffer[1] = static_cast<uint8_t>((crc >> 8) & 0xFF);
+                buffer[2] = counterByte;
 
                 mProtectingCounter = mCheckingCounter;
                 return true;
@@ -150,9 +100,9 @@ namespace ara
             // Check — verify CRC-16 and counter
             // -----------------------------------------------------------------------
             CheckStatusType Profile05::Check(
-                const std::vector<uint8_t> &protectedData)
+                const std::uint8_t *protectedData, std::size_t size)
             {
-                if (protectedData.size() < cHeaderLength + 1)
+                if (protectedData == nullptr || size < cHeaderLength + 1)
                 {
                     return CheckStatusType::kNoNewData;
                 }
@@ -162,11 +112,8 @@ namespace ara
                     (static_cast<uint16_t>(protectedData[1]) << 8);
                 const uint8_t counterByte = protectedData[2];
 
-                const std::vector<uint8_t> payload(
-                    protectedData.begin() + static_cast<std::ptrdiff_t>(cHeaderLength),
-                    protectedData.end());
-
-                const uint16_t computedCrc = computeCrc(payload, counterByte);
+                const uint16_t computedCrc = computeCrc(
+                    protectedData + cHeaderLength, size - cHeaderLength, counterByte);
                 if (receivedCrc != computedCrc)
                 {
                     return CheckStatusType::kWrongCrc;
@@ -19,8 +19,6 @@
 #ifndef PROFILE05_H
 #define PROFILE05_H
 
-#include <array>
-#include <atomic>
 #include <cstdint>
 #include "./profile.h"
 
@@ -51,37 +49,32 @@ namespace ara
             class Profile05 : public Profile
             {
             private:
-                static constexpr std::size_t cTableSize{256};
-                static constexpr uint16_t cCrcPoly{0x8005}; ///< CRC-16/ARC polynomial (reflected)
                 static constexpr uint8_t cCounterMax{0x0f};
                 static constexpr std::size_t cHeaderLength{3};
 
-                static volatile std::atomic_bool mCrcTableInitialized;
-                static std::array<uint16_t, cTableSize> mCrcTable;
-
                 Profile05Config mConfig;
                 uint8_t mProtectingCounter{0};
                 uint8_t mCheckingCounter{0};
 
-                static void initializeCrcTable() noexcept;
-                static uint16_t crcStep(uint16_t crc, uint8_t byte) noexcept;
-                uint16_t computeCrc(const std::vector<uint8_t> &payload,
+                uint16_t computeCrc(const uint8_t *payload, std::size_t length,
                                     uint8_t counterByte) const noexcept;
 
             public:
                 Profile05() noexcept;
                 explicit Profile05(const Profile05Config &config) noexcept;
 
-                bool TryProtect(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                std::size_t HeaderLength() const noexcept override;
+
+                bool TryProtectInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
+
+                bool TryForwardInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
 
-                bool TryForward(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                using Profile::Check;
 
                 CheckStatusType Check(
-                    const std::vector<uint8_t> &protectedData) override;
+                    const std::uint8_t *protectedData, std::size_t size) override;
             };
         }
     }
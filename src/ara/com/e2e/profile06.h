@@ -16,8 +16,6 @@
 #ifndef PROFILE06_H
 #define PROFILE06_H
 
-#include <array>
-#include <atomic>
 #include <cstdint>
 #include "./profile.h"
 
@@ -38,38 +36,33 @@ namespace ara
             class Profile06 : public Profile
             {
             private:
-                static constexpr std::size_t cTableSize{256};
-                static constexpr uint32_t cCrcPoly{0xEDB88320U}; ///< reflected 0x04C11DB7
                 static constexpr uint32_t cCrcInitial{0xFFFFFFFFU};
                 static constexpr uint8_t cCounterMax{0xFF};
                 static constexpr std::size_t cHeaderLength{6};
 
-                static volatile std::atomic_bool mCrcTableInitialized;
-                static std::array<uint32_t, cTableSize> mCrcTable;
-
                 Profile06Config mConfig;
                 uint8_t mProtectingCounter{0};
                 uint8_t mCheckingCounter{0};
 
-                static void initializeCrcTable() noexcept;
-                static uint32_t crcStep(uint32_t crc, uint8_t byte) noexcept;
-                uint32_t computeCrc(const std::vector<uint8_t> &payload,
+                uint32_t computeCrc(const uint8_t *payload, std::size_t length,
                                     uint8_t counterByte) const noexcept;
 
             public:
                 Profile06() noexcept;
                 explicit Profile06(const Profile06Config &config) noexcept;
 
-                bool TryProtect(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                std::size_t HeaderLength() const noexcept override;
+
+                bool TryProtectInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
+
+                bool TryForwardInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
 
-                bool TryForward(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                using Profile::Check;
 
                 CheckStatusType Check(
-                    const std::vector<uint8_t> &protectedData) override;
+                    const std::uint8_t *protectedData, std::size_t size) override;
             };
         }
     }
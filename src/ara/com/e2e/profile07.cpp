@@ -3,6 +3,7 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include "./profile07.h"
+#include "./crc.h"
 #include <algorithm>
 
 namespace ara
@@ -11,69 +12,30 @@ namespace ara
     {
         namespace e2e
         {
-            constexpr std::size_t Profile07::cTableSize;
-            constexpr uint64_t Profile07::cReflectedPoly;
             constexpr uint16_t Profile07::cCounterMax;
             constexpr std::size_t Profile07::cHeaderLength;
 
-            volatile std::atomic_bool Profile07::mCrcTableInitialized{false};
-            std::array<uint64_t, Profile07::cTableSize> Profile07::mCrcTable{};
-
-            // -----------------------------------------------------------------------
-            // CRC-64/ECMA-182 table (reflected polynomial 0xC96C5795D7870F42)
-            // Normal polynomial 0x42F0E1EBA9EA3693, reflected for LSB-first processing.
-            // Initial value: 0x0000000000000000, final XOR: 0x0000000000000000
-            // -----------------------------------------------------------------------
-            void Profile07::initializeCrcTable() noexcept
-            {
-                for (uint32_t i = 0; i < cTableSize; ++i)
-                {
-                    uint64_t crc = static_cast<uint64_t>(i);
-                    for (uint8_t bit = 0; bit < 8; ++bit)
-                    {
-                        if (crc & 0x0000000000000001ULL)
-                        {
-                            crc = (crc >> 1) ^ cReflectedPoly;
-                        }
-                        else
-                        {
-                            crc >>= 1;
-                        }
-                    }
-                    mCrcTable[i] = crc;
-                }
-            }
-
-            uint64_t Profile07::crcStep(uint64_t crc, uint8_t byte) noexcept
-            {
-                const auto idx = static_cast<uint8_t>((crc ^ static_cast<uint64_t>(byte)) & 0xFFU);
-                return static_cast<uint64_t>((crc >> 8) ^ mCrcTable[idx]);
-            }
-
             // -----------------------------------------------------------------------
             // Compute CRC-64/ECMA-182 over:
             //   DataID (4 bytes LE) + Counter (2 bytes LE) + payload bytes
             // Initial value: 0x0000000000000000, final XOR: none
             // -----------------------------------------------------------------------
             uint64_t Profile07::computeCrc(
-                const std::vector<uint8_t> &payload,
+                const uint8_t *payload,
+                std::size_t length,
                 uint16_t counter) const noexcept
             {
+                // DataID (LE 4 bytes), counter (LE 2 bytes), then the payload
+                const uint8_t cHeader[]{
+                    static_cast<uint8_t>(mConfig.dataId & 0xFFU),
+                    static_cast<uint8_t>((mConfig.dataId >> 8) & 0xFFU),
+                    static_cast<uint8_t>((mConfig.dataId >> 16) & 0xFFU),
+                    static_cast<uint8_t>((mConfig.dataId >> 24) & 0xFFU),
+                    static_cast<uint8_t>(counter & 0xFFU),
+                    static_cast<uint8_t>((counter >> 8) & 0xFFU)};
                 uint64_t crc = 0x0000000000000000ULL;
-                // DataID (LE 4 bytes)
-                crc = crcStep(crc, static_cast<uint8_t>(mConfig.dataId & 0xFFU));
-                crc = crcStep(crc, static_cast<uint8_t>((mConfig.dataId >> 8) & 0xFFU));
-                crc = crcStep(crc, static_cast<uint8_t>((mConfig.dataId >> 16) & 0xFFU));
-                crc = crcStep(crc, static_cast<uint8_t>((mConfig.dataId >> 24) & 0xFFU));
-                // Counter (LE 2 bytes)
-                crc = crcStep(crc, static_cast<uint8_t>(counter & 0xFFU));
-                crc = crcStep(crc, static_cast<uint8_t>((counter >> 8) & 0xFFU));
-                // Payload
-                for (uint8_t b : payload)
-                {
-                    crc = crcStep(crc, b);
-                }
-                return crc;
+                crc = Crc64::Update(crc, cHeader, sizeof(cHeader));
+                return Crc64::Update(crc, payload, length);
             }
 
             // -----------------------------------------------------------------------
@@ -82,105 +44,89 @@ namespace ara
             Profile07::Profile07() noexcept
                 : mConfig{}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
             }
 
             Profile07::Profile07(const Profile07Config &config) noexcept
                 : mConfig{config}, mProtectingCounter{0}, mCheckingCounter{0}
             {
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable();
-                }
+            }
+
+            std::size_t Profile07::HeaderLength() const noexcept
+            {
+                return cHeaderLength;
             }
 
             // -----------------------------------------------------------------------
-            // TryProtect — build 16-byte header
+            // TryProtectInPlace — build 16-byte header
             //   byte[0-7]   = CRC64 (LE)
             //   byte[8-9]   = Counter (LE 16-bit)
             //   byte[10-13] = DataID (LE 32-bit)
             //   byte[14-15] = Reserved (0x00)
             // -----------------------------------------------------------------------
-            bool Profile07::TryProtect(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile07::TryProtectInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
-                if (unprotectedData.empty()) return false;
+                if (buffer == nullptr || size <= cHeaderLength) return false;
 
                 mProtectingCounter = (mProtectingCounter < cCounterMax)
                                          ? static_cast<uint16_t>(mProtectingCounter + 1U)
                                          : 0U;
 
                 const uint16_t counter = mProtectingCounter;
-                const uint64_t crc = computeCrc(unprotectedData, counter);
-
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
+                const uint64_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, counter);
 
                 // CRC-64 little-endian (8 bytes)
-                protectedData.push_back(static_cast<uint8_t>(crc & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 8) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 16) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 24) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 32) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 40) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 48) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 56) & 0xFFU));
+                buffer[0] = static_cast<uint8_t>(crc & 0xFFU);
+                buffer[1] = static_cast<uint8_t>((crc >> 8) & 0xFFU);
+                buffer[2] = static_cast<uint8_t>((crc >> 16) & 0xFFU);
+                buffer[3] = static_cast<uint8_t>((crc >> 24) & 0xFFU);
+                buffer[4] = static_cast<uint8_t>((crc >> 32) & 0xFFU);
+                buffer[5] = static_cast<uint8_t>((crc >> 40) & 0xFFU);
+                buffer[6] = static_cast<uint8_t>((crc >> 48) & 0xFFU);
+                buffer[7] = static_cast<uint8_t>((crc >> 56) & 0xFFU);
                 // Counter (LE 2 bytes)
-                protectedData.push_back(static_cast<uint8_t>(counter & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((counter >> 8) & 0xFFU));
+                buffer[8] = static_cast<uint8_t>(counter & 0xFFU);
+                buffer[9] = static_cast<uint8_t>((counter >> 8) & 0xFFU);
                 // DataID (LE 4 bytes)
-                protectedData.push_back(static_cast<uint8_t>(mConfig.dataId & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((mConfig.dataId >> 8) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((mConfig.dataId >> 16) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((mConfig.dataId >> 24) & 0xFFU));
+                buffer[10] = static_cast<uint8_t>(mConfig.dataId & 0xFFU);
+                buffer[11] = static_cast<uint8_t>((mConfig.dataId >> 8) & 0xFFU);
+                buffer[12] = static_cast<uint8_t>((mConfig.dataId >> 16) & 0xFFU);
+                buffer[13] = static_cast<uint8_t>((mConfig.dataId >> 24) & 0xFFU);
                 // Reserved (2 bytes)
-                protectedData.push_back(0x00U);
-                protectedData.push_back(0x00U);
-                // Payload
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                buffer[14] = 0x00U;
+                buffer[15] = 0x00U;
                 return true;
             }
 
             // -----------------------------------------------------------------------
-            // TryForward — gateway mode: reuse last checked counter
+            // TryForwardInPlace — gateway mode: reuse last checked counter
             // -----------------------------------------------------------------------
-            bool Profile07::TryForward(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile07::TryForwardInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
-                if (unprotectedData.empty()) return false;
+                if (buffer == nullptr || size <= cHeaderLength) return false;
 
                 const uint16_t counter = mCheckingCounter;
-                const uint64_t crc = computeCrc(unprotectedData, counter);
-
-                protectedData.clear();
-                protectedData.reserve(cHeaderLength + unprotectedData.size());
-
-                protectedData.push_back(static_cast<uint8_t>(crc & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 8) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 16) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 24) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 32) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 40) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 48) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((crc >> 56) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>(counter & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((counter >> 8) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>(mConfig.dataId & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((mConfig.dataId >> 8) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((mConfig.dataId >> 16) & 0xFFU));
-                protectedData.push_back(static_cast<uint8_t>((mConfig.dataId >> 24) & 0xFFU));
-                protectedData.push_back(0x00U);
-                protectedData.push_back(0x00U);
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(), unprotectedData.end());
+                const uint64_t crc = computeCrc(
+                    buffer + cHeaderLength, size - cHeaderLength, counter);
+
+                buffer[0] = static_cast<uint8_t>(crc & 0xFFU);
+                buffer[1] = static_cast<uint8_t>((crc >> 8) & 0xFFU);
+                buffer[2] = static_cast<uint8_t>((crc >> 16) & 0xFFU);
+                buffer[3] = static_cast<uint8_t>((crc >> 24) & 0xFFU);
+                buffer[4] = static_cast<uint8_t>((crc >> 32) & 0xFFU);
+                buffer[5] = static_cast<uint8_t>((crc >> 40) & 0xFFU);
+                buffer[6] = static_cast<uint8_t>((crc >> 48) & 0xFFU);
+                buffer[7] = static_cast<uint8_t>((crc >> 56) & 0xFFU);
+                buffer[8] = static_cast<uint8_t>(counter & 0xFFU);
+                buffer[9] = static_cast<uint8_t>((counter >> 8) & 0xFFU);
+                buffer[10] = static_cast<uint8_t>(mConfig.dataId & 0xFFU);
+                buffer[11] = static_cast<uint8_t>((mConfig.dataId >> 8) & 0xFFU);
+                buffer[12] = static_cast<uint8_t>((mConfig.dataId >> 16) & 0xFFU);
+                buffer[13] = static_cast<uint8_t>((mConfig.dataId >> 24) & 0xFFU);
+                buffer[14] = 0x00U;
+                buffer[15] = 0x00U;
 
                 mProtectingCounter = mCheckingCounter;
                 return true;
@@ -190,9 +136,9 @@ namespace ara
             // Check — verify CRC-64/ECMA-182 and 16-bit counter sequence
             // -----------------------------------------------------------------------
             CheckStatusType Profile07::Check(
-                const std::vector<uint8_t> &protectedData)
+                const std::uint8_t *protectedData, std::size_t size)
             {
-                if (protectedData.size() < cHeaderLength + 1U)
+                if (protectedData == nullptr || size < cHeaderLength + 1U)
                 {
                     return CheckStatusType::kNoNewData;
                 }
@@ -216,11 +162,8 @@ namespace ara
                 // byte[10-13] = DataID (not re-verified; already in CRC computation)
                 // byte[14-15] = Reserved (ignored)
 
-                const std::vector<uint8_t> payload(
-                    protectedData.begin() + static_cast<std::ptrdiff_t>(cHeaderLength),
-                    protectedData.end());
-
-                const uint64_t computedCrc = computeCrc(payload, receivedCounter);
+                const uint64_t computedCrc = computeCrc(
+                    protectedData + cHeaderLength, size - cHeaderLength, receivedCounter);
                 if (receivedCrc != computedCrc)
                 {
                     return CheckStatusType::kWrongCrc;
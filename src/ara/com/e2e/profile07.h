@@ -24,8 +24,6 @@
 #ifndef PROFILE07_H
 #define PROFILE07_H
 
-#include <array>
-#include <atomic>
 #include <cstdint>
 #include "./profile.h"
 
@@ -60,40 +58,35 @@ namespace ara
             class Profile07 : public Profile
             {
             private:
-                static constexpr std::size_t cTableSize{256};
                 /// @brief Reflected polynomial of CRC-64/ECMA-182
                 ///        Normal polynomial: 0x42F0E1EBA9EA3693
                 ///        Reflected:         0xC96C5795D7870F42
-                static constexpr uint64_t cReflectedPoly{0xC96C5795D7870F42ULL};
                 static constexpr uint16_t cCounterMax{0xFFFEU};
                 static constexpr std::size_t cHeaderLength{16};
 
-                static volatile std::atomic_bool mCrcTableInitialized;
-                static std::array<uint64_t, cTableSize> mCrcTable;
-
                 Profile07Config mConfig;
                 uint16_t mProtectingCounter{0};
                 uint16_t mCheckingCounter{0};
 
-                static void initializeCrcTable() noexcept;
-                static uint64_t crcStep(uint64_t crc, uint8_t byte) noexcept;
-                uint64_t computeCrc(const std::vector<uint8_t> &payload,
+                uint64_t computeCrc(const uint8_t *payload, std::size_t length,
                                     uint16_t counter) const noexcept;
 
             public:
                 Profile07() noexcept;
                 explicit Profile07(const Profile07Config &config) noexcept;
 
-                bool TryProtect(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                std::size_t HeaderLength() const noexcept override;
+
+                bool TryProtectInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
+
+                bool TryForwardInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
 
-                bool TryForward(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                using Profile::Check;
 
                 CheckStatusType Check(
-                    const std::vector<uint8_t> &protectedData) override;
+                    const std::uint8_t *protectedData, std::size_t size) override;
             };
         }
     }
@@ -3,6 +3,7 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include "./profile11.h"
+#include "./crc.h"
 #include <cstddef>
 
 namespace ara
@@ -11,61 +12,33 @@ namespace ara
     {
         namespace e2e
         {
-            constexpr std::size_t Profile11::cTableSize;
-            volatile std::atomic_bool Profile11::mCrcTableInitialized{false};
-            std::array<uint8_t, Profile11::cTableSize> Profile11::mCrcTable;
+            constexpr std::size_t Profile11::cHeaderLength;
 
             Profile11::Profile11() noexcept : mProtectingCounter{0},
                                               mCheckingCounter{0}
             {
-                const uint8_t cCrcPoly{0x1d};
-
-                if (!mCrcTableInitialized)
-                {
-                    mCrcTableInitialized = true;
-                    initializeCrcTable(cCrcPoly);
-                }
             }
 
-            void Profile11::initializeCrcTable(uint8_t crcPoly) noexcept
+            uint8_t Profile11::calculateCrc(
+                const uint8_t *data, std::size_t size) noexcept
             {
-                const uint8_t cCrcMask{0x80};
-
-                for (uint16_t i = 0; i < cTableSize; ++i)
-                {
-                    auto _crc{static_cast<uint8_t>(i)};
-
-                    for (uint8_t j = 0; j < 8; ++j)
-                    {
-                        _crc = (_crc & cCrcMask) ? ((_crc << 1) ^ crcPoly) : (_crc << 1);
-                    }
+                const uint8_t cInitial{0xff};
+                const uint8_t cResult{Crc8::Update(cInitial, data, size)};
 
-                    mCrcTable[i] = _crc;
-                }
+                return static_cast<uint8_t>(~cResult);
             }
 
-            uint8_t Profile11::calculateCrc(
-                const std::vector<uint8_t> &data, std::size_t offset)
+            std::size_t Profile11::HeaderLength() const noexcept
             {
-                uint8_t _result{0xff};
-
-                for (std::size_t i = offset; i < data.size(); ++i)
-                {
-                    const uint8_t cElement{data[i]};
-                    const auto cIndex{static_cast<std::size_t>(_result ^ cElement)};
-                    _result = mCrcTable[cIndex];
-                }
-
-                return ~_result;
+                return cHeaderLength;
             }
 
-            bool Profile11::TryProtect(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile11::TryProtectInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
                 const uint8_t cCounterMask{0xf0};
 
-                if (unprotectedData.empty())
+                if (buffer == nullptr || size <= cHeaderLength)
                 {
                     return false;
                 }
@@ -79,52 +52,26 @@ namespace ara
                     mProtectingCounter = 0;
                 }
 
-                const auto cCounter{
-                    static_cast<uint8_t>(mProtectingCounter | cCounterMask)};
-
-                // Build [counter | payload] for CRC, avoiding O(n) insert-at-front
-                protectedData.clear();
-                protectedData.reserve(2U + unprotectedData.size());
-                protectedData.push_back(cCounter);
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(),
-                                     unprotectedData.end());
-
-                const uint8_t cCrc{calculateCrc(protectedData)};
-
-                // Prepend CRC (single O(n) shift instead of two)
-                protectedData.insert(protectedData.begin(), cCrc);
+                // [CRC | counter | payload], the CRC covering counter and payload
+                buffer[1] = static_cast<uint8_t>(mProtectingCounter | cCounterMask);
+                buffer[0] = calculateCrc(buffer + 1, size - 1);
 
                 return true;
             }
 
-            bool Profile11::TryForward(
-                const std::vector<uint8_t> &unprotectedData,
-                std::vector<uint8_t> &protectedData)
+            bool Profile11::TryForwardInPlace(
+                std::uint8_t *buffer, std::size_t size)
             {
                 const uint8_t cCounterMask{0xf0};
 
-                if (unprotectedData.empty())
+                if (buffer == nullptr || size <= cHeaderLength)
                 {
                     return false;
                 }
 
                 // Replicate the last checked status (counter) for gateway-style forwarding.
-                const auto cCounter{
-                    static_cast<uint8_t>((mCheckingCounter & 0x0f) | cCounterMask)};
-
-                // Build [counter | payload] for CRC, avoiding O(n) insert-at-front
-                protectedData.clear();
-                protectedData.reserve(2U + unprotectedData.size());
-                protectedData.push_back(cCounter);
-                protectedData.insert(protectedData.end(),
-                                     unprotectedData.begin(),
-                                     unprotectedData.end());
-
-                const uint8_t cCrc{calculateCrc(protectedData)};
-
-                // Prepend CRC (single O(n) shift instead of two)
-                protectedData.insert(protectedData.begin(), cCrc);
+                buffer[1] = static_cast<uint8_t>((mCheckingCounter & 0x0f) | cCounterMask);
+                buffer[0] = calculateCrc(buffer + 1, size - 1);
 
                 // Keep protect/forward sequence aligned when both are used.
                 mProtectingCounter = static_cast<uint8_t>(mCheckingCounter & 0x0f);
@@ -132,20 +79,21 @@ namespace ara
             }
 
             CheckStatusType Profile11::Check(
-                const std::vector<uint8_t> &protectedData)
+                const std::uint8_t *protectedData, std::size_t size)
             {
                 const std::size_t cMinimumSize{3};
                 const std::size_t cCrcOffset{0};
                 const std::size_t cCounterOffset{1};
                 const uint8_t cCounterMask{0x0f};
 
-                if (protectedData.size() < cMinimumSize)
+                if (protectedData == nullptr || size < cMinimumSize)
                 {
                     return CheckStatusType::kNoNewData;
                 }
 
                 const uint8_t cReceivedCrc{protectedData[cCrcOffset]};
-                const uint8_t cComputedCrc{calculateCrc(protectedData, cCrcOffset + 1)};
+                const uint8_t cComputedCrc{calculateCrc(
+                    protectedData + cCrcOffset + 1, size - cCrcOffset - 1)};
 
                 if (cReceivedCrc != cComputedCrc)
                 {
@@ -5,8 +5,6 @@
 #ifndef PROFILE11_H
 #define PROFILE11_H
 
-#include <array>
-#include <atomic>
 #include "./profile.h"
 
 namespace ara
@@ -16,36 +14,34 @@ namespace ara
         namespace e2e
         {
             /// @brief E2E Profile11 variant A implementation
-            /// @remarks The CRC calculation is based on CRC table without any hardware acceleration.
+            /// @remarks The CRC calculation is delegated to the shared E2E CRC engine.
             class Profile11 : public Profile
             {
             private:
-                static constexpr std::size_t cTableSize{256};
-                static volatile std::atomic_bool mCrcTableInitialized;
-                static std::array<uint8_t, cTableSize> mCrcTable;
-
+                static constexpr std::size_t cHeaderLength{2};
                 const uint8_t cCounterMax{0x0e};
 
                 uint8_t mProtectingCounter;
                 uint8_t mCheckingCounter;
 
-                static void initializeCrcTable(uint8_t crcPoly) noexcept;
                 static uint8_t calculateCrc(
-                    const std::vector<uint8_t> &data, std::size_t offset = 0);
+                    const uint8_t *data, std::size_t size) noexcept;
 
             public:
                 Profile11() noexcept;
 
-                bool TryProtect(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                std::size_t HeaderLength() const noexcept override;
+
+                bool TryProtectInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
+
+                bool TryForwardInPlace(
+                    std::uint8_t *buffer, std::size_t size) override;
 
-                bool TryForward(
-                    const std::vector<uint8_t> &unprotectedData,
-                    std::vector<uint8_t> &protectedData) override;
+                using Profile::Check;
 
                 CheckStatusType Check(
-                    const std::vector<uint8_t> &protectedData) override;
+                    const std::uint8_t *protectedData, std::size_t size) override;
             };
         }
     }
@@ -5,15 +5,19 @@
 #ifndef ARA_COM_EVENT_H
 #define ARA_COM_EVENT_H
 
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include "./types.h"
 #include "./qos.h"
 #include "./sample_ptr.h"
 #include "./serialization.h"
 #include "./internal/event_binding.h"
+#include "./internal/sample_filter.h"
+#include "./internal/sample_pool.h"
 #include "../core/result.h"
 
 namespace ara
@@ -31,7 +35,86 @@ namespace ara
             EventCacheUpdatePolicy mCachePolicy{
                 EventCacheUpdatePolicy::kLastN};
             FilterConfig mFilter{};
-            std::uint32_t mDecimationCounter{0U};
+            internal::SampleFilter mSampleFilter;
+            bool mBindingFilters{false};
+            typename internal::SamplePool<T>::Handle mSamplePool;
+
+            /// @brief Apply the subscription filter to a serialized sample,
+            ///        unless the binding already filtered it on receipt.
+            bool acceptSample(const std::uint8_t *data, std::size_t size) noexcept
+            {
+                return mBindingFilters || mSampleFilter.Accept(data, size);
+            }
+
+            /// @brief Wrap a deserialized value, preferring a pooled slot.
+            SamplePtr<T> makeSample(T &&value)
+            {
+                if (mSamplePool)
+                {
+                    return mSamplePool->Emplace(std::move(value));
+                }
+                return SamplePtr<T>{
+                    std::unique_ptr<const T>{new T(std::move(value))}};
+            }
+
+            /// @brief Zero-copy delivery of trivially copyable samples that
+            ///        stay in transport memory until the SamplePtr is dropped.
+            template <typename F>
+            core::Result<std::size_t> getNewLoanedSamples(
+                F &f,
+                std::size_t maxNumberOfSamples)
+            {
+                bool hasDeserializationError{false};
+
+                auto receiveResult = mBinding->GetNewLoanedSamples(
+                    [this, &f, &hasDeserializationError](
+                        const std::uint8_t *data,
+                        std::size_t size,
+                        SampleReleaser releaser)
+                    {
+                        if (size < sizeof(T))
+                        {
+                            releaser.Release(releaser.Context, data);
+                            hasDeserializationError = true;
+                            return;
+                        }
+
+                        if (!acceptSample(data, size))
+                        {
+                            releaser.Release(releaser.Context, data);
+                            return;
+                        }
+
+                        if (reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0U)
+                        {
+                            // Misaligned chunk: fall back to one pooled copy.
+                            auto deserResult =
+                                Serializer<T>::Deserialize(data, size);
+                            releaser.Release(releaser.Context, data);
+                            if (deserResult.HasValue())
+                            {
+                                f(makeSample(std::move(deserResult).Value()));
+                            }
+                            else
+                            {
+                                hasDeserializationError = true;
+                            }
+                            return;
+                        }
+
+                        f(SamplePtr<T>{
+                            reinterpret_cast<const T *>(data), releaser});
+                    },
+                    maxNumberOfSamples);
+
+                if (receiveResult.HasValue() && hasDeserializationError)
+                {
+                    return core::Result<std::size_t>::FromError(
+                        MakeErrorCode(ComErrc::kSerializationError));
+                }
+
+                return receiveResult;
+            }
 
         public:
             /// @brief Construct from a binding implementation
@@ -56,6 +139,7 @@ namespace ara
             {
                 if (mBinding)
                 {
+                    mSamplePool = internal::SamplePool<T>::Create(maxSampleCount);
                     mBinding->Subscribe(maxSampleCount);
                 }
             }
@@ -77,17 +161,26 @@ namespace ara
                            const FilterConfig &filter)
             {
                 mFilter = filter;
-                mDecimationCounter = 0U;
+                mSampleFilter.Configure(filter);
+                mBindingFilters =
+                    mBinding && mBinding->SetSampleFilter(filter);
                 Subscribe(maxSampleCount);
             }
 
             /// @brief Subscribe with QoS profile (SWS_CM_00920).
             /// @param maxSampleCount Maximum number of samples to buffer.
             /// @param qos Quality of Service profile for this subscription.
+            /// @note The binding enforces the profile: CycloneDDS maps it to
+            ///       native reader QoS, iceoryx to its queue capacity and
+            ///       history, SOME/IP to a local deadline monitor and
+            ///       MinSeparation rate limiter.
             void Subscribe(std::size_t maxSampleCount,
                            const EventQosProfile &qos)
             {
-                (void)qos;
+                if (mBinding)
+                {
+                    mBinding->SetQosProfile(qos);
+                }
                 Subscribe(maxSampleCount);
             }
 
@@ -130,6 +223,12 @@ namespace ara
                         MakeErrorCode(ComErrc::kServiceNotAvailable));
                 }
 
+                if (std::is_trivially_copyable<T>::value &&
+                    mBinding->SupportsSampleLoans())
+                {
+                    return getNewLoanedSamples(f, maxNumberOfSamples);
+                }
+
                 bool hasDeserializationError{false};
 
                 auto receiveResult = mBinding->GetNewSamples(
@@ -137,23 +236,18 @@ namespace ara
                         const std::uint8_t *data,
                         std::size_t size)
                     {
+                        // Filter on raw bytes so rejected samples are
+                        // never deserialized.
+                        if (!acceptSample(data, size))
+                        {
+                            return;
+                        }
+
                         auto deserResult =
                             Serializer<T>::Deserialize(data, size);
                         if (deserResult.HasValue())
                         {
-                            if (mFilter.Type == FilterType::kOneEveryN)
-                            {
-                                ++mDecimationCounter;
-                                if (mDecimationCounter < mFilter.DecimationFactor)
-                                {
-                                    return;
-                                }
-                                mDecimationCounter = 0U;
-                            }
-
-                            auto sample = std::make_unique<const T>(
-                                std::move(deserResult).Value());
-                            f(SamplePtr<T>{std::move(sample)});
+                            f(makeSample(std::move(deserResult).Value()));
                         }
                         else if (!hasDeserializationError)
                         {
@@ -233,6 +327,27 @@ namespace ara
                 }
             }
 
+            /// @brief Set handler for QoS deadline misses
+            /// @param handler Callback invoked from the binding's monitor
+            ///        thread whenever no sample arrived within the Deadline
+            ///        of the subscribed EventQosProfile.
+            void SetDeadlineMissedHandler(DeadlineMissedHandler handler)
+            {
+                if (mBinding)
+                {
+                    mBinding->SetDeadlineMissedHandler(std::move(handler));
+                }
+            }
+
+            /// @brief Remove deadline-missed handler
+            void UnsetDeadlineMissedHandler()
+            {
+                if (mBinding)
+                {
+                    mBinding->UnsetDeadlineMissedHandler();
+                }
+            }
+
             /// @brief Number of free sample slots available
             /// @returns Remaining free sample capacity in receive queue.
             std::size_t GetFreeSampleCount() const noexcept
@@ -305,7 +420,7 @@ namespace ara
                         MakeErrorCode(ComErrc::kServiceNotOffered));
                 }
 
-                auto allocResult = mBinding->Allocate(sizeof(T));
+                auto allocResult = mBinding->AllocateAligned(sizeof(T), alignof(T));
                 if (!allocResult.HasValue())
                 {
                     return core::Result<SampleAllocateePtr<T>>::FromError(
@@ -319,8 +434,8 @@ namespace ara
                 auto deleter = [binding](T *ptr)
                 {
                     ptr->~T();
-                    // Note: if SendAllocated is not called, we need to free
-                    std::free(ptr);
+                    // Not sent: hand the buffer back to the binding that allocated it
+                    binding->Deallocate(ptr);
                 };
 
                 return core::Result<SampleAllocateePtr<T>>::FromValue(
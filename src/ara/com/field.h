@@ -345,7 +345,7 @@ namespace ara
 
                 return mGetBinding->Register(
                     [h = std::move(handler)](
-                        const std::vector<std::uint8_t> & /*request*/)
+                        core::Span<const std::uint8_t> /*request*/)
                         -> core::Result<std::vector<std::uint8_t>>
                     {
                         auto future = h();
@@ -383,7 +383,7 @@ namespace ara
 
                 return mSetBinding->Register(
                     [h = std::move(handler), this](
-                        const std::vector<std::uint8_t> &request)
+                        core::Span<const std::uint8_t> request)
                         -> core::Result<std::vector<std::uint8_t>>
                     {
                         auto deserResult = Serializer<T>::Deserialize(
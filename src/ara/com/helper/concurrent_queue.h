@@ -1,15 +1,38 @@
 /// @file src/ara/com/helper/concurrent_queue.h
 /// @brief Declarations for concurrent queue.
-/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+/// @details Bounded multi-producer/multi-consumer ring after D. Vyukov: every
+///          cell carries a sequence number that tells producers and consumers
+///          whether it is free or filled for their lap, so a slot is claimed
+///          with a single compare-and-swap on the head or tail index and no
+///          lock is ever taken on the fast path. The Try* calls therefore only
+///          fail when the ring is really full or empty.
+///
+///          Blocking and timed calls park on a condition variable that is only
+///          signalled while someone is parked and, for consumers, only when
+///          the queue turns non-empty, so the producers of a burst do not
+///          take the wait mutex one after another. On Linux an eventfd can be
+///          requested so that a poller-driven consumer sleeps until data
+///          arrives instead of spinning.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
 
 #ifndef CONCURRENT_QUEUE_H
 #define CONCURRENT_QUEUE_H
 
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
-#include <queue>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <atomic>
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
 
 namespace ara
 {
@@ -17,121 +40,469 @@ namespace ara
     {
         namespace helper
         {
-            /// @brief Thread-safe wrapper around STL queue using locking mechanism
+            /// @brief Thread-safe bounded lock-free MPMC queue
             /// @tparam T Queue element type
             template <typename T>
             class ConcurrentQueue
             {
+            public:
+                /// @brief Capacity of a default-constructed queue
+                static constexpr std::size_t cDefaultCapacity{1024U};
+
             private:
-                std::mutex mMutex;
-                std::condition_variable mCV;
-                std::queue<T> mQueue;
-                std::atomic_size_t mSize;
+                static constexpr std::size_t cCacheLineSize{64U};
+
+                struct Cell
+                {
+                    std::atomic_size_t Sequence;
+                    typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+                };
+
+                using Clock = std::chrono::steady_clock;
+
+                std::vector<Cell> mCells;
+                const std::size_t mMask;
+                // The indices are written by different threads, so keep each on
+                // its own cache line.
+                char mPadding0[cCacheLineSize];
+                std::atomic_size_t mEnqueuePosition;
+                char mPadding1[cCacheLineSize];
+                std::atomic_size_t mDequeuePosition;
+                char mPadding2[cCacheLineSize];
+
+                std::mutex mWaitMutex;
+                std::condition_variable mNotEmpty;
+                std::condition_variable mNotFull;
+                std::atomic_size_t mWaitingConsumers;
+                std::atomic_size_t mWaitingProducers;
+                std::atomic_bool mClosed;
+                std::atomic_int mEventFd;
+                std::once_flag mEventFdFlag;
+
+                static std::size_t roundCapacity(std::size_t capacity) noexcept
+                {
+                    std::size_t _result{2U};
+                    while (_result < capacity)
+                    {
+                        _result <<= 1U;
+                    }
+                    return _result;
+                }
+
+                bool hasElement() const noexcept
+                {
+                    const std::size_t cPosition{
+                        mDequeuePosition.load(std::memory_order_relaxed)};
+                    const Cell &_cell{mCells[cPosition & mMask]};
+                    return _cell.Sequence.load(std::memory_order_acquire) == cPosition + 1U;
+                }
+
+                bool hasSpace() const noexcept
+                {
+                    const std::size_t cPosition{
+                        mEnqueuePosition.load(std::memory_order_relaxed)};
+                    const Cell &_cell{mCells[cPosition & mMask]};
+                    return _cell.Sequence.load(std::memory_order_acquire) == cPosition;
+                }
+
+                void wake(
+                    const std::atomic_size_t &waiters,
+                    std::condition_variable &condition)
+                {
+                    // Pairs with the fence in waitUntil: either the waiter sees
+                    // the new state, or the waiter count is seen here.
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (waiters.load(std::memory_order_relaxed) > 0U)
+                    {
+                        {
+                            std::lock_guard<std::mutex> _lock(mWaitMutex);
+                        }
+                        condition.notify_one();
+                    }
+                }
+
+                void signalEventFd() noexcept
+                {
+#if defined(__linux__)
+                    const int cEventFd{mEventFd.load(std::memory_order_acquire)};
+                    if (cEventFd >= 0)
+                    {
+                        const std::uint64_t cIncrement{1U};
+                        ssize_t _written{::write(cEventFd, &cIncrement, sizeof(cIncrement))};
+                        static_cast<void>(_written);
+                    }
+#endif
+                }
+
+                template <typename U>
+                bool tryEmplace(U &&element)
+                {
+                    Cell *_cell;
+                    std::size_t _position{
+                        mEnqueuePosition.load(std::memory_order_relaxed)};
+                    for (;;)
+                    {
+                        _cell = &mCells[_position & mMask];
+                        const std::size_t cSequence{
+                            _cell->Sequence.load(std::memory_order_acquire)};
+                        const std::ptrdiff_t cDifference{
+                            static_cast<std::ptrdiff_t>(cSequence - _position)};
+                        if (cDifference == 0)
+                        {
+                            if (mEnqueuePosition.compare_exchange_weak(
+                                    _position, _position + 1U, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                        }
+                        else if (cDifference < 0)
+                        {
+                            // The cell still holds the element of the last lap.
+                            return false;
+                        }
+                        else
+                        {
+                            _position = mEnqueuePosition.load(std::memory_order_relaxed);
+                        }
+                    }
+
+                    new (&_cell->Storage) T(std::forward<U>(element));
+                    _cell->Sequence.store(_position + 1U, std::memory_order_release);
+
+                    // A parked consumer saw the queue empty, so only the
+                    // element at the head needs to wake it; later elements
+                    // of a burst leave the wait mutex alone.
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (mDequeuePosition.load(std::memory_order_relaxed) == _position)
+                    {
+                        wake(mWaitingConsumers, mNotEmpty);
+                    }
+                    signalEventFd();
+                    return true;
+                }
+
+                // Park until the predicate holds, the queue is closed or the
+                // deadline passes; returns false only on the latter two.
+                template <typename Predicate>
+                bool waitUntil(
+                    std::atomic_size_t &waiters,
+                    std::condition_variable &condition,
+                    Predicate ready,
+                    const Clock::time_point *deadline)
+                {
+                    std::unique_lock<std::mutex> _lock(mWaitMutex);
+                    waiters.fetch_add(1U, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                    bool _result{true};
+                    while (!ready())
+                    {
+                        if (mClosed.load(std::memory_order_acquire))
+                        {
+                            _result = false;
+                            break;
+                        }
+
+                        if (deadline == nullptr)
+                        {
+                            condition.wait(_lock);
+                        }
+                        else if (condition.wait_until(_lock, *deadline) ==
+                                 std::cv_status::timeout)
+                        {
+                            _result = ready();
+                            break;
+                        }
+                    }
+
+                    waiters.fetch_sub(1U, std::memory_order_relaxed);
+                    return _result;
+                }
+
+                template <typename U>
+                bool enqueue(U &&element, const Clock::time_point *deadline)
+                {
+                    for (;;)
+                    {
+                        if (mClosed.load(std::memory_order_acquire))
+                        {
+                            return false;
+                        }
+                        if (tryEmplace(std::forward<U>(element)))
+                        {
+                            return true;
+                        }
+                        if (!waitUntil(
+                                mWaitingProducers,
+                                mNotFull,
+                                [this] { return hasSpace(); },
+                                deadline))
+                        {
+                            return !mClosed.load(std::memory_order_acquire) &&
+                                   tryEmplace(std::forward<U>(element));
+                        }
+                    }
+                }
+
+                bool dequeue(T &element, const Clock::time_point *deadline)
+                {
+                    for (;;)
+                    {
+                        if (TryDequeue(element))
+                        {
+                            return true;
+                        }
+                        if (!waitUntil(
+                                mWaitingConsumers,
+                                mNotEmpty,
+                                [this] { return hasElement(); },
+                                deadline))
+                        {
+                            // Drain what is left after closing.
+                            return TryDequeue(element);
+                        }
+                    }
+                }
 
             public:
-                ConcurrentQueue() : mSize{0}
+                /// @brief Constructor
+                /// @param capacity Maximum number of queued elements, rounded up
+                ///        to a power of two
+                explicit ConcurrentQueue(std::size_t capacity = cDefaultCapacity)
+                    : mCells(roundCapacity(capacity)),
+                      mMask{mCells.size() - 1U},
+                      mEnqueuePosition{0U},
+                      mDequeuePosition{0U},
+                      mWaitingConsumers{0U},
+                      mWaitingProducers{0U},
+                      mClosed{false},
+                      mEventFd{-1}
                 {
+                    for (std::size_t i = 0U; i < mCells.size(); ++i)
+                    {
+                        mCells[i].Sequence.store(i, std::memory_order_relaxed);
+                    }
                 }
 
-                ~ConcurrentQueue() = default;
+                ~ConcurrentQueue() noexcept
+                {
+                    const std::size_t cEnd{mEnqueuePosition.load()};
+                    for (std::size_t _position = mDequeuePosition.load();
+                         _position != cEnd;
+                         ++_position)
+                    {
+                        Cell &_cell{mCells[_position & mMask]};
+                        if (_cell.Sequence.load() == _position + 1U)
+                        {
+                            reinterpret_cast<T *>(&_cell.Storage)->~T();
+                        }
+                    }
+
+#if defined(__linux__)
+                    const int cEventFd{mEventFd.load()};
+                    if (cEventFd >= 0)
+                    {
+                        ::close(cEventFd);
+                    }
+#endif
+                }
+
+                ConcurrentQueue(const ConcurrentQueue &) = delete;
+                ConcurrentQueue &operator=(const ConcurrentQueue &) = delete;
+
+                /// @brief Maximum number of queued elements
+                std::size_t Capacity() const noexcept
+                {
+                    return mCells.size();
+                }
 
                 /// @brief Indicate whether the queue is empty or not
                 /// @returns True if the queue is empty, otherwise false
+                /// @note An element whose enqueuing is still in progress counts
+                ///       as not yet queued.
                 bool Empty() const noexcept
                 {
-                    return mSize == 0;
+                    return !hasElement();
                 }
 
                 /// @brief Try to insert an element to the queue via moving
                 /// @param[in] element Element to be moved into the queue
-                /// @return True if the element is moved to the queue successfully, otherwise false
+                /// @return True if the element is moved to the queue successfully,
+                ///         false if the queue is full
                 /// @note The insertion is based on move constructor emplacement rather than pushing.
                 bool TryEnqueue(T &&element)
                 {
-                    std::unique_lock<std::mutex> _lock(mMutex, std::defer_lock);
-                    if (_lock.try_lock())
-                    {
-                        mQueue.emplace(std::move(element));
-                        ++mSize;
-                        _lock.unlock();
-                        mCV.notify_one();
-                        return true;
-                    }
-                    else
-                    {
-                        return false;
-                    }
+                    return tryEmplace(std::move(element));
                 }
 
                 /// @brief Try to insert an element to the queue via copying
-                /// @param[in] element Element to be moved into the queue
-                /// @return True if the element is moved to the queue successfully, otherwise false
-                /// @note The insertion is based on move constructor emplacement rather than pushing.
+                /// @param[in] element Element to be copied into the queue
+                /// @return True if the element is copied to the queue successfully,
+                ///         false if the queue is full
                 bool TryEnqueue(const T &element)
                 {
-                    std::unique_lock<std::mutex> _lock(mMutex, std::defer_lock);
-                    if (_lock.try_lock())
-                    {
-                        mQueue.emplace(element);
-                        ++mSize;
-                        _lock.unlock();
-                        mCV.notify_one();
-                        return true;
-                    }
-                    else
-                    {
-                        return false;
-                    }
+                    return tryEmplace(element);
+                }
+
+                /// @brief Insert an element, blocking while the queue is full
+                /// @param[in] element Element to be moved into the queue
+                /// @returns False if the queue is closed
+                bool Enqueue(T &&element)
+                {
+                    return enqueue(std::move(element), nullptr);
+                }
+
+                /// @brief Insert an element, blocking while the queue is full
+                /// @param[in] element Element to be copied into the queue
+                /// @returns False if the queue is closed
+                bool Enqueue(const T &element)
+                {
+                    return enqueue(element, nullptr);
+                }
+
+                /// @brief Insert an element, blocking at most until a timeout
+                /// @param[in] element Element to be moved into the queue
+                /// @param[in] timeout Maximum duration to wait for space
+                /// @returns False on timeout or if the queue is closed; the
+                ///          element is then left untouched
+                template <typename Rep, typename Period>
+                bool WaitEnqueue(
+                    T &&element,
+                    const std::chrono::duration<Rep, Period> &timeout)
+                {
+                    const Clock::time_point cDeadline{
+                        Clock::now() +
+                        std::chrono::duration_cast<Clock::duration>(timeout)};
+                    return enqueue(std::move(element), &cDeadline);
                 }
 
                 /// @brief Try to peek an element from the queue by removing it
                 /// @param[out] element Element that is moved out from the queue
-                /// @returns True if the element is dequeued successfully, otherwise false
+                /// @returns True if the element is dequeued successfully,
+                ///          false if the queue is empty
                 bool TryDequeue(T &element)
                 {
-                    std::unique_lock<std::mutex> _lock(mMutex, std::defer_lock);
-                    if (_lock.try_lock())
+                    Cell *_cell;
+                    std::size_t _position{
+                        mDequeuePosition.load(std::memory_order_relaxed)};
+                    for (;;)
                     {
-                        if (mQueue.empty())
+                        _cell = &mCells[_position & mMask];
+                        const std::size_t cSequence{
+                            _cell->Sequence.load(std::memory_order_acquire)};
+                        const std::ptrdiff_t cDifference{
+                            static_cast<std::ptrdiff_t>(cSequence - (_position + 1U))};
+                        if (cDifference == 0)
+                        {
+                            if (mDequeuePosition.compare_exchange_weak(
+                                    _position, _position + 1U, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                        }
+                        else if (cDifference < 0)
                         {
-                            _lock.unlock();
                             return false;
                         }
-                        element = std::move(mQueue.front());
-                        mQueue.pop();
-                        --mSize;
-                        _lock.unlock();
-                        return true;
+                        else
+                        {
+                            _position = mDequeuePosition.load(std::memory_order_relaxed);
+                        }
                     }
-                    else
+
+                    T *_stored{reinterpret_cast<T *>(&_cell->Storage)};
+                    element = std::move(*_stored);
+                    _stored->~T();
+                    // Hand the cell over to the producer of the next lap.
+                    _cell->Sequence.store(_position + mMask + 1U, std::memory_order_release);
+
+                    wake(mWaitingProducers, mNotFull);
+                    // Producers only wake one consumer per empty queue, so
+                    // pass the wake-up on while elements are left; the fence
+                    // in the wake above orders this check after the claim.
+                    if (hasElement())
                     {
-                        return false;
+                        wake(mWaitingConsumers, mNotEmpty);
                     }
+                    return true;
+                }
+
+                /// @brief Remove an element, blocking while the queue is empty
+                /// @param[out] element Element that is moved out from the queue
+                /// @returns False if the queue is closed and drained
+                bool Dequeue(T &element)
+                {
+                    return dequeue(element, nullptr);
                 }
 
                 /// @brief Block until an element is available or timeout expires
                 /// @param[out] element Element that is moved out from the queue
                 /// @param[in] timeout Maximum duration to wait
                 /// @returns True if an element was dequeued, false on timeout
+                ///          or if the queue is closed and drained
                 template <typename Rep, typename Period>
                 bool WaitDequeue(
                     T &element,
                     const std::chrono::duration<Rep, Period> &timeout)
                 {
-                    std::unique_lock<std::mutex> lock(mMutex);
-                    if (!mCV.wait_for(lock, timeout,
-                            [this] { return !mQueue.empty(); }))
+                    const Clock::time_point cDeadline{
+                        Clock::now() +
+                        std::chrono::duration_cast<Clock::duration>(timeout)};
+                    return dequeue(element, &cDeadline);
+                }
+
+                /// @brief Release all blocked callers and refuse new elements
+                /// @note Queued elements can still be dequeued.
+                void Close()
+                {
+                    mClosed.store(true, std::memory_order_release);
                     {
-                        return false;
+                        std::lock_guard<std::mutex> _lock(mWaitMutex);
                     }
-                    element = std::move(mQueue.front());
-                    mQueue.pop();
-                    --mSize;
-                    return true;
+                    mNotEmpty.notify_all();
+                    mNotFull.notify_all();
+                    signalEventFd();
+                }
+
+                /// @brief Indicate whether the queue is closed
+                bool IsClosed() const noexcept
+                {
+                    return mClosed.load(std::memory_order_acquire);
+                }
+
+                /// @brief Get a descriptor that becomes readable on enqueuing
+                /// @details The descriptor is an eventfd created on the first
+                ///          call; every later enqueue adds one to its counter.
+                ///          A consumer reads it to reset the counter and then
+                ///          drains the queue with TryDequeue().
+                /// @returns Non-blocking eventfd, or -1 if unsupported
+                int WakeupDescriptor()
+                {
+#if defined(__linux__)
+                    std::call_once(
+                        mEventFdFlag,
+                        [this]
+                        {
+                            mEventFd.store(
+                                ::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC),
+                                std::memory_order_release);
+                        });
+                    // Elements queued before the descriptor existed.
+                    if (hasElement())
+                    {
+                        signalEventFd();
+                    }
+                    return mEventFd.load(std::memory_order_acquire);
+#else
+                    return -1;
+#endif
                 }
             };
+
+            template <typename T>
+            constexpr std::size_t ConcurrentQueue<T>::cDefaultCapacity;
         }
     }
 }
 
-#endif
\ No newline at end of file
+#endif
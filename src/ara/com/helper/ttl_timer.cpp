@@ -3,6 +3,7 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include <chrono>
+#include <utility>
 #include "./ttl_timer.h"
 
 namespace ara
@@ -11,91 +12,145 @@ namespace ara
     {
         namespace helper
         {
-            TtlTimer::TtlTimer() noexcept : mLock(mMutex, std::defer_lock),
-                                            mRequested{false},
-                                            mDisposing{false},
-                                            mTtl{0}
+            TtlTimer::TtlTimer() noexcept : TtlTimer(core::TimerWheel::Instance())
             {
             }
 
+            TtlTimer::TtlTimer(core::TimerWheel &wheel) noexcept : mWheel{wheel},
+                                                                   mState{std::make_shared<State>()},
+                                                                   mRequested{false},
+                                                                   mExpiryTimer{0}
+            {
+            }
+
+            std::vector<TtlTimer::Listener> TtlTimer::getListeners(const State &state)
+            {
+                std::vector<Listener> _result;
+                if (!state.Disposing)
+                {
+                    _result.reserve(state.Listeners.size());
+                    for (const auto &listener : state.Listeners)
+                    {
+                        _result.push_back(listener.second);
+                    }
+                }
+
+                return _result;
+            }
+
+            void TtlTimer::notify(const std::vector<Listener> &listeners)
+            {
+                for (const Listener &listener : listeners)
+                {
+                    listener();
+                }
+            }
+
             bool TtlTimer::GetRequested() const noexcept
             {
                 return mRequested;
             }
 
-            void TtlTimer::SetRequested(bool requested) noexcept
+            void TtlTimer::SetRequested(bool requested)
             {
                 mRequested = requested;
-                mSignalFlag = true;
-                mConditionVariable.notify_one();
+                std::vector<Listener> _listeners;
+                {
+                    std::lock_guard<std::mutex> _lock(mState->Mutex);
+                    _listeners = getListeners(*mState);
+                }
+                notify(_listeners);
             }
 
             bool TtlTimer::GetOffered() const noexcept
             {
-                return mTtl > 0;
-            }
-
-            void TtlTimer::SetOffered(uint32_t ttl) noexcept
-            {
-                mTtl = ttl;
-                mSignalFlag = true;
-                mConditionVariable.notify_one();
+                return mState->Ttl > 0;
             }
 
-            void TtlTimer::WaitForSignal()
+            void TtlTimer::SetOffered(uint32_t ttl)
             {
-                // If disposing, return immediately
-                if (mDisposing)
+                std::unique_lock<std::mutex> _lock(mState->Mutex);
+                if (mExpiryTimer != 0)
                 {
-                    return;
+                    mWheel.Cancel(mExpiryTimer);
+                    mExpiryTimer = 0;
                 }
-                else
+
+                // A stale expiry that was already dispatched is recognised by
+                // its generation and ignored.
+                const uint64_t cGeneration{++mState->Generation};
+                mState->Ttl = ttl;
+
+                if (ttl > 0)
                 {
-                    mLock.lock();
-                    mConditionVariable.wait(mLock, [this]{ return mSignalFlag.load(); });
-                    mSignalFlag = false;
-                    mLock.unlock();
+                    std::weak_ptr<State> _weakState{mState};
+                    mExpiryTimer = mWheel.Schedule(
+                        std::chrono::seconds(ttl),
+                        [_weakState, cGeneration]()
+                        {
+                            std::shared_ptr<State> _state{_weakState.lock()};
+                            if (!_state)
+                            {
+                                return;
+                            }
+
+                            std::vector<Listener> _listeners;
+                            {
+                                std::lock_guard<std::mutex> _expiryLock(_state->Mutex);
+                                if (_state->Generation != cGeneration)
+                                {
+                                    return;
+                                }
+
+                                _state->Ttl = 0;
+                                _listeners = getListeners(*_state);
+                            }
+                            // Runs on a wheel worker, so the listeners only
+                            // react to the expiry and never wait here.
+                            notify(_listeners);
+                        });
                 }
+
+                std::vector<Listener> _listeners{getListeners(*mState)};
+                _lock.unlock();
+                notify(_listeners);
             }
 
-            bool TtlTimer::WaitForExpiration()
+            TtlTimer::ListenerId TtlTimer::Subscribe(Listener listener)
             {
-                // If disposing, return timeout immediately
-                if (mTtl == 0 || mDisposing)
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                if (mState->Disposing)
                 {
-                    return true;
-                }
-                else
-                {
-                    mLock.lock();
-                    std::cv_status _status =
-                        mConditionVariable.wait_for(
-                            mLock, std::chrono::seconds(mTtl));
-                    mSignalFlag = false;
-                    mLock.unlock();
-
-                    // Due to the TTL delay above, re-check the TTL and disposing values
-                    if (_status == std::cv_status::timeout || mTtl == 0 || mDisposing)
-                    {
-                        return true;
-                    }
-                    else
-                    {
-                        return false;
-                    }
+                    return 0;
                 }
+
+                const ListenerId cId{mState->NextListenerId++};
+                mState->Listeners.emplace(cId, std::move(listener));
+                return cId;
+            }
+
+            void TtlTimer::Unsubscribe(ListenerId id) noexcept
+            {
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                mState->Listeners.erase(id);
             }
 
             void TtlTimer::Dispose() noexcept
             {
-                mDisposing = true;
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                mState->Disposing = true;
+                mState->Listeners.clear();
             }
 
             TtlTimer::~TtlTimer() noexcept
             {
                 Dispose();
-                mConditionVariable.notify_one();
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                if (mExpiryTimer != 0)
+                {
+                    mWheel.Cancel(mExpiryTimer);
+                }
             }
         }
     }
-}
\ No newline at end of file
+}
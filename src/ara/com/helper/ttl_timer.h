@@ -6,8 +6,12 @@
 #define TTL_TIMER_H
 
 #include <mutex>
-#include <condition_variable>
 #include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+#include "../../core/timer_wheel.h"
 
 namespace ara
 {
@@ -16,20 +20,53 @@ namespace ara
         namespace helper
         {
             /// @brief Time To Live countdown timer
+            /// @details The TTL runs on a shared timer wheel instead of a
+            ///          timed wait, so an offered service does not tie up a
+            ///          thread until its TTL elapses. Instead of blocking on
+            ///          the timer, a client state subscribes a listener that
+            ///          is called on every change of the requested or offered
+            ///          status, including the TTL expiry.
             /// @note The timer is not copyable.
             class TtlTimer
             {
+            public:
+                /// @brief Callback on a status change or the TTL expiry
+                /// @note A listener may run on a timer wheel worker and must not block.
+                using Listener = std::function<void()>;
+
+                /// @brief Subscription handle, never zero
+                using ListenerId = uint64_t;
+
             private:
-                std::mutex mMutex;
-                std::unique_lock<std::mutex> mLock;
-                std::condition_variable mConditionVariable;
-                bool mRequested;
-                bool mDisposing;
-                std::atomic_bool mSignalFlag;
-                uint32_t mTtl;
+                // Shared with the pending wheel timer, which may outlive this
+                // object until it is dispatched.
+                struct State
+                {
+                    std::mutex Mutex;
+                    std::map<ListenerId, Listener> Listeners;
+                    ListenerId NextListenerId{1};
+                    bool Disposing{false};
+                    std::atomic<uint32_t> Ttl{0};
+                    uint64_t Generation{0};
+                };
+
+                core::TimerWheel &mWheel;
+                std::shared_ptr<State> mState;
+                std::atomic_bool mRequested;
+                core::TimerWheel::TimerId mExpiryTimer;
+
+                // Copied under the lock so that the listeners run unlocked.
+                static std::vector<Listener> getListeners(const State &state);
+                static void notify(const std::vector<Listener> &listeners);
 
             public:
+                /// @brief Constructor using the process-wide timer wheel
                 TtlTimer() noexcept;
+
+                /// @brief Constructor
+                /// @param wheel Timer wheel that counts the TTL down
+                explicit TtlTimer(core::TimerWheel &wheel) noexcept;
+
                 TtlTimer(const TtlTimer &) = delete;
                 TtlTimer &operator=(const TtlTimer &) = delete;
                 ~TtlTimer() noexcept;
@@ -42,7 +79,7 @@ namespace ara
                 /// @brief Set the service requested status
                 /// @param requested Service client requested status
                 /// @see GetRequested
-                void SetRequested(bool requested) noexcept;
+                void SetRequested(bool requested);
 
                 /// @brief Indicate whether the service server is offered or not
                 /// @returns True if the service server is offered, otherwise false
@@ -50,21 +87,24 @@ namespace ara
                 bool GetOffered() const noexcept;
 
                 /// @brief Set the service offered status
-                /// @param ttl Received service offer entry TTL
+                /// @param ttl Received service offer entry TTL in seconds
                 /// @see GetOffered
-                /// @note Zero TTL indicates stop offering.
-                void SetOffered(uint32_t ttl) noexcept;
+                /// @note Zero TTL indicates stop offering. A non-zero TTL
+                ///       (re)arms the expiry on the timer wheel.
+                void SetOffered(uint32_t ttl);
 
-                /// @brief Wait for a signal from SetRequested or SetOffered
-                /// @see SetRequested(bool)
-                /// @see SetOffered(uint32_t)
-                void WaitForSignal();
+                /// @brief Subscribe to status changes and the TTL expiry
+                /// @param listener Callback invoked without any timer lock held
+                /// @returns Handle to unsubscribe with, or zero if the timer is disposed
+                /// @note A listener may still run once after Unsubscribe
+                ///       returned if it was already being notified.
+                ListenerId Subscribe(Listener listener);
 
-                /// @brief Wait for the timer to expire or reset
-                /// @returns True if the TTL is expired, otherwise false in case of timer reset
-                bool WaitForExpiration();
+                /// @brief Remove a listener
+                /// @param id Handle returned by Subscribe
+                void Unsubscribe(ListenerId id) noexcept;
 
-                /// @brief Dispose the timer which causes all the waitings return immediately
+                /// @brief Dispose the timer which drops all the listeners
                 /// @remarks The side effect of this function call is irreversible.
                 void Dispose() noexcept;
             };
@@ -72,4 +112,4 @@ namespace ara
     }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,304 @@
+/// @file src/ara/com/helper/udp_batch.cpp
+/// @brief Implementation for batched UDP datagram I/O.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include <cstring>
+#include "./udp_batch.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            const std::size_t UdpBatchSender::cDefaultBatchSize{32U};
+            const std::size_t UdpBatchSender::cDefaultSlotSize{1472U};
+
+            UdpBatchSender::UdpBatchSender(
+                int socketFd,
+                const sockaddr_in &destination,
+                std::size_t batchSize,
+                std::size_t slotSize,
+                std::chrono::milliseconds maxDelay) : mBatch{std::make_shared<Batch>()},
+                                                      mMaxDelay{maxDelay}
+            {
+                const std::size_t cBatchSize{std::max<std::size_t>(1U, batchSize)};
+                mBatch->SocketFd = socketFd;
+                mBatch->Destination = destination;
+                mBatch->SlotSize = std::max<std::size_t>(1U, slotSize);
+                mBatch->Slab.resize(cBatchSize * mBatch->SlotSize);
+                mBatch->Vectors.resize(cBatchSize);
+                for (std::size_t i = 0U; i < cBatchSize; ++i)
+                {
+                    mBatch->Vectors[i].iov_base = &mBatch->Slab[i * mBatch->SlotSize];
+                    mBatch->Vectors[i].iov_len = 0U;
+                }
+
+#if defined(__linux__)
+                // The headers only ever change in their iovec length.
+                mBatch->Headers.resize(cBatchSize);
+                for (std::size_t i = 0U; i < cBatchSize; ++i)
+                {
+                    msghdr &_header{mBatch->Headers[i].msg_hdr};
+                    std::memset(&mBatch->Headers[i], 0, sizeof(mmsghdr));
+                    _header.msg_name = &mBatch->Destination;
+                    _header.msg_namelen = sizeof(sockaddr_in);
+                    _header.msg_iov = &mBatch->Vectors[i];
+                    _header.msg_iovlen = 1U;
+                }
+#endif
+            }
+
+            UdpBatchSender::~UdpBatchSender() noexcept
+            {
+                std::lock_guard<std::mutex> _lock(mBatch->Mutex);
+                flush(*mBatch);
+            }
+
+            void UdpBatchSender::flush(Batch &batch)
+            {
+                batch.FlushDeadline.Cancel();
+
+                std::size_t _sent{0U};
+                while (_sent < batch.Pending)
+                {
+#if defined(__linux__)
+                    const int _result{
+                        ::sendmmsg(
+                            batch.SocketFd,
+                            &batch.Headers[_sent],
+                            static_cast<unsigned int>(batch.Pending - _sent),
+                            0)};
+                    ++batch.Statistics.Syscalls;
+                    if (_result <= 0)
+                    {
+                        break;
+                    }
+                    _sent += static_cast<std::size_t>(_result);
+#else
+                    const ssize_t _result{
+                        ::sendto(
+                            batch.SocketFd,
+                            batch.Vectors[_sent].iov_base,
+                            batch.Vectors[_sent].iov_len,
+                            0,
+                            reinterpret_cast<const sockaddr *>(&batch.Destination),
+                            sizeof(sockaddr_in))};
+                    ++batch.Statistics.Syscalls;
+                    if (_result < 0)
+                    {
+                        break;
+                    }
+                    ++_sent;
+#endif
+                }
+
+                batch.Statistics.Datagrams += _sent;
+                batch.Statistics.Dropped += batch.Pending - _sent;
+                batch.Pending = 0U;
+            }
+
+            void UdpBatchSender::sendUnbatched(
+                Batch &batch, const std::uint8_t *data, std::size_t size)
+            {
+                const ssize_t _result{
+                    ::sendto(
+                        batch.SocketFd,
+                        data,
+                        size,
+                        0,
+                        reinterpret_cast<const sockaddr *>(&batch.Destination),
+                        sizeof(sockaddr_in))};
+                ++batch.Statistics.Syscalls;
+                if (_result < 0)
+                {
+                    ++batch.Statistics.Dropped;
+                }
+                else
+                {
+                    ++batch.Statistics.Datagrams;
+                }
+            }
+
+            void UdpBatchSender::Send(const std::uint8_t *data, std::size_t size)
+            {
+                std::lock_guard<std::mutex> _lock(mBatch->Mutex);
+                Batch &_batch{*mBatch};
+
+                if (size > _batch.SlotSize)
+                {
+                    // Keep the datagram order: older staged ones go first.
+                    flush(_batch);
+                    sendUnbatched(_batch, data, size);
+                    return;
+                }
+
+                iovec &_vector{_batch.Vectors[_batch.Pending]};
+                std::memcpy(_vector.iov_base, data, size);
+                _vector.iov_len = size;
+                ++_batch.Pending;
+
+                if (_batch.Pending == _batch.Vectors.size())
+                {
+                    flush(_batch);
+                }
+                else if (_batch.Pending == 1U &&
+                         mMaxDelay > std::chrono::milliseconds::zero())
+                {
+                    Batch *const cBatch{mBatch.get()};
+                    _batch.FlushDeadline.Arm(
+                        mMaxDelay,
+                        std::shared_ptr<std::mutex>(mBatch, &mBatch->Mutex),
+                        [cBatch]() { flush(*cBatch); });
+                }
+            }
+
+            void UdpBatchSender::Flush()
+            {
+                std::lock_guard<std::mutex> _lock(mBatch->Mutex);
+                flush(*mBatch);
+            }
+
+            std::size_t UdpBatchSender::PendingCount() const
+            {
+                std::lock_guard<std::mutex> _lock(mBatch->Mutex);
+                return mBatch->Pending;
+            }
+
+            UdpBatchStatistics UdpBatchSender::GetStatistics() const
+            {
+                std::lock_guard<std::mutex> _lock(mBatch->Mutex);
+                return mBatch->Statistics;
+            }
+
+            const std::size_t UdpBatchReceiver::cDefaultBatchSize{32U};
+            const std::size_t UdpBatchReceiver::cDefaultSlotSize{1500U};
+
+            UdpBatchReceiver::UdpBatchReceiver(
+                int socketFd,
+                std::size_t batchSize,
+                std::size_t slotSize) : mSocketFd{socketFd},
+                                        mSlotSize{std::max<std::size_t>(1U, slotSize)},
+                                        mCount{0U}
+            {
+                const std::size_t cBatchSize{std::max<std::size_t>(1U, batchSize)};
+                mSlab.resize(cBatchSize * mSlotSize);
+                mVectors.resize(cBatchSize);
+                mSources.resize(cBatchSize);
+                mSlots.resize(cBatchSize, 0U);
+                mSizes.resize(cBatchSize, 0U);
+                for (std::size_t i = 0U; i < cBatchSize; ++i)
+                {
+                    mVectors[i].iov_base = &mSlab[i * mSlotSize];
+                    mVectors[i].iov_len = mSlotSize;
+                }
+
+#if defined(__linux__)
+                mHeaders.resize(cBatchSize);
+                for (std::size_t i = 0U; i < cBatchSize; ++i)
+                {
+                    std::memset(&mHeaders[i], 0, sizeof(mmsghdr));
+                    msghdr &_header{mHeaders[i].msg_hdr};
+                    _header.msg_name = &mSources[i];
+                    _header.msg_iov = &mVectors[i];
+                    _header.msg_iovlen = 1U;
+                }
+#endif
+            }
+
+            std::size_t UdpBatchReceiver::Receive(int flags)
+            {
+                mCount = 0U;
+
+#if defined(__linux__)
+                for (auto &_header : mHeaders)
+                {
+                    // The kernel overwrites the address length on return.
+                    _header.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+                }
+
+                const int _result{
+                    ::recvmmsg(
+                        mSocketFd,
+                        mHeaders.data(),
+                        static_cast<unsigned int>(mHeaders.size()),
+                        flags,
+                        nullptr)};
+                ++mStatistics.Syscalls;
+                for (int i = 0; i < _result; ++i)
+                {
+                    // A truncated datagram would reach the parser cut short.
+                    if (mHeaders[i].msg_hdr.msg_flags & MSG_TRUNC)
+                    {
+                        ++mStatistics.Truncated;
+                        continue;
+                    }
+
+                    mSlots[mCount] = static_cast<std::size_t>(i);
+                    mSizes[mCount] = mHeaders[i].msg_len;
+                    ++mCount;
+                }
+#else
+                // Without recvmmsg only the first read may block.
+                int _flags{flags};
+                while (mCount < mVectors.size())
+                {
+                    msghdr _header;
+                    std::memset(&_header, 0, sizeof(_header));
+                    _header.msg_name = &mSources[mCount];
+                    _header.msg_namelen = sizeof(sockaddr_in);
+                    _header.msg_iov = &mVectors[mCount];
+                    _header.msg_iovlen = 1U;
+                    const ssize_t _result{::recvmsg(mSocketFd, &_header, _flags)};
+                    ++mStatistics.Syscalls;
+                    if (_result < 0)
+                    {
+                        break;
+                    }
+                    _flags |= MSG_DONTWAIT;
+
+                    // The slot is reused for the next datagram.
+                    if (_header.msg_flags & MSG_TRUNC)
+                    {
+                        ++mStatistics.Truncated;
+                        continue;
+                    }
+
+                    mSlots[mCount] = mCount;
+                    mSizes[mCount] = static_cast<std::size_t>(_result);
+                    ++mCount;
+                }
+#endif
+
+                mStatistics.Datagrams += mCount;
+                return mCount;
+            }
+
+            std::size_t UdpBatchReceiver::Count() const noexcept
+            {
+                return mCount;
+            }
+
+            const std::uint8_t *UdpBatchReceiver::Data(std::size_t index) const noexcept
+            {
+                return &mSlab[mSlots[index] * mSlotSize];
+            }
+
+            std::size_t UdpBatchReceiver::Size(std::size_t index) const noexcept
+            {
+                return mSizes[index];
+            }
+
+            const sockaddr_in &UdpBatchReceiver::Source(std::size_t index) const noexcept
+            {
+                return mSources[mSlots[index]];
+            }
+
+            const UdpBatchStatistics &UdpBatchReceiver::GetStatistics() const noexcept
+            {
+                return mStatistics;
+            }
+        }
+    }
+}
@@ -0,0 +1,187 @@
+/// @file src/ara/com/helper/udp_batch.h
+/// @brief Batched UDP datagram I/O.
+/// @details Datagrams are staged in a preallocated slab and handed to the
+///          kernel several at a time with sendmmsg()/recvmmsg(), so a burst
+///          costs one system call per batch instead of one per datagram.
+///          Platforms without these calls fall back to a sendto()/recvfrom()
+///          loop with the same interface.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef UDP_BATCH_H
+#define UDP_BATCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include "../../core/timer_wheel.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            /// @brief Counters of a batched UDP endpoint
+            struct UdpBatchStatistics
+            {
+                /// @brief Datagrams handed to or taken from the kernel
+                std::uint64_t Datagrams{0U};
+                /// @brief Send or receive system calls issued
+                std::uint64_t Syscalls{0U};
+                /// @brief Datagrams the kernel refused
+                std::uint64_t Dropped{0U};
+                /// @brief Received datagrams dropped for not fitting in a slot
+                std::uint64_t Truncated{0U};
+            };
+
+            /// @brief Batching UDP sender towards a fixed destination
+            /// @details A batch is flushed when it is full, when Flush() is
+            ///          called, or - if a maximum delay is given - when its
+            ///          first datagram has waited that long on the process-wide
+            ///          timer wheel. The sender is thread-safe.
+            class UdpBatchSender
+            {
+            public:
+                /// @brief Default number of datagrams per system call
+                static const std::size_t cDefaultBatchSize;
+                /// @brief Default slab slot size (Ethernet MTU minus IPv4/UDP headers)
+                static const std::size_t cDefaultSlotSize;
+
+            private:
+                // Shared with a pending deadline flush on the timer wheel.
+                struct Batch
+                {
+                    std::mutex Mutex;
+                    int SocketFd;
+                    sockaddr_in Destination;
+                    std::size_t SlotSize;
+                    std::vector<std::uint8_t> Slab;
+                    std::vector<iovec> Vectors;
+#if defined(__linux__)
+                    std::vector<mmsghdr> Headers;
+#endif
+                    std::size_t Pending{0U};
+                    core::DeadlineTimer FlushDeadline;
+                    UdpBatchStatistics Statistics;
+                };
+
+                std::shared_ptr<Batch> mBatch;
+                const std::chrono::milliseconds mMaxDelay;
+
+                static void flush(Batch &batch);
+                static void sendUnbatched(
+                    Batch &batch, const std::uint8_t *data, std::size_t size);
+
+            public:
+                /// @brief Constructor
+                /// @param socketFd UDP socket, owned by the caller
+                /// @param destination Destination of every datagram
+                /// @param batchSize Datagrams per system call (at least one)
+                /// @param slotSize Largest datagram that is batched; larger
+                ///        ones are sent on their own
+                /// @param maxDelay Longest time a datagram may wait for its
+                ///        batch to fill; zero leaves flushing to the caller
+                UdpBatchSender(
+                    int socketFd,
+                    const sockaddr_in &destination,
+                    std::size_t batchSize = cDefaultBatchSize,
+                    std::size_t slotSize = cDefaultSlotSize,
+                    std::chrono::milliseconds maxDelay = std::chrono::milliseconds::zero());
+
+                /// @brief Flush the pending datagrams
+                ~UdpBatchSender() noexcept;
+
+                UdpBatchSender(const UdpBatchSender &) = delete;
+                UdpBatchSender &operator=(const UdpBatchSender &) = delete;
+
+                /// @brief Stage a datagram, flushing the batch if it gets full
+                /// @param data Datagram bytes, copied into the slab
+                /// @param size Datagram size
+                void Send(const std::uint8_t *data, std::size_t size);
+
+                /// @brief Hand all staged datagrams to the kernel
+                void Flush();
+
+                /// @brief Number of staged datagrams
+                std::size_t PendingCount() const;
+
+                /// @brief Get a snapshot of the counters
+                UdpBatchStatistics GetStatistics() const;
+            };
+
+            /// @brief Batching UDP receiver
+            /// @details Receive() fills a preallocated slab with up to a batch
+            ///          of datagrams in one system call; the datagrams stay
+            ///          valid until the next Receive(). A datagram longer than
+            ///          a slot is dropped and counted as truncated. The
+            ///          receiver is meant for a single reading thread.
+            class UdpBatchReceiver
+            {
+            public:
+                /// @brief Default number of datagrams per system call
+                static const std::size_t cDefaultBatchSize;
+                /// @brief Default slab slot size
+                static const std::size_t cDefaultSlotSize;
+
+            private:
+                const int mSocketFd;
+                const std::size_t mSlotSize;
+                std::vector<std::uint8_t> mSlab;
+                std::vector<iovec> mVectors;
+                std::vector<sockaddr_in> mSources;
+                std::vector<std::size_t> mSlots;
+                std::vector<std::size_t> mSizes;
+#if defined(__linux__)
+                std::vector<mmsghdr> mHeaders;
+#endif
+                std::size_t mCount;
+                UdpBatchStatistics mStatistics;
+
+            public:
+                /// @brief Constructor
+                /// @param socketFd Bound UDP socket, owned by the caller
+                /// @param batchSize Datagrams per system call (at least one)
+                /// @param slotSize Largest datagram size; longer ones are dropped
+                UdpBatchReceiver(
+                    int socketFd,
+                    std::size_t batchSize = cDefaultBatchSize,
+                    std::size_t slotSize = cDefaultSlotSize);
+
+                UdpBatchReceiver(const UdpBatchReceiver &) = delete;
+                UdpBatchReceiver &operator=(const UdpBatchReceiver &) = delete;
+
+                /// @brief Receive the datagrams that are already queued
+                /// @param flags recvmmsg()/recvfrom() flags
+                /// @returns Number of received datagrams that fit in their
+                ///          slot, zero if none or on error
+                std::size_t Receive(int flags = MSG_DONTWAIT);
+
+                /// @brief Number of datagrams of the last Receive()
+                std::size_t Count() const noexcept;
+
+                /// @brief Get a received datagram
+                /// @param index Datagram index below Count()
+                const std::uint8_t *Data(std::size_t index) const noexcept;
+
+                /// @brief Get the size of a received datagram
+                /// @param index Datagram index below Count()
+                std::size_t Size(std::size_t index) const noexcept;
+
+                /// @brief Get the sender of a received datagram
+                /// @param index Datagram index below Count()
+                const sockaddr_in &Source(std::size_t index) const noexcept;
+
+                /// @brief Get the counters
+                const UdpBatchStatistics &GetStatistics() const noexcept;
+            };
+        }
+    }
+}
+
+#endif
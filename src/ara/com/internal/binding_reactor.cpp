@@ -0,0 +1,200 @@
+/// @file src/ara/com/internal/binding_reactor.cpp
+/// @brief Implementation for the shared binding dispatcher.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include "./binding_reactor.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            namespace
+            {
+                std::atomic<std::size_t> sDefaultWorkerCount{1U};
+            }
+
+            // ── BindingReactor::Source ─────────────────────────────────────
+
+            BindingReactor::Source::Source(
+                BindingReactor &reactor,
+                std::function<void()> handler)
+                : mReactor{reactor},
+                  mHandler{std::move(handler)}
+            {
+            }
+
+            void BindingReactor::Source::Notify()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (mClosed)
+                    {
+                        return;
+                    }
+                    if (mRunning)
+                    {
+                        mRerun = true;
+                        return;
+                    }
+                    if (mScheduled)
+                    {
+                        return;
+                    }
+                    mScheduled = true;
+                }
+
+                std::shared_ptr<Source> self{shared_from_this()};
+                mReactor.Post([self] { self->run(); });
+            }
+
+            void BindingReactor::Source::run()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mScheduled = false;
+                    if (mClosed)
+                    {
+                        return;
+                    }
+                    mRunning = true;
+                    mRerun = false;
+                    mRunner = std::this_thread::get_id();
+                }
+
+                // A throwing handler must neither take the worker down nor
+                // leave Close() waiting for a run that never ends.
+                try
+                {
+                    mHandler();
+                }
+                catch (...)
+                {
+                }
+
+                bool rerun{false};
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mRunning = false;
+                    mRunner = std::thread::id{};
+                    if (mRerun && !mClosed)
+                    {
+                        mRerun = false;
+                        mScheduled = true;
+                        rerun = true;
+                    }
+                }
+                mIdle.notify_all();
+
+                if (rerun)
+                {
+                    std::shared_ptr<Source> self{shared_from_this()};
+                    mReactor.Post([self] { self->run(); });
+                }
+            }
+
+            void BindingReactor::Source::Close()
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mClosed = true;
+                mRerun = false;
+                if (mRunner != std::this_thread::get_id())
+                {
+                    mIdle.wait(lock, [this] { return !mRunning; });
+                }
+            }
+
+            // ── BindingReactor ─────────────────────────────────────────────
+
+            BindingReactor::BindingReactor(std::size_t workerCount)
+            {
+                const std::size_t count{std::max<std::size_t>(1U, workerCount)};
+                mWorkers.reserve(count);
+                for (std::size_t i = 0U; i < count; ++i)
+                {
+                    mWorkers.emplace_back(&BindingReactor::workerLoop, this);
+                }
+            }
+
+            BindingReactor::~BindingReactor() noexcept
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mStopping = true;
+                }
+                mWork.notify_all();
+
+                for (auto &worker : mWorkers)
+                {
+                    if (worker.joinable())
+                    {
+                        worker.join();
+                    }
+                }
+            }
+
+            void BindingReactor::SetDefaultWorkerCount(
+                std::size_t workerCount) noexcept
+            {
+                sDefaultWorkerCount.store(
+                    std::max<std::size_t>(1U, workerCount),
+                    std::memory_order_relaxed);
+            }
+
+            BindingReactor &BindingReactor::Instance()
+            {
+                // Leaked so that bindings destroyed during static destruction
+                // can still close their sources.
+                static auto *sInstance{
+                    new BindingReactor{
+                        sDefaultWorkerCount.load(std::memory_order_relaxed)}};
+                return *sInstance;
+            }
+
+            std::shared_ptr<BindingReactor::Source> BindingReactor::Register(
+                std::function<void()> handler)
+            {
+                return std::make_shared<Source>(*this, std::move(handler));
+            }
+
+            void BindingReactor::Post(std::function<void()> task)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mQueue.push_back(std::move(task));
+                }
+                mWork.notify_one();
+            }
+
+            std::size_t BindingReactor::WorkerCount() const noexcept
+            {
+                return mWorkers.size();
+            }
+
+            void BindingReactor::workerLoop()
+            {
+                while (true)
+                {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(mMutex);
+                        mWork.wait(
+                            lock, [this] { return mStopping || !mQueue.empty(); });
+                        if (mQueue.empty())
+                        {
+                            return;
+                        }
+                        task = std::move(mQueue.front());
+                        mQueue.pop_front();
+                    }
+
+                    task();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/// @file src/ara/com/internal/binding_reactor.h
+/// @brief Shared per-process dispatcher for ara::com transport bindings.
+/// @details Transport bindings no longer own receive threads. Each one
+///          registers a Source with the reactor and calls Source::Notify()
+///          from whatever context its transport signals data in (a DDS
+///          data-available listener, the shared iceoryx Listener, a vsomeip
+///          message handler). The reactor then runs the source's handler on
+///          one of its worker threads. Notifications are coalesced and the
+///          handler of one source never runs concurrently with itself, so a
+///          binding can keep a single-producer receive path without locks.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_INTERNAL_BINDING_REACTOR_H
+#define ARA_COM_INTERNAL_BINDING_REACTOR_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            /// @brief Executor with a fixed number of worker threads that
+            ///        multiplexes the receive paths of all bindings
+            class BindingReactor
+            {
+            public:
+                /// @brief Registered receive path of one binding
+                class Source : public std::enable_shared_from_this<Source>
+                {
+                private:
+                    friend class BindingReactor;
+
+                    BindingReactor &mReactor;
+                    std::function<void()> mHandler;
+                    std::mutex mMutex;
+                    std::condition_variable mIdle;
+                    bool mScheduled{false};
+                    bool mRunning{false};
+                    bool mRerun{false};
+                    bool mClosed{false};
+                    std::thread::id mRunner;
+
+                    void run();
+
+                public:
+                    Source(
+                        BindingReactor &reactor,
+                        std::function<void()> handler);
+
+                    Source(const Source &) = delete;
+                    Source &operator=(const Source &) = delete;
+
+                    /// @brief Request one run of the handler
+                    /// @details Thread-safe and cheap enough for transport
+                    ///          callbacks. Notifications that arrive while a run
+                    ///          is queued are merged into it; one that arrives
+                    ///          while the handler runs schedules another run.
+                    void Notify();
+
+                    /// @brief Stop dispatching to the handler
+                    /// @details Waits for a running handler unless called from
+                    ///          within that handler. No run starts afterwards.
+                    void Close();
+                };
+
+            private:
+                std::mutex mMutex;
+                std::condition_variable mWork;
+                std::deque<std::function<void()>> mQueue;
+                std::vector<std::thread> mWorkers;
+                bool mStopping{false};
+
+                void workerLoop();
+
+            public:
+                /// @brief Start the worker threads
+                /// @param workerCount Number of dispatch threads (at least one)
+                explicit BindingReactor(std::size_t workerCount = 1U);
+
+                /// @brief Drain the queued tasks and join the workers
+                ~BindingReactor() noexcept;
+
+                BindingReactor(const BindingReactor &) = delete;
+                BindingReactor &operator=(const BindingReactor &) = delete;
+
+                /// @brief Set the worker count of the process-wide reactor
+                /// @note Only effective before the first Instance() call.
+                static void SetDefaultWorkerCount(std::size_t workerCount) noexcept;
+
+                /// @brief Process-wide reactor shared by all bindings
+                static BindingReactor &Instance();
+
+                /// @brief Register a receive path
+                /// @param handler Invoked on a worker thread after Notify()
+                /// @returns Source handle; Close() it before the handler's
+                ///          captures are destroyed
+                std::shared_ptr<Source> Register(std::function<void()> handler);
+
+                /// @brief Queue a one-shot task
+                void Post(std::function<void()> task);
+
+                /// @brief Number of worker threads
+                std::size_t WorkerCount() const noexcept;
+            };
+        }
+    }
+}
+
+#endif
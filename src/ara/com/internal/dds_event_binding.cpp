@@ -89,6 +89,52 @@ namespace ara
                         entity = 0;
                     }
                 }
+
+                /// @brief Map an EventQosProfile onto native DataReader QoS.
+                void applyReaderQos(
+                    dds_qos_t *qos,
+                    const EventQosProfile &profile,
+                    std::size_t maxSampleCount) noexcept
+                {
+                    dds_qset_reliability(
+                        qos,
+                        profile.Reliability == ReliabilityKind::kReliable
+                            ? DDS_RELIABILITY_RELIABLE
+                            : DDS_RELIABILITY_BEST_EFFORT,
+                        DDS_SECS(1));
+
+                    const int32_t depth = static_cast<int32_t>(maxSampleCount);
+                    if (profile.History == HistoryKind::kKeepAll)
+                    {
+                        // Keep-all is still bounded by the subscriber's
+                        // sample budget so memory cannot grow unchecked.
+                        dds_qset_history(qos, DDS_HISTORY_KEEP_ALL, 0);
+                        dds_qset_resource_limits(qos, depth, -1, -1);
+                    }
+                    else
+                    {
+                        dds_qset_history(qos, DDS_HISTORY_KEEP_LAST, depth);
+                    }
+
+                    // The skeleton writer offers transient-local; requesting
+                    // more (kTransient) would never match without a
+                    // durability service, so both map to transient-local.
+                    dds_qset_durability(
+                        qos,
+                        profile.Durability == DurabilityKind::kVolatile
+                            ? DDS_DURABILITY_VOLATILE
+                            : DDS_DURABILITY_TRANSIENT_LOCAL);
+
+                    dds_qset_transport_priority(
+                        qos, static_cast<int32_t>(profile.Priority));
+                }
+
+                /// @brief DataReader listener hook; runs on a DDS thread and
+                ///        only schedules the drain on the binding reactor.
+                void onDataAvailable(dds_entity_t, void *arg)
+                {
+                    static_cast<BindingReactor::Source *>(arg)->Notify();
+                }
             } // namespace
 
             // ── DdsProxyEventBinding ───────────────────────────────────────
@@ -107,6 +153,14 @@ namespace ara
             {
             }
 
+            DdsProxyEventBinding::DdsProxyEventBinding(
+                EventBindingConfig config,
+                QueueOverflowPolicy overflowPolicy) noexcept
+                : mConfig{config},
+                  mSampleRing{overflowPolicy}
+            {
+            }
+
             DdsProxyEventBinding::~DdsProxyEventBinding() noexcept
             {
                 if (mState != SubscriptionState::kNotSubscribed)
@@ -126,8 +180,13 @@ namespace ara
                         return core::Result<void>::FromError(
                             MakeErrorCode(ComErrc::kFieldValueIsNotValid));
                     }
-                    mMaxSampleCount = std::max<std::size_t>(1U, maxSampleCount);
-                    mSampleQueue.clear();
+                    mMaxSampleCount =
+                        mHasQos ? EventQosMonitor::QueueCapacity(
+                                      maxSampleCount, mQosMonitor.GetQos())
+                                : std::max<std::size_t>(1U, maxSampleCount);
+                    mSampleRing.Reset(
+                        mMaxSampleCount, ARA_COM_DDS_MAX_PAYLOAD_SIZE);
+                    mQosMonitor.Start();
                     mState = SubscriptionState::kSubscriptionPending;
                     if (mStateChangeHandler)
                     {
@@ -174,17 +233,34 @@ namespace ara
                         MakeErrorCode(ComErrc::kNetworkBindingFailure));
                 }
 
-                // Reliable QoS reader
+                // Reliable keep-last reader unless a QoS profile says otherwise
                 dds_qos_t *qos = dds_create_qos();
-                dds_qset_reliability(qos, DDS_RELIABILITY_RELIABLE,
-                                     DDS_SECS(1));
-                dds_qset_history(qos, DDS_HISTORY_KEEP_LAST,
-                                 static_cast<int32_t>(mMaxSampleCount));
-                mReader = dds_create_reader(mSubscriber, mTopic, qos, nullptr);
+                if (mHasQos)
+                {
+                    applyReaderQos(qos, mQosMonitor.GetQos(), mMaxSampleCount);
+                }
+                else
+                {
+                    dds_qset_reliability(qos, DDS_RELIABILITY_RELIABLE,
+                                         DDS_SECS(1));
+                    dds_qset_history(qos, DDS_HISTORY_KEEP_LAST,
+                                     static_cast<int32_t>(mMaxSampleCount));
+                }
+                // The listener is installed at creation, so even samples
+                // delivered for a transient-local history raise it.
+                mReceiveSource = BindingReactor::Instance().Register(
+                    [this] { drainSamples(); });
+                dds_listener_t *listener =
+                    dds_create_listener(mReceiveSource.get());
+                dds_lset_data_available(listener, &onDataAvailable);
+                mReader = dds_create_reader(mSubscriber, mTopic, qos, listener);
+                dds_delete_listener(listener);
                 dds_delete_qos(qos);
 
                 if (mReader < 0)
                 {
+                    mReceiveSource->Close();
+                    mReceiveSource.reset();
                     deleteSafe(mSubscriber);
                     deleteSafe(mTopic);
                     deleteSafe(mParticipant);
@@ -192,36 +268,6 @@ namespace ara
                         MakeErrorCode(ComErrc::kNetworkBindingFailure));
                 }
 
-                // WaitSet + ReadCondition for the polling thread
-                mReadCond = dds_create_readcondition(
-                    mReader, DDS_ANY_SAMPLE_STATE |
-                                 DDS_ANY_VIEW_STATE |
-                                 DDS_ANY_INSTANCE_STATE);
-                if (mReadCond < 0)
-                {
-                    deleteSafe(mReader);
-                    deleteSafe(mSubscriber);
-                    deleteSafe(mTopic);
-                    deleteSafe(mParticipant);
-                    return core::Result<void>::FromError(
-                        MakeErrorCode(ComErrc::kNetworkBindingFailure));
-                }
-
-                mWaitSet = dds_create_waitset(mParticipant);
-                if (mWaitSet < 0)
-                {
-                    deleteSafe(mReadCond);
-                    deleteSafe(mReader);
-                    deleteSafe(mSubscriber);
-                    deleteSafe(mTopic);
-                    deleteSafe(mParticipant);
-                    return core::Result<void>::FromError(
-                        MakeErrorCode(ComErrc::kNetworkBindingFailure));
-                }
-
-                dds_waitset_attach(mWaitSet, mReadCond,
-                                   static_cast<dds_attach_t>(mReader));
-
                 SubscriptionStateChangeHandler subscribedNotify;
                 {
                     std::lock_guard<std::mutex> lock(mMutex);
@@ -237,23 +283,21 @@ namespace ara
                     subscribedNotify(SubscriptionState::kSubscribed);
                 }
 
-                mRunning.store(true, std::memory_order_relaxed);
-                mPollThread = std::thread([this] { pollLoop(); });
-
                 return core::Result<void>::FromValue();
             }
 
             void DdsProxyEventBinding::Unsubscribe()
             {
-                mRunning.store(false, std::memory_order_relaxed);
-                if (mPollThread.joinable())
+                // Waits for a drain already running on the reactor. The
+                // source outlives the reader, whose listener may still fire.
+                if (mReceiveSource)
                 {
-                    mPollThread.join();
+                    mReceiveSource->Close();
                 }
+                mQosMonitor.Stop();
 
-                deleteSafe(mWaitSet);
-                deleteSafe(mReadCond);
                 deleteSafe(mReader);
+                mReceiveSource.reset();
                 deleteSafe(mSubscriber);
                 deleteSafe(mTopic);
                 deleteSafe(mParticipant);
@@ -266,7 +310,7 @@ namespace ara
                         return;
                     }
                     mState = SubscriptionState::kNotSubscribed;
-                    mSampleQueue.clear();
+                    mSampleRing.Clear();
                     mReceiveHandler = nullptr;
                     if (mStateChangeHandler)
                     {
@@ -297,35 +341,55 @@ namespace ara
                         MakeErrorCode(ComErrc::kSetHandlerNotSet));
                 }
 
-                std::size_t delivered = 0U;
-                while (delivered < maxNumberOfSamples)
                 {
-                    std::vector<std::uint8_t> sample;
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (mState != SubscriptionState::kSubscribed)
                     {
-                        std::lock_guard<std::mutex> lock(mMutex);
-                        if (mState != SubscriptionState::kSubscribed)
-                        {
-                            if (delivered == 0U)
-                            {
-                                return core::Result<std::size_t>::FromError(
-                                    MakeErrorCode(ComErrc::kServiceNotAvailable));
-                            }
-                            break;
-                        }
-                        if (mSampleQueue.empty())
-                        {
-                            break;
-                        }
-                        sample = std::move(mSampleQueue.front());
-                        mSampleQueue.pop_front();
+                        return core::Result<std::size_t>::FromError(
+                            MakeErrorCode(ComErrc::kServiceNotAvailable));
                     }
-                    handler(sample.data(), sample.size());
-                    ++delivered;
                 }
 
+                const std::size_t delivered =
+                    mSampleRing.Drain(handler, maxNumberOfSamples);
                 return core::Result<std::size_t>::FromValue(delivered);
             }
 
+            bool DdsProxyEventBinding::SetSampleFilter(
+                const FilterConfig &filter)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mState != SubscriptionState::kNotSubscribed)
+                {
+                    return false;
+                }
+                mSampleFilter.Configure(filter);
+                return true;
+            }
+
+            bool DdsProxyEventBinding::SetQosProfile(const EventQosProfile &qos)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mState != SubscriptionState::kNotSubscribed)
+                {
+                    return false;
+                }
+                mQosMonitor.Configure(qos);
+                mHasQos = true;
+                return true;
+            }
+
+            void DdsProxyEventBinding::SetDeadlineMissedHandler(
+                DeadlineMissedHandler handler)
+            {
+                mQosMonitor.SetDeadlineMissedHandler(std::move(handler));
+            }
+
+            void DdsProxyEventBinding::UnsetDeadlineMissedHandler()
+            {
+                mQosMonitor.UnsetDeadlineMissedHandler();
+            }
+
             void DdsProxyEventBinding::SetReceiveHandler(
                 std::function<void()> handler)
             {
@@ -343,11 +407,12 @@ namespace ara
                 const noexcept
             {
                 std::lock_guard<std::mutex> lock(mMutex);
-                if (mSampleQueue.size() >= mMaxSampleCount)
+                const std::size_t buffered = mSampleRing.Size();
+                if (buffered >= mMaxSampleCount)
                 {
                     return 0U;
                 }
-                return mMaxSampleCount - mSampleQueue.size();
+                return mMaxSampleCount - buffered;
             }
 
             void DdsProxyEventBinding::SetSubscriptionStateChangeHandler(
@@ -363,36 +428,23 @@ namespace ara
                 mStateChangeHandler = nullptr;
             }
 
-            void DdsProxyEventBinding::pollLoop() noexcept
+            void DdsProxyEventBinding::drainSamples() noexcept
             {
-                static constexpr dds_duration_t cWaitTimeout = DDS_MSECS(50);
-
-                while (mRunning.load(std::memory_order_relaxed))
+                static constexpr std::size_t cMaxTake = 16U;
+                AraComDdsRawEvent msgs[cMaxTake];
+                void *ptrBuf[cMaxTake];
+                dds_sample_info_t si[cMaxTake];
+                for (std::size_t i = 0U; i < cMaxTake; ++i)
                 {
-                    if (mWaitSet <= 0)
-                    {
-                        break;
-                    }
-
-                    dds_attach_t triggered = 0;
-                    const int32_t waitRet =
-                        dds_waitset_wait(mWaitSet, &triggered, 1, cWaitTimeout);
-                    if (waitRet <= 0)
-                    {
-                        continue; // timeout or error
-                    }
-
-                    // Drain all available samples
-                    static constexpr std::size_t cMaxTake = 16U;
-                    AraComDdsRawEvent msgs[cMaxTake];
-                    void *ptrBuf[cMaxTake];
-                    dds_sample_info_t si[cMaxTake];
-                    for (std::size_t i = 0U; i < cMaxTake; ++i)
-                    {
-                        ptrBuf[i] = &msgs[i];
-                    }
+                    ptrBuf[i] = &msgs[i];
+                }
 
-                    const int32_t n = dds_take(
+                // Take until the reader is empty: the listener only fires
+                // again for samples that arrive after the status was reset.
+                int32_t n = static_cast<int32_t>(cMaxTake);
+                while (n == static_cast<int32_t>(cMaxTake))
+                {
+                    n = dds_take(
                         mReader, ptrBuf, si,
                         static_cast<size_t>(cMaxTake),
                         static_cast<uint32_t>(cMaxTake));
@@ -408,15 +460,16 @@ namespace ara
                         const std::uint32_t payloadSize =
                             std::min(msg.size, ARA_COM_DDS_MAX_PAYLOAD_SIZE);
 
+                        if (!mQosMonitor.OnSample() ||
+                            !mSampleFilter.Accept(msg.data, payloadSize) ||
+                            !mSampleRing.Push(msg.data, payloadSize))
+                        {
+                            continue;
+                        }
+
                         std::function<void()> notify;
                         {
                             std::lock_guard<std::mutex> lock(mMutex);
-                            if (mSampleQueue.size() >= mMaxSampleCount)
-                            {
-                                mSampleQueue.pop_front();
-                            }
-                            mSampleQueue.emplace_back(
-                                msg.data, msg.data + payloadSize);
                             notify = mReceiveHandler;
                         }
 
@@ -489,6 +542,9 @@ namespace ara
                 dds_qos_t *qos = dds_create_qos();
                 dds_qset_reliability(qos, DDS_RELIABILITY_RELIABLE, DDS_SECS(1));
                 dds_qset_history(qos, DDS_HISTORY_KEEP_LAST, 16);
+                // Transient-local so that readers requesting any durability
+                // match; volatile readers still get no history.
+                dds_qset_durability(qos, DDS_DURABILITY_TRANSIENT_LOCAL);
                 mWriter = dds_create_writer(mPublisher, mTopic, qos, nullptr);
                 dds_delete_qos(qos);
 
@@ -590,6 +646,12 @@ namespace ara
 
             core::Result<void> DdsSkeletonEventBinding::SendAllocated(
                 void *data, std::size_t size)
+            {
+                return SendAllocatedFrame(data, 0U, size);
+            }
+
+            core::Result<void> DdsSkeletonEventBinding::SendAllocatedFrame(
+                void *data, std::size_t offset, std::size_t size)
             {
                 if (!data)
                 {
@@ -597,9 +659,9 @@ namespace ara
                         MakeErrorCode(ComErrc::kFieldValueIsNotValid));
                 }
 
-                const std::vector<std::uint8_t> payload(
-                    static_cast<const std::uint8_t *>(data),
-                    static_cast<const std::uint8_t *>(data) + size);
+                const std::uint8_t *frame{
+                    static_cast<const std::uint8_t *>(data) + offset};
+                const std::vector<std::uint8_t> payload(frame, frame + size);
                 std::free(data);
 
                 return Send(payload);
@@ -9,20 +9,25 @@
 ///          Publisher/Subscriber, and DataWriter/DataReader inside their own
 ///          DDS domain, identified by the EventBindingConfig service/instance IDs.
 ///
-///          The proxy uses a background thread (WaitForData + Take loop) to
-///          drain samples into an internal queue and notify the receive handler.
+///          The proxy installs a data-available listener on its DataReader
+///          that wakes a BindingReactor source; the reactor drains samples
+///          into a lock-free SampleRing and notifies the receive handler, so
+///          no thread is spawned per subscription.
 ///
 ///          This file is part of the Adaptive AUTOSAR educational implementation.
 
 #ifndef ARA_COM_INTERNAL_DDS_EVENT_BINDING_H
 #define ARA_COM_INTERNAL_DDS_EVENT_BINDING_H
 
-#include <atomic>
-#include <deque>
+#include <memory>
 #include <mutex>
 #include <string>
-#include <thread>
+#include "./binding_reactor.h"
 #include "./event_binding.h"
+#include "./event_qos_monitor.h"
+#include "./queue_overflow_policy.h"
+#include "./sample_filter.h"
+#include "./sample_ring.h"
 #include "../com_error_domain.h"
 
 #if defined(ARA_COM_USE_CYCLONEDDS) && (ARA_COM_USE_CYCLONEDDS == 1)
@@ -68,14 +73,21 @@ namespace ara
 #endif // ARA_COM_USE_CYCLONEDDS
 
             /// @brief CycloneDDS-based proxy-side event binding.
-            ///        Uses a background thread to drain samples from the DataReader.
+            ///        Drains the DataReader on the shared binding reactor.
+            ///        Reliability, history, durability and priority of the event
+            ///        QoS profile map to native reader QoS. Deadline and
+            ///        MinSeparation are enforced locally, because the skeleton
+            ///        writer offers no deadline a requesting reader could match.
             class DdsProxyEventBinding final : public ProxyEventBinding
             {
             private:
                 EventBindingConfig mConfig;
                 mutable std::mutex mMutex;
                 SubscriptionState mState{SubscriptionState::kNotSubscribed};
-                std::deque<std::vector<std::uint8_t>> mSampleQueue;
+                SampleRing mSampleRing;
+                SampleFilter mSampleFilter;
+                EventQosMonitor mQosMonitor;
+                bool mHasQos{false};
                 std::size_t mMaxSampleCount{16U};
                 std::function<void()> mReceiveHandler;
                 SubscriptionStateChangeHandler mStateChangeHandler;
@@ -85,14 +97,11 @@ namespace ara
                 dds_entity_t mTopic{0};
                 dds_entity_t mSubscriber{0};
                 dds_entity_t mReader{0};
-                dds_entity_t mWaitSet{0};
-                dds_entity_t mReadCond{0};
 #endif
 
-                std::atomic<bool> mRunning{false};
-                std::thread mPollThread;
+                std::shared_ptr<BindingReactor::Source> mReceiveSource;
 
-                void pollLoop() noexcept;
+                void drainSamples() noexcept;
 
             public:
                 static std::string makeTopicName(
@@ -100,6 +109,11 @@ namespace ara
 
                 explicit DdsProxyEventBinding(
                     EventBindingConfig config) noexcept;
+
+                /// @brief Constructor with configurable queue overflow policy.
+                DdsProxyEventBinding(
+                    EventBindingConfig config,
+                    QueueOverflowPolicy overflowPolicy) noexcept;
                 ~DdsProxyEventBinding() noexcept override;
 
                 DdsProxyEventBinding(const DdsProxyEventBinding &) = delete;
@@ -112,6 +126,11 @@ namespace ara
                 core::Result<std::size_t> GetNewSamples(
                     RawReceiveHandler handler,
                     std::size_t maxNumberOfSamples) override;
+                bool SetSampleFilter(const FilterConfig &filter) override;
+                bool SetQosProfile(const EventQosProfile &qos) override;
+                void SetDeadlineMissedHandler(
+                    DeadlineMissedHandler handler) override;
+                void UnsetDeadlineMissedHandler() override;
                 void SetReceiveHandler(std::function<void()> handler) override;
                 void UnsetReceiveHandler() override;
                 std::size_t GetFreeSampleCount() const noexcept override;
@@ -152,6 +171,8 @@ namespace ara
                 core::Result<void *> Allocate(std::size_t size) override;
                 core::Result<void> SendAllocated(
                     void *data, std::size_t size) override;
+                core::Result<void> SendAllocatedFrame(
+                    void *data, std::size_t offset, std::size_t size) override;
                 void SetInitialValue(
                     const std::vector<std::uint8_t> &payload) override;
             };
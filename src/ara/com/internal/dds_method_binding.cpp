@@ -135,6 +135,13 @@ namespace ara
                         entity = 0;
                     }
                 }
+
+                /// @brief DataReader listener hook; runs on a DDS thread and
+                ///        only schedules the drain on the binding reactor.
+                void onDataAvailable(dds_entity_t, void *arg)
+                {
+                    static_cast<BindingReactor::Source *>(arg)->Notify();
+                }
             } // namespace
 
             // ── DdsProxyMethodBinding ──────────────────────────────────────────
@@ -219,7 +226,10 @@ namespace ara
                 dds_qos_t *rqos = dds_create_qos();
                 dds_qset_reliability(rqos, DDS_RELIABILITY_RELIABLE, DDS_SECS(5));
                 dds_qset_history(rqos, DDS_HISTORY_KEEP_LAST, 16);
-                mReader = dds_create_reader(mSubscriber, mRepTopic, rqos, nullptr);
+                dds_listener_t *listener = dds_create_listener(mReplySource.get());
+                dds_lset_data_available(listener, &onDataAvailable);
+                mReader = dds_create_reader(mSubscriber, mRepTopic, rqos, listener);
+                dds_delete_listener(listener);
                 dds_delete_qos(rqos);
                 if (mReader < 0)
                 {
@@ -227,32 +237,11 @@ namespace ara
                     return false;
                 }
 
-                mReadCond = dds_create_readcondition(
-                    mReader,
-                    DDS_ANY_SAMPLE_STATE | DDS_ANY_VIEW_STATE | DDS_ANY_INSTANCE_STATE);
-                if (mReadCond < 0)
-                {
-                    shutdownDds();
-                    return false;
-                }
-
-                mWaitSet = dds_create_waitset(mParticipant);
-                if (mWaitSet < 0)
-                {
-                    shutdownDds();
-                    return false;
-                }
-
-                dds_waitset_attach(mWaitSet, mReadCond,
-                                   static_cast<dds_attach_t>(mReader));
-
                 return true;
             }
 
             void DdsProxyMethodBinding::shutdownDds() noexcept
             {
-                deleteSafe(mWaitSet);
-                deleteSafe(mReadCond);
                 deleteSafe(mReader);
                 deleteSafe(mSubscriber);
                 deleteSafe(mWriter);
@@ -264,35 +253,27 @@ namespace ara
 
             DdsProxyMethodBinding::DdsProxyMethodBinding(
                 MethodBindingConfig config) noexcept
-                : mConfig{config}
+                : mConfig{config},
+                  mScheduler{std::make_shared<MethodRequestScheduler>(
+                      [this](std::uint32_t sessionId,
+                             const std::vector<std::uint8_t> &requestPayload)
+                      {
+                          return transmit(sessionId, requestPayload);
+                      })},
+                  mReplySource{BindingReactor::Instance().Register(
+                      [this] { drainReplies(); })}
             {
                 mInitialized = initDds();
-                if (mInitialized)
-                {
-                    mRunning.store(true, std::memory_order_relaxed);
-                    mPollThread = std::thread([this] { pollLoop(); });
-                }
             }
 
             DdsProxyMethodBinding::~DdsProxyMethodBinding() noexcept
             {
-                mRunning.store(false, std::memory_order_relaxed);
-                if (mPollThread.joinable())
-                {
-                    mPollThread.join();
-                }
+                // Waits for a dispatch already running on the reactor.
+                mReplySource->Close();
 
-                // Fail any pending calls
-                std::unordered_map<std::uint32_t, RawResponseHandler> pending;
-                {
-                    std::lock_guard<std::mutex> lock(mMutex);
-                    pending.swap(mPending);
-                }
-                for (auto &kv : pending)
-                {
-                    kv.second(core::Result<std::vector<std::uint8_t>>::FromError(
-                        MakeErrorCode(ComErrc::kNetworkBindingFailure)));
-                }
+                // Fails the pending calls and waits for a running transmit.
+                mScheduler->Shutdown(
+                    MakeErrorCode(ComErrc::kNetworkBindingFailure));
 
                 shutdownDds();
             }
@@ -317,14 +298,19 @@ namespace ara
                     return;
                 }
 
-                const std::uint32_t sessionId =
-                    mNextSessionId.fetch_add(1U, std::memory_order_relaxed);
+                mScheduler->Submit(requestPayload, std::move(responseHandler));
+            }
 
-                {
-                    std::lock_guard<std::mutex> lock(mMutex);
-                    mPending.emplace(sessionId, std::move(responseHandler));
-                }
+            bool DdsProxyMethodBinding::SetQosProfile(const MethodQosProfile &qos)
+            {
+                mScheduler->SetQosProfile(qos);
+                return true;
+            }
 
+            bool DdsProxyMethodBinding::transmit(
+                std::uint32_t sessionId,
+                const std::vector<std::uint8_t> &requestPayload)
+            {
                 AraComDdsRawRequest req;
                 req.session_id = sessionId;
                 req.size = static_cast<std::uint32_t>(requestPayload.size());
@@ -335,56 +321,26 @@ namespace ara
                                 ARA_COM_DDS_MAX_METHOD_PAYLOAD_SIZE - requestPayload.size());
                 }
 
-                const dds_return_t rc = dds_write(mWriter, &req);
-                if (rc != DDS_RETCODE_OK)
-                {
-                    RawResponseHandler handler;
-                    {
-                        std::lock_guard<std::mutex> lock(mMutex);
-                        auto it = mPending.find(sessionId);
-                        if (it != mPending.end())
-                        {
-                            handler = std::move(it->second);
-                            mPending.erase(it);
-                        }
-                    }
-                    if (handler)
-                    {
-                        handler(core::Result<std::vector<std::uint8_t>>::FromError(
-                            MakeErrorCode(ComErrc::kCommunicationStackError)));
-                    }
-                }
+                return dds_write(mWriter, &req) == DDS_RETCODE_OK;
             }
 
-            void DdsProxyMethodBinding::pollLoop() noexcept
+            void DdsProxyMethodBinding::drainReplies() noexcept
             {
-                static constexpr dds_duration_t cWaitTimeout = DDS_MSECS(50);
-
-                while (mRunning.load(std::memory_order_relaxed))
+                static constexpr std::size_t cMaxTake = 16U;
+                AraComDdsRawReply msgs[cMaxTake];
+                void *ptrBuf[cMaxTake];
+                dds_sample_info_t si[cMaxTake];
+                for (std::size_t i = 0U; i < cMaxTake; ++i)
                 {
-                    if (mWaitSet <= 0)
-                    {
-                        break;
-                    }
-
-                    dds_attach_t triggered = 0;
-                    const int32_t waitRet =
-                        dds_waitset_wait(mWaitSet, &triggered, 1, cWaitTimeout);
-                    if (waitRet <= 0)
-                    {
-                        continue;
-                    }
-
-                    static constexpr std::size_t cMaxTake = 16U;
-                    AraComDdsRawReply msgs[cMaxTake];
-                    void *ptrBuf[cMaxTake];
-                    dds_sample_info_t si[cMaxTake];
-                    for (std::size_t i = 0U; i < cMaxTake; ++i)
-                    {
-                        ptrBuf[i] = &msgs[i];
-                    }
+                    ptrBuf[i] = &msgs[i];
+                }
 
-                    const int32_t n = dds_take(
+                // Take until the reader is empty: the listener only fires
+                // again for samples that arrive after the status was reset.
+                int32_t n = static_cast<int32_t>(cMaxTake);
+                while (n == static_cast<int32_t>(cMaxTake))
+                {
+                    n = dds_take(
                         mReader, ptrBuf, si,
                         static_cast<size_t>(cMaxTake),
                         static_cast<uint32_t>(cMaxTake));
@@ -397,34 +353,21 @@ namespace ara
                         }
 
                         const auto &msg = msgs[i];
-                        RawResponseHandler handler;
-                        {
-                            std::lock_guard<std::mutex> lock(mMutex);
-                            auto it = mPending.find(msg.session_id);
-                            if (it != mPending.end())
-                            {
-                                handler = std::move(it->second);
-                                mPending.erase(it);
-                            }
-                        }
-
-                        if (!handler)
-                        {
-                            continue;
-                        }
-
                         if (msg.is_error != 0U)
                         {
-                            handler(core::Result<std::vector<std::uint8_t>>::FromError(
-                                MakeErrorCode(ComErrc::kCommunicationStackError)));
+                            mScheduler->Complete(
+                                msg.session_id,
+                                core::Result<std::vector<std::uint8_t>>::FromError(
+                                    MakeErrorCode(ComErrc::kCommunicationStackError)));
                         }
                         else
                         {
                             const std::uint32_t payloadSize =
                                 std::min(msg.size, ARA_COM_DDS_MAX_METHOD_PAYLOAD_SIZE);
-                            handler(core::Result<std::vector<std::uint8_t>>::FromValue(
-                                std::vector<std::uint8_t>(
-                                    msg.data, msg.data + payloadSize)));
+                            mScheduler->Complete(
+                                msg.session_id,
+                                core::Span<const std::uint8_t>(
+                                    msg.data, payloadSize));
                         }
                     }
                 }
@@ -498,7 +441,10 @@ namespace ara
                 dds_qos_t *rqos = dds_create_qos();
                 dds_qset_reliability(rqos, DDS_RELIABILITY_RELIABLE, DDS_SECS(5));
                 dds_qset_history(rqos, DDS_HISTORY_KEEP_LAST, 16);
-                mReader = dds_create_reader(mSubscriber, mReqTopic, rqos, nullptr);
+                dds_listener_t *listener = dds_create_listener(mRequestSource.get());
+                dds_lset_data_available(listener, &onDataAvailable);
+                mReader = dds_create_reader(mSubscriber, mReqTopic, rqos, listener);
+                dds_delete_listener(listener);
                 dds_delete_qos(rqos);
                 if (mReader < 0)
                 {
@@ -506,32 +452,11 @@ namespace ara
                     return false;
                 }
 
-                mReadCond = dds_create_readcondition(
-                    mReader,
-                    DDS_ANY_SAMPLE_STATE | DDS_ANY_VIEW_STATE | DDS_ANY_INSTANCE_STATE);
-                if (mReadCond < 0)
-                {
-                    shutdownDds();
-                    return false;
-                }
-
-                mWaitSet = dds_create_waitset(mParticipant);
-                if (mWaitSet < 0)
-                {
-                    shutdownDds();
-                    return false;
-                }
-
-                dds_waitset_attach(mWaitSet, mReadCond,
-                                   static_cast<dds_attach_t>(mReader));
-
                 return true;
             }
 
             void DdsSkeletonMethodBinding::shutdownDds() noexcept
             {
-                deleteSafe(mWaitSet);
-                deleteSafe(mReadCond);
                 deleteSafe(mReader);
                 deleteSafe(mSubscriber);
                 deleteSafe(mWriter);
@@ -568,9 +493,13 @@ namespace ara
 
                 if (!mInitialized)
                 {
+                    mRequestSource = BindingReactor::Instance().Register(
+                        [this] { drainRequests(); });
                     mInitialized = initDds();
                     if (!mInitialized)
                     {
+                        mRequestSource->Close();
+                        mRequestSource.reset();
                         std::lock_guard<std::mutex> lock(mMutex);
                         mHandler = nullptr;
                         return core::Result<void>::FromError(
@@ -578,21 +507,15 @@ namespace ara
                     }
                 }
 
-                if (!mServiceThread.joinable())
-                {
-                    mRunning.store(true, std::memory_order_relaxed);
-                    mServiceThread = std::thread([this] { serviceLoop(); });
-                }
-
                 return core::Result<void>::FromValue();
             }
 
             void DdsSkeletonMethodBinding::Unregister()
             {
-                mRunning.store(false, std::memory_order_relaxed);
-                if (mServiceThread.joinable())
+                // Waits for a dispatch already running on the reactor.
+                if (mRequestSource)
                 {
-                    mServiceThread.join();
+                    mRequestSource->Close();
                 }
 
                 {
@@ -605,37 +528,26 @@ namespace ara
                     shutdownDds();
                     mInitialized = false;
                 }
+                mRequestSource.reset();
             }
 
-            void DdsSkeletonMethodBinding::serviceLoop() noexcept
+            void DdsSkeletonMethodBinding::drainRequests() noexcept
             {
-                static constexpr dds_duration_t cWaitTimeout = DDS_MSECS(50);
-
-                while (mRunning.load(std::memory_order_relaxed))
+                static constexpr std::size_t cMaxTake = 16U;
+                AraComDdsRawRequest msgs[cMaxTake];
+                void *ptrBuf[cMaxTake];
+                dds_sample_info_t si[cMaxTake];
+                for (std::size_t i = 0U; i < cMaxTake; ++i)
                 {
-                    if (mWaitSet <= 0)
-                    {
-                        break;
-                    }
-
-                    dds_attach_t triggered = 0;
-                    const int32_t waitRet =
-                        dds_waitset_wait(mWaitSet, &triggered, 1, cWaitTimeout);
-                    if (waitRet <= 0)
-                    {
-                        continue;
-                    }
-
-                    static constexpr std::size_t cMaxTake = 16U;
-                    AraComDdsRawRequest msgs[cMaxTake];
-                    void *ptrBuf[cMaxTake];
-                    dds_sample_info_t si[cMaxTake];
-                    for (std::size_t i = 0U; i < cMaxTake; ++i)
-                    {
-                        ptrBuf[i] = &msgs[i];
-                    }
+                    ptrBuf[i] = &msgs[i];
+                }
 
-                    const int32_t n = dds_take(
+                // Take until the reader is empty: the listener only fires
+                // again for samples that arrive after the status was reset.
+                int32_t n = static_cast<int32_t>(cMaxTake);
+                while (n == static_cast<int32_t>(cMaxTake))
+                {
+                    n = dds_take(
                         mReader, ptrBuf, si,
                         static_cast<size_t>(cMaxTake),
                         static_cast<uint32_t>(cMaxTake));
@@ -650,8 +562,8 @@ namespace ara
                         const auto &msg = msgs[i];
                         const std::uint32_t payloadSize =
                             std::min(msg.size, ARA_COM_DDS_MAX_METHOD_PAYLOAD_SIZE);
-                        const std::vector<std::uint8_t> reqPayload(
-                            msg.data, msg.data + payloadSize);
+                        const core::Span<const std::uint8_t> reqPayload(
+                            msg.data, payloadSize);
 
                         RawRequestHandler handler;
                         {
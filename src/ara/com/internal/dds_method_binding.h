@@ -2,24 +2,25 @@
 /// @brief CycloneDDS-backed ProxyMethodBinding and SkeletonMethodBinding.
 /// @details Two DDS topics per method — request and reply — provide a
 ///          request-reply RPC channel without IDL code generation.
-///          The proxy assigns an atomic session ID to each call, stores the
-///          response handler in a pending map, and writes the request to the
-///          request topic.  A background thread drains the reply topic and
-///          dispatches the matching response handler.
-///          The skeleton runs a background thread that drains the request
-///          topic, invokes the registered handler, and writes the reply.
+///          The proxy hands each call to its MethodRequestScheduler, which
+///          assigns the session ID, tracks timeout and retries, and writes the
+///          request to the request topic.  A data-available listener on the
+///          reply reader schedules the shared BindingReactor, which drains the
+///          reply topic and completes the matching call.
+///          The skeleton drains the request topic on the reactor the same way,
+///          invokes the registered handler, and writes the reply.
 ///
 ///          This file is part of the Adaptive AUTOSAR educational implementation.
 
 #ifndef ARA_COM_INTERNAL_DDS_METHOD_BINDING_H
 #define ARA_COM_INTERNAL_DDS_METHOD_BINDING_H
 
-#include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
-#include <thread>
-#include <unordered_map>
+#include "./binding_reactor.h"
 #include "./method_binding.h"
+#include "./method_request_scheduler.h"
 #include "../com_error_domain.h"
 
 #if defined(ARA_COM_USE_CYCLONEDDS) && (ARA_COM_USE_CYCLONEDDS == 1)
@@ -75,9 +76,6 @@ namespace ara
             {
             private:
                 MethodBindingConfig mConfig;
-                std::mutex mMutex;
-                std::atomic<std::uint32_t> mNextSessionId{1U};
-                std::unordered_map<std::uint32_t, RawResponseHandler> mPending;
 
 #if defined(ARA_COM_USE_CYCLONEDDS) && (ARA_COM_USE_CYCLONEDDS == 1)
                 dds_entity_t mParticipant{0};
@@ -87,15 +85,16 @@ namespace ara
                 dds_entity_t mWriter{0};
                 dds_entity_t mSubscriber{0};
                 dds_entity_t mReader{0};
-                dds_entity_t mWaitSet{0};
-                dds_entity_t mReadCond{0};
 #endif
 
-                std::atomic<bool> mRunning{false};
-                std::thread mPollThread;
+                std::shared_ptr<MethodRequestScheduler> mScheduler;
+                std::shared_ptr<BindingReactor::Source> mReplySource;
                 bool mInitialized{false};
 
-                void pollLoop() noexcept;
+                bool transmit(
+                    std::uint32_t sessionId,
+                    const std::vector<std::uint8_t> &requestPayload);
+                void drainReplies() noexcept;
                 bool initDds() noexcept;
                 void shutdownDds() noexcept;
 
@@ -119,11 +118,13 @@ namespace ara
                 void Call(
                     const std::vector<std::uint8_t> &requestPayload,
                     RawResponseHandler responseHandler) override;
+
+                bool SetQosProfile(const MethodQosProfile &qos) override;
             };
 
             /// @brief CycloneDDS-based skeleton-side method binding.
             ///        Creates a DDS reader for requests and a DDS writer for replies.
-            ///        A background thread services requests and writes replies.
+            ///        Requests are serviced on the shared binding reactor.
             class DdsSkeletonMethodBinding final : public SkeletonMethodBinding
             {
             private:
@@ -139,15 +140,12 @@ namespace ara
                 dds_entity_t mWriter{0};
                 dds_entity_t mSubscriber{0};
                 dds_entity_t mReader{0};
-                dds_entity_t mWaitSet{0};
-                dds_entity_t mReadCond{0};
 #endif
 
-                std::atomic<bool> mRunning{false};
-                std::thread mServiceThread;
+                std::shared_ptr<BindingReactor::Source> mRequestSource;
                 bool mInitialized{false};
 
-                void serviceLoop() noexcept;
+                void drainRequests() noexcept;
                 bool initDds() noexcept;
                 void shutdownDds() noexcept;
 
@@ -6,10 +6,15 @@
 #define ARA_COM_INTERNAL_EVENT_BINDING_H
 
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <vector>
 #include "../../core/result.h"
+#include "../com_error_domain.h"
+#include "../qos.h"
+#include "../sample_ptr.h"
 #include "../types.h"
 
 namespace ara
@@ -43,6 +48,13 @@ namespace ara
                 using RawReceiveHandler =
                     std::function<void(const std::uint8_t *, std::size_t)>;
 
+                /// @brief Callback type for loaned payload delivery.
+                ///        The handler receives transport-owned bytes and the hook
+                ///        that gives them back; it must invoke the hook exactly
+                ///        once, either immediately or later through a SamplePtr.
+                using LoanedReceiveHandler =
+                    std::function<void(const std::uint8_t *, std::size_t, SampleReleaser)>;
+
                 virtual ~ProxyEventBinding() noexcept = default;
 
                 /// @brief Subscribe to the event
@@ -64,6 +76,61 @@ namespace ara
                     RawReceiveHandler handler,
                     std::size_t maxNumberOfSamples) = 0;
 
+                /// @brief Install a raw-byte filter evaluated on the receive path,
+                ///        before samples are queued or copied out of the transport
+                /// @param filter Filter configuration (decimation / content)
+                /// @returns True if the binding applies the filter, false if the
+                ///          caller has to filter the delivered samples itself
+                /// @note Only honored while not subscribed.
+                virtual bool SetSampleFilter(const FilterConfig &filter)
+                {
+                    (void)filter;
+                    return false;
+                }
+
+                /// @brief Apply an event QoS profile on the next Subscribe()
+                /// @param qos Reliability, history, deadline, separation, priority
+                /// @returns True if the binding enforces the profile
+                /// @note Only honored while not subscribed.
+                virtual bool SetQosProfile(const EventQosProfile &qos)
+                {
+                    (void)qos;
+                    return false;
+                }
+
+                /// @brief Set callback invoked when the QoS deadline is missed
+                virtual void SetDeadlineMissedHandler(
+                    DeadlineMissedHandler handler)
+                {
+                    (void)handler;
+                }
+
+                /// @brief Remove deadline-missed callback
+                virtual void UnsetDeadlineMissedHandler()
+                {
+                }
+
+                /// @brief Whether GetNewLoanedSamples() can hand out transport memory
+                virtual bool SupportsSampleLoans() const noexcept
+                {
+                    return false;
+                }
+
+                /// @brief Retrieve buffered samples without copying them out of
+                ///        transport memory (e.g. iceoryx shared-memory chunks)
+                /// @param handler Callback receiving each loaned payload
+                /// @param maxNumberOfSamples Maximum number of samples to consume
+                /// @returns Number of samples consumed, or error if loans are unsupported
+                virtual core::Result<std::size_t> GetNewLoanedSamples(
+                    LoanedReceiveHandler handler,
+                    std::size_t maxNumberOfSamples)
+                {
+                    (void)handler;
+                    (void)maxNumberOfSamples;
+                    return core::Result<std::size_t>::FromError(
+                        MakeErrorCode(ComErrc::kCommunicationStackError));
+                }
+
                 /// @brief Set callback invoked when new data arrives (no-arg form per AP spec)
                 virtual void SetReceiveHandler(
                     std::function<void()> handler) = 0;
@@ -102,16 +169,56 @@ namespace ara
 
                 /// @brief Allocate a buffer for zero-copy send
                 /// @param size Desired buffer size in bytes
-                /// @returns Pointer to allocated buffer, or error
+                /// @returns Pointer to allocated buffer, aligned for any
+                ///          fundamental type, or error
                 virtual core::Result<void *> Allocate(
                     std::size_t size) = 0;
 
+                /// @brief Allocate a buffer for a sample of a known alignment
+                /// @param size Desired buffer size in bytes
+                /// @param alignment Alignment of the sample type, a power of
+                ///        two up to alignof(std::max_align_t)
+                /// @returns Pointer to allocated buffer, aligned at least to
+                ///          alignment, or error
+                /// @note The default ignores the alignment, as Allocate()
+                ///       already suits any fundamental type.
+                virtual core::Result<void *> AllocateAligned(
+                    std::size_t size, std::size_t alignment)
+                {
+                    static_cast<void>(alignment);
+                    return Allocate(size);
+                }
+
                 /// @brief Publish a previously allocated buffer (zero-copy path)
                 /// @param data Pointer obtained from Allocate()
                 /// @param size Size of the data
                 virtual core::Result<void> SendAllocated(
                     void *data, std::size_t size) = 0;
 
+                /// @brief Publish a frame that starts inside an allocated buffer
+                /// @param data Pointer obtained from Allocate()
+                /// @param offset Offset of the frame from data
+                /// @param size Size of the frame
+                /// @note The default moves the frame to the start of the
+                ///       buffer; copying bindings read it in place instead.
+                virtual core::Result<void> SendAllocatedFrame(
+                    void *data, std::size_t offset, std::size_t size)
+                {
+                    if (data != nullptr && offset > 0U)
+                    {
+                        std::memmove(
+                            data, static_cast<std::uint8_t *>(data) + offset, size);
+                    }
+                    return SendAllocated(data, size);
+                }
+
+                /// @brief Give back a buffer from Allocate() without publishing it
+                /// @param data Pointer obtained from Allocate()
+                virtual void Deallocate(void *data)
+                {
+                    std::free(data); // Default: Allocate() handed out heap memory
+                }
+
                 /// @brief Set the initial value to be delivered to new subscribers.
                 ///        For SOME/IP: triggers vsomeip notify(force=true) so that
                 ///        any new subscriber immediately receives the current field value.
@@ -0,0 +1,170 @@
+/// @file src/ara/com/internal/event_qos_monitor.cpp
+/// @brief Implementation for local EventQosProfile enforcement.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include <utility>
+#include "./event_qos_monitor.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            EventQosMonitor::EventQosMonitor()
+                : mState{std::make_shared<State>()}
+            {
+            }
+
+            EventQosMonitor::~EventQosMonitor() noexcept
+            {
+                Stop();
+            }
+
+            void EventQosMonitor::Configure(const EventQosProfile &qos) noexcept
+            {
+                std::lock_guard<std::recursive_mutex> lock(mState->Mutex);
+                mQos = qos;
+                mState->Deadline = std::chrono::duration_cast<Clock::duration>(
+                    std::max(qos.Deadline, std::chrono::milliseconds{0}));
+                mMinSeparation = std::chrono::duration_cast<Clock::duration>(
+                    std::max(qos.MinSeparation, std::chrono::milliseconds{0}));
+            }
+
+            const EventQosProfile &EventQosMonitor::GetQos() const noexcept
+            {
+                return mQos;
+            }
+
+            std::size_t EventQosMonitor::QueueCapacity(
+                std::size_t maxSampleCount,
+                const EventQosProfile &qos) noexcept
+            {
+                std::size_t capacity = std::max<std::size_t>(1U, maxSampleCount);
+                if (qos.History == HistoryKind::kKeepLast && qos.HistoryDepth > 0U)
+                {
+                    capacity = std::min<std::size_t>(capacity, qos.HistoryDepth);
+                }
+                return capacity;
+            }
+
+            void EventQosMonitor::SetDeadlineMissedHandler(
+                DeadlineMissedHandler handler)
+            {
+                std::lock_guard<std::recursive_mutex> lock(mState->Mutex);
+                mState->Handler = std::move(handler);
+            }
+
+            void EventQosMonitor::UnsetDeadlineMissedHandler()
+            {
+                std::lock_guard<std::recursive_mutex> lock(mState->Mutex);
+                mState->Handler = nullptr;
+            }
+
+            void EventQosMonitor::Start()
+            {
+                std::lock_guard<std::recursive_mutex> lock(mState->Mutex);
+                mHasAccepted = false;
+                mState->MissedCount.store(0U, std::memory_order_relaxed);
+                mState->LastArrival.store(
+                    Clock::now().time_since_epoch().count(),
+                    std::memory_order_relaxed);
+
+                if (mState->Running || mState->Deadline <= Clock::duration::zero())
+                {
+                    return;
+                }
+                mState->Running = true;
+                mState->LastReport = Clock::now();
+                arm(mState, mState->Deadline);
+            }
+
+            void EventQosMonitor::Stop() noexcept
+            {
+                std::lock_guard<std::recursive_mutex> lock(mState->Mutex);
+                if (mState->Running)
+                {
+                    mState->Running = false;
+                    ++mState->Generation;
+                    TimerWheel::Instance().Cancel(mState->Timer);
+                    mState->Timer = 0U;
+                }
+            }
+
+            bool EventQosMonitor::OnSample(Clock::time_point now) noexcept
+            {
+                // Every arrival proves the publisher alive, even the ones the
+                // rate limiter drops below.
+                mState->LastArrival.store(
+                    now.time_since_epoch().count(), std::memory_order_relaxed);
+
+                if (mMinSeparation > Clock::duration::zero() && mHasAccepted &&
+                    (now - mLastAccepted) < mMinSeparation)
+                {
+                    return false;
+                }
+                mLastAccepted = now;
+                mHasAccepted = true;
+                return true;
+            }
+
+            std::uint32_t EventQosMonitor::GetDeadlineMissedCount() const noexcept
+            {
+                return mState->MissedCount.load(std::memory_order_relaxed);
+            }
+
+            void EventQosMonitor::arm(
+                const std::shared_ptr<State> &state,
+                Clock::duration delay)
+            {
+                const std::uint64_t cGeneration{state->Generation};
+                std::weak_ptr<State> weakState{state};
+                state->Timer = TimerWheel::Instance().Schedule(
+                    delay,
+                    [weakState, cGeneration]()
+                    {
+                        std::shared_ptr<State> state{weakState.lock()};
+                        if (!state)
+                        {
+                            return;
+                        }
+
+                        std::lock_guard<std::recursive_mutex> lock(state->Mutex);
+                        if (state->Running && state->Generation == cGeneration)
+                        {
+                            check(state);
+                        }
+                    });
+            }
+
+            void EventQosMonitor::check(const std::shared_ptr<State> &state)
+            {
+                const Clock::time_point lastArrival{Clock::duration{
+                    state->LastArrival.load(std::memory_order_relaxed)}};
+                const Clock::time_point expiry =
+                    std::max(lastArrival, state->LastReport) + state->Deadline;
+                const Clock::time_point now{Clock::now()};
+                if (now < expiry)
+                {
+                    arm(state, expiry - now);
+                    return;
+                }
+
+                // Report once per silent period, then re-arm from now. The
+                // timer is re-armed first so that a Stop() from the handler
+                // cancels it.
+                state->LastReport = now;
+                const std::uint32_t total =
+                    state->MissedCount.fetch_add(
+                        1U, std::memory_order_relaxed) + 1U;
+                arm(state, state->Deadline);
+                const DeadlineMissedHandler handler{state->Handler};
+                if (handler)
+                {
+                    handler(total);
+                }
+            }
+        }
+    }
+}
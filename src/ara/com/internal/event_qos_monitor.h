@@ -0,0 +1,121 @@
+/// @file src/ara/com/internal/event_qos_monitor.h
+/// @brief Local EventQosProfile enforcement for transport bindings.
+/// @details Bindings whose transport has no native QoS (SOME/IP, iceoryx)
+///          use this monitor to apply the MinSeparation rate limit on the
+///          receive path and to watch the Deadline period of the publisher.
+///          A missed deadline is reported once per elapsed period through a
+///          DeadlineMissedHandler for as long as the publisher stays silent.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_INTERNAL_EVENT_QOS_MONITOR_H
+#define ARA_COM_INTERNAL_EVENT_QOS_MONITOR_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include "../qos.h"
+#include "./timer_wheel.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            /// @brief Deadline watchdog and MinSeparation rate limiter
+            /// @details The deadline is checked by one-shot timers on the
+            ///          shared TimerWheel, re-armed at the latest of the last
+            ///          arrival and the last report plus the Deadline period.
+            /// @note OnSample() is meant for a single receive thread; the
+            ///       other members may be called from any thread.
+            class EventQosMonitor
+            {
+            public:
+                /// @brief Monotonic clock used for all arrival timestamps
+                using Clock = std::chrono::steady_clock;
+
+            private:
+                // Shared with the wheel callbacks, which only hold it weakly.
+                struct State
+                {
+                    std::recursive_mutex Mutex;
+                    Clock::duration Deadline{Clock::duration::zero()};
+                    DeadlineMissedHandler Handler;
+                    bool Running{false};
+                    std::uint64_t Generation{0U};
+                    TimerWheel::TimerId Timer{0U};
+                    Clock::time_point LastReport;
+                    std::atomic<Clock::rep> LastArrival{0};
+                    std::atomic<std::uint32_t> MissedCount{0U};
+                };
+
+                EventQosProfile mQos;
+                Clock::duration mMinSeparation{Clock::duration::zero()};
+
+                Clock::time_point mLastAccepted;
+                bool mHasAccepted{false};
+
+                std::shared_ptr<State> mState;
+
+                static void arm(
+                    const std::shared_ptr<State> &state,
+                    Clock::duration delay);
+                static void check(const std::shared_ptr<State> &state);
+
+            public:
+                EventQosMonitor();
+                ~EventQosMonitor() noexcept;
+
+                EventQosMonitor(const EventQosMonitor &) = delete;
+                EventQosMonitor &operator=(const EventQosMonitor &) = delete;
+
+                /// @brief Replace the enforced profile
+                /// @param qos Event QoS profile
+                /// @note Only takes effect on the next Start().
+                void Configure(const EventQosProfile &qos) noexcept;
+
+                /// @brief Get the configured profile
+                const EventQosProfile &GetQos() const noexcept;
+
+                /// @brief Sample queue capacity implied by the profile
+                /// @param maxSampleCount Capacity requested by the application
+                /// @param qos Event QoS profile
+                /// @returns maxSampleCount, clamped to HistoryDepth for keep-last
+                static std::size_t QueueCapacity(
+                    std::size_t maxSampleCount,
+                    const EventQosProfile &qos) noexcept;
+
+                /// @brief Set the deadline-missed callback
+                /// @note Invoked from a TimerWheel executor thread. Stop()
+                ///       waits for a running handler, except when it is
+                ///       called from within the handler itself.
+                void SetDeadlineMissedHandler(DeadlineMissedHandler handler);
+
+                /// @brief Remove the deadline-missed callback
+                void UnsetDeadlineMissedHandler();
+
+                /// @brief Reset the rate limiter and arm the deadline watchdog
+                /// @note A deadline timer is only scheduled if a Deadline is set.
+                void Start();
+
+                /// @brief Stop the deadline watchdog
+                void Stop() noexcept;
+
+                /// @brief Record a sample arrival and apply MinSeparation
+                /// @param now Arrival time
+                /// @returns False if the sample arrived too soon after the
+                ///          previously accepted one and must be dropped
+                bool OnSample(Clock::time_point now = Clock::now()) noexcept;
+
+                /// @brief Number of deadline misses since the last Start()
+                std::uint32_t GetDeadlineMissedCount() const noexcept;
+            };
+        }
+    }
+}
+
+#endif
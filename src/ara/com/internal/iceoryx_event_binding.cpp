@@ -3,7 +3,10 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <iomanip>
+#include <memory>
 #include <sstream>
 #include "./iceoryx_event_binding.h"
 
@@ -29,8 +32,111 @@ namespace ara
                     result[3] = hex[id & 0xF];
                     return result;
                 }
+
+                /// @brief Handle to a taken chunk as stored in the sample ring.
+                struct ChunkRef
+                {
+                    const std::uint8_t *Payload;
+                    std::size_t Size;
+                };
+
+                ChunkRef decodeChunkRef(const std::uint8_t *data) noexcept
+                {
+                    ChunkRef chunk;
+                    std::memcpy(&chunk, data, sizeof(chunk));
+                    return chunk;
+                }
             } // namespace
 
+            // ── IceoryxProxyEventBinding::ChunkOwner ──────────────────────
+
+            class IceoryxProxyEventBinding::ChunkOwner
+            {
+            private:
+                std::mutex mMutex;
+                zerocopy::ZeroCopySubscriber mSubscriber;
+                std::atomic<std::size_t> mReferences{1U};
+
+                ~ChunkOwner() noexcept = default;
+
+            public:
+                /// @brief Drops one reference when a Handle goes out of scope.
+                struct Unreffer
+                {
+                    void operator()(ChunkOwner *owner) const noexcept
+                    {
+                        owner->Unref();
+                    }
+                };
+
+                /// @brief Reference held for the duration of one drain.
+                using Handle = std::unique_ptr<ChunkOwner, Unreffer>;
+
+                ChunkOwner(
+                    zerocopy::ChannelDescriptor channel,
+                    std::uint64_t queueCapacity,
+                    std::uint64_t historyRequest)
+                    : mSubscriber{
+                          std::move(channel), "ara_com_proxy",
+                          queueCapacity, historyRequest}
+                {
+                }
+
+                ChunkOwner(const ChunkOwner &) = delete;
+                ChunkOwner &operator=(const ChunkOwner &) = delete;
+
+                zerocopy::ZeroCopySubscriber &Subscriber() noexcept
+                {
+                    return mSubscriber;
+                }
+
+                core::Result<bool> TryTake(ChunkRef &chunk) noexcept
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    return mSubscriber.TryTakeChunk(chunk.Payload, chunk.Size);
+                }
+
+                void Release(const std::uint8_t *payload) noexcept
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mSubscriber.ReleaseChunk(payload);
+                }
+
+                void Ref() noexcept
+                {
+                    mReferences.fetch_add(1U, std::memory_order_relaxed);
+                }
+
+                void Unref() noexcept
+                {
+                    if (mReferences.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+                    {
+                        delete this;
+                    }
+                }
+
+                /// @brief SampleReleaser hook for chunks lent to the application.
+                static void ReleaseLoan(void *context, const void *sample) noexcept
+                {
+                    ChunkOwner *owner{static_cast<ChunkOwner *>(context)};
+                    owner->Release(static_cast<const std::uint8_t *>(sample));
+                    owner->Unref();
+                }
+
+                /// @brief SampleRing discard hook for queued chunk handles.
+                static void DiscardChunk(
+                    void *context,
+                    const std::uint8_t *data,
+                    std::size_t size)
+                {
+                    if (size == sizeof(ChunkRef))
+                    {
+                        static_cast<ChunkOwner *>(context)->Release(
+                            decodeChunkRef(data).Payload);
+                    }
+                }
+            };
+
             // ── IceoryxProxyEventBinding ───────────────────────────────────
 
             zerocopy::ChannelDescriptor
@@ -53,7 +159,7 @@ namespace ara
                 EventBindingConfig config,
                 QueueOverflowPolicy overflowPolicy) noexcept
                 : mConfig{config},
-                  mOverflowPolicy{overflowPolicy}
+                  mSampleRing{overflowPolicy}
             {
             }
 
@@ -76,8 +182,12 @@ namespace ara
                         return core::Result<void>::FromError(
                             MakeErrorCode(ComErrc::kFieldValueIsNotValid));
                     }
-                    mMaxSampleCount = std::max<std::size_t>(1U, maxSampleCount);
-                    mSampleQueue.clear();
+                    mMaxSampleCount =
+                        mHasQos ? EventQosMonitor::QueueCapacity(
+                                      maxSampleCount, mQosMonitor.GetQos())
+                                : std::max<std::size_t>(1U, maxSampleCount);
+                    mSampleRing.Reset(mMaxSampleCount, sizeof(ChunkRef));
+                    mQosMonitor.Start();
                     mState = SubscriptionState::kSubscriptionPending;
                     if (mStateChangeHandler)
                     {
@@ -90,10 +200,37 @@ namespace ara
                     pendingNotify(SubscriptionState::kSubscriptionPending);
                 }
 
-                mSubscriber.reset(new zerocopy::ZeroCopySubscriber{
+                // Late joiners only get the publisher's history when the
+                // profile asks for a non-volatile durability.
+                std::uint64_t historyRequest{0U};
+                if (mHasQos &&
+                    mQosMonitor.GetQos().Durability != DurabilityKind::kVolatile)
+                {
+                    historyRequest = std::min<std::uint64_t>(
+                        mQosMonitor.GetQos().HistoryDepth, mMaxSampleCount);
+                }
+
+                ChunkOwner *owner{new ChunkOwner{
                     makeChannel(mConfig),
-                    "ara_com_proxy",
-                    static_cast<std::uint64_t>(mMaxSampleCount)});
+                    static_cast<std::uint64_t>(mMaxSampleCount),
+                    historyRequest}};
+                mSampleRing.SetDiscardHook(&ChunkOwner::DiscardChunk, owner);
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mChunkOwner = owner;
+                }
+
+                zerocopy::ZeroCopySubscriber &subscriber{owner->Subscriber()};
+                mReceiveSource = BindingReactor::Instance().Register(
+                    [this] { drainChunks(); });
+                BindingReactor::Source *source{mReceiveSource.get()};
+                if (subscriber.IsBindingActive() &&
+                    !subscriber.SetDataCallback([source] { source->Notify(); }))
+                {
+                    Unsubscribe();
+                    return core::Result<void>::FromError(
+                        MakeErrorCode(ComErrc::kNetworkBindingFailure));
+                }
 
                 SubscriptionStateChangeHandler subscribedNotify;
                 {
@@ -110,38 +247,60 @@ namespace ara
                     subscribedNotify(SubscriptionState::kSubscribed);
                 }
 
-                mRunning.store(true, std::memory_order_relaxed);
-                mPollThread = std::thread([this] { pollLoop(); });
+                // History and anything that arrived before the callback was
+                // attached raised no notification.
+                if (subscriber.IsBindingActive())
+                {
+                    mReceiveSource->Notify();
+                }
 
                 return core::Result<void>::FromValue();
             }
 
             void IceoryxProxyEventBinding::Unsubscribe()
             {
-                mRunning.store(false, std::memory_order_relaxed);
-                if (mPollThread.joinable())
+                // Waits for a drain already running on the reactor.
+                ChunkOwner *owner{nullptr};
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    owner = mChunkOwner;
+                }
+                if (owner != nullptr)
+                {
+                    owner->Subscriber().UnsetDataCallback();
+                }
+                if (mReceiveSource)
                 {
-                    mPollThread.join();
+                    mReceiveSource->Close();
+                    mReceiveSource.reset();
                 }
+                mQosMonitor.Stop();
 
                 SubscriptionStateChangeHandler notify;
                 {
                     std::lock_guard<std::mutex> lock(mMutex);
                     if (mState == SubscriptionState::kNotSubscribed)
                     {
-                        mSubscriber.reset();
                         return;
                     }
                     mState = SubscriptionState::kNotSubscribed;
-                    mSampleQueue.clear();
+                    mSampleRing.Clear();
                     mReceiveHandler = nullptr;
+                    mChunkOwner = nullptr;
                     if (mStateChangeHandler)
                     {
                         notify = mStateChangeHandler;
                     }
                 }
 
-                mSubscriber.reset();
+                // Chunks still lent to the application, and a GetNewSamples()
+                // drain still in flight, keep the subscriber alive until they
+                // drop their own reference.
+                mSampleRing.SetDiscardHook(nullptr, nullptr);
+                if (owner != nullptr)
+                {
+                    owner->Unref();
+                }
 
                 if (notify)
                 {
@@ -166,35 +325,107 @@ namespace ara
                         MakeErrorCode(ComErrc::kSetHandlerNotSet));
                 }
 
-                std::size_t delivered = 0U;
-                while (delivered < maxNumberOfSamples)
+                ChunkOwner::Handle owner;
                 {
-                    std::vector<std::uint8_t> sample;
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (mState != SubscriptionState::kSubscribed)
                     {
-                        std::lock_guard<std::mutex> lock(mMutex);
-                        if (mState != SubscriptionState::kSubscribed)
-                        {
-                            if (delivered == 0U)
-                            {
-                                return core::Result<std::size_t>::FromError(
-                                    MakeErrorCode(ComErrc::kServiceNotAvailable));
-                            }
-                            break;
-                        }
-                        if (mSampleQueue.empty())
-                        {
-                            break;
-                        }
-                        sample = std::move(mSampleQueue.front());
-                        mSampleQueue.pop_front();
+                        return core::Result<std::size_t>::FromError(
+                            MakeErrorCode(ComErrc::kServiceNotAvailable));
                     }
-                    handler(sample.data(), sample.size());
-                    ++delivered;
+                    mChunkOwner->Ref();
+                    owner.reset(mChunkOwner);
                 }
 
+                const std::size_t delivered = mSampleRing.Drain(
+                    [&handler, &owner](const std::uint8_t *data, std::size_t)
+                    {
+                        const ChunkRef chunk{decodeChunkRef(data)};
+                        handler(chunk.Payload, chunk.Size);
+                        owner->Release(chunk.Payload);
+                    },
+                    maxNumberOfSamples);
                 return core::Result<std::size_t>::FromValue(delivered);
             }
 
+            bool IceoryxProxyEventBinding::SupportsSampleLoans() const noexcept
+            {
+                return true;
+            }
+
+            core::Result<std::size_t>
+            IceoryxProxyEventBinding::GetNewLoanedSamples(
+                LoanedReceiveHandler handler,
+                std::size_t maxNumberOfSamples)
+            {
+                if (!handler)
+                {
+                    return core::Result<std::size_t>::FromError(
+                        MakeErrorCode(ComErrc::kSetHandlerNotSet));
+                }
+
+                ChunkOwner::Handle owner;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (mState != SubscriptionState::kSubscribed)
+                    {
+                        return core::Result<std::size_t>::FromError(
+                            MakeErrorCode(ComErrc::kServiceNotAvailable));
+                    }
+                    mChunkOwner->Ref();
+                    owner.reset(mChunkOwner);
+                }
+
+                const std::size_t delivered = mSampleRing.Drain(
+                    [&handler, &owner](const std::uint8_t *data, std::size_t)
+                    {
+                        const ChunkRef chunk{decodeChunkRef(data)};
+                        owner->Ref();
+                        handler(
+                            chunk.Payload,
+                            chunk.Size,
+                            SampleReleaser{&ChunkOwner::ReleaseLoan, owner.get()});
+                    },
+                    maxNumberOfSamples);
+                return core::Result<std::size_t>::FromValue(delivered);
+            }
+
+            bool IceoryxProxyEventBinding::SetSampleFilter(
+                const FilterConfig &filter)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mState != SubscriptionState::kNotSubscribed)
+                {
+                    return false;
+                }
+                mSampleFilter.Configure(filter);
+                return true;
+            }
+
+            bool IceoryxProxyEventBinding::SetQosProfile(
+                const EventQosProfile &qos)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mState != SubscriptionState::kNotSubscribed)
+                {
+                    return false;
+                }
+                mQosMonitor.Configure(qos);
+                mHasQos = true;
+                return true;
+            }
+
+            void IceoryxProxyEventBinding::SetDeadlineMissedHandler(
+                DeadlineMissedHandler handler)
+            {
+                mQosMonitor.SetDeadlineMissedHandler(std::move(handler));
+            }
+
+            void IceoryxProxyEventBinding::UnsetDeadlineMissedHandler()
+            {
+                mQosMonitor.UnsetDeadlineMissedHandler();
+            }
+
             void IceoryxProxyEventBinding::SetReceiveHandler(
                 std::function<void()> handler)
             {
@@ -212,11 +443,12 @@ namespace ara
             IceoryxProxyEventBinding::GetFreeSampleCount() const noexcept
             {
                 std::lock_guard<std::mutex> lock(mMutex);
-                if (mSampleQueue.size() >= mMaxSampleCount)
+                const std::size_t buffered = mSampleRing.Size();
+                if (buffered >= mMaxSampleCount)
                 {
                     return 0U;
                 }
-                return mMaxSampleCount - mSampleQueue.size();
+                return mMaxSampleCount - buffered;
             }
 
             void IceoryxProxyEventBinding::SetSubscriptionStateChangeHandler(
@@ -232,62 +464,63 @@ namespace ara
                 mStateChangeHandler = nullptr;
             }
 
-            void IceoryxProxyEventBinding::pollLoop() noexcept
+            void IceoryxProxyEventBinding::drainChunks() noexcept
             {
-                static constexpr std::chrono::milliseconds cPollTimeout{50};
+                // The reactor never runs this concurrently with itself, which
+                // keeps the ring single-producer.
+                ChunkOwner::Handle owner;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (mChunkOwner == nullptr)
+                    {
+                        return;
+                    }
+                    mChunkOwner->Ref();
+                    owner.reset(mChunkOwner);
+                }
 
-                while (mRunning.load(std::memory_order_relaxed))
+                while (true)
                 {
-                    if (!mSubscriber || !mSubscriber->IsBindingActive())
+                    ChunkRef chunk{nullptr, 0U};
+                    const auto result = owner->TryTake(chunk);
+                    if (!result.HasValue())
+                    {
+                        // e.g. too many chunks held by the application; the
+                        // rest is picked up on the next arrival.
+                        break;
+                    }
+                    if (!result.Value())
                     {
-                        std::this_thread::sleep_for(cPollTimeout);
+                        break;
+                    }
+
+                    if (chunk.Payload == nullptr || chunk.Size == 0U ||
+                        !mQosMonitor.OnSample() ||
+                        !mSampleFilter.Accept(chunk.Payload, chunk.Size))
+                    {
+                        owner->Release(chunk.Payload);
                         continue;
                     }
 
-                    if (!mSubscriber->WaitForData(cPollTimeout))
+                    // The ring applies the overflow policy without locking
+                    // and releases evicted chunks through the discard hook.
+                    if (!mSampleRing.Push(
+                            reinterpret_cast<const std::uint8_t *>(&chunk),
+                            sizeof(chunk)))
                     {
+                        owner->Release(chunk.Payload);
                         continue;
                     }
 
-                    while (true)
+                    std::function<void()> notify;
+                    {
+                        std::lock_guard<std::mutex> lock(mMutex);
+                        notify = mReceiveHandler;
+                    }
+
+                    if (notify)
                     {
-                        zerocopy::ReceivedSample sample;
-                        const auto result = mSubscriber->TryTake(sample);
-                        if (!result.HasValue() || !result.Value())
-                        {
-                            break;
-                        }
-
-                        const auto *data = sample.Data();
-                        const auto size = sample.Size();
-                        if (data == nullptr || size == 0U)
-                        {
-                            continue;
-                        }
-
-                        std::function<void()> notify;
-                        {
-                            std::lock_guard<std::mutex> lock(mMutex);
-                            if (mSampleQueue.size() >= mMaxSampleCount)
-                            {
-                                if (mOverflowPolicy ==
-                                    QueueOverflowPolicy::kRejectNew)
-                                {
-                                    mDroppedSamples.fetch_add(
-                                        1U, std::memory_order_relaxed);
-                                    continue;
-                                }
-                                // kDropOldest: discard the oldest sample
-                                mSampleQueue.pop_front();
-                            }
-                            mSampleQueue.emplace_back(data, data + size);
-                            notify = mReceiveHandler;
-                        }
-
-                        if (notify)
-                        {
-                            notify();
-                        }
+                        notify();
                     }
                 }
             }
@@ -370,7 +603,8 @@ namespace ara
                 }
 
                 zerocopy::LoanedSample sample;
-                auto loanResult = mPublisher->Loan(size, sample);
+                auto loanResult = mPublisher->Loan(
+                    size, sample, alignof(std::max_align_t));
                 if (!loanResult.HasValue())
                 {
                     return core::Result<void *>::FromError(loanResult.Error());
@@ -416,6 +650,54 @@ namespace ara
                 return mPublisher->Publish(std::move(sample));
             }
 
+            core::Result<void> IceoryxSkeletonEventBinding::SendAllocatedFrame(
+                void *data, std::size_t offset, std::size_t size)
+            {
+                if (offset == 0U)
+                {
+                    return SendAllocated(data, size);
+                }
+
+                // A chunk is published whole. The E2E decorator starts the
+                // frame at the chunk unless the sample's alignment forces
+                // padding in front of the header; only then is the frame
+                // copied into a chunk of its own size.
+                zerocopy::LoanedSample sample;
+                {
+                    std::lock_guard<std::mutex> lock(mLoanMutex);
+                    auto it = mActiveLoans.find(data);
+                    if (it == mActiveLoans.end())
+                    {
+                        return core::Result<void>::FromError(
+                            MakeErrorCode(ComErrc::kFieldValueIsNotValid));
+                    }
+                    sample = std::move(it->second);
+                    mActiveLoans.erase(it);
+                }
+
+                if (!mOffered || !mPublisher)
+                {
+                    return core::Result<void>::FromError(
+                        MakeErrorCode(ComErrc::kServiceNotOffered));
+                }
+
+                zerocopy::LoanedSample frame;
+                auto loanResult = mPublisher->Loan(size, frame);
+                if (!loanResult.HasValue())
+                {
+                    return core::Result<void>::FromError(loanResult.Error());
+                }
+                std::memcpy(frame.Data(), sample.Data() + offset, size);
+                return mPublisher->Publish(std::move(frame));
+            }
+
+            void IceoryxSkeletonEventBinding::Deallocate(void *data)
+            {
+                // Dropping the LoanedSample releases the chunk back to iceoryx.
+                std::lock_guard<std::mutex> lock(mLoanMutex);
+                mActiveLoans.erase(data);
+            }
+
             void IceoryxSkeletonEventBinding::SetInitialValue(
                 const std::vector<std::uint8_t> &payload)
             {
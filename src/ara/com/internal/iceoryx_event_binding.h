@@ -2,9 +2,13 @@
 /// @brief iceoryx-backed ProxyEventBinding and SkeletonEventBinding.
 /// @details Wraps ZeroCopyPublisher / ZeroCopySubscriber in the abstract
 ///          ProxyEventBinding / SkeletonEventBinding interface.
-///          The ProxyEventBinding uses a background thread that calls
-///          ZeroCopySubscriber::WaitForData() and then drains samples
-///          into an internal deque, notifying the receive handler on arrival.
+///          The ProxyEventBinding registers a data callback on the process-wide
+///          iceoryx Listener that wakes a BindingReactor source; the reactor
+///          then queues handles to the received shared-memory chunks in a
+///          lock-free SampleRing and notifies the receive handler, so no
+///          thread is spawned per subscription. Payloads are never copied out of
+///          shared memory: GetNewSamples() reads them in place and
+///          GetNewLoanedSamples() lends the chunk itself to the application.
 ///          The SkeletonEventBinding publishes via PublishCopy() (copy path)
 ///          or via Loan() + Publish() (zero-copy path).
 ///
@@ -14,12 +18,14 @@
 #define ARA_COM_INTERNAL_ICEORYX_EVENT_BINDING_H
 
 #include <atomic>
-#include <deque>
 #include <mutex>
-#include <thread>
 #include <unordered_map>
+#include "./binding_reactor.h"
 #include "./event_binding.h"
+#include "./event_qos_monitor.h"
 #include "./queue_overflow_policy.h"
+#include "./sample_filter.h"
+#include "./sample_ring.h"
 #include "../com_error_domain.h"
 #include "../zerocopy/zero_copy.h"
 
@@ -32,29 +38,34 @@ namespace ara
         namespace internal
         {
             /// @brief iceoryx-based proxy-side event binding.
-            ///        A background polling thread drains ZeroCopySubscriber
-            ///        samples into an internal queue and fires the receive handler.
+            ///        The shared binding reactor takes ZeroCopySubscriber
+            ///        chunks into an internal queue and fires the receive handler.
+            ///        The QoS HistoryDepth sizes the iceoryx subscriber queue and,
+            ///        for non-volatile durability, its history request; Deadline
+            ///        and MinSeparation are enforced by a local EventQosMonitor.
             class IceoryxProxyEventBinding final : public ProxyEventBinding
             {
             private:
+                /// @brief Reference-counted subscriber that outlives the
+                ///        binding while loaned chunks are still held.
+                class ChunkOwner;
+
                 EventBindingConfig mConfig;
                 mutable std::mutex mMutex;
                 SubscriptionState mState{SubscriptionState::kNotSubscribed};
-                std::deque<std::vector<std::uint8_t>> mSampleQueue;
+                SampleRing mSampleRing;
+                SampleFilter mSampleFilter;
+                EventQosMonitor mQosMonitor;
+                bool mHasQos{false};
                 std::size_t mMaxSampleCount{16U};
                 std::function<void()> mReceiveHandler;
                 SubscriptionStateChangeHandler mStateChangeHandler;
-                QueueOverflowPolicy mOverflowPolicy{
-                    QueueOverflowPolicy::kDropOldest};
-
-                std::unique_ptr<zerocopy::ZeroCopySubscriber> mSubscriber;
-                std::atomic<bool> mRunning{false};
-                std::thread mPollThread;
 
-                /// @brief Dropped sample counter (incremented when policy rejects)
-                std::atomic<std::uint64_t> mDroppedSamples{0U};
+                /// @brief Guarded by mMutex; drains hold their own reference.
+                ChunkOwner *mChunkOwner{nullptr};
+                std::shared_ptr<BindingReactor::Source> mReceiveSource;
 
-                void pollLoop() noexcept;
+                void drainChunks() noexcept;
 
             public:
                 static zerocopy::ChannelDescriptor makeChannel(
@@ -79,6 +90,15 @@ namespace ara
                 core::Result<std::size_t> GetNewSamples(
                     RawReceiveHandler handler,
                     std::size_t maxNumberOfSamples) override;
+                bool SetSampleFilter(const FilterConfig &filter) override;
+                bool SetQosProfile(const EventQosProfile &qos) override;
+                void SetDeadlineMissedHandler(
+                    DeadlineMissedHandler handler) override;
+                void UnsetDeadlineMissedHandler() override;
+                bool SupportsSampleLoans() const noexcept override;
+                core::Result<std::size_t> GetNewLoanedSamples(
+                    LoanedReceiveHandler handler,
+                    std::size_t maxNumberOfSamples) override;
                 void SetReceiveHandler(std::function<void()> handler) override;
                 void UnsetReceiveHandler() override;
                 std::size_t GetFreeSampleCount() const noexcept override;
@@ -119,6 +139,9 @@ namespace ara
                 core::Result<void *> Allocate(std::size_t size) override;
                 core::Result<void> SendAllocated(
                     void *data, std::size_t size) override;
+                core::Result<void> SendAllocatedFrame(
+                    void *data, std::size_t offset, std::size_t size) override;
+                void Deallocate(void *data) override;
                 void SetInitialValue(
                     const std::vector<std::uint8_t> &payload) override;
             };
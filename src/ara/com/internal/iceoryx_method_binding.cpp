@@ -2,7 +2,7 @@
 /// @brief Implementation of iceoryx method binding.
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
-#include <algorithm>
+#include <vector>
 #include "./iceoryx_method_binding.h"
 
 #if ARA_COM_USE_ICEORYX
@@ -87,29 +87,29 @@ namespace ara
                 mRepSubscriber.reset(new zerocopy::ZeroCopySubscriber{
                     makeReplyChannel(mConfig), "ara_com_proxy_method", 64U});
 
-                mRunning.store(true, std::memory_order_relaxed);
-                mPollThread = std::thread([this] { pollLoop(); });
+                mScheduler = std::make_shared<MethodRequestScheduler>(
+                    [this](std::uint32_t sessionId,
+                           const std::vector<std::uint8_t> &requestPayload)
+                    {
+                        return transmit(sessionId, requestPayload);
+                    });
+
+                // Replies only follow our own requests, so there is nothing
+                // to drain before the callback is attached.
+                mReplySource = BindingReactor::Instance().Register(
+                    [this] { drainReplies(); });
+                BindingReactor::Source *source{mReplySource.get()};
+                mRepSubscriber->SetDataCallback([source] { source->Notify(); });
             }
 
             IceoryxProxyMethodBinding::~IceoryxProxyMethodBinding() noexcept
             {
-                mRunning.store(false, std::memory_order_relaxed);
-                if (mPollThread.joinable())
-                {
-                    mPollThread.join();
-                }
+                mRepSubscriber->UnsetDataCallback();
+                mReplySource->Close();
 
-                // Fail any pending calls
-                std::unordered_map<std::uint32_t, PendingCall> pending;
-                {
-                    std::lock_guard<std::mutex> lock(mMutex);
-                    pending.swap(mPending);
-                }
-                for (auto &kv : pending)
-                {
-                    kv.second.Handler(core::Result<std::vector<std::uint8_t>>::FromError(
-                        MakeErrorCode(ComErrc::kNetworkBindingFailure)));
-                }
+                // Fails the pending calls and waits for a running transmit.
+                mScheduler->Shutdown(
+                    MakeErrorCode(ComErrc::kNetworkBindingFailure));
 
                 mRepSubscriber.reset();
                 mReqPublisher.reset();
@@ -127,135 +127,66 @@ namespace ara
                     return;
                 }
 
-                const std::uint32_t sessionId =
-                    mNextSessionId.fetch_add(1U, std::memory_order_relaxed);
+                mScheduler->Submit(requestPayload, std::move(responseHandler));
+            }
 
-                {
-                    std::lock_guard<std::mutex> lock(mMutex);
-                    PendingCall pc;
-                    pc.Handler = std::move(responseHandler);
-                    pc.Deadline = std::chrono::steady_clock::now() + mTimeout;
-                    mPending.emplace(sessionId, std::move(pc));
-                }
+            bool IceoryxProxyMethodBinding::SetQosProfile(
+                const MethodQosProfile &qos)
+            {
+                mScheduler->SetQosProfile(qos);
+                return true;
+            }
 
+            bool IceoryxProxyMethodBinding::transmit(
+                std::uint32_t sessionId,
+                const std::vector<std::uint8_t> &requestPayload)
+            {
                 // Framing: [4-byte session_id LE] + [request bytes]
                 std::vector<std::uint8_t> frame;
                 frame.reserve(4U + requestPayload.size());
                 encodeU32LE(sessionId, frame);
                 frame.insert(frame.end(), requestPayload.begin(), requestPayload.end());
 
-                auto result = mReqPublisher->PublishCopy(frame);
-                if (!result.HasValue())
-                {
-                    RawResponseHandler handler;
-                    {
-                        std::lock_guard<std::mutex> lock(mMutex);
-                        auto it = mPending.find(sessionId);
-                        if (it != mPending.end())
-                        {
-                            handler = std::move(it->second.Handler);
-                            mPending.erase(it);
-                        }
-                    }
-                    if (handler)
-                    {
-                        handler(core::Result<std::vector<std::uint8_t>>::FromError(
-                            MakeErrorCode(ComErrc::kCommunicationStackError)));
-                    }
-                }
+                return mReqPublisher->PublishCopy(frame).HasValue();
             }
 
-            void IceoryxProxyMethodBinding::pollLoop() noexcept
+            void IceoryxProxyMethodBinding::drainReplies() noexcept
             {
-                static constexpr std::chrono::milliseconds cPollTimeout{50};
-
-                while (mRunning.load(std::memory_order_relaxed))
+                while (true)
                 {
-                    if (!mRepSubscriber || !mRepSubscriber->IsBindingActive())
+                    zerocopy::ReceivedSample sample;
+                    const auto taken = mRepSubscriber->TryTake(sample);
+                    if (!taken.HasValue() || !taken.Value())
                     {
-                        std::this_thread::sleep_for(cPollTimeout);
-                        continue;
+                        break;
                     }
 
-                    if (!mRepSubscriber->WaitForData(cPollTimeout))
+                    const auto *data = sample.Data();
+                    const auto size = sample.Size();
+
+                    // Framing: [4-byte session_id] [4-byte is_error] [reply bytes]
+                    std::uint32_t sessionId = 0U;
+                    std::uint32_t isError = 0U;
+                    if (!decodeU32LE(data, size, 0U, sessionId) ||
+                        !decodeU32LE(data, size, 4U, isError))
                     {
-                        // Check for timed-out pending calls
-                        auto now = std::chrono::steady_clock::now();
-                        std::vector<RawResponseHandler> timedOut;
-                        {
-                            std::lock_guard<std::mutex> lock(mMutex);
-                            for (auto it = mPending.begin(); it != mPending.end();)
-                            {
-                                if (now >= it->second.Deadline)
-                                {
-                                    timedOut.push_back(std::move(it->second.Handler));
-                                    it = mPending.erase(it);
-                                }
-                                else
-                                {
-                                    ++it;
-                                }
-                            }
-                        }
-                        for (auto &h : timedOut)
-                        {
-                            h(core::Result<std::vector<std::uint8_t>>::FromError(
-                                MakeErrorCode(ComErrc::kCommunicationStackError)));
-                        }
                         continue;
                     }
 
-                    while (true)
+                    if (isError != 0U)
                     {
-                        zerocopy::ReceivedSample sample;
-                        const auto taken = mRepSubscriber->TryTake(sample);
-                        if (!taken.HasValue() || !taken.Value())
-                        {
-                            break;
-                        }
-
-                        const auto *data = sample.Data();
-                        const auto size = sample.Size();
-
-                        // Framing: [4-byte session_id] [4-byte is_error] [reply bytes]
-                        std::uint32_t sessionId = 0U;
-                        std::uint32_t isError = 0U;
-                        if (!decodeU32LE(data, size, 0U, sessionId) ||
-                            !decodeU32LE(data, size, 4U, isError))
-                        {
-                            continue;
-                        }
-
-                        RawResponseHandler handler;
-                        {
-                            std::lock_guard<std::mutex> lock(mMutex);
-                            auto it = mPending.find(sessionId);
-                            if (it != mPending.end())
-                            {
-                                handler = std::move(it->second.Handler);
-                                mPending.erase(it);
-                            }
-                        }
-
-                        if (!handler)
-                        {
-                            continue;
-                        }
-
-                        if (isError != 0U)
-                        {
-                            handler(core::Result<std::vector<std::uint8_t>>::FromError(
+                        mScheduler->Complete(
+                            sessionId,
+                            core::Result<std::vector<std::uint8_t>>::FromError(
                                 MakeErrorCode(ComErrc::kCommunicationStackError)));
-                        }
-                        else
-                        {
-                            const std::size_t headerSize = 8U; // session_id + is_error
-                            const std::vector<std::uint8_t> replyPayload(
-                                data + headerSize,
-                                data + size);
-                            handler(core::Result<std::vector<std::uint8_t>>::FromValue(
-                                replyPayload));
-                        }
+                    }
+                    else
+                    {
+                        const std::size_t headerSize = 8U; // session_id + is_error
+                        mScheduler->Complete(
+                            sessionId,
+                            core::Span<const std::uint8_t>(
+                                data + headerSize, size - headerSize));
                     }
                 }
             }
@@ -287,14 +218,6 @@ namespace ara
                     mHandler = std::move(handler);
                 }
 
-                if (!mReqSubscriber)
-                {
-                    mReqSubscriber.reset(new zerocopy::ZeroCopySubscriber{
-                        IceoryxProxyMethodBinding::makeRequestChannel(mConfig),
-                        "ara_com_skeleton_method",
-                        64U});
-                }
-
                 if (!mRepPublisher)
                 {
                     mRepPublisher.reset(new zerocopy::ZeroCopyPublisher{
@@ -302,10 +225,30 @@ namespace ara
                         "ara_com_skeleton_method"});
                 }
 
-                if (!mServiceThread.joinable())
+                if (!mReqSubscriber)
                 {
-                    mRunning.store(true, std::memory_order_relaxed);
-                    mServiceThread = std::thread([this] { serviceLoop(); });
+                    mReqSubscriber.reset(new zerocopy::ZeroCopySubscriber{
+                        IceoryxProxyMethodBinding::makeRequestChannel(mConfig),
+                        "ara_com_skeleton_method",
+                        64U});
+
+                    if (mReqSubscriber->IsBindingActive())
+                    {
+                        mRequestSource = BindingReactor::Instance().Register(
+                            [this] { drainRequests(); });
+                        BindingReactor::Source *source{mRequestSource.get()};
+                        if (!mReqSubscriber->SetDataCallback(
+                                [source] { source->Notify(); }))
+                        {
+                            Unregister();
+                            return core::Result<void>::FromError(
+                                MakeErrorCode(ComErrc::kNetworkBindingFailure));
+                        }
+
+                        // Requests that arrived before the callback was
+                        // attached raised no notification.
+                        mRequestSource->Notify();
+                    }
                 }
 
                 return core::Result<void>::FromValue();
@@ -313,10 +256,15 @@ namespace ara
 
             void IceoryxSkeletonMethodBinding::Unregister()
             {
-                mRunning.store(false, std::memory_order_relaxed);
-                if (mServiceThread.joinable())
+                // Waits for a dispatch already running on the reactor.
+                if (mReqSubscriber)
+                {
+                    mReqSubscriber->UnsetDataCallback();
+                }
+                if (mRequestSource)
                 {
-                    mServiceThread.join();
+                    mRequestSource->Close();
+                    mRequestSource.reset();
                 }
 
                 {
@@ -328,81 +276,65 @@ namespace ara
                 mReqSubscriber.reset();
             }
 
-            void IceoryxSkeletonMethodBinding::serviceLoop() noexcept
+            void IceoryxSkeletonMethodBinding::drainRequests() noexcept
             {
-                static constexpr std::chrono::milliseconds cPollTimeout{50};
-
-                while (mRunning.load(std::memory_order_relaxed))
+                while (true)
                 {
-                    if (!mReqSubscriber || !mReqSubscriber->IsBindingActive())
+                    zerocopy::ReceivedSample sample;
+                    const auto taken = mReqSubscriber->TryTake(sample);
+                    if (!taken.HasValue() || !taken.Value())
                     {
-                        std::this_thread::sleep_for(cPollTimeout);
-                        continue;
+                        break;
                     }
 
-                    if (!mReqSubscriber->WaitForData(cPollTimeout))
+                    const auto *data = sample.Data();
+                    const auto size = sample.Size();
+
+                    // Framing: [4-byte session_id] [request bytes]
+                    std::uint32_t sessionId = 0U;
+                    if (!decodeU32LE(data, size, 0U, sessionId))
                     {
                         continue;
                     }
 
-                    while (true)
-                    {
-                        zerocopy::ReceivedSample sample;
-                        const auto taken = mReqSubscriber->TryTake(sample);
-                        if (!taken.HasValue() || !taken.Value())
-                        {
-                            break;
-                        }
-
-                        const auto *data = sample.Data();
-                        const auto size = sample.Size();
-
-                        // Framing: [4-byte session_id] [request bytes]
-                        std::uint32_t sessionId = 0U;
-                        if (!decodeU32LE(data, size, 0U, sessionId))
-                        {
-                            continue;
-                        }
-
-                        const std::size_t headerSize = 4U;
-                        const std::vector<std::uint8_t> reqPayload(
-                            data + headerSize, data + size);
+                    const std::size_t headerSize = 4U;
+                    const core::Span<const std::uint8_t> reqPayload(
+                        data + headerSize, size - headerSize);
 
-                        RawRequestHandler handler;
-                        {
-                            std::lock_guard<std::mutex> lock(mMutex);
-                            handler = mHandler;
-                        }
+                    RawRequestHandler handler;
+                    {
+                        std::lock_guard<std::mutex> lock(mMutex);
+                        handler = mHandler;
+                    }
 
-                        // Build reply frame: [4-byte session_id] [4-byte is_error] [reply bytes]
-                        std::vector<std::uint8_t> replyFrame;
-                        encodeU32LE(sessionId, replyFrame);
+                    // Build reply frame: [4-byte session_id] [4-byte is_error] [reply bytes]
+                    std::vector<std::uint8_t> replyFrame;
+                    encodeU32LE(sessionId, replyFrame);
 
-                        if (handler)
+                    if (handler)
+                    {
+                        auto result = handler(reqPayload);
+                        if (result.HasValue())
                         {
-                            auto result = handler(reqPayload);
-                            if (result.HasValue())
-                            {
-                                encodeU32LE(0U, replyFrame); // is_error = 0
-                                const auto &respPayload = result.Value();
-                                replyFrame.insert(replyFrame.end(),
-                                                  respPayload.begin(),
-                                                  respPayload.end());
-                            }
-                            else
-                            {
-                                encodeU32LE(1U, replyFrame); // is_error = 1
-                            }
+                            encodeU32LE(0U, replyFrame); // is_error = 0
+                            const auto &respPayload = result.Value();
+                            replyFrame.insert(replyFrame.end(),
+                                              respPayload.begin(),
+                                              respPayload.end());
                         }
                         else
                         {
-                            encodeU32LE(1U, replyFrame); // is_error = 1 (no handler)
+                            encodeU32LE(1U, replyFrame); // is_error = 1
                         }
+                    }
+                    else
+                    {
+                        encodeU32LE(1U, replyFrame); // is_error = 1 (no handler)
+                    }
 
-                        if (mRepPublisher)
-                        {
-                            mRepPublisher->PublishCopy(replyFrame);
-                        }
+                    if (mRepPublisher)
+                    {
+                        mRepPublisher->PublishCopy(replyFrame);
                     }
                 }
             }
@@ -12,22 +12,23 @@
 ///            Reply   payload: [4-byte session_id LE] + [4-byte is_error LE]
 ///                             + [serialized return value (empty on error)]
 ///
-///          The proxy publishes requests and subscribes to replies; a
-///          background poll thread dispatches response handlers keyed by
-///          session ID.  The skeleton subscribes to requests and publishes
-///          replies; a background service thread calls the registered handler.
+///          The proxy publishes requests and subscribes to replies; its
+///          MethodRequestScheduler owns the pending calls, their timeouts and
+///          retries, and replies are matched to it on the shared BindingReactor
+///          when the process-wide iceoryx Listener signals one.  The skeleton
+///          subscribes to requests and publishes replies; the registered handler
+///          runs on the reactor as well, so no thread is spawned per method.
 ///
 ///          This file is part of the Adaptive AUTOSAR educational implementation.
 
 #ifndef ARA_COM_INTERNAL_ICEORYX_METHOD_BINDING_H
 #define ARA_COM_INTERNAL_ICEORYX_METHOD_BINDING_H
 
-#include <atomic>
-#include <chrono>
+#include <memory>
 #include <mutex>
-#include <thread>
-#include <unordered_map>
+#include "./binding_reactor.h"
 #include "./method_binding.h"
+#include "./method_request_scheduler.h"
 #include "../com_error_domain.h"
 #include "../zerocopy/zero_copy.h"
 
@@ -39,10 +40,6 @@ namespace ara
     {
         namespace internal
         {
-            /// @brief Default method call timeout for iceoryx bindings.
-            static constexpr std::chrono::milliseconds
-                cDefaultMethodTimeout{5000};
-
             /// @brief iceoryx-based proxy-side method binding.
             ///        Publishes serialized requests on a request channel and
             ///        receives serialized replies on a reply channel.
@@ -50,24 +47,17 @@ namespace ara
             {
             private:
                 MethodBindingConfig mConfig;
-                std::mutex mMutex;
-                std::atomic<std::uint32_t> mNextSessionId{1U};
-
-                struct PendingCall
-                {
-                    RawResponseHandler Handler;
-                    std::chrono::steady_clock::time_point Deadline;
-                };
-                std::unordered_map<std::uint32_t, PendingCall> mPending;
 
                 std::unique_ptr<zerocopy::ZeroCopyPublisher> mReqPublisher;
                 std::unique_ptr<zerocopy::ZeroCopySubscriber> mRepSubscriber;
 
-                std::atomic<bool> mRunning{false};
-                std::thread mPollThread;
-                std::chrono::milliseconds mTimeout{cDefaultMethodTimeout};
+                std::shared_ptr<MethodRequestScheduler> mScheduler;
+                std::shared_ptr<BindingReactor::Source> mReplySource;
 
-                void pollLoop() noexcept;
+                bool transmit(
+                    std::uint32_t sessionId,
+                    const std::vector<std::uint8_t> &requestPayload);
+                void drainReplies() noexcept;
 
             public:
                 static zerocopy::ChannelDescriptor makeRequestChannel(
@@ -87,6 +77,8 @@ namespace ara
                 void Call(
                     const std::vector<std::uint8_t> &requestPayload,
                     RawResponseHandler responseHandler) override;
+
+                bool SetQosProfile(const MethodQosProfile &qos) override;
             };
 
             /// @brief iceoryx-based skeleton-side method binding.
@@ -102,10 +94,9 @@ namespace ara
                 std::unique_ptr<zerocopy::ZeroCopySubscriber> mReqSubscriber;
                 std::unique_ptr<zerocopy::ZeroCopyPublisher> mRepPublisher;
 
-                std::atomic<bool> mRunning{false};
-                std::thread mServiceThread;
+                std::shared_ptr<BindingReactor::Source> mRequestSource;
 
-                void serviceLoop() noexcept;
+                void drainRequests() noexcept;
 
             public:
                 explicit IceoryxSkeletonMethodBinding(
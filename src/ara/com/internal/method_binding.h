@@ -8,7 +8,9 @@
 #include <cstdint>
 #include <functional>
 #include <vector>
+#include "../qos.h"
 #include "../../core/result.h"
+#include "../../core/span.h"
 
 namespace ara
 {
@@ -45,6 +47,15 @@ namespace ara
                 virtual void Call(
                     const std::vector<std::uint8_t> &requestPayload,
                     RawResponseHandler responseHandler) = 0;
+
+                /// @brief Apply a method QoS profile to subsequent calls
+                /// @param qos Timeout, concurrency window, retry and priority
+                /// @returns True if the binding enforces the profile
+                virtual bool SetQosProfile(const MethodQosProfile &qos)
+                {
+                    (void)qos;
+                    return false;
+                }
             };
 
             /// @brief Abstract skeleton-side method binding.
@@ -53,9 +64,11 @@ namespace ara
             {
             public:
                 /// @brief Handler type: receives request bytes, returns response bytes
+                /// @note The request view is only valid during the call; it
+                ///       may point into the transport's receive buffer.
                 using RawRequestHandler =
                     std::function<core::Result<std::vector<std::uint8_t>>(
-                        const std::vector<std::uint8_t> &)>;
+                        core::Span<const std::uint8_t>)>;
 
                 virtual ~SkeletonMethodBinding() noexcept = default;
 
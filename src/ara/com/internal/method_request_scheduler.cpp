@@ -0,0 +1,380 @@
+/// @file src/ara/com/internal/method_request_scheduler.cpp
+/// @brief Implementation for the proxy-side method request scheduler.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include <utility>
+#include "./method_request_scheduler.h"
+#include "./binding_reactor.h"
+#include "../com_error_domain.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            namespace
+            {
+                /// @brief Cap of the exponential backoff (RetryDelay * 2^16).
+                const std::uint32_t cMaxBackoffShift{16U};
+
+                core::Result<std::vector<std::uint8_t>> errorResult(
+                    const core::ErrorCode &error)
+                {
+                    return core::Result<std::vector<std::uint8_t>>::FromError(error);
+                }
+            }
+
+            MethodRequestScheduler::MethodRequestScheduler(
+                TransmitFunction transmit,
+                std::uint32_t maxSessionId,
+                TimerWheel &timers)
+                : mTransmit{std::move(transmit)},
+                  mMaxSessionId{std::max<std::uint32_t>(1U, maxSessionId)},
+                  mTimers{timers}
+            {
+            }
+
+            MethodRequestScheduler::~MethodRequestScheduler() noexcept
+            {
+                Shutdown(MakeErrorCode(ComErrc::kNetworkBindingFailure));
+            }
+
+            void MethodRequestScheduler::SetQosProfile(const MethodQosProfile &qos)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mQos = qos;
+                }
+                pump();
+            }
+
+            MethodQosProfile MethodRequestScheduler::GetQosProfile()
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                return mQos;
+            }
+
+            void MethodRequestScheduler::Submit(
+                std::vector<std::uint8_t> payload,
+                ResponseHandler handler)
+            {
+                std::uint8_t priority;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    priority = mQos.Priority;
+                }
+                Submit(std::move(payload), std::move(handler), priority);
+            }
+
+            void MethodRequestScheduler::Submit(
+                std::vector<std::uint8_t> payload,
+                ResponseHandler handler,
+                std::uint8_t priority)
+            {
+                Request request{
+                    std::make_shared<const std::vector<std::uint8_t>>(
+                        std::move(payload)),
+                    std::move(handler),
+                    0U};
+
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (!mClosed)
+                    {
+                        mWaiting.emplace(
+                            QueueKey{priority, mNextSequence++},
+                            std::move(request));
+                        request.Handler = nullptr;
+                    }
+                }
+
+                if (request.Handler)
+                {
+                    request.Handler(errorResult(
+                        MakeErrorCode(ComErrc::kNetworkBindingFailure)));
+                    return;
+                }
+                pump();
+            }
+
+            bool MethodRequestScheduler::takeHandler(
+                std::uint32_t sessionId, ResponseHandler &handler)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                auto it = mInFlight.find(sessionId);
+                if (it == mInFlight.end())
+                {
+                    return false;
+                }
+                mTimers.Cancel(it->second.Timer);
+                handler = std::move(it->second.Call.Handler);
+                mInFlight.erase(it);
+                --mActive;
+                return true;
+            }
+
+            bool MethodRequestScheduler::Complete(
+                std::uint32_t sessionId,
+                core::Result<std::vector<std::uint8_t>> result)
+            {
+                ResponseHandler handler;
+                if (!takeHandler(sessionId, handler))
+                {
+                    return false;
+                }
+
+                handler(std::move(result));
+                pump();
+                return true;
+            }
+
+            bool MethodRequestScheduler::Complete(
+                std::uint32_t sessionId,
+                core::Span<const std::uint8_t> payload)
+            {
+                ResponseHandler handler;
+                if (!takeHandler(sessionId, handler))
+                {
+                    return false;
+                }
+
+                handler(core::Result<std::vector<std::uint8_t>>::FromValue(
+                    std::vector<std::uint8_t>(payload.begin(), payload.end())));
+                pump();
+                return true;
+            }
+
+            void MethodRequestScheduler::Shutdown(core::ErrorCode error)
+            {
+                std::vector<ResponseHandler> handlers;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mClosed = true;
+                    for (auto &entry : mWaiting)
+                    {
+                        handlers.push_back(std::move(entry.second.Handler));
+                    }
+                    for (auto &entry : mInFlight)
+                    {
+                        mTimers.Cancel(entry.second.Timer);
+                        handlers.push_back(std::move(entry.second.Call.Handler));
+                    }
+                    for (auto &entry : mBackoff)
+                    {
+                        mTimers.Cancel(entry.second.Timer);
+                        handlers.push_back(std::move(entry.second.Call.Handler));
+                    }
+                    mWaiting.clear();
+                    mInFlight.clear();
+                    mBackoff.clear();
+                    mActive = 0U;
+                }
+
+                {
+                    // Wait for a transmission that is still running.
+                    std::lock_guard<std::recursive_mutex> transmitLock(mTransmitMutex);
+                }
+
+                for (auto &handler : handlers)
+                {
+                    handler(errorResult(error));
+                }
+            }
+
+            std::size_t MethodRequestScheduler::ActiveCount()
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                return mActive;
+            }
+
+            std::size_t MethodRequestScheduler::QueuedCount()
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                return mWaiting.size();
+            }
+
+            std::size_t MethodRequestScheduler::windowSize() const noexcept
+            {
+                return std::max<std::size_t>(
+                    1U,
+                    std::min<std::uint32_t>(
+                        mQos.MaxConcurrentRequests, mMaxSessionId));
+            }
+
+            std::uint32_t MethodRequestScheduler::allocateSessionId()
+            {
+                // The window never exceeds mMaxSessionId, so a free ID exists.
+                while (true)
+                {
+                    const std::uint32_t sessionId{mNextSessionId};
+                    mNextSessionId =
+                        sessionId >= mMaxSessionId ? 1U : sessionId + 1U;
+                    if (mInFlight.find(sessionId) == mInFlight.end())
+                    {
+                        return sessionId;
+                    }
+                }
+            }
+
+            void MethodRequestScheduler::pump()
+            {
+                std::vector<Request> ready;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    while (!mClosed &&
+                           !mWaiting.empty() &&
+                           mActive < windowSize())
+                    {
+                        ready.push_back(std::move(mWaiting.begin()->second));
+                        mWaiting.erase(mWaiting.begin());
+                        ++mActive;
+                    }
+                }
+
+                for (auto &request : ready)
+                {
+                    launch(std::move(request));
+                }
+            }
+
+            void MethodRequestScheduler::launch(Request request)
+            {
+                const Payload data{request.Data};
+                std::uint32_t sessionId{0U};
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (!mClosed)
+                    {
+                        sessionId = allocateSessionId();
+                        TimerWheel::TimerId timer{0U};
+                        if (mQos.ResponseTimeout.count() > 0)
+                        {
+                            std::weak_ptr<MethodRequestScheduler> weak{
+                                shared_from_this()};
+                            timer = mTimers.Schedule(
+                                mQos.ResponseTimeout,
+                                [weak, sessionId]
+                                {
+                                    BindingReactor::Instance().Post(
+                                        [weak, sessionId]
+                                        {
+                                            if (auto self = weak.lock())
+                                            {
+                                                self->onTimeout(sessionId);
+                                            }
+                                        });
+                                });
+                        }
+                        mInFlight.emplace(
+                            sessionId, InFlightCall{std::move(request), timer});
+                        request.Handler = nullptr;
+                    }
+                }
+
+                if (request.Handler)
+                {
+                    // Taken off the queue before Shutdown() ran.
+                    request.Handler(errorResult(
+                        MakeErrorCode(ComErrc::kNetworkBindingFailure)));
+                    return;
+                }
+
+                bool sent{true};
+                {
+                    std::lock_guard<std::recursive_mutex> transmitLock(mTransmitMutex);
+                    bool closed;
+                    {
+                        std::lock_guard<std::mutex> lock(mMutex);
+                        closed = mClosed;
+                    }
+                    if (!closed)
+                    {
+                        sent = mTransmit(sessionId, *data);
+                    }
+                }
+
+                if (!sent)
+                {
+                    expire(sessionId, true);
+                }
+            }
+
+            void MethodRequestScheduler::expire(
+                std::uint32_t sessionId, bool cancelTimer)
+            {
+                ResponseHandler handler;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    auto it = mInFlight.find(sessionId);
+                    if (it == mInFlight.end())
+                    {
+                        return;
+                    }
+                    if (cancelTimer)
+                    {
+                        mTimers.Cancel(it->second.Timer);
+                    }
+                    Request call{std::move(it->second.Call)};
+                    mInFlight.erase(it);
+
+                    if (mQos.AutoRetry && call.Attempt < mQos.MaxRetries)
+                    {
+                        // Keeps its window slot while backing off.
+                        const std::uint32_t shift{
+                            std::min(call.Attempt, cMaxBackoffShift)};
+                        ++call.Attempt;
+                        const std::uint64_t key{mNextSequence++};
+                        std::weak_ptr<MethodRequestScheduler> weak{
+                            shared_from_this()};
+                        const TimerWheel::TimerId timer{mTimers.Schedule(
+                            mQos.RetryDelay * (1 << shift),
+                            [weak, key]
+                            {
+                                BindingReactor::Instance().Post(
+                                    [weak, key]
+                                    {
+                                        if (auto self = weak.lock())
+                                        {
+                                            self->onRetry(key);
+                                        }
+                                    });
+                            })};
+                        mBackoff.emplace(key, InFlightCall{std::move(call), timer});
+                        return;
+                    }
+
+                    handler = std::move(call.Handler);
+                    --mActive;
+                }
+
+                handler(errorResult(
+                    MakeErrorCode(ComErrc::kCommunicationStackError)));
+                pump();
+            }
+
+            void MethodRequestScheduler::onTimeout(std::uint32_t sessionId)
+            {
+                expire(sessionId, false);
+            }
+
+            void MethodRequestScheduler::onRetry(std::uint64_t key)
+            {
+                Request request;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    auto it = mBackoff.find(key);
+                    if (it == mBackoff.end())
+                    {
+                        return;
+                    }
+                    request = std::move(it->second.Call);
+                    mBackoff.erase(it);
+                }
+
+                launch(std::move(request));
+            }
+        }
+    }
+}
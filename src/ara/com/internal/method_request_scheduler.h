@@ -0,0 +1,175 @@
+/// @file src/ara/com/internal/method_request_scheduler.h
+/// @brief Proxy-side request scheduler enforcing a MethodQosProfile.
+/// @details Each proxy method binding owns one scheduler that holds its
+///          pending-call table. The scheduler:
+///          - caps in-flight calls at MaxConcurrentRequests and queues the
+///            overflow, higher Priority first and FIFO within a priority;
+///          - arms one timer per call on the shared TimerWheel instead of a
+///            thread or a periodic sweep;
+///          - resends timed-out or unsendable calls up to MaxRetries times
+///            when AutoRetry is set, doubling RetryDelay on each attempt.
+///
+///          Bindings only transmit frames tagged with the session ID the
+///          scheduler assigns and report replies with Complete(). Expiries
+///          are dispatched on the shared BindingReactor.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_INTERNAL_METHOD_REQUEST_SCHEDULER_H
+#define ARA_COM_INTERNAL_METHOD_REQUEST_SCHEDULER_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "./method_binding.h"
+#include "./timer_wheel.h"
+#include "../qos.h"
+#include "../../core/error_code.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            /// @brief Call window, timeout and retry engine of one proxy method
+            class MethodRequestScheduler
+                : public std::enable_shared_from_this<MethodRequestScheduler>
+            {
+            public:
+                using ResponseHandler = ProxyMethodBinding::RawResponseHandler;
+
+                /// @brief Sends one request frame
+                /// @returns False if the transport rejected the frame
+                using TransmitFunction = std::function<bool(
+                    std::uint32_t sessionId,
+                    const std::vector<std::uint8_t> &payload)>;
+
+            private:
+                using Payload = std::shared_ptr<const std::vector<std::uint8_t>>;
+
+                struct Request
+                {
+                    Payload Data;
+                    ResponseHandler Handler;
+                    std::uint32_t Attempt{0U};
+                };
+
+                struct InFlightCall
+                {
+                    Request Call;
+                    TimerWheel::TimerId Timer;
+                };
+
+                /// @brief Higher priority first, then submission order
+                struct QueueKey
+                {
+                    std::uint8_t Priority;
+                    std::uint64_t Sequence;
+
+                    bool operator<(const QueueKey &other) const noexcept
+                    {
+                        return Priority != other.Priority
+                                   ? Priority > other.Priority
+                                   : Sequence < other.Sequence;
+                    }
+                };
+
+                const TransmitFunction mTransmit;
+                const std::uint32_t mMaxSessionId;
+                TimerWheel &mTimers;
+
+                std::mutex mMutex;
+                // Held while mTransmit runs so that Shutdown() can wait for
+                // it; recursive because a reply may complete synchronously
+                // and its handler may submit the next call.
+                std::recursive_mutex mTransmitMutex;
+
+                MethodQosProfile mQos;
+                std::map<QueueKey, Request> mWaiting;
+                std::unordered_map<std::uint32_t, InFlightCall> mInFlight;
+                std::unordered_map<std::uint64_t, InFlightCall> mBackoff;
+                std::size_t mActive{0U};
+                std::uint32_t mNextSessionId{1U};
+                std::uint64_t mNextSequence{0U};
+                bool mClosed{false};
+
+                std::size_t windowSize() const noexcept;
+                std::uint32_t allocateSessionId();
+                void pump();
+                void launch(Request request);
+                void expire(std::uint32_t sessionId, bool cancelTimer);
+                void onTimeout(std::uint32_t sessionId);
+                void onRetry(std::uint64_t key);
+                bool takeHandler(std::uint32_t sessionId, ResponseHandler &handler);
+
+            public:
+                /// @brief Constructor
+                /// @param transmit Sends a frame; called without internal locks
+                /// @param maxSessionId Largest session ID the transport can
+                ///        carry; IDs cycle through [1, maxSessionId]
+                /// @param timers Wheel used for response and retry timers
+                /// @note Create with std::make_shared; timers refer back to the
+                ///       scheduler through a weak pointer.
+                explicit MethodRequestScheduler(
+                    TransmitFunction transmit,
+                    std::uint32_t maxSessionId = UINT32_MAX,
+                    TimerWheel &timers = TimerWheel::Instance());
+
+                ~MethodRequestScheduler() noexcept;
+
+                MethodRequestScheduler(const MethodRequestScheduler &) = delete;
+                MethodRequestScheduler &operator=(const MethodRequestScheduler &) = delete;
+
+                /// @brief Apply a profile to calls submitted from now on
+                /// @note A larger window starts queued calls immediately.
+                void SetQosProfile(const MethodQosProfile &qos);
+
+                /// @brief Current profile
+                MethodQosProfile GetQosProfile();
+
+                /// @brief Queue a call at the profile priority
+                void Submit(
+                    std::vector<std::uint8_t> payload,
+                    ResponseHandler handler);
+
+                /// @brief Queue a call at an explicit priority
+                void Submit(
+                    std::vector<std::uint8_t> payload,
+                    ResponseHandler handler,
+                    std::uint8_t priority);
+
+                /// @brief Deliver the reply of an in-flight call
+                /// @returns False if no call waits for this session ID
+                bool Complete(
+                    std::uint32_t sessionId,
+                    core::Result<std::vector<std::uint8_t>> result);
+
+                /// @brief Deliver the successful reply of an in-flight call
+                /// @param sessionId Session ID of the reply
+                /// @param payload Reply bytes, copied only if a call waits for them
+                /// @returns False if no call waits for this session ID
+                bool Complete(
+                    std::uint32_t sessionId,
+                    core::Span<const std::uint8_t> payload);
+
+                /// @brief Fail every call and stop transmitting
+                /// @details Waits for a transmission in progress, so the
+                ///          binding may release its transport afterwards.
+                void Shutdown(core::ErrorCode error);
+
+                /// @brief Calls that hold a window slot (sent or backing off)
+                std::size_t ActiveCount();
+
+                /// @brief Calls waiting for a window slot
+                std::size_t QueuedCount();
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,159 @@
+/// @file src/ara/com/internal/sample_filter.cpp
+/// @brief Implementation for the raw-payload event filter.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <cstring>
+#include "./sample_filter.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            namespace
+            {
+                std::size_t fieldSize(FilterFieldType fieldType) noexcept
+                {
+                    switch (fieldType)
+                    {
+                    case FilterFieldType::kUInt8:
+                    case FilterFieldType::kInt8:
+                        return 1U;
+                    case FilterFieldType::kUInt16:
+                    case FilterFieldType::kInt16:
+                        return 2U;
+                    case FilterFieldType::kUInt32:
+                    case FilterFieldType::kInt32:
+                    case FilterFieldType::kFloat32:
+                        return 4U;
+                    case FilterFieldType::kUInt64:
+                    case FilterFieldType::kInt64:
+                    case FilterFieldType::kFloat64:
+                        return 8U;
+                    default:
+                        return 0U;
+                    }
+                }
+
+                template <typename T>
+                double readAs(const std::uint8_t *data) noexcept
+                {
+                    T value;
+                    std::memcpy(&value, data, sizeof(T));
+                    return static_cast<double>(value);
+                }
+            }
+
+            SampleFilter::SampleFilter(const FilterConfig &config) noexcept
+                : mConfig{config}
+            {
+            }
+
+            void SampleFilter::Configure(const FilterConfig &config) noexcept
+            {
+                mConfig = config;
+                mDecimationCounter = 0U;
+            }
+
+            const FilterConfig &SampleFilter::GetConfig() const noexcept
+            {
+                return mConfig;
+            }
+
+            bool SampleFilter::IsPassThrough() const noexcept
+            {
+                return mConfig.Type != FilterType::kOneEveryN &&
+                       mConfig.Type != FilterType::kContent;
+            }
+
+            bool SampleFilter::Accept(
+                const std::uint8_t *data, std::size_t size) noexcept
+            {
+                switch (mConfig.Type)
+                {
+                case FilterType::kOneEveryN:
+                {
+                    ++mDecimationCounter;
+                    if (mDecimationCounter < mConfig.DecimationFactor)
+                    {
+                        return false;
+                    }
+                    mDecimationCounter = 0U;
+                    return true;
+                }
+
+                case FilterType::kContent:
+                {
+                    double value;
+                    if (!ReadField(
+                            data, size,
+                            mConfig.FieldOffset, mConfig.FieldType, value))
+                    {
+                        return false;
+                    }
+                    return value >= mConfig.RangeLow &&
+                           value <= mConfig.RangeHigh;
+                }
+
+                default:
+                    return true;
+                }
+            }
+
+            bool SampleFilter::ReadField(
+                const std::uint8_t *data,
+                std::size_t size,
+                std::size_t offset,
+                FilterFieldType fieldType,
+                double &value) noexcept
+            {
+                const std::size_t width{fieldSize(fieldType)};
+                if (data == nullptr || width == 0U ||
+                    offset > size || size - offset < width)
+                {
+                    return false;
+                }
+
+                const std::uint8_t *field{data + offset};
+                switch (fieldType)
+                {
+                case FilterFieldType::kUInt8:
+                    value = readAs<std::uint8_t>(field);
+                    break;
+                case FilterFieldType::kUInt16:
+                    value = readAs<std::uint16_t>(field);
+                    break;
+                case FilterFieldType::kUInt32:
+                    value = readAs<std::uint32_t>(field);
+                    break;
+                case FilterFieldType::kUInt64:
+                    value = readAs<std::uint64_t>(field);
+                    break;
+                case FilterFieldType::kInt8:
+                    value = readAs<std::int8_t>(field);
+                    break;
+                case FilterFieldType::kInt16:
+                    value = readAs<std::int16_t>(field);
+                    break;
+                case FilterFieldType::kInt32:
+                    value = readAs<std::int32_t>(field);
+                    break;
+                case FilterFieldType::kInt64:
+                    value = readAs<std::int64_t>(field);
+                    break;
+                case FilterFieldType::kFloat32:
+                    value = readAs<float>(field);
+                    break;
+                case FilterFieldType::kFloat64:
+                    value = readAs<double>(field);
+                    break;
+                default:
+                    return false;
+                }
+
+                return true;
+            }
+        }
+    }
+}
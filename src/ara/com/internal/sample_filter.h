@@ -0,0 +1,74 @@
+/// @file src/ara/com/internal/sample_filter.h
+/// @brief Raw-payload event filter shared by ProxyEvent and transport bindings.
+/// @details Evaluates a FilterConfig on serialized sample bytes, so that
+///          samples rejected by decimation or content filtering are dropped
+///          before they are copied out of the transport or deserialized.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_INTERNAL_SAMPLE_FILTER_H
+#define ARA_COM_INTERNAL_SAMPLE_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include "../types.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            /// @brief Stateful raw-byte sample filter
+            /// @note Not thread-safe; Accept() must be called from a single
+            ///       thread (the transport receive thread or the consumer).
+            class SampleFilter
+            {
+            private:
+                FilterConfig mConfig;
+                std::uint32_t mDecimationCounter{0U};
+
+            public:
+                SampleFilter() noexcept = default;
+
+                /// @brief Constructor
+                /// @param config Filter configuration
+                explicit SampleFilter(const FilterConfig &config) noexcept;
+
+                /// @brief Replace the configuration and restart decimation
+                /// @param config Filter configuration
+                void Configure(const FilterConfig &config) noexcept;
+
+                /// @brief Get the active configuration
+                const FilterConfig &GetConfig() const noexcept;
+
+                /// @brief Whether Accept() passes every sample
+                /// @note kThreshold and kRange compare the deserialized value
+                ///       and are therefore not evaluated on raw bytes.
+                bool IsPassThrough() const noexcept;
+
+                /// @brief Decide whether a serialized sample is delivered
+                /// @param data Serialized payload
+                /// @param size Payload size in bytes
+                /// @returns True if the sample passes the filter
+                bool Accept(const std::uint8_t *data, std::size_t size) noexcept;
+
+                /// @brief Read a scalar payload field as double
+                /// @param data Serialized payload
+                /// @param size Payload size in bytes
+                /// @param offset Byte offset of the field
+                /// @param fieldType Field encoding
+                /// @param[out] value Field value
+                /// @returns False if the payload is too short to hold the field
+                static bool ReadField(
+                    const std::uint8_t *data,
+                    std::size_t size,
+                    std::size_t offset,
+                    FilterFieldType fieldType,
+                    double &value) noexcept;
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,179 @@
+/// @file src/ara/com/internal/sample_pool.h
+/// @brief Fixed-capacity object pool backing proxy-side SamplePtr instances.
+/// @details ProxyEvent<T> creates one pool per subscription, sized from
+///          `Subscribe(maxSampleCount)`. Deserialized samples are constructed
+///          in place in a free slot, and the SamplePtr hands the slot back on
+///          destruction, so the receive path does not touch the heap while
+///          the application holds at most `maxSampleCount` samples.
+///
+///          The pool is reference counted by its owner and by every sample in
+///          flight, so samples may safely outlive the ProxyEvent that produced
+///          them.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_INTERNAL_SAMPLE_POOL_H
+#define ARA_COM_INTERNAL_SAMPLE_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../sample_ptr.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            /// @brief Lock-free fixed-capacity pool of `T` objects.
+            /// @tparam T Sample type
+            template <typename T>
+            class SamplePool
+            {
+            private:
+                struct Slot
+                {
+                    typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+                    std::atomic<bool> InUse{false};
+                };
+
+                std::unique_ptr<Slot[]> mSlots;
+                std::size_t mCapacity;
+                std::atomic<std::size_t> mCursor{0U};
+                std::atomic<std::size_t> mReferences{1U};
+
+                explicit SamplePool(std::size_t capacity)
+                    : mSlots{new Slot[std::max<std::size_t>(1U, capacity)]},
+                      mCapacity{std::max<std::size_t>(1U, capacity)}
+                {
+                }
+
+                ~SamplePool() noexcept = default;
+
+                void unref() noexcept
+                {
+                    if (mReferences.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+                    {
+                        delete this;
+                    }
+                }
+
+                static void releaseSample(void *context, const void *sample) noexcept
+                {
+                    SamplePool *pool{static_cast<SamplePool *>(context)};
+                    static_cast<const T *>(sample)->~T();
+
+                    const std::uintptr_t base{
+                        reinterpret_cast<std::uintptr_t>(pool->mSlots.get())};
+                    const std::size_t index{static_cast<std::size_t>(
+                        (reinterpret_cast<std::uintptr_t>(sample) - base) /
+                        sizeof(Slot))};
+                    pool->mSlots[index].InUse.store(false, std::memory_order_release);
+                    pool->unref();
+                }
+
+                Slot *claimSlot() noexcept
+                {
+                    const std::size_t start{
+                        mCursor.fetch_add(1U, std::memory_order_relaxed)};
+                    for (std::size_t i = 0U; i < mCapacity; ++i)
+                    {
+                        Slot &slot{mSlots[(start + i) % mCapacity]};
+                        bool expected{false};
+                        if (!slot.InUse.load(std::memory_order_relaxed) &&
+                            slot.InUse.compare_exchange_strong(
+                                expected, true, std::memory_order_acquire))
+                        {
+                            return &slot;
+                        }
+                    }
+
+                    return nullptr;
+                }
+
+            public:
+                /// @brief Drops the owner reference instead of deleting the pool.
+                struct Detacher
+                {
+                    /// @brief Release the owner reference.
+                    void operator()(SamplePool *pool) const noexcept
+                    {
+                        pool->unref();
+                    }
+                };
+
+                /// @brief Owning handle held by the pool creator.
+                using Handle = std::unique_ptr<SamplePool, Detacher>;
+
+                SamplePool(const SamplePool &) = delete;
+                SamplePool &operator=(const SamplePool &) = delete;
+
+                /// @brief Create a pool
+                /// @param capacity Number of slots (clamped to at least one)
+                /// @returns Owning handle
+                static Handle Create(std::size_t capacity)
+                {
+                    return Handle{new SamplePool{capacity}};
+                }
+
+                /// @brief Move a value into a free slot
+                /// @param value Sample value
+                /// @returns Pooled sample, or a heap-allocated sample if every
+                ///          slot is still held by the application
+                SamplePtr<T> Emplace(T &&value)
+                {
+                    Slot *slot{claimSlot()};
+                    if (slot == nullptr)
+                    {
+                        return SamplePtr<T>{
+                            std::unique_ptr<const T>{new T(std::move(value))}};
+                    }
+
+                    const T *sample;
+                    try
+                    {
+                        sample = new (&slot->Storage) T(std::move(value));
+                    }
+                    catch (...)
+                    {
+                        slot->InUse.store(false, std::memory_order_release);
+                        throw;
+                    }
+
+                    mReferences.fetch_add(1U, std::memory_order_relaxed);
+                    return SamplePtr<T>{
+                        sample, SampleReleaser{&SamplePool::releaseSample, this}};
+                }
+
+                /// @brief Number of slots
+                std::size_t Capacity() const noexcept
+                {
+                    return mCapacity;
+                }
+
+                /// @brief Approximate number of free slots
+                std::size_t FreeCount() const noexcept
+                {
+                    std::size_t freeSlots{0U};
+                    for (std::size_t i = 0U; i < mCapacity; ++i)
+                    {
+                        if (!mSlots[i].InUse.load(std::memory_order_relaxed))
+                        {
+                            ++freeSlots;
+                        }
+                    }
+
+                    return freeSlots;
+                }
+            };
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,225 @@
+/// @file src/ara/com/internal/sample_ring.cpp
+/// @brief Implementation for the bounded lock-free sample ring.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include "./sample_ring.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            SampleRing::SampleRing(
+                QueueOverflowPolicy overflowPolicy) noexcept
+                : mOverflowPolicy{overflowPolicy}
+            {
+            }
+
+            void SampleRing::Reset(
+                std::size_t capacity, std::size_t payloadReserve)
+            {
+                capacity = std::max<std::size_t>(1U, capacity);
+                std::lock_guard<std::mutex> lock(mResetMutex);
+
+                if (!mSlots || capacity != mCapacity)
+                {
+                    mSlots.reset(new Slot[capacity]);
+                    mCapacity = capacity;
+                }
+
+                for (std::size_t i = 0U; i < mCapacity; ++i)
+                {
+                    mSlots[i].Payload.clear();
+                    mSlots[i].Payload.reserve(payloadReserve);
+                    mSlots[i].Sequence.store(i, std::memory_order_relaxed);
+                }
+
+                mEnqueuePos.store(0U, std::memory_order_relaxed);
+                mDequeuePos.store(0U, std::memory_order_relaxed);
+                mDroppedSamples.store(0U, std::memory_order_release);
+            }
+
+            SampleRing::Slot *SampleRing::claimReadable(
+                std::size_t &position) noexcept
+            {
+                if (!mSlots)
+                {
+                    return nullptr;
+                }
+
+                position = mDequeuePos.load(std::memory_order_relaxed);
+                while (true)
+                {
+                    Slot &slot{mSlots[position % mCapacity]};
+                    const std::size_t sequence{
+                        slot.Sequence.load(std::memory_order_acquire)};
+                    const std::ptrdiff_t diff{
+                        static_cast<std::ptrdiff_t>(sequence) -
+                        static_cast<std::ptrdiff_t>(position + 1U)};
+
+                    if (diff == 0)
+                    {
+                        if (mDequeuePos.compare_exchange_weak(
+                                position, position + 1U,
+                                std::memory_order_relaxed))
+                        {
+                            return &slot;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        // Slot not yet published: the ring is empty.
+                        return nullptr;
+                    }
+                    else
+                    {
+                        position = mDequeuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            bool SampleRing::tryPush(
+                const std::uint8_t *data, std::size_t size)
+            {
+                std::size_t position{
+                    mEnqueuePos.load(std::memory_order_relaxed)};
+                while (true)
+                {
+                    Slot &slot{mSlots[position % mCapacity]};
+                    const std::size_t sequence{
+                        slot.Sequence.load(std::memory_order_acquire)};
+                    const std::ptrdiff_t diff{
+                        static_cast<std::ptrdiff_t>(sequence) -
+                        static_cast<std::ptrdiff_t>(position)};
+
+                    if (diff == 0)
+                    {
+                        if (mEnqueuePos.compare_exchange_weak(
+                                position, position + 1U,
+                                std::memory_order_relaxed))
+                        {
+                            // Publish the slot even if the copy throws, so
+                            // the ring never stalls on a half-written slot.
+                            SlotRelease release{slot, position + 1U};
+                            slot.Payload.assign(data, data + size);
+                            return true;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        // Slot still owned by a consumer lap: the ring is full.
+                        return false;
+                    }
+                    else
+                    {
+                        position = mEnqueuePos.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            bool SampleRing::discardOldest() noexcept
+            {
+                std::size_t position;
+                Slot *slot{claimReadable(position)};
+                if (slot == nullptr)
+                {
+                    return false;
+                }
+
+                SlotRelease release{*slot, position + mCapacity};
+                if (mDiscardHook != nullptr)
+                {
+                    mDiscardHook(
+                        mDiscardContext,
+                        slot->Payload.data(),
+                        slot->Payload.size());
+                }
+                return true;
+            }
+
+            void SampleRing::SetDiscardHook(
+                DiscardHook hook, void *context) noexcept
+            {
+                mDiscardHook = hook;
+                mDiscardContext = context;
+            }
+
+            bool SampleRing::Push(const std::uint8_t *data, std::size_t size)
+            {
+                if (!mSlots)
+                {
+                    return false;
+                }
+
+                if (tryPush(data, size))
+                {
+                    return true;
+                }
+
+                if (mOverflowPolicy == QueueOverflowPolicy::kDropOldest)
+                {
+                    // Evict the head and retry once. The retry can still fail
+                    // if a consumer is holding the slot being reused, in which
+                    // case the new sample is lost instead of spinning here.
+                    if (discardOldest())
+                    {
+                        mDroppedSamples.fetch_add(
+                            1U, std::memory_order_relaxed);
+                    }
+
+                    if (tryPush(data, size))
+                    {
+                        return true;
+                    }
+                }
+
+                mDroppedSamples.fetch_add(1U, std::memory_order_relaxed);
+                return false;
+            }
+
+            void SampleRing::Clear() noexcept
+            {
+                while (discardOldest())
+                {
+                }
+            }
+
+            std::size_t SampleRing::Size() const noexcept
+            {
+                const std::size_t dequeued{
+                    mDequeuePos.load(std::memory_order_acquire)};
+                const std::size_t enqueued{
+                    mEnqueuePos.load(std::memory_order_acquire)};
+
+                if (enqueued <= dequeued)
+                {
+                    return 0U;
+                }
+
+                return std::min(enqueued - dequeued, mCapacity);
+            }
+
+            std::size_t SampleRing::Capacity() const noexcept
+            {
+                return mCapacity;
+            }
+
+            std::size_t SampleRing::FreeCount() const noexcept
+            {
+                return mCapacity - Size();
+            }
+
+            std::uint64_t SampleRing::GetDroppedSampleCount() const noexcept
+            {
+                return mDroppedSamples.load(std::memory_order_relaxed);
+            }
+
+            QueueOverflowPolicy SampleRing::GetOverflowPolicy() const noexcept
+            {
+                return mOverflowPolicy;
+            }
+        }
+    }
+}
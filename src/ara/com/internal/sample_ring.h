@@ -0,0 +1,189 @@
+/// @file src/ara/com/internal/sample_ring.h
+/// @brief Bounded lock-free sample ring shared by proxy event bindings.
+/// @details The ring replaces the mutex-guarded `std::deque<std::vector>`
+///          queue that each transport binding used to keep. Slot storage is
+///          preallocated once per subscription (sized from
+///          `Subscribe(maxSampleCount)`), and each slot keeps its payload
+///          buffer across reuse, so steady-state traffic does not allocate.
+///
+///          Producers and consumers synchronize only through per-slot
+///          sequence numbers (bounded MPMC ring after D. Vyukov), which lets
+///          the transport callback thread keep pushing while the application
+///          thread drains a whole batch via Drain().
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_INTERNAL_SAMPLE_RING_H
+#define ARA_COM_INTERNAL_SAMPLE_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "./queue_overflow_policy.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            /// @brief Bounded, preallocated multi-producer/multi-consumer ring
+            ///        of raw event payloads.
+            /// @note The ring is not copyable. Reset() must not run
+            ///       concurrently with Push(); it waits for a running
+            ///       Drain() batch to finish instead.
+            class SampleRing
+            {
+            public:
+                /// @brief Hook invoked on payloads the ring discards without
+                ///        delivering them (overflow eviction and Clear())
+                using DiscardHook = void (*)(
+                    void *context, const std::uint8_t *data, std::size_t size);
+
+            private:
+                static constexpr std::size_t cCacheLineSize{64U};
+
+                struct Slot
+                {
+                    std::atomic<std::size_t> Sequence{0U};
+                    std::vector<std::uint8_t> Payload;
+                };
+
+                /// @brief Releases a claimed slot back to producers, even if
+                ///        the consumer callback throws.
+                class SlotRelease
+                {
+                private:
+                    Slot &mSlot;
+                    std::size_t mSequence;
+
+                public:
+                    SlotRelease(Slot &slot, std::size_t sequence) noexcept
+                        : mSlot{slot}, mSequence{sequence}
+                    {
+                    }
+
+                    SlotRelease(const SlotRelease &) = delete;
+                    SlotRelease &operator=(const SlotRelease &) = delete;
+
+                    ~SlotRelease() noexcept
+                    {
+                        mSlot.Sequence.store(
+                            mSequence, std::memory_order_release);
+                    }
+                };
+
+                /// @brief Serializes Reset() against Drain() batches, so a
+                ///        resubscribe cannot rebuild slots under a poll
+                std::mutex mResetMutex;
+                std::unique_ptr<Slot[]> mSlots;
+                std::size_t mCapacity{0U};
+                QueueOverflowPolicy mOverflowPolicy;
+                DiscardHook mDiscardHook{nullptr};
+                void *mDiscardContext{nullptr};
+
+                alignas(cCacheLineSize) std::atomic<std::size_t> mEnqueuePos{0U};
+                alignas(cCacheLineSize) std::atomic<std::size_t> mDequeuePos{0U};
+                alignas(cCacheLineSize) std::atomic<std::uint64_t> mDroppedSamples{0U};
+
+                /// @brief Claim the oldest readable slot.
+                /// @param[out] position Ring position of the claimed slot
+                /// @returns Claimed slot, or nullptr if the ring is empty
+                Slot *claimReadable(std::size_t &position) noexcept;
+
+                bool tryPush(
+                    const std::uint8_t *data, std::size_t size);
+
+                bool discardOldest() noexcept;
+
+            public:
+                /// @brief Constructor
+                /// @param overflowPolicy Policy applied when the ring is full
+                explicit SampleRing(
+                    QueueOverflowPolicy overflowPolicy =
+                        QueueOverflowPolicy::kDropOldest) noexcept;
+
+                SampleRing(const SampleRing &) = delete;
+                SampleRing &operator=(const SampleRing &) = delete;
+
+                ~SampleRing() noexcept = default;
+
+                /// @brief (Re)allocate slot storage and discard all samples
+                /// @param capacity Number of slots (clamped to at least one)
+                /// @param payloadReserve Bytes reserved up front in every slot
+                /// @note Blocks while another thread runs Drain(); must not be
+                ///       called from inside a Drain() consumer.
+                void Reset(
+                    std::size_t capacity, std::size_t payloadReserve = 0U);
+
+                /// @brief Install a hook for discarded payloads, e.g. to give
+                ///        transport chunk handles stored in the ring back
+                /// @param hook Hook function, or nullptr to remove it
+                /// @param context Opaque context passed to the hook
+                /// @note Must not run concurrently with Push(), Drain() or Clear().
+                void SetDiscardHook(DiscardHook hook, void *context) noexcept;
+
+                /// @brief Copy a payload into the next free slot
+                /// @param data Payload bytes
+                /// @param size Payload size in bytes
+                /// @returns False if the sample was not stored (ring full under
+                ///          kRejectNew, head slot still being consumed, or
+                ///          no slot storage), otherwise true
+                /// @note Slot buffers keep their capacity, so a push only
+                ///       allocates while a slot grows to the largest payload.
+                bool Push(const std::uint8_t *data, std::size_t size);
+
+                /// @brief Consume up to @p maxCount samples in FIFO order
+                /// @tparam F Callable as `void(const std::uint8_t *, std::size_t)`
+                /// @param consumer Invoked in place on each slot payload
+                /// @param maxCount Maximum number of samples to consume
+                /// @returns Number of samples consumed
+                /// @note Concurrent Drain() calls run one batch at a time.
+                template <typename F>
+                std::size_t Drain(F &&consumer, std::size_t maxCount)
+                {
+                    std::lock_guard<std::mutex> lock(mResetMutex);
+                    std::size_t consumed{0U};
+                    while (consumed < maxCount)
+                    {
+                        std::size_t position;
+                        Slot *slot{claimReadable(position)};
+                        if (slot == nullptr)
+                        {
+                            break;
+                        }
+
+                        SlotRelease release{*slot, position + mCapacity};
+                        consumer(slot->Payload.data(), slot->Payload.size());
+                        ++consumed;
+                    }
+
+                    return consumed;
+                }
+
+                /// @brief Discard all buffered samples (keeps slot storage)
+                void Clear() noexcept;
+
+                /// @brief Approximate number of buffered samples
+                std::size_t Size() const noexcept;
+
+                /// @brief Number of slots
+                std::size_t Capacity() const noexcept;
+
+                /// @brief Approximate number of free slots
+                std::size_t FreeCount() const noexcept;
+
+                /// @brief Number of samples lost to the overflow policy
+                std::uint64_t GetDroppedSampleCount() const noexcept;
+
+                /// @brief Get the configured overflow policy
+                QueueOverflowPolicy GetOverflowPolicy() const noexcept;
+            };
+        }
+    }
+}
+
+#endif
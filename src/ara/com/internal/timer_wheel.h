@@ -0,0 +1,25 @@
+/// @file src/ara/com/internal/timer_wheel.h
+/// @brief Timer wheel for binding-level timeouts.
+/// @details The binding shares the process-wide hierarchical wheel of
+///          ara::core, so method timeouts, SD phases and NM ticks are all
+///          served by one thread.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_INTERNAL_TIMER_WHEEL_H
+#define ARA_COM_INTERNAL_TIMER_WHEEL_H
+
+#include "../../core/timer_wheel.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            using TimerWheel = core::TimerWheel;
+        }
+    }
+}
+
+#endif
@@ -23,6 +23,14 @@ namespace ara
             {
             }
 
+            VsomeipProxyEventBinding::VsomeipProxyEventBinding(
+                EventBindingConfig config,
+                QueueOverflowPolicy overflowPolicy) noexcept
+                : mConfig{config},
+                  mSampleRing{overflowPolicy}
+            {
+            }
+
             VsomeipProxyEventBinding::~VsomeipProxyEventBinding() noexcept
             {
                 if (mState != SubscriptionState::kNotSubscribed)
@@ -43,8 +51,12 @@ namespace ara
                             MakeErrorCode(ComErrc::kFieldValueIsNotValid));
                     }
 
-                    mMaxSampleCount = std::max<std::size_t>(1U, maxSampleCount);
-                    mSampleQueue.clear();
+                    mMaxSampleCount =
+                        mHasQos ? EventQosMonitor::QueueCapacity(
+                                      maxSampleCount, mQosMonitor.GetQos())
+                                : std::max<std::size_t>(1U, maxSampleCount);
+                    mSampleRing.Reset(mMaxSampleCount);
+                    mQosMonitor.Start();
                     mState = SubscriptionState::kSubscriptionPending;
                     if (mStateChangeHandler)
                     {
@@ -58,40 +70,58 @@ namespace ara
                     pendingNotify(SubscriptionState::kSubscriptionPending);
                 }
 
+                // The message handler holds its own reference: vsomeip may
+                // still be running it while Unsubscribe() drops ours.
+                mNotifySource = BindingReactor::Instance().Register(
+                    [this] { notifyReceiveHandler(); });
+                std::shared_ptr<BindingReactor::Source> source{mNotifySource};
+
                 auto app = someip::VsomeipApplication::GetClientApplication();
                 app->request_service(
                     static_cast<vsomeip::service_t>(mConfig.ServiceId),
                     static_cast<vsomeip::instance_t>(mConfig.InstanceId));
 
+                vsomeip::reliability_type_e reliability{
+                    vsomeip::reliability_type_e::RT_UNKNOWN};
+                if (mHasQos)
+                {
+                    reliability =
+                        (mQosMonitor.GetQos().Reliability ==
+                         ReliabilityKind::kReliable)
+                            ? vsomeip::reliability_type_e::RT_RELIABLE
+                            : vsomeip::reliability_type_e::RT_UNRELIABLE;
+                }
+
                 std::set<vsomeip::eventgroup_t> eventGroups{
                     static_cast<vsomeip::eventgroup_t>(mConfig.EventGroupId)};
                 app->request_event(
                     static_cast<vsomeip::service_t>(mConfig.ServiceId),
                     static_cast<vsomeip::instance_t>(mConfig.InstanceId),
                     static_cast<vsomeip::event_t>(mConfig.EventId),
-                    eventGroups);
+                    eventGroups,
+                    vsomeip::event_type_e::ET_EVENT,
+                    reliability);
 
                 app->register_message_handler(
                     static_cast<vsomeip::service_t>(mConfig.ServiceId),
                     static_cast<vsomeip::instance_t>(mConfig.InstanceId),
                     static_cast<vsomeip::method_t>(mConfig.EventId),
-                    [this](const std::shared_ptr<vsomeip::message> &message)
+                    [this, source](const std::shared_ptr<vsomeip::message> &message)
                     {
-                        std::vector<std::uint8_t> payloadBytes;
+                        const std::uint8_t *payloadData{nullptr};
+                        std::size_t payloadSize{0U};
                         if (message)
                         {
                             auto payload = message->get_payload();
                             if (payload)
                             {
-                                const auto len =
+                                payloadData = payload->get_data();
+                                payloadSize =
                                     static_cast<std::size_t>(payload->get_length());
-                                payloadBytes.assign(
-                                    payload->get_data(),
-                                    payload->get_data() + len);
                             }
                         }
 
-                        std::function<void()> notifyHandler;
+                        bool notify{false};
                         {
                             std::lock_guard<std::mutex> lock(mMutex);
                             if (mState == SubscriptionState::kNotSubscribed)
@@ -99,20 +129,28 @@ namespace ara
                                 return;
                             }
 
-                            if (mSampleQueue.size() >= mMaxSampleCount)
+                            // Samples closer than MinSeparation and filtered
+                            // samples never leave the vsomeip buffer.
+                            if (!mQosMonitor.OnSample() ||
+                                !mSampleFilter.Accept(payloadData, payloadSize))
                             {
-                                mSampleQueue.pop_front();
+                                return;
                             }
-                            mSampleQueue.push_back(std::move(payloadBytes));
-                            if (mReceiveHandler)
+
+                            // Copy straight from the vsomeip payload into a
+                            // preallocated ring slot; the consumer drains
+                            // without taking this lock per sample.
+                            if (!mSampleRing.Push(payloadData, payloadSize))
                             {
-                                notifyHandler = mReceiveHandler;
+                                return;
                             }
+                            notify = static_cast<bool>(mReceiveHandler);
                         }
 
-                        if (notifyHandler)
+                        // Keep application code off the vsomeip dispatcher.
+                        if (notify)
                         {
-                            notifyHandler();
+                            source->Notify();
                         }
                     });
 
@@ -205,13 +243,14 @@ namespace ara
                         return;
                     }
                     mState = SubscriptionState::kNotSubscribed;
-                    mSampleQueue.clear();
+                    mSampleRing.Clear();
                     mReceiveHandler = nullptr;
                     if (mStateChangeHandler)
                     {
                         notify = mStateChangeHandler;
                     }
                 }
+                mQosMonitor.Stop();
 
                 auto app = someip::VsomeipApplication::GetClientApplication();
                 app->unsubscribe(
@@ -228,12 +267,33 @@ namespace ara
                     static_cast<vsomeip::instance_t>(mConfig.InstanceId),
                     static_cast<vsomeip::method_t>(mConfig.EventId));
 
+                // Waits for a receive handler already running on the reactor.
+                if (mNotifySource)
+                {
+                    mNotifySource->Close();
+                    mNotifySource.reset();
+                }
+
                 if (notify)
                 {
                     notify(SubscriptionState::kNotSubscribed);
                 }
             }
 
+            void VsomeipProxyEventBinding::notifyReceiveHandler()
+            {
+                std::function<void()> handler;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    handler = mReceiveHandler;
+                }
+
+                if (handler)
+                {
+                    handler();
+                }
+            }
+
             SubscriptionState
             VsomeipProxyEventBinding::GetSubscriptionState() const noexcept
             {
@@ -251,34 +311,56 @@ namespace ara
                         MakeErrorCode(ComErrc::kSetHandlerNotSet));
                 }
 
-                std::size_t delivered = 0U;
-                while (delivered < maxNumberOfSamples)
                 {
-                    std::vector<std::uint8_t> sample;
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    if (mState != SubscriptionState::kSubscribed)
                     {
-                        std::lock_guard<std::mutex> lock(mMutex);
-                        if (mState != SubscriptionState::kSubscribed)
-                        {
-                            if (delivered == 0U)
-                            {
-                                return core::Result<std::size_t>::FromError(
-                                    MakeErrorCode(ComErrc::kServiceNotAvailable));
-                            }
-                            break;
-                        }
-                        if (mSampleQueue.empty())
-                        {
-                            break;
-                        }
-                        sample = std::move(mSampleQueue.front());
-                        mSampleQueue.pop_front();
+                        return core::Result<std::size_t>::FromError(
+                            MakeErrorCode(ComErrc::kServiceNotAvailable));
                     }
-                    handler(sample.data(), sample.size());
-                    ++delivered;
                 }
+
+                const std::size_t delivered =
+                    mSampleRing.Drain(handler, maxNumberOfSamples);
                 return core::Result<std::size_t>::FromValue(delivered);
             }
 
+            bool VsomeipProxyEventBinding::SetSampleFilter(
+                const FilterConfig &filter)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mState != SubscriptionState::kNotSubscribed)
+                {
+                    return false;
+                }
+                mSampleFilter.Configure(filter);
+                return true;
+            }
+
+            bool VsomeipProxyEventBinding::SetQosProfile(
+                const EventQosProfile &qos)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mState != SubscriptionState::kNotSubscribed)
+                {
+                    return false;
+                }
+                mQosMonitor.Configure(qos);
+                mHasQos = true;
+                return true;
+            }
+
+            void VsomeipProxyEventBinding::SetDeadlineMissedHandler(
+                DeadlineMissedHandler handler)
+            {
+                mQosMonitor.SetDeadlineMissedHandler(std::move(handler));
+            }
+
+            void VsomeipProxyEventBinding::UnsetDeadlineMissedHandler()
+            {
+                mQosMonitor.UnsetDeadlineMissedHandler();
+            }
+
             void VsomeipProxyEventBinding::SetReceiveHandler(
                 std::function<void()> handler)
             {
@@ -296,11 +378,12 @@ namespace ara
             VsomeipProxyEventBinding::GetFreeSampleCount() const noexcept
             {
                 std::lock_guard<std::mutex> lock(mMutex);
-                if (mSampleQueue.size() >= mMaxSampleCount)
+                const std::size_t buffered = mSampleRing.Size();
+                if (buffered >= mMaxSampleCount)
                 {
                     return 0U;
                 }
-                return mMaxSampleCount - mSampleQueue.size();
+                return mMaxSampleCount - buffered;
             }
 
             void VsomeipProxyEventBinding::SetSubscriptionStateChangeHandler(
@@ -417,6 +500,12 @@ namespace ara
 
             core::Result<void> VsomeipSkeletonEventBinding::SendAllocated(
                 void *data, std::size_t size)
+            {
+                return SendAllocatedFrame(data, 0U, size);
+            }
+
+            core::Result<void> VsomeipSkeletonEventBinding::SendAllocatedFrame(
+                void *data, std::size_t offset, std::size_t size)
             {
                 if (!data)
                 {
@@ -426,7 +515,7 @@ namespace ara
 
                 auto vsPayload = vsomeip::runtime::get()->create_payload();
                 vsPayload->set_data(
-                    static_cast<const vsomeip::byte_t *>(data),
+                    static_cast<const vsomeip::byte_t *>(data) + offset,
                     static_cast<vsomeip::length_t>(size));
                 std::free(data);
 
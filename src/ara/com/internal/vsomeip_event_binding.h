@@ -5,11 +5,16 @@
 #ifndef ARA_COM_INTERNAL_VSOMEIP_EVENT_BINDING_H
 #define ARA_COM_INTERNAL_VSOMEIP_EVENT_BINDING_H
 
-#include <deque>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include "./binding_reactor.h"
 #include "./event_binding.h"
+#include "./event_qos_monitor.h"
+#include "./queue_overflow_policy.h"
+#include "./sample_filter.h"
+#include "./sample_ring.h"
 #include "../com_error_domain.h"
 #include "../someip/vsomeip_application.h"
 
@@ -23,21 +28,37 @@ namespace ara
         {
             /// @brief vsomeip-based proxy-side event binding.
             ///        Extracts the subscribe/message-handler/sample-queue logic from ServiceProxy.
+            ///        SOME/IP has no per-event QoS, so Deadline and MinSeparation
+            ///        are enforced locally by an EventQosMonitor and Reliability
+            ///        selects the TCP or UDP endpoint of the requested event.
+            ///        Samples are queued on the vsomeip dispatcher thread, while
+            ///        the receive handler runs on the shared binding reactor.
             class VsomeipProxyEventBinding final : public ProxyEventBinding
             {
             private:
                 EventBindingConfig mConfig;
                 mutable std::mutex mMutex;
                 SubscriptionState mState{SubscriptionState::kNotSubscribed};
-                std::deque<std::vector<std::uint8_t>> mSampleQueue;
+                SampleRing mSampleRing;
+                SampleFilter mSampleFilter;
+                EventQosMonitor mQosMonitor;
+                bool mHasQos{false};
                 std::size_t mMaxSampleCount{16U};
                 std::function<void()> mReceiveHandler;
                 SubscriptionStateChangeHandler mStateChangeHandler;
+                std::shared_ptr<BindingReactor::Source> mNotifySource;
+
+                void notifyReceiveHandler();
 
             public:
                 explicit VsomeipProxyEventBinding(
                     EventBindingConfig config) noexcept;
 
+                /// @brief Constructor with configurable queue overflow policy.
+                VsomeipProxyEventBinding(
+                    EventBindingConfig config,
+                    QueueOverflowPolicy overflowPolicy) noexcept;
+
                 ~VsomeipProxyEventBinding() noexcept override;
 
                 VsomeipProxyEventBinding(const VsomeipProxyEventBinding &) = delete;
@@ -50,6 +71,11 @@ namespace ara
                 core::Result<std::size_t> GetNewSamples(
                     RawReceiveHandler handler,
                     std::size_t maxNumberOfSamples) override;
+                bool SetSampleFilter(const FilterConfig &filter) override;
+                bool SetQosProfile(const EventQosProfile &qos) override;
+                void SetDeadlineMissedHandler(
+                    DeadlineMissedHandler handler) override;
+                void UnsetDeadlineMissedHandler() override;
                 void SetReceiveHandler(
                     std::function<void()> handler) override;
                 void UnsetReceiveHandler() override;
@@ -88,6 +114,8 @@ namespace ara
                 core::Result<void *> Allocate(std::size_t size) override;
                 core::Result<void> SendAllocated(
                     void *data, std::size_t size) override;
+                core::Result<void> SendAllocatedFrame(
+                    void *data, std::size_t offset, std::size_t size) override;
                 void SetInitialValue(
                     const std::vector<std::uint8_t> &payload) override;
             };
@@ -12,6 +12,12 @@ namespace ara
     {
         namespace internal
         {
+            namespace
+            {
+                /// @brief Largest SOME/IP session ID (16-bit header field).
+                const std::uint32_t cMaxSomeIpSessionId{0xFFFFU};
+            }
+
             // ── VsomeipProxyMethodBinding ──────────────────────────
 
             VsomeipProxyMethodBinding::VsomeipProxyMethodBinding(
@@ -25,6 +31,7 @@ namespace ara
                       1U)}       // interfaceVersion
             {
                 mRpcClient = mOwnedClient.get();
+                attach();
             }
 
             VsomeipProxyMethodBinding::VsomeipProxyMethodBinding(
@@ -33,13 +40,77 @@ namespace ara
                 : mConfig{config},
                   mRpcClient{rpcClient}
             {
+                attach();
+            }
+
+            VsomeipProxyMethodBinding::~VsomeipProxyMethodBinding() noexcept
+            {
+                if (mRpcClient)
+                {
+                    mRpcClient->SetViewHandler(
+                        mConfig.ServiceId,
+                        mConfig.MethodId,
+                        nullptr);
+                }
+                if (mScheduler)
+                {
+                    mScheduler->Shutdown(
+                        MakeErrorCode(ComErrc::kNetworkBindingFailure));
+                }
+            }
+
+            void VsomeipProxyMethodBinding::attach()
+            {
+                if (!mRpcClient)
+                {
+                    return;
+                }
+
+                // Use the public Send overload with an explicit session ID so
+                // that concurrent calls can be told apart on response.
+                mScheduler = std::make_shared<MethodRequestScheduler>(
+                    [this](std::uint32_t sessionId,
+                           const std::vector<std::uint8_t> &requestPayload)
+                    {
+                        mRpcClient->Send(
+                            mConfig.ServiceId,
+                            mConfig.MethodId,
+                            0U,
+                            static_cast<std::uint16_t>(sessionId),
+                            requestPayload);
+                        return true;
+                    },
+                    cMaxSomeIpSessionId);
+
+                // One handler per method for the binding's lifetime; it only
+                // looks up the pending call.
+                MethodRequestScheduler *scheduler{mScheduler.get()};
+                mRpcClient->SetViewHandler(
+                    mConfig.ServiceId,
+                    mConfig.MethodId,
+                    [scheduler](const someip::rpc::SomeIpRpcMessageView &response)
+                    {
+                        if (response.ReturnCode == someip::SomeIpReturnCode::eOK)
+                        {
+                            // Copied once, and only for a call still waiting.
+                            scheduler->Complete(
+                                response.SessionId, response.RpcPayload);
+                        }
+                        else
+                        {
+                            scheduler->Complete(
+                                response.SessionId,
+                                core::Result<std::vector<std::uint8_t>>::FromError(
+                                    MakeErrorCode(ComErrc::kCommunicationStackError)));
+                        }
+                    });
             }
 
             void VsomeipProxyMethodBinding::Call(
                 const std::vector<std::uint8_t> &requestPayload,
                 RawResponseHandler responseHandler)
             {
-                if (!mRpcClient)
+                if (!mScheduler)
                 {
                     responseHandler(
                         core::Result<std::vector<std::uint8_t>>::FromError(
@@ -47,25 +118,18 @@ namespace ara
                     return;
                 }
 
-                // Set up the response handler on the RPC client
-                mRpcClient->SetHandler(
-                    mConfig.ServiceId,
-                    mConfig.MethodId,
-                    [responseHandler](
-                        const someip::rpc::SomeIpRpcMessage &response)
-                    {
-                        responseHandler(
-                            core::Result<std::vector<std::uint8_t>>::FromValue(
-                                response.RpcPayload()));
-                    });
+                mScheduler->Submit(requestPayload, std::move(responseHandler));
+            }
 
-                // Use the public Send overload: Send(serviceId, methodId, clientId, rpcPayload)
-                // clientId 0 is used as a default; the RPC client manages session IDs internally
-                mRpcClient->Send(
-                    mConfig.ServiceId,
-                    mConfig.MethodId,
-                    0U,
-                    requestPayload);
+            bool VsomeipProxyMethodBinding::SetQosProfile(
+                const MethodQosProfile &qos)
+            {
+                if (!mScheduler)
+                {
+                    return false;
+                }
+                mScheduler->SetQosProfile(qos);
+                return true;
             }
 
             // ── VsomeipSkeletonMethodBinding ──────────────────────
@@ -111,18 +175,19 @@ namespace ara
                         MakeErrorCode(ComErrc::kSetHandlerNotSet));
                 }
 
-                // RpcServer::HandlerType = function<bool(const vector<uint8_t>&, vector<uint8_t>&)>
-                mRpcServer->SetHandler(
+                // The handler reads the request in the transport buffer; the
+                // response vector is handed to the transport by move.
+                mRpcServer->SetViewHandler(
                     mConfig.ServiceId,
                     mConfig.MethodId,
                     [handler](
-                        const std::vector<std::uint8_t> &requestPayload,
+                        const someip::rpc::SomeIpRpcMessageView &request,
                         std::vector<std::uint8_t> &responsePayload) -> bool
                     {
-                        auto result = handler(requestPayload);
+                        auto result = handler(request.RpcPayload);
                         if (result.HasValue())
                         {
-                            responsePayload = result.Value();
+                            responsePayload = std::move(result).Value();
                             return true;
                         }
                         return false;
@@ -135,7 +200,7 @@ namespace ara
             {
                 if (mRpcServer)
                 {
-                    mRpcServer->SetHandler(
+                    mRpcServer->SetViewHandler(
                         mConfig.ServiceId,
                         mConfig.MethodId,
                         nullptr);
@@ -9,6 +9,7 @@
 #include <memory>
 #include <mutex>
 #include "./method_binding.h"
+#include "./method_request_scheduler.h"
 #include "../com_error_domain.h"
 #include "../someip/rpc/rpc_client.h"
 #include "../someip/rpc/rpc_server.h"
@@ -27,12 +28,17 @@ namespace ara
             ///        Self-contained: internally creates and owns a SocketRpcClient
             ///        when constructed with only a MethodBindingConfig (factory path).
             ///        Also supports external RpcClient injection for legacy callers.
+            ///        Responses are matched to calls by their SOME/IP session ID,
+            ///        which the MethodRequestScheduler assigns.
             class VsomeipProxyMethodBinding final : public ProxyMethodBinding
             {
             private:
                 MethodBindingConfig mConfig;
                 someip::rpc::RpcClient *mRpcClient{nullptr};
                 std::unique_ptr<someip::rpc::SocketRpcClient> mOwnedClient;
+                std::shared_ptr<MethodRequestScheduler> mScheduler;
+
+                void attach();
 
             public:
                 /// @brief Self-contained constructor (for BindingFactory).
@@ -45,11 +51,13 @@ namespace ara
                     MethodBindingConfig config,
                     someip::rpc::RpcClient *rpcClient) noexcept;
 
-                ~VsomeipProxyMethodBinding() noexcept override = default;
+                ~VsomeipProxyMethodBinding() noexcept override;
 
                 void Call(
                     const std::vector<std::uint8_t> &requestPayload,
                     RawResponseHandler responseHandler) override;
+
+                bool SetQosProfile(const MethodQosProfile &qos) override;
             };
 
             /// @brief vsomeip-based skeleton-side method binding.
@@ -32,7 +32,7 @@ namespace ara
             struct TupleDeserializer<>
             {
                 static core::Result<std::tuple<>> Deserialize(
-                    const std::vector<std::uint8_t> &,
+                    core::Span<const std::uint8_t>,
                     std::size_t &)
                 {
                     return core::Result<std::tuple<>>::FromValue(std::make_tuple());
@@ -44,7 +44,7 @@ namespace ara
             struct TupleDeserializer<First, Rest...>
             {
                 static core::Result<std::tuple<First, Rest...>> Deserialize(
-                    const std::vector<std::uint8_t> &payload,
+                    core::Span<const std::uint8_t> payload,
                     std::size_t &offset)
                 {
                     if (offset > payload.size())
@@ -81,6 +81,45 @@ namespace ara
                 }
             };
 
+            /// @brief Total wire size of a method argument list.
+            inline std::size_t ArgsWireSize()
+            {
+                return 0U;
+            }
+
+            template <typename First, typename... Rest>
+            std::size_t ArgsWireSize(const First &first, const Rest &...rest)
+            {
+                return WireSize(first) + ArgsWireSize(rest...);
+            }
+
+            /// @brief Encode a method argument list back to back.
+            inline void WriteArgs(SerializeCursor &)
+            {
+            }
+
+            template <typename First, typename... Rest>
+            void WriteArgs(
+                SerializeCursor &cursor,
+                const First &first,
+                const Rest &...rest)
+            {
+                WriteTo(first, cursor);
+                WriteArgs(cursor, rest...);
+            }
+
+            /// @brief Serialize method arguments into one exactly-sized buffer.
+            ///        The size pre-pass replaces the per-argument temporaries
+            ///        that were previously concatenated.
+            template <typename... Args>
+            std::vector<std::uint8_t> SerializeArgs(const Args &...args)
+            {
+                std::vector<std::uint8_t> payload(ArgsWireSize(args...));
+                SerializeCursor cursor{payload.data(), payload.size()};
+                WriteArgs(cursor, args...);
+                return payload;
+            }
+
             /// @brief C++14 equivalent of std::apply: expands tuple elements as function args.
             template <typename F, typename Tuple, std::size_t... Is>
             auto ApplyTupleImpl(F &&f, Tuple &&t, std::index_sequence<Is...>)
@@ -123,24 +162,9 @@ namespace ara
         private:
             std::unique_ptr<internal::ProxyMethodBinding> mBinding;
 
-            static void AppendSerialized(std::vector<std::uint8_t> &) {}
-
-            template <typename First, typename... Rest>
-            static void AppendSerialized(
-                std::vector<std::uint8_t> &payload,
-                const First &first,
-                const Rest &...rest)
-            {
-                auto bytes = Serializer<First>::Serialize(first);
-                payload.insert(payload.end(), bytes.begin(), bytes.end());
-                AppendSerialized(payload, rest...);
-            }
-
             static std::vector<std::uint8_t> SerializeArgs(const Args &...args)
             {
-                std::vector<std::uint8_t> payload;
-                AppendSerialized(payload, args...);
-                return payload;
+                return detail::SerializeArgs(args...);
             }
 
         public:
@@ -157,6 +181,17 @@ namespace ara
             ProxyMethod(ProxyMethod &&) noexcept = default;
             ProxyMethod &operator=(ProxyMethod &&) noexcept = default;
 
+            /// @brief Apply a method QoS profile (SWS_CM_00920).
+            /// @param qos Response timeout, concurrency window, retries and
+            ///        priority for subsequent calls.
+            /// @returns True if the binding enforces the profile.
+            /// @note Calls beyond MaxConcurrentRequests are queued by priority
+            ///       until an outstanding call completes.
+            bool SetQosProfile(const MethodQosProfile &qos)
+            {
+                return mBinding && mBinding->SetQosProfile(qos);
+            }
+
             /// @brief Invoke the remote method
             /// @param args Method arguments
             /// @returns Future containing the result
@@ -211,24 +246,9 @@ namespace ara
         private:
             std::unique_ptr<internal::ProxyMethodBinding> mBinding;
 
-            static void AppendSerialized(std::vector<std::uint8_t> &) {}
-
-            template <typename First, typename... Rest>
-            static void AppendSerialized(
-                std::vector<std::uint8_t> &payload,
-                const First &first,
-                const Rest &...rest)
-            {
-                auto bytes = Serializer<First>::Serialize(first);
-                payload.insert(payload.end(), bytes.begin(), bytes.end());
-                AppendSerialized(payload, rest...);
-            }
-
             static std::vector<std::uint8_t> SerializeArgs(const Args &...args)
             {
-                std::vector<std::uint8_t> payload;
-                AppendSerialized(payload, args...);
-                return payload;
+                return detail::SerializeArgs(args...);
             }
 
         public:
@@ -245,6 +265,17 @@ namespace ara
             ProxyMethod(ProxyMethod &&) noexcept = default;
             ProxyMethod &operator=(ProxyMethod &&) noexcept = default;
 
+            /// @brief Apply a method QoS profile (SWS_CM_00920).
+            /// @param qos Response timeout, concurrency window, retries and
+            ///        priority for subsequent calls.
+            /// @returns True if the binding enforces the profile.
+            /// @note Calls beyond MaxConcurrentRequests are queued by priority
+            ///       until an outstanding call completes.
+            bool SetQosProfile(const MethodQosProfile &qos)
+            {
+                return mBinding && mBinding->SetQosProfile(qos);
+            }
+
             /// @brief Invokes a remote method that has no return payload.
             /// @param args Method arguments.
             /// @returns Future that resolves on acknowledgement or error.
@@ -338,7 +369,7 @@ namespace ara
 
                 return mBinding->Register(
                     [h = std::move(handler), mtx = mDispatchMutex](
-                        const std::vector<std::uint8_t> &request)
+                        core::Span<const std::uint8_t> request)
                         -> core::Result<std::vector<std::uint8_t>>
                     {
                         // kEventSingleThread: serialize concurrent calls
@@ -426,7 +457,7 @@ namespace ara
 
                 return mBinding->Register(
                     [h = std::move(handler), mtx = mDispatchMutex](
-                        const std::vector<std::uint8_t> &request)
+                        core::Span<const std::uint8_t> request)
                         -> core::Result<std::vector<std::uint8_t>>
                     {
                         std::unique_lock<std::recursive_mutex> guard;
@@ -485,24 +516,9 @@ namespace ara
         private:
             std::unique_ptr<internal::ProxyMethodBinding> mBinding;
 
-            static void AppendSerialized(std::vector<std::uint8_t> &) {}
-
-            template <typename First, typename... Rest>
-            static void AppendSerialized(
-                std::vector<std::uint8_t> &payload,
-                const First &first,
-                const Rest &...rest)
-            {
-                auto bytes = Serializer<First>::Serialize(first);
-                payload.insert(payload.end(), bytes.begin(), bytes.end());
-                AppendSerialized(payload, rest...);
-            }
-
             static std::vector<std::uint8_t> SerializeArgs(const Args &...args)
             {
-                std::vector<std::uint8_t> payload;
-                AppendSerialized(payload, args...);
-                return payload;
+                return detail::SerializeArgs(args...);
             }
 
         public:
@@ -586,7 +602,7 @@ namespace ara
 
                 return mBinding->Register(
                     [h = std::move(handler), mtx = mDispatchMutex](
-                        const std::vector<std::uint8_t> &request)
+                        core::Span<const std::uint8_t> request)
                         -> core::Result<std::vector<std::uint8_t>>
                     {
                         std::unique_lock<std::recursive_mutex> guard;
@@ -9,6 +9,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 
 namespace ara
 {
@@ -98,6 +99,10 @@ namespace ara
             }
         };
 
+        /// @brief Callback raised when a subscribed event misses its deadline.
+        /// @param totalCount Number of deadline misses since subscription
+        using DeadlineMissedHandler = std::function<void(std::uint32_t totalCount)>;
+
         /// @brief QoS profile for method (RPC) communication.
         struct MethodQosProfile
         {
@@ -5,6 +5,7 @@
 #ifndef ARA_COM_SAMPLE_PTR_H
 #define ARA_COM_SAMPLE_PTR_H
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -13,12 +14,165 @@ namespace ara
 {
     namespace com
     {
+        /// @brief Allocation-free hook that returns a received sample to its owner.
+        /// @details The hook is a plain function pointer plus an opaque context, so
+        ///          a SamplePtr can hand a sample back to a heap allocator, an
+        ///          object pool or a loaned transport chunk without type erasure
+        ///          overhead (no `std::function`, no control block).
+        struct SampleReleaser
+        {
+            /// @brief Release function; receives Context and the sample address.
+            void (*Release)(void *context, const void *sample) noexcept;
+            /// @brief Owner-specific context (pool, subscriber, ...), may be null.
+            void *Context;
+        };
+
         /// @brief Smart pointer for accessing received event samples (proxy side).
         ///        Per AUTOSAR AP SWS_CM_00306, provides const access to received data.
-        ///        For zero-copy paths, the custom deleter returns the buffer to the
-        ///        underlying middleware (e.g. iceoryx).
+        /// @details The sample may live on the heap, in a per-subscription object
+        ///          pool, or directly in a transport chunk loaned by the middleware
+        ///          (e.g. iceoryx). On destruction the SampleReleaser returns the
+        ///          memory to whichever owner produced it.
+        template <typename T>
+        class SamplePtr
+        {
+        private:
+            const T *mPtr;
+            SampleReleaser mReleaser;
+
+            static void deleteSample(void *, const void *sample) noexcept
+            {
+                delete static_cast<const T *>(sample);
+            }
+
+            void release() noexcept
+            {
+                if (mPtr != nullptr && mReleaser.Release != nullptr)
+                {
+                    mReleaser.Release(mReleaser.Context, mPtr);
+                }
+                mPtr = nullptr;
+                mReleaser = SampleReleaser{nullptr, nullptr};
+            }
+
+        public:
+            /// @brief Creates an empty sample pointer.
+            SamplePtr() noexcept : mPtr{nullptr}, mReleaser{nullptr, nullptr}
+            {
+            }
+
+            /// @brief Creates an empty sample pointer.
+            SamplePtr(std::nullptr_t) noexcept : SamplePtr()
+            {
+            }
+
+            /// @brief Takes ownership of a heap-allocated sample.
+            /// @param sample Sample released with `delete`.
+            explicit SamplePtr(std::unique_ptr<const T> sample) noexcept
+                : mPtr{sample.release()},
+                  mReleaser{&SamplePtr::deleteSample, nullptr}
+            {
+            }
+
+            /// @brief Takes ownership of a sample held by an external owner.
+            /// @param sample Sample address.
+            /// @param releaser Hook invoked exactly once when the sample is dropped.
+            SamplePtr(const T *sample, SampleReleaser releaser) noexcept
+                : mPtr{sample}, mReleaser{releaser}
+            {
+            }
+
+            SamplePtr(const SamplePtr &) = delete;
+            SamplePtr &operator=(const SamplePtr &) = delete;
+
+            /// @brief Move constructor.
+            SamplePtr(SamplePtr &&other) noexcept
+                : mPtr{other.mPtr}, mReleaser{other.mReleaser}
+            {
+                other.mPtr = nullptr;
+                other.mReleaser = SampleReleaser{nullptr, nullptr};
+            }
+
+            /// @brief Move assignment; releases the currently held sample.
+            /// @returns Reference to `*this`.
+            SamplePtr &operator=(SamplePtr &&other) noexcept
+            {
+                if (this != &other)
+                {
+                    release();
+                    mPtr = other.mPtr;
+                    mReleaser = other.mReleaser;
+                    other.mPtr = nullptr;
+                    other.mReleaser = SampleReleaser{nullptr, nullptr};
+                }
+                return *this;
+            }
+
+            /// @brief Releases the currently held sample.
+            /// @returns Reference to `*this`.
+            SamplePtr &operator=(std::nullptr_t) noexcept
+            {
+                release();
+                return *this;
+            }
+
+            ~SamplePtr() noexcept
+            {
+                release();
+            }
+
+            /// @brief Pointer-style access to the sample.
+            const T *operator->() const noexcept { return mPtr; }
+            /// @brief Dereferences the sample.
+            const T &operator*() const noexcept { return *mPtr; }
+
+            /// @brief Returns the raw sample pointer.
+            const T *Get() const noexcept { return mPtr; }
+
+            /// @brief Checks whether a sample is currently held.
+            explicit operator bool() const noexcept
+            {
+                return mPtr != nullptr;
+            }
+
+            /// @brief Releases the held sample and leaves the pointer empty.
+            void Reset(std::nullptr_t = nullptr) noexcept
+            {
+                release();
+            }
+
+            /// @brief Swaps ownership with another sample pointer.
+            /// @param other Other object to swap with.
+            void Swap(SamplePtr &other) noexcept
+            {
+                std::swap(mPtr, other.mPtr);
+                std::swap(mReleaser, other.mReleaser);
+            }
+        };
+
+        template <typename T>
+        bool operator==(const SamplePtr<T> &sample, std::nullptr_t) noexcept
+        {
+            return !sample;
+        }
+
+        template <typename T>
+        bool operator==(std::nullptr_t, const SamplePtr<T> &sample) noexcept
+        {
+            return !sample;
+        }
+
         template <typename T>
-        using SamplePtr = std::unique_ptr<const T>;
+        bool operator!=(const SamplePtr<T> &sample, std::nullptr_t) noexcept
+        {
+            return static_cast<bool>(sample);
+        }
+
+        template <typename T>
+        bool operator!=(std::nullptr_t, const SamplePtr<T> &sample) noexcept
+        {
+            return static_cast<bool>(sample);
+        }
 
         /// @brief Smart pointer for skeleton-side sample allocation.
         ///        Per AUTOSAR AP SWS_CM_00308, allows in-place construction of
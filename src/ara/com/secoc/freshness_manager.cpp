@@ -39,21 +39,33 @@ namespace ara
                 return result;
             }
 
+            // -----------------------------------------------------------------------
+            // find — lock-free lookup of a registered entry
+            // -----------------------------------------------------------------------
+            FreshnessManager::Entry *FreshnessManager::find(PduId pduId) const noexcept
+            {
+                Entry *entry = mEntries.Find(pduId);
+                return entry != nullptr &&
+                               entry->registered.load(std::memory_order_acquire)
+                           ? entry
+                           : nullptr;
+            }
+
             // -----------------------------------------------------------------------
             // RegisterPdu
             // -----------------------------------------------------------------------
             bool FreshnessManager::RegisterPdu(PduId pduId, const FreshnessConfig &config)
             {
                 std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pduId);
-                if (it != mEntries.end())
+                Entry &entry = mEntries.Slot(pduId);
+                if (entry.registered.load(std::memory_order_relaxed))
                 {
                     return false; // already registered
                 }
-                Entry entry;
-                entry.config = config;
-                entry.counter = 0;
-                mEntries[pduId] = entry;
+                entry.counterWidth.store(config.counterWidth, std::memory_order_relaxed);
+                entry.maxCounter.store(config.maxCounter, std::memory_order_relaxed);
+                entry.counter.store(0, std::memory_order_relaxed);
+                entry.registered.store(true, std::memory_order_release);
                 return true;
             }
 
@@ -63,7 +75,11 @@ namespace ara
             void FreshnessManager::UnregisterPdu(PduId pduId)
             {
                 std::lock_guard<std::mutex> lock(mMutex);
-                mEntries.erase(pduId);
+                Entry *entry = mEntries.Find(pduId);
+                if (entry != nullptr)
+                {
+                    entry->registered.store(false, std::memory_order_release);
+                }
             }
 
             // -----------------------------------------------------------------------
@@ -72,15 +88,41 @@ namespace ara
             ara::core::Result<FreshnessValue> FreshnessManager::GetFreshnessValue(
                 PduId pduId) const
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pduId);
-                if (it == mEntries.end())
+                const Entry *entry = find(pduId);
+                if (entry == nullptr)
                 {
                     return ara::core::Result<FreshnessValue>::FromError(
                         MakeErrorCode(SecOcErrc::kNotInitialized));
                 }
-                const Entry &entry = it->second;
-                return counterToBytes(entry.counter, entry.config.counterWidth);
+                return counterToBytes(
+                    entry->counter.load(std::memory_order_acquire),
+                    entry->counterWidth.load(std::memory_order_relaxed));
+            }
+
+            ara::core::Result<std::size_t> FreshnessManager::GetFreshnessValue(
+                PduId pduId,
+                uint8_t *buffer,
+                std::size_t capacity) const
+            {
+                const Entry *entry = find(pduId);
+                if (entry == nullptr)
+                {
+                    return ara::core::Result<std::size_t>::FromError(
+                        MakeErrorCode(SecOcErrc::kNotInitialized));
+                }
+                const uint8_t width = entry->counterWidth.load(std::memory_order_relaxed);
+                if (buffer == nullptr || capacity < width)
+                {
+                    return ara::core::Result<std::size_t>::FromError(
+                        MakeErrorCode(SecOcErrc::kInvalidPayloadLength));
+                }
+                const uint64_t counter = entry->counter.load(std::memory_order_acquire);
+                for (uint8_t i = 0; i < width; ++i)
+                {
+                    buffer[i] = i < 8 ? static_cast<uint8_t>((counter >> (i * 8)) & 0xFF)
+                                      : 0;
+                }
+                return static_cast<std::size_t>(width);
             }
 
             // -----------------------------------------------------------------------
@@ -88,32 +130,25 @@ namespace ara
             // -----------------------------------------------------------------------
             ara::core::Result<void> FreshnessManager::IncrementCounter(PduId pduId)
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pduId);
-                if (it == mEntries.end())
+                Entry *entry = find(pduId);
+                if (entry == nullptr)
                 {
                     return ara::core::Result<void>::FromError(
                         MakeErrorCode(SecOcErrc::kNotInitialized));
                 }
-                Entry &entry = it->second;
-                const uint64_t maxVal = entry.config.maxCounter;
+                const uint64_t maxVal = entry->maxCounter.load(std::memory_order_relaxed);
 
-                if (maxVal != 0 && entry.counter >= maxVal)
+                uint64_t current = entry->counter.load(std::memory_order_relaxed);
+                do
                 {
-                    if (entry.config.maxCounter == 0)
-                    {
-                        entry.counter = 0; // wrap around
-                    }
-                    else
+                    if (maxVal != 0 && current >= maxVal)
                     {
                         return ara::core::Result<void>::FromError(
                             MakeErrorCode(SecOcErrc::kFreshnessOverflow));
                     }
-                }
-                else
-                {
-                    ++entry.counter;
-                }
+                } while (!entry->counter.compare_exchange_weak(
+                    current, current + 1,
+                    std::memory_order_acq_rel, std::memory_order_relaxed));
                 return {};
             }
 
@@ -126,34 +161,53 @@ namespace ara
                 PduId pduId,
                 const FreshnessValue &receivedFreshness)
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pduId);
-                if (it == mEntries.end())
+                Entry *entry = find(pduId);
+                if (entry == nullptr)
                 {
                     return ara::core::Result<void>::FromError(
                         MakeErrorCode(SecOcErrc::kNotInitialized));
                 }
-                Entry &entry = it->second;
 
-                if (receivedFreshness.size() != entry.config.counterWidth)
+                if (receivedFreshness.size() !=
+                    entry->counterWidth.load(std::memory_order_relaxed))
                 {
                     return ara::core::Result<void>::FromError(
                         MakeErrorCode(SecOcErrc::kInvalidPayloadLength));
                 }
 
-                const uint64_t received = bytesToCounter(receivedFreshness);
-                const uint64_t current = entry.counter;
+                return advanceCounter(*entry, bytesToCounter(receivedFreshness));
+            }
 
-                // Accept if received > current (strictly monotonic)
-                // or received == current + 1 (next expected value)
-                if (received <= current)
+            ara::core::Result<void> FreshnessManager::VerifyAndUpdate(
+                PduId pduId,
+                uint64_t receivedCounter)
+            {
+                Entry *entry = find(pduId);
+                if (entry == nullptr)
                 {
                     return ara::core::Result<void>::FromError(
-                        MakeErrorCode(SecOcErrc::kFreshnessCounterFailed));
+                        MakeErrorCode(SecOcErrc::kNotInitialized));
                 }
+                return advanceCounter(*entry, receivedCounter);
+            }
 
-                // Update stored counter to match received value
-                entry.counter = received;
+            ara::core::Result<void> FreshnessManager::advanceCounter(
+                Entry &entry, uint64_t received)
+            {
+                // Accept if received > current (strictly monotonic). A lost race
+                // re-checks against the winner's value, so each value is accepted
+                // at most once.
+                uint64_t current = entry.counter.load(std::memory_order_relaxed);
+                do
+                {
+                    if (received <= current)
+                    {
+                        return ara::core::Result<void>::FromError(
+                            MakeErrorCode(SecOcErrc::kFreshnessCounterFailed));
+                    }
+                } while (!entry.counter.compare_exchange_weak(
+                    current, received,
+                    std::memory_order_acq_rel, std::memory_order_relaxed));
                 return {};
             }
 
@@ -162,14 +216,13 @@ namespace ara
             // -----------------------------------------------------------------------
             ara::core::Result<uint64_t> FreshnessManager::GetCounterValue(PduId pduId) const
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pduId);
-                if (it == mEntries.end())
+                const Entry *entry = find(pduId);
+                if (entry == nullptr)
                 {
                     return ara::core::Result<uint64_t>::FromError(
                         MakeErrorCode(SecOcErrc::kNotInitialized));
                 }
-                return it->second.counter;
+                return entry->counter.load(std::memory_order_acquire);
             }
 
             // -----------------------------------------------------------------------
@@ -177,14 +230,13 @@ namespace ara
             // -----------------------------------------------------------------------
             ara::core::Result<void> FreshnessManager::ResetCounter(PduId pduId)
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pduId);
-                if (it == mEntries.end())
+                Entry *entry = find(pduId);
+                if (entry == nullptr)
                 {
                     return ara::core::Result<void>::FromError(
                         MakeErrorCode(SecOcErrc::kNotInitialized));
                 }
-                it->second.counter = 0;
+                entry->counter.store(0, std::memory_order_release);
                 return {};
             }
 
@@ -203,11 +255,15 @@ namespace ara
                         MakeErrorCode(SecOcErrc::kNotInitialized));
                 }
 
-                for (const auto &kv : mEntries)
-                {
-                    ofs << static_cast<uint32_t>(kv.first) << " "
-                        << kv.second.counter << "\n";
-                }
+                mEntries.ForEach(
+                    [&ofs](PduId pduId, const Entry &entry)
+                    {
+                        if (entry.registered.load(std::memory_order_acquire))
+                        {
+                            ofs << static_cast<uint32_t>(pduId) << " "
+                                << entry.counter.load(std::memory_order_acquire) << "\n";
+                        }
+                    });
 
                 if (!ofs)
                 {
@@ -250,11 +306,10 @@ namespace ara
                             MakeErrorCode(SecOcErrc::kConfigurationError));
                     }
 
-                    const PduId pduId{static_cast<PduId>(pduIdRaw)};
-                    auto it = mEntries.find(pduId);
-                    if (it != mEntries.end())
+                    Entry *entry = find(static_cast<PduId>(pduIdRaw));
+                    if (entry != nullptr)
                     {
-                        it->second.counter = counter;
+                        entry->counter.store(counter, std::memory_order_release);
                     }
                     // Unknown PDU IDs are silently ignored
                 }
@@ -277,20 +332,19 @@ namespace ara
             // -----------------------------------------------------------------------
             bool FreshnessManager::IsNearOverflow(PduId pduId) const
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pduId);
-                if (it == mEntries.end())
+                const Entry *entry = find(pduId);
+                if (entry == nullptr)
                 {
                     return false;
                 }
-                const Entry &entry = it->second;
-                if (entry.config.maxCounter == 0U)
+                const uint64_t maxCounter = entry->maxCounter.load(std::memory_order_relaxed);
+                if (maxCounter == 0U)
                 {
                     return false; // no limit configured
                 }
                 const double ratio =
-                    static_cast<double>(entry.counter) /
-                    static_cast<double>(entry.config.maxCounter);
+                    static_cast<double>(entry->counter.load(std::memory_order_acquire)) /
+                    static_cast<double>(maxCounter);
                 return ratio >= cOverflowWarningRatio;
             }
 
@@ -14,14 +14,16 @@
 #ifndef ARA_COM_SECOC_FRESHNESS_MANAGER_H
 #define ARA_COM_SECOC_FRESHNESS_MANAGER_H
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
-#include <map>
 #include <mutex>
 #include <string>
 #include <vector>
 #include "../../core/result.h"
 #include "./secoc_error_domain.h"
+#include "./pdu_table.h"
 
 namespace ara
 {
@@ -54,6 +56,11 @@ namespace ara
             ///          Each PDU has an independent counter that increments on every
             ///          authenticated transmission or verified reception.
             ///
+            ///          Counters live in a flat table indexed by PDU ID and are
+            ///          updated with atomic compare-and-swap, so the per-PDU paths
+            ///          neither lock nor allocate. Only registration, persistence
+            ///          and the callback setter take the manager's mutex.
+            ///
             ///          Usage:
             ///          @code
             ///          FreshnessManager fm;
@@ -92,6 +99,17 @@ namespace ara
                 /// @returns Current freshness as byte vector, or error if not registered.
                 ara::core::Result<FreshnessValue> GetFreshnessValue(PduId pduId) const;
 
+                /// @brief Write the current freshness value into a caller buffer.
+                /// @param pduId PDU identifier.
+                /// @param buffer Output buffer for the little-endian freshness bytes.
+                /// @param capacity Output buffer size.
+                /// @returns Number of bytes written (the counter width), or
+                ///          kInvalidPayloadLength if the buffer is too small.
+                ara::core::Result<std::size_t> GetFreshnessValue(
+                    PduId pduId,
+                    uint8_t *buffer,
+                    std::size_t capacity) const;
+
                 /// @brief Increment the freshness counter after a successful transmission.
                 /// @param pduId PDU identifier.
                 /// @returns Ok or error (overflow, not registered).
@@ -109,6 +127,15 @@ namespace ara
                     PduId pduId,
                     const FreshnessValue &receivedFreshness);
 
+                /// @brief Verify an already decoded freshness counter and update on success.
+                /// @param pduId PDU identifier.
+                /// @param receivedCounter Received freshness as a 64-bit counter.
+                /// @returns Ok if the counter is strictly greater than the stored one,
+                ///          kFreshnessCounterFailed otherwise.
+                ara::core::Result<void> VerifyAndUpdate(
+                    PduId pduId,
+                    uint64_t receivedCounter);
+
                 /// @brief Get the current counter value as a 64-bit integer.
                 /// @param pduId PDU identifier.
                 /// @returns Counter value or error.
@@ -133,14 +160,25 @@ namespace ara
                 ara::core::Result<void> LoadFromFile(const std::string &filePath);
 
             private:
+                /// @brief Table slot; the configuration is published by @c registered.
                 struct Entry
                 {
-                    FreshnessConfig config;
-                    uint64_t counter{0};
+                    std::atomic<bool> registered{false};
+                    std::atomic<uint8_t> counterWidth{0};
+                    std::atomic<uint64_t> maxCounter{0};
+                    std::atomic<uint64_t> counter{0};
                 };
 
+                /// @brief Serializes registration, persistence and the callback.
                 mutable std::mutex mMutex;
-                std::map<PduId, Entry> mEntries;
+                PduTable<Entry> mEntries;
+
+                /// @brief Find a registered entry without locking.
+                Entry *find(PduId pduId) const noexcept;
+
+                /// @brief Accept @p received if it advances the entry's counter.
+                static ara::core::Result<void> advanceCounter(
+                    Entry &entry, uint64_t received);
 
                 /// @brief Convert 64-bit counter to byte vector (little-endian).
                 static FreshnessValue counterToBytes(uint64_t counter, uint8_t width);
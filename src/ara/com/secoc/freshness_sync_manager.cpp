@@ -16,67 +16,79 @@ namespace ara
             {
             }
 
+            FreshnessSyncManager::Slot *FreshnessSyncManager::find(
+                PduId pdu) const noexcept
+            {
+                Slot *slot = mEntries.Find(pdu);
+                return slot != nullptr && slot->Registered.load(std::memory_order_acquire)
+                           ? slot
+                           : nullptr;
+            }
+
             core::Result<void> FreshnessSyncManager::RegisterPdu(
                 PduId pdu, ReplayWindowConfig window)
             {
                 std::lock_guard<std::mutex> lock(mMutex);
-                if (mEntries.count(pdu) > 0)
+                Slot &slot = mEntries.Slot(pdu);
+                if (slot.Registered.load(std::memory_order_relaxed))
                 {
                     return core::Result<void>::FromError(
                         MakeErrorCode(
                             SecOcErrc::kConfigurationError));
                 }
-                FreshnessSyncEntry entry;
-                entry.Window = window;
-                entry.LastSyncTime = std::chrono::steady_clock::now();
-                mEntries[pdu] = entry;
+                slot.Window = window;
+                slot.LastSyncTime.store(
+                    std::chrono::steady_clock::now().time_since_epoch().count(),
+                    std::memory_order_relaxed);
+                slot.Registered.store(true, std::memory_order_release);
+                ++mEntryCount;
                 return core::Result<void>::FromValue();
             }
 
             core::Result<uint64_t> FreshnessSyncManager::GetLocalCounter(
                 PduId pdu) const
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pdu);
-                if (it == mEntries.end())
+                const Slot *slot = find(pdu);
+                if (slot == nullptr)
                 {
                     return core::Result<uint64_t>::FromError(
                         MakeErrorCode(
                             SecOcErrc::kFreshnessCounterFailed));
                 }
-                return core::Result<uint64_t>::FromValue(it->second.LocalCounter);
+                return core::Result<uint64_t>::FromValue(
+                    slot->LocalCounter.load(std::memory_order_acquire));
             }
 
             core::Result<uint64_t> FreshnessSyncManager::IncrementCounter(
                 PduId pdu)
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pdu);
-                if (it == mEntries.end())
+                Slot *slot = find(pdu);
+                if (slot == nullptr)
                 {
                     return core::Result<uint64_t>::FromError(
                         MakeErrorCode(
                             SecOcErrc::kFreshnessCounterFailed));
                 }
-                ++(it->second.LocalCounter);
-                return core::Result<uint64_t>::FromValue(it->second.LocalCounter);
+                return core::Result<uint64_t>::FromValue(
+                    slot->LocalCounter.fetch_add(1, std::memory_order_acq_rel) + 1);
             }
 
             FreshnessVerifyResult FreshnessSyncManager::VerifyFreshness(
                 PduId pdu, uint64_t receivedCounter)
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pdu);
-                if (it == mEntries.end())
+                Slot *slot = find(pdu);
+                if (slot == nullptr)
                 {
                     return FreshnessVerifyResult::kRejectedUnknownPdu;
                 }
 
-                auto &entry = it->second;
-                uint64_t localVal = entry.RemoteCounter;
+                auto &entry = *slot;
 
                 // Check age since last sync
-                auto elapsed = std::chrono::steady_clock::now() - entry.LastSyncTime;
+                const std::chrono::steady_clock::duration elapsed =
+                    std::chrono::steady_clock::now().time_since_epoch() -
+                    std::chrono::steady_clock::duration{
+                        entry.LastSyncTime.load(std::memory_order_acquire)};
                 auto elapsedMs = std::chrono::duration_cast<
                     std::chrono::milliseconds>(elapsed).count();
                 if (entry.Window.MaxAgeMs > 0 &&
@@ -85,61 +97,81 @@ namespace ara
                     return FreshnessVerifyResult::kRejectedExpired;
                 }
 
-                // Replay / backward tolerance check.
-                // The initial RemoteCounter=0 is a sentinel (no counter accepted yet);
-                // replay protection only activates once HasAny is true to avoid
-                // incorrectly rejecting a legitimate first counter of value 0.
-                if (entry.HasAny && receivedCounter <= localVal)
+                // Concurrent verifications of one PDU race on compare-and-swap;
+                // the loser re-runs the checks against the winner's state.
+                for (;;)
                 {
-                    uint64_t diff = localVal - receivedCounter;
-                    // diff==0 is an exact replay; diff>BackwardTolerance is too far back.
-                    if (diff == 0 || diff > entry.Window.BackwardTolerance)
+                    const bool hasAny = entry.HasAny.load(std::memory_order_acquire);
+                    uint64_t localVal = entry.RemoteCounter.load(std::memory_order_acquire);
+
+                    // Replay / backward tolerance check.
+                    // The initial RemoteCounter=0 is a sentinel (no counter accepted yet);
+                    // replay protection only activates once HasAny is true to avoid
+                    // incorrectly rejecting a legitimate first counter of value 0.
+                    if (hasAny && receivedCounter <= localVal)
                     {
-                        return FreshnessVerifyResult::kRejectedTooOld;
+                        uint64_t diff = localVal - receivedCounter;
+                        // diff==0 is an exact replay; diff>BackwardTolerance is too far back.
+                        if (diff == 0 || diff > entry.Window.BackwardTolerance)
+                        {
+                            return FreshnessVerifyResult::kRejectedTooOld;
+                        }
                     }
-                }
 
-                // Check forward tolerance
-                if (receivedCounter > localVal + entry.Window.ForwardTolerance)
-                {
-                    return FreshnessVerifyResult::kRejectedTooNew;
-                }
+                    // Check forward tolerance
+                    if (receivedCounter > localVal + entry.Window.ForwardTolerance)
+                    {
+                        return FreshnessVerifyResult::kRejectedTooNew;
+                    }
 
-                // Advance the window to prevent replay: RemoteCounter tracks the
-                // highest accepted counter from the remote ECU (SecOC monotonic window).
-                entry.HasAny = true;
-                if (receivedCounter > entry.RemoteCounter)
-                {
-                    entry.RemoteCounter = receivedCounter;
-                }
+                    // Only one thread may accept the first counter.
+                    bool expected = false;
+                    if (!hasAny &&
+                        !entry.HasAny.compare_exchange_strong(
+                            expected, true, std::memory_order_acq_rel))
+                    {
+                        continue;
+                    }
 
-                return FreshnessVerifyResult::kAccepted;
+                    // Advance the window to prevent replay: RemoteCounter tracks the
+                    // highest accepted counter from the remote ECU (SecOC monotonic window).
+                    if (receivedCounter > localVal &&
+                        !entry.RemoteCounter.compare_exchange_strong(
+                            localVal, receivedCounter, std::memory_order_acq_rel))
+                    {
+                        continue;
+                    }
+
+                    return FreshnessVerifyResult::kAccepted;
+                }
             }
 
             core::Result<void> FreshnessSyncManager::ProcessSyncResponse(
                 const FreshnessSyncResponse &response)
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(response.Pdu);
-                if (it == mEntries.end())
+                Slot *slot = find(response.Pdu);
+                if (slot == nullptr)
                 {
                     return core::Result<void>::FromError(
                         MakeErrorCode(
                             SecOcErrc::kFreshnessCounterFailed));
                 }
 
-                it->second.RemoteCounter = response.AcknowledgedCounter;
-                it->second.State = response.SyncState;
-                it->second.LastSyncTime = std::chrono::steady_clock::now();
+                slot->RemoteCounter.store(
+                    response.AcknowledgedCounter, std::memory_order_release);
+                slot->State.store(
+                    static_cast<uint8_t>(response.SyncState), std::memory_order_release);
+                slot->LastSyncTime.store(
+                    std::chrono::steady_clock::now().time_since_epoch().count(),
+                    std::memory_order_release);
                 return core::Result<void>::FromValue();
             }
 
             core::Result<FreshnessSyncRequest>
             FreshnessSyncManager::CreateSyncRequest(PduId pdu) const
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pdu);
-                if (it == mEntries.end())
+                const Slot *slot = find(pdu);
+                if (slot == nullptr)
                 {
                     return core::Result<FreshnessSyncRequest>::FromError(
                         MakeErrorCode(
@@ -148,7 +180,7 @@ namespace ara
 
                 FreshnessSyncRequest req;
                 req.Pdu = pdu;
-                req.CounterValue = it->second.LocalCounter;
+                req.CounterValue = slot->LocalCounter.load(std::memory_order_acquire);
                 req.TimestampMs = NowMs();
                 req.SourceEcuId = mLocalEcuId;
                 return core::Result<FreshnessSyncRequest>::FromValue(req);
@@ -169,8 +201,8 @@ namespace ara
 
                 {
                     std::lock_guard<std::mutex> lock(mMutex);
-                    auto it = mEntries.find(pdu);
-                    if (it == mEntries.end())
+                    const Slot *slot = find(pdu);
+                    if (slot == nullptr)
                     {
                         return core::Result<FreshnessSyncRequest>::FromError(
                             MakeErrorCode(SecOcErrc::kFreshnessCounterFailed));
@@ -181,7 +213,7 @@ namespace ara
                             MakeErrorCode(SecOcErrc::kConfigurationError));
                     }
                     req.Pdu = pdu;
-                    req.CounterValue = it->second.LocalCounter;
+                    req.CounterValue = slot->LocalCounter.load(std::memory_order_acquire);
                     req.TimestampMs = NowMs();
                     req.SourceEcuId = mLocalEcuId;
                     sender = mSender;
@@ -196,13 +228,13 @@ namespace ara
             FreshnessSyncState FreshnessSyncManager::GetSyncState(
                 PduId pdu) const
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mEntries.find(pdu);
-                if (it == mEntries.end())
+                const Slot *slot = find(pdu);
+                if (slot == nullptr)
                 {
                     return FreshnessSyncState::kUnsynchronized;
                 }
-                return it->second.State;
+                return static_cast<FreshnessSyncState>(
+                    slot->State.load(std::memory_order_acquire));
             }
 
             const std::string &FreshnessSyncManager::GetLocalEcuId() const noexcept
@@ -215,14 +247,19 @@ namespace ara
                 std::lock_guard<std::mutex> lock(mMutex);
                 std::vector<uint8_t> result;
 
-                uint32_t count = static_cast<uint32_t>(mEntries.size());
+                uint32_t count = static_cast<uint32_t>(mEntryCount);
                 static constexpr size_t cEntryBytes = 19u;
                 result.reserve(4u + static_cast<size_t>(count) * cEntryBytes);
                 result.resize(4);
                 std::memcpy(result.data(), &count, 4);
 
-                for (const auto &kv : mEntries)
+                mEntries.ForEach([&result](PduId pdu, const Slot &slot)
                 {
+                    if (!slot.Registered.load(std::memory_order_acquire))
+                    {
+                        return;
+                    }
+
                     // Per-entry layout (19 bytes):
                     //   2B  PduId
                     //   8B  LocalCounter
@@ -231,15 +268,14 @@ namespace ara
                     static constexpr size_t cEntryBytes = 19u;
                     size_t pos = result.size();
                     result.resize(pos + cEntryBytes);
-                    uint16_t pdu = kv.first;
-                    uint64_t local = kv.second.LocalCounter;
-                    uint64_t remote = kv.second.RemoteCounter;
-                    uint8_t hasAny = kv.second.HasAny ? 1u : 0u;
+                    uint64_t local = slot.LocalCounter.load(std::memory_order_acquire);
+                    uint64_t remote = slot.RemoteCounter.load(std::memory_order_acquire);
+                    uint8_t hasAny = slot.HasAny.load(std::memory_order_acquire) ? 1u : 0u;
                     std::memcpy(result.data() + pos,      &pdu,    2);
                     std::memcpy(result.data() + pos + 2,  &local,  8);
                     std::memcpy(result.data() + pos + 10, &remote, 8);
                     result[pos + 18] = hasAny;
-                }
+                });
 
                 return result;
             }
@@ -277,12 +313,12 @@ namespace ara
                     uint8_t hasAny = data[offset + 18];
                     offset += cEntryBytes;
 
-                    auto it = mEntries.find(pdu);
-                    if (it != mEntries.end())
+                    Slot *slot = find(pdu);
+                    if (slot != nullptr)
                     {
-                        it->second.LocalCounter  = local;
-                        it->second.RemoteCounter = remote;
-                        it->second.HasAny        = (hasAny != 0u);
+                        slot->LocalCounter.store(local, std::memory_order_release);
+                        slot->RemoteCounter.store(remote, std::memory_order_release);
+                        slot->HasAny.store(hasAny != 0u, std::memory_order_release);
                     }
                 }
 
@@ -292,7 +328,7 @@ namespace ara
             size_t FreshnessSyncManager::RegisteredPduCount() const
             {
                 std::lock_guard<std::mutex> lock(mMutex);
-                return mEntries.size();
+                return mEntryCount;
             }
 
             uint64_t FreshnessSyncManager::NowMs() const
@@ -6,15 +6,16 @@
 #ifndef ARA_COM_SECOC_FRESHNESS_SYNC_MANAGER_H
 #define ARA_COM_SECOC_FRESHNESS_SYNC_MANAGER_H
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <functional>
-#include <map>
 #include <mutex>
 #include <string>
 #include <vector>
 #include "../../core/result.h"
 #include "./secoc_error_domain.h"
+#include "./pdu_table.h"
 
 namespace ara
 {
@@ -95,6 +96,10 @@ namespace ara
             /// @brief Cross-ECU freshness counter synchronization manager.
             /// @details Manages per-PDU freshness counters with multi-ECU sync,
             ///          replay acceptance windows, and persistence support.
+            ///
+            ///          Counters and sync state are per-PDU atomics in a flat
+            ///          table, so VerifyFreshness() never waits for a sync
+            ///          response being applied to the same or another PDU.
             class FreshnessSyncManager
             {
             public:
@@ -155,12 +160,32 @@ namespace ara
                 size_t RegisteredPduCount() const;
 
             private:
+                /// @brief Table slot mirroring FreshnessSyncEntry with atomics.
+                /// @details The window is written before @c Registered is published
+                ///          and never changes afterwards.
+                struct Slot
+                {
+                    std::atomic<bool> Registered{false};
+                    std::atomic<uint64_t> LocalCounter{0};
+                    std::atomic<uint64_t> RemoteCounter{0};
+                    std::atomic<bool> HasAny{false};
+                    std::atomic<uint8_t> State{0};
+                    /// @brief steady_clock ticks of the last sync.
+                    std::atomic<std::chrono::steady_clock::rep> LastSyncTime{0};
+                    ReplayWindowConfig Window;
+                };
+
                 std::string mLocalEcuId;
+                /// @brief Serializes registration, persistence and the sender.
                 mutable std::mutex mMutex;
-                std::map<PduId, FreshnessSyncEntry> mEntries;
+                PduTable<Slot> mEntries;
+                size_t mEntryCount{0};
                 SyncMessageSender mSender;
 
                 uint64_t NowMs() const;
+
+                /// @brief Find a registered slot without locking.
+                Slot *find(PduId pdu) const noexcept;
             };
         }
     }
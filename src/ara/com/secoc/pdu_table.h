@@ -0,0 +1,137 @@
+/// @file src/ara/com/secoc/pdu_table.h
+/// @brief Flat PDU-indexed slot table with lock-free lookup.
+/// @details The 16-bit PDU ID space is split into 256 pages of 256 slots.
+///          A page is allocated when the first PDU in it is registered and
+///          lives as long as the table, so a lookup is two indexed loads and
+///          never takes a lock. Slots are padded to a cache line so that
+///          counters of neighbouring PDUs do not share one.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_SECOC_PDU_TABLE_H
+#define ARA_COM_SECOC_PDU_TABLE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace secoc
+        {
+            /// @brief Page-allocated table holding one @p TSlot per 16-bit PDU ID.
+            /// @tparam TSlot Default-constructible slot type; it tracks its own
+            ///         registration state.
+            /// @note Slot() and ForEach() callers must serialize among themselves
+            ///       (the owning manager's registration mutex). Find() may run
+            ///       concurrently with both.
+            template <typename TSlot>
+            class PduTable
+            {
+            public:
+                static constexpr std::size_t cPageBits{8U};
+                static constexpr std::size_t cPageSize{std::size_t{1} << cPageBits};
+                static constexpr std::size_t cPageCount{
+                    std::size_t{1} << (16U - cPageBits)};
+
+                /// @brief Slot padded to a cache line
+                struct alignas(64) PaddedSlot
+                {
+                    TSlot Value;
+                };
+
+                using Page = std::array<PaddedSlot, cPageSize>;
+
+                PduTable() noexcept
+                {
+                    for (auto &page : mPages)
+                    {
+                        page.store(nullptr, std::memory_order_relaxed);
+                    }
+                }
+
+                ~PduTable() noexcept
+                {
+                    for (auto &pageRef : mPages)
+                    {
+                        Page *page{pageRef.load(std::memory_order_relaxed)};
+                        if (page != nullptr)
+                        {
+                            page->~Page();
+                            std::free(page);
+                        }
+                    }
+                }
+
+                PduTable(const PduTable &) = delete;
+                PduTable &operator=(const PduTable &) = delete;
+
+                /// @brief Look up the slot of a PDU whose page exists
+                /// @returns Slot, or nullptr if no PDU of its page was ever registered
+                TSlot *Find(std::uint16_t pduId) const noexcept
+                {
+                    Page *page{mPages[pduId >> cPageBits].load(std::memory_order_acquire)};
+                    return page == nullptr
+                               ? nullptr
+                               : &(*page)[pduId & (cPageSize - 1U)].Value;
+                }
+
+                /// @brief Get the slot of a PDU, allocating its page on first use
+                TSlot &Slot(std::uint16_t pduId)
+                {
+                    std::atomic<Page *> &pageRef{mPages[pduId >> cPageBits]};
+                    Page *page{pageRef.load(std::memory_order_relaxed)};
+                    if (page == nullptr)
+                    {
+                        page = allocatePage();
+                        pageRef.store(page, std::memory_order_release);
+                    }
+                    return (*page)[pduId & (cPageSize - 1U)].Value;
+                }
+
+                /// @brief Visit every slot of the allocated pages in PDU ID order
+                /// @param visitor Callable taking (PDU ID, slot reference)
+                template <typename TVisitor>
+                void ForEach(TVisitor &&visitor) const
+                {
+                    for (std::size_t pageIndex = 0U; pageIndex < cPageCount; ++pageIndex)
+                    {
+                        Page *page{mPages[pageIndex].load(std::memory_order_acquire)};
+                        if (page == nullptr)
+                        {
+                            continue;
+                        }
+                        for (std::size_t i = 0U; i < cPageSize; ++i)
+                        {
+                            visitor(
+                                static_cast<std::uint16_t>((pageIndex << cPageBits) | i),
+                                (*page)[i].Value);
+                        }
+                    }
+                }
+
+            private:
+                std::array<std::atomic<Page *>, cPageCount> mPages;
+
+                static Page *allocatePage()
+                {
+                    // C++14 operator new only guarantees fundamental alignment.
+                    void *raw{nullptr};
+                    if (posix_memalign(&raw, alignof(Page), sizeof(Page)) != 0)
+                    {
+                        throw std::bad_alloc();
+                    }
+                    return new (raw) Page();
+                }
+            };
+
+        } // namespace secoc
+    }     // namespace com
+} // namespace ara
+
+#endif // ARA_COM_SECOC_PDU_TABLE_H
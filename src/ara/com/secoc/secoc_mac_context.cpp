@@ -0,0 +1,90 @@
+/// @file src/ara/com/secoc/secoc_mac_context.cpp
+/// @brief Implementation of the SecOC MAC contexts.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include "./secoc_mac_context.h"
+#include <cstring>
+
+namespace ara
+{
+    namespace com
+    {
+        namespace secoc
+        {
+            // -----------------------------------------------------------------------
+            // HmacMacContext
+            // -----------------------------------------------------------------------
+            HmacMacContext::HmacMacContext(
+                const std::vector<std::uint8_t> &key,
+                ara::crypto::DigestAlgorithm algorithm)
+                : mCtx{algorithm}, mKeyed{false}, mFresh{false}
+            {
+                // Start() runs the key schedule; later tags only Restart().
+                mKeyed = mCtx.Start(key).HasValue();
+                mFresh = mKeyed;
+            }
+
+            bool HmacMacContext::Start()
+            {
+                if (!mKeyed)
+                {
+                    return false;
+                }
+                if (mFresh)
+                {
+                    mFresh = false;
+                    return true;
+                }
+                return mCtx.Restart().HasValue();
+            }
+
+            bool HmacMacContext::Update(const std::uint8_t *data, std::size_t size)
+            {
+                return size == 0U || mCtx.Update(data, size).HasValue();
+            }
+
+            bool HmacMacContext::Finish(std::uint8_t *tag, std::size_t length)
+            {
+                if (length == 0U)
+                {
+                    // Nothing to emit; the next Start() discards the pending state.
+                    return true;
+                }
+                return mCtx.Finish(tag, length).HasValue();
+            }
+
+            // -----------------------------------------------------------------------
+            // FunctionMacContext
+            // -----------------------------------------------------------------------
+            FunctionMacContext::FunctionMacContext(
+                std::vector<std::uint8_t> key, MacFunction macFn)
+                : mKey{std::move(key)}, mMacFn{std::move(macFn)}
+            {
+            }
+
+            bool FunctionMacContext::Start()
+            {
+                mInput.clear();
+                return static_cast<bool>(mMacFn);
+            }
+
+            bool FunctionMacContext::Update(const std::uint8_t *data, std::size_t size)
+            {
+                mInput.insert(mInput.end(), data, data + size);
+                return true;
+            }
+
+            bool FunctionMacContext::Finish(std::uint8_t *tag, std::size_t length)
+            {
+                const std::vector<std::uint8_t> cMac{mMacFn(mKey, mInput)};
+                if (cMac.size() < length)
+                {
+                    return false;
+                }
+                std::memcpy(tag, cMac.data(), length);
+                return true;
+            }
+
+        } // namespace secoc
+    }     // namespace com
+} // namespace ara
@@ -0,0 +1,99 @@
+/// @file src/ara/com/secoc/secoc_mac_context.h
+/// @brief Pre-keyed, incremental MAC contexts for SecOC PDU processing.
+/// @details A SecOcPdu owns one MacContext for its whole lifetime. The key is
+///          bound once at construction, and each PDU is fed in pieces
+///          (DataID, freshness, payload) instead of being concatenated into
+///          a MAC input buffer first.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_SECOC_SECOC_MAC_CONTEXT_H
+#define ARA_COM_SECOC_SECOC_MAC_CONTEXT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "../../crypto/mac_function_ctx.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace secoc
+        {
+            /// @brief MAC computation function type.
+            /// @details Signature: (key, data) → MAC bytes (32 bytes for HMAC-SHA-256)
+            using MacFunction = std::function<std::vector<uint8_t>(
+                const std::vector<uint8_t> & /*key*/,
+                const std::vector<uint8_t> & /*data*/)>;
+
+            /// @brief Keyed MAC context computing one tag at a time.
+            /// @details Not thread-safe: SecOcPdu serializes access to its context.
+            class MacContext
+            {
+            public:
+                virtual ~MacContext() noexcept = default;
+
+                /// @brief Begin a new tag under the bound key.
+                /// @returns True on success.
+                virtual bool Start() = 0;
+
+                /// @brief Feed the next piece of the MAC input.
+                /// @returns True on success.
+                virtual bool Update(const std::uint8_t *data, std::size_t size) = 0;
+
+                /// @brief Finish the tag and write its leading bytes.
+                /// @param tag Output buffer.
+                /// @param length Number of tag bytes to write.
+                /// @returns False if the tag is shorter than length or computation failed.
+                virtual bool Finish(std::uint8_t *tag, std::size_t length) = 0;
+            };
+
+            /// @brief HMAC context from ara::crypto with the key schedule done once.
+            class HmacMacContext final : public MacContext
+            {
+            private:
+                ara::crypto::MessageAuthenticationCodeCtx mCtx;
+                bool mKeyed;
+                bool mFresh;
+
+            public:
+                /// @brief Bind the key.
+                /// @param key Symmetric key bytes.
+                /// @param algorithm HMAC digest algorithm.
+                explicit HmacMacContext(
+                    const std::vector<std::uint8_t> &key,
+                    ara::crypto::DigestAlgorithm algorithm =
+                        ara::crypto::DigestAlgorithm::kSha256);
+
+                bool Start() override;
+                bool Update(const std::uint8_t *data, std::size_t size) override;
+                bool Finish(std::uint8_t *tag, std::size_t length) override;
+            };
+
+            /// @brief Adapter running a MacFunction over an accumulated input.
+            /// @details Keeps the legacy (key, data) → MAC interface usable. The
+            ///          input buffer is reused, so steady-state tags only allocate
+            ///          what the function itself returns.
+            class FunctionMacContext final : public MacContext
+            {
+            private:
+                std::vector<std::uint8_t> mKey;
+                MacFunction mMacFn;
+                std::vector<std::uint8_t> mInput;
+
+            public:
+                FunctionMacContext(std::vector<std::uint8_t> key, MacFunction macFn);
+
+                bool Start() override;
+                bool Update(const std::uint8_t *data, std::size_t size) override;
+                bool Finish(std::uint8_t *tag, std::size_t length) override;
+            };
+
+        } // namespace secoc
+    }     // namespace com
+} // namespace ara
+
+#endif // ARA_COM_SECOC_SECOC_MAC_CONTEXT_H
@@ -5,6 +5,8 @@
 #include "./secoc_pdu.h"
 #include <stdexcept>
 #include <algorithm>
+#include <climits>
+#include <cstring>
 
 namespace ara
 {
@@ -13,197 +15,260 @@ namespace ara
         namespace secoc
         {
             // -----------------------------------------------------------------------
-            // Constructor
+            // Constructors
             // -----------------------------------------------------------------------
             SecOcPdu::SecOcPdu(
                 const SecOcPduConfig &config,
                 std::vector<uint8_t> key,
                 MacFunction macFn,
                 FreshnessManager *freshnessManager)
+                : SecOcPdu(config,
+                           std::unique_ptr<MacContext>(new FunctionMacContext(
+                               std::move(key), std::move(macFn))),
+                           freshnessManager)
+            {
+            }
+
+            SecOcPdu::SecOcPdu(
+                const SecOcPduConfig &config,
+                std::unique_ptr<MacContext> macContext,
+                FreshnessManager *freshnessManager)
                 : mConfig{config},
-                  mKey{std::move(key)},
-                  mMacFn{std::move(macFn)},
-                  mFreshnessManager{freshnessManager}
+                  mMacContext{std::move(macContext)},
+                  mFreshnessManager{freshnessManager},
+                  mCounterWidth{config.freshnessConfig.counterWidth}
             {
                 if (mFreshnessManager == nullptr)
                 {
                     throw std::invalid_argument("SecOcPdu: freshnessManager must not be null");
                 }
+                if (!mMacContext)
+                {
+                    throw std::invalid_argument("SecOcPdu: macContext must not be null");
+                }
                 // Register PDU freshness counter
                 mFreshnessManager->RegisterPdu(mConfig.dataId, mConfig.freshnessConfig);
+
+                // The counter may have been registered earlier with another width.
+                auto freshnessResult = mFreshnessManager->GetFreshnessValue(mConfig.dataId);
+                if (freshnessResult.HasValue())
+                {
+                    mCounterWidth = static_cast<uint8_t>(freshnessResult.Value().size());
+                }
             }
 
             // -----------------------------------------------------------------------
-            // buildMacInput — concatenate DataID || Freshness || Payload
+            // encodeFreshness — counter as little-endian bytes of the counter width
             // -----------------------------------------------------------------------
-            std::vector<uint8_t> SecOcPdu::buildMacInput(
-                const FreshnessValue &freshness,
-                const std::vector<uint8_t> &payload) const
+            void SecOcPdu::encodeFreshness(uint64_t counter, uint8_t *freshness) const noexcept
             {
-                std::vector<uint8_t> input;
-                input.reserve(2 + freshness.size() + payload.size());
+                for (uint8_t i = 0; i < mCounterWidth; ++i)
+                {
+                    freshness[i] = i < 8
+                                       ? static_cast<uint8_t>((counter >> (i * 8)) & 0xFF)
+                                       : 0;
+                }
+            }
 
+            // -----------------------------------------------------------------------
+            // computeMac — feed DataID || Freshness || Payload to the MAC context
+            // -----------------------------------------------------------------------
+            bool SecOcPdu::computeMac(
+                const uint8_t *freshness,
+                const uint8_t *payload,
+                std::size_t payloadLength,
+                uint8_t *mac)
+            {
                 // DataID (big-endian)
-                input.push_back(static_cast<uint8_t>(mConfig.dataId >> 8));
-                input.push_back(static_cast<uint8_t>(mConfig.dataId & 0xFF));
+                const uint8_t dataId[2]{
+                    static_cast<uint8_t>(mConfig.dataId >> 8),
+                    static_cast<uint8_t>(mConfig.dataId & 0xFF)};
 
-                // Full freshness value
-                input.insert(input.end(), freshness.begin(), freshness.end());
-
-                // Payload
-                input.insert(input.end(), payload.begin(), payload.end());
+                return mMacContext->Start() &&
+                       mMacContext->Update(dataId, sizeof(dataId)) &&
+                       mMacContext->Update(freshness, mCounterWidth) &&
+                       mMacContext->Update(payload, payloadLength) &&
+                       mMacContext->Finish(mac, mConfig.truncatedMacLength);
+            }
 
-                return input;
+            std::size_t SecOcPdu::SecuredLength(std::size_t payloadLength) const noexcept
+            {
+                return payloadLength +
+                       std::min(mConfig.truncatedFreshnessLength, mCounterWidth) +
+                       mConfig.truncatedMacLength;
             }
 
             // -----------------------------------------------------------------------
-            // Protect — authenticate payload for transmission
+            // ProtectInto — authenticate payload for transmission
             //
             // Wire format: | payload | truncated_freshness | truncated_MAC |
             // -----------------------------------------------------------------------
-            ara::core::Result<std::vector<uint8_t>> SecOcPdu::Protect(
-                const std::vector<uint8_t> &payload)
+            ara::core::Result<std::size_t> SecOcPdu::ProtectInto(
+                const uint8_t *payload,
+                std::size_t payloadLength,
+                uint8_t *secured,
+                std::size_t capacity)
             {
-                if (payload.empty())
+                const std::size_t securedLength = SecuredLength(payloadLength);
+                if (payloadLength == 0 || capacity < securedLength)
                 {
-                    return ara::core::Result<std::vector<uint8_t>>::FromError(
+                    return ara::core::Result<std::size_t>::FromError(
                         MakeErrorCode(SecOcErrc::kInvalidPayloadLength));
                 }
 
+                std::lock_guard<std::mutex> lock(mMutex);
+
                 // 1. Get current freshness value
-                auto freshnessResult = mFreshnessManager->GetFreshnessValue(mConfig.dataId);
-                if (!freshnessResult.HasValue())
+                auto counterResult = mFreshnessManager->GetCounterValue(mConfig.dataId);
+                if (!counterResult.HasValue())
                 {
-                    return ara::core::Result<std::vector<uint8_t>>::FromError(
-                        freshnessResult.Error());
+                    return ara::core::Result<std::size_t>::FromError(
+                        counterResult.Error());
                 }
-                const FreshnessValue &freshness = freshnessResult.Value();
+                uint8_t freshness[UINT8_MAX];
+                encodeFreshness(counterResult.Value(), freshness);
 
-                // 2. Compute MAC over (DataID || Freshness || Payload)
-                const std::vector<uint8_t> macInput = buildMacInput(freshness, payload);
-                const std::vector<uint8_t> mac = mMacFn(mKey, macInput);
+                // 2. Payload first, so the MAC reads it from its final place
+                std::memmove(secured, payload, payloadLength);
+
+                // 3. Truncated freshness (least significant bytes, little-endian order)
+                const uint8_t truncFreshLen = std::min(
+                    mConfig.truncatedFreshnessLength, mCounterWidth);
+                std::memcpy(secured + payloadLength, freshness, truncFreshLen);
 
-                if (mac.size() < mConfig.truncatedMacLength)
+                // 4. Truncated MAC over (DataID || Freshness || Payload)
+                if (!computeMac(freshness, secured, payloadLength,
+                                secured + payloadLength + truncFreshLen))
                 {
-                    return ara::core::Result<std::vector<uint8_t>>::FromError(
+                    return ara::core::Result<std::size_t>::FromError(
                         MakeErrorCode(SecOcErrc::kTruncatedMacFailed));
                 }
 
-                // 3. Build secured PDU
-                std::vector<uint8_t> secured;
-                secured.reserve(payload.size() +
-                                mConfig.truncatedFreshnessLength +
-                                mConfig.truncatedMacLength);
-
-                // Payload
-                secured.insert(secured.end(), payload.begin(), payload.end());
-
-                // Truncated freshness (least significant bytes, little-endian order)
-                const uint8_t truncFreshLen = std::min(
-                    mConfig.truncatedFreshnessLength,
-                    static_cast<uint8_t>(freshness.size()));
-                secured.insert(secured.end(),
-                               freshness.begin(),
-                               freshness.begin() + truncFreshLen);
-
-                // Truncated MAC (first N bytes of full MAC)
-                secured.insert(secured.end(),
-                               mac.begin(),
-                               mac.begin() + mConfig.truncatedMacLength);
-
-                // 4. Increment freshness counter
+                // 5. Increment freshness counter
                 auto incrResult = mFreshnessManager->IncrementCounter(mConfig.dataId);
                 if (!incrResult.HasValue())
                 {
-                    return ara::core::Result<std::vector<uint8_t>>::FromError(
+                    return ara::core::Result<std::size_t>::FromError(
                         incrResult.Error());
                 }
 
-                return secured;
+                return securedLength;
             }
 
             // -----------------------------------------------------------------------
-            // Verify — authenticate received secured PDU
+            // VerifyInPlace — authenticate received secured PDU
             //
             // Expected wire format: | payload | truncated_freshness | truncated_MAC |
             // -----------------------------------------------------------------------
-            ara::core::Result<std::vector<uint8_t>> SecOcPdu::Verify(
-                const std::vector<uint8_t> &securedPdu)
+            ara::core::Result<std::size_t> SecOcPdu::VerifyInPlace(
+                const uint8_t *securedPdu,
+                std::size_t length)
             {
                 const std::size_t minLen =
                     mConfig.truncatedFreshnessLength + mConfig.truncatedMacLength + 1;
 
-                if (securedPdu.size() < minLen)
+                if (length < minLen)
                 {
-                    return ara::core::Result<std::vector<uint8_t>>::FromError(
+                    return ara::core::Result<std::size_t>::FromError(
                         MakeErrorCode(SecOcErrc::kInvalidPayloadLength));
                 }
 
-                // Extract MAC (last truncatedMacLength bytes)
-                const std::size_t macStart = securedPdu.size() - mConfig.truncatedMacLength;
-                const std::vector<uint8_t> receivedMac(
-                    securedPdu.begin() + static_cast<std::ptrdiff_t>(macStart),
-                    securedPdu.end());
-
-                // Extract truncated freshness
+                const std::size_t macStart = length - mConfig.truncatedMacLength;
                 const std::size_t freshStart = macStart - mConfig.truncatedFreshnessLength;
-                const FreshnessValue receivedTruncFresh(
-                    securedPdu.begin() + static_cast<std::ptrdiff_t>(freshStart),
-                    securedPdu.begin() + static_cast<std::ptrdiff_t>(macStart));
 
-                // Extract payload
-                const std::vector<uint8_t> payload(
-                    securedPdu.begin(),
-                    securedPdu.begin() + static_cast<std::ptrdiff_t>(freshStart));
+                std::lock_guard<std::mutex> lock(mMutex);
 
                 // Expand truncated freshness to full width using stored counter as upper bits
-                auto currentFreshnessResult = mFreshnessManager->GetFreshnessValue(mConfig.dataId);
-                if (!currentFreshnessResult.HasValue())
+                auto counterResult = mFreshnessManager->GetCounterValue(mConfig.dataId);
+                if (!counterResult.HasValue())
                 {
-                    return ara::core::Result<std::vector<uint8_t>>::FromError(
-                        currentFreshnessResult.Error());
+                    return ara::core::Result<std::size_t>::FromError(
+                        counterResult.Error());
                 }
-                FreshnessValue fullFreshness = currentFreshnessResult.Value();
+                uint8_t freshness[UINT8_MAX];
+                encodeFreshness(counterResult.Value(), freshness);
 
                 // Overlay received truncated bytes (lower bytes) onto stored counter (upper bytes)
-                for (std::size_t i = 0; i < receivedTruncFresh.size() && i < fullFreshness.size(); ++i)
+                std::memcpy(freshness, securedPdu + freshStart,
+                            std::min(mConfig.truncatedFreshnessLength, mCounterWidth));
+
+                uint64_t receivedCounter = 0;
+                for (uint8_t i = 0; i < mCounterWidth && i < 8; ++i)
+                {
+                    receivedCounter |= static_cast<uint64_t>(freshness[i]) << (i * 8);
+                }
+
+                // Compute expected MAC
+                uint8_t expectedMac[UINT8_MAX];
+                if (!computeMac(freshness, securedPdu, freshStart, expectedMac))
+                {
+                    return ara::core::Result<std::size_t>::FromError(
+                        MakeErrorCode(SecOcErrc::kTruncatedMacFailed));
+                }
+
+                // Constant-time comparison of truncated MAC
+                uint8_t difference = 0;
+                for (uint8_t i = 0; i < mConfig.truncatedMacLength; ++i)
+                {
+                    difference |= static_cast<uint8_t>(
+                        securedPdu[macStart + i] ^ expectedMac[i]);
+                }
+
+                if (difference != 0)
                 {
-                    fullFreshness[i] = receivedTruncFresh[i];
+                    return ara::core::Result<std::size_t>::FromError(
+                        MakeErrorCode(SecOcErrc::kAuthenticationFailed));
                 }
 
-                // Verify freshness monotonicity
-                auto verifyResult = mFreshnessManager->VerifyAndUpdate(mConfig.dataId, fullFreshness);
+                // Only an authentic PDU may advance the receiver's counter.
+                auto verifyResult =
+                    mFreshnessManager->VerifyAndUpdate(mConfig.dataId, receivedCounter);
                 if (!verifyResult.HasValue())
                 {
-                    return ara::core::Result<std::vector<uint8_t>>::FromError(
+                    return ara::core::Result<std::size_t>::FromError(
                         verifyResult.Error());
                 }
 
-                // Compute expected MAC
-                const std::vector<uint8_t> macInput = buildMacInput(fullFreshness, payload);
-                const std::vector<uint8_t> expectedMac = mMacFn(mKey, macInput);
+                return freshStart;
+            }
 
-                if (expectedMac.size() < mConfig.truncatedMacLength)
+            // -----------------------------------------------------------------------
+            // Protect / Verify — vector convenience wrappers
+            // -----------------------------------------------------------------------
+            ara::core::Result<std::vector<uint8_t>> SecOcPdu::Protect(
+                const std::vector<uint8_t> &payload)
+            {
+                if (payload.empty())
                 {
                     return ara::core::Result<std::vector<uint8_t>>::FromError(
-                        MakeErrorCode(SecOcErrc::kTruncatedMacFailed));
+                        MakeErrorCode(SecOcErrc::kInvalidPayloadLength));
                 }
 
-                // Constant-time comparison of truncated MAC
-                bool macMatch = true;
-                for (uint8_t i = 0; i < mConfig.truncatedMacLength; ++i)
+                std::vector<uint8_t> secured(SecuredLength(payload.size()));
+                auto result = ProtectInto(
+                    payload.data(), payload.size(), secured.data(), secured.size());
+                if (!result.HasValue())
                 {
-                    macMatch &= (receivedMac[i] == expectedMac[i]);
+                    return ara::core::Result<std::vector<uint8_t>>::FromError(
+                        result.Error());
                 }
+                return secured;
+            }
 
-                if (!macMatch)
+            ara::core::Result<std::vector<uint8_t>> SecOcPdu::Verify(
+                const std::vector<uint8_t> &securedPdu)
+            {
+                auto result = VerifyInPlace(securedPdu.data(), securedPdu.size());
+                if (!result.HasValue())
                 {
                     return ara::core::Result<std::vector<uint8_t>>::FromError(
-                        MakeErrorCode(SecOcErrc::kAuthenticationFailed));
+                        result.Error());
                 }
 
                 // Return authenticated payload
-                return payload;
+                return std::vector<uint8_t>(
+                    securedPdu.begin(),
+                    securedPdu.begin() + static_cast<std::ptrdiff_t>(result.Value()));
             }
 
         } // namespace secoc
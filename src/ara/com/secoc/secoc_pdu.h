@@ -10,7 +10,9 @@
 ///          MAC computation input:
 ///          | DataID (2 bytes) | Freshness (W bytes) | Payload (N bytes) |
 ///
-///          The MAC algorithm uses HMAC-SHA-256 (from ara::crypto).
+///          The MAC algorithm uses HMAC-SHA-256 (from ara::crypto) by default;
+///          any MacContext can be plugged in. The MAC input is fed to the
+///          context piecewise and never concatenated.
 ///
 ///          Reference: AUTOSAR_SWS_SecureOnboardCommunication §7.3
 ///
@@ -19,12 +21,15 @@
 #ifndef ARA_COM_SECOC_SECOC_PDU_H
 #define ARA_COM_SECOC_SECOC_PDU_H
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 #include <vector>
-#include <functional>
 #include "../../core/result.h"
 #include "./secoc_error_domain.h"
 #include "./freshness_manager.h"
+#include "./secoc_mac_context.h"
 
 namespace ara
 {
@@ -56,12 +61,6 @@ namespace ara
                 FreshnessConfig freshnessConfig{};
             };
 
-            /// @brief MAC computation function type.
-            /// @details Signature: (key, data) → MAC bytes (32 bytes for HMAC-SHA-256)
-            using MacFunction = std::function<std::vector<uint8_t>(
-                const std::vector<uint8_t> & /*key*/,
-                const std::vector<uint8_t> & /*data*/)>;
-
             /// @brief SecOC secured PDU processor.
             /// @details Handles authentication on transmit and verification on receive.
             ///
@@ -77,6 +76,10 @@ namespace ara
             ///          auto result = secoc.Verify(received_bytes);
             ///          if (result.HasValue()) process(result.Value());  // authenticated payload
             ///          @endcode
+            ///
+            ///          ProtectInto() and VerifyInPlace() do the same work on caller
+            ///          buffers without allocating. Calls on one instance are
+            ///          serialized; distinct instances may run in parallel.
             class SecOcPdu
             {
             public:
@@ -90,8 +93,43 @@ namespace ara
                          MacFunction macFn,
                          FreshnessManager *freshnessManager);
 
+                /// @brief Construct a SecOC PDU processor around a keyed MAC context.
+                /// @param config PDU configuration.
+                /// @param macContext Pre-keyed MAC context owned by this PDU.
+                /// @param freshnessManager Freshness manager (shared ownership allowed).
+                SecOcPdu(const SecOcPduConfig &config,
+                         std::unique_ptr<MacContext> macContext,
+                         FreshnessManager *freshnessManager);
+
                 ~SecOcPdu() = default;
 
+                /// @brief Get the secured PDU length for a payload length.
+                std::size_t SecuredLength(std::size_t payloadLength) const noexcept;
+
+                /// @brief Protect a payload into a caller-provided buffer.
+                /// @param payload Unsecured payload bytes (may alias @p secured).
+                /// @param payloadLength Payload length in bytes.
+                /// @param secured Output buffer for the secured PDU.
+                /// @param capacity Output buffer size.
+                /// @returns Secured PDU length, or kInvalidPayloadLength if the
+                ///          payload is empty or the buffer is too small.
+                /// @post Freshness counter is incremented on success.
+                ara::core::Result<std::size_t> ProtectInto(
+                    const uint8_t *payload,
+                    std::size_t payloadLength,
+                    uint8_t *secured,
+                    std::size_t capacity);
+
+                /// @brief Verify a received secured PDU without copying it.
+                /// @param securedPdu Received bytes (payload + freshness + MAC).
+                /// @param length Received length in bytes.
+                /// @returns Length of the authenticated payload, which starts at
+                ///          @p securedPdu, or error if verification failed.
+                /// @post Freshness counter is updated on success.
+                ara::core::Result<std::size_t> VerifyInPlace(
+                    const uint8_t *securedPdu,
+                    std::size_t length);
+
                 /// @brief Protect (authenticate) a payload for transmission.
                 /// @param payload Unsecured payload bytes.
                 /// @returns Secured PDU bytes (payload + freshness + truncated MAC),
@@ -110,14 +148,20 @@ namespace ara
 
             private:
                 SecOcPduConfig mConfig;
-                std::vector<uint8_t> mKey;
-                MacFunction mMacFn;
+                std::unique_ptr<MacContext> mMacContext;
                 FreshnessManager *mFreshnessManager;
-
-                /// @brief Build MAC input: DataID || Freshness || Payload
-                std::vector<uint8_t> buildMacInput(
-                    const FreshnessValue &freshness,
-                    const std::vector<uint8_t> &payload) const;
+                uint8_t mCounterWidth;
+                std::mutex mMutex;
+
+                /// @brief Write the freshness counter's little-endian bytes.
+                void encodeFreshness(uint64_t counter, uint8_t *freshness) const noexcept;
+
+                /// @brief Compute the truncated MAC over DataID || Freshness || Payload.
+                bool computeMac(
+                    const uint8_t *freshness,
+                    const uint8_t *payload,
+                    std::size_t payloadLength,
+                    uint8_t *mac);
             };
 
         } // namespace secoc
@@ -2,6 +2,9 @@
 /// @brief Implementation of SecOcPduCollective.
 
 #include "./secoc_pdu_collective.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
 #include <utility>
 
 namespace ara
@@ -13,7 +16,9 @@ namespace ara
             void SecOcPduCollective::AddPdu(PduId id, SecOcPdu *pdu)
             {
                 std::lock_guard<std::mutex> lock(mMutex);
-                mPdus[id] = pdu;
+                auto pdus = std::make_shared<PduMap>(*mPdus);
+                (*pdus)[id] = pdu;
+                mPdus = std::move(pdus);
             }
 
             core::Result<std::map<PduId, std::vector<std::uint8_t>>>
@@ -31,8 +36,8 @@ namespace ara
                 std::map<PduId, std::vector<std::uint8_t>> result;
                 for (const auto &pair : payloads)
                 {
-                    auto it = mPdus.find(pair.first);
-                    if (it == mPdus.end() || !it->second)
+                    auto it = mPdus->find(pair.first);
+                    if (it == mPdus->end() || !it->second)
                         return core::Result<std::map<PduId, std::vector<std::uint8_t>>>::FromError(
                             MakeErrorCode(SecOcErrc::kAuthenticationFailed));
 
@@ -50,7 +55,7 @@ namespace ara
             SecOcPduCollective::VerifyAll(
                 const std::map<PduId, std::vector<std::uint8_t>> &securedPdus)
             {
-                std::map<PduId, SecOcPdu *> pdus;
+                std::shared_ptr<const PduMap> pdus;
                 VerificationStatusCallback callback;
                 SecOcOverrideStatus overrideStatus;
                 {
@@ -75,8 +80,8 @@ namespace ara
                         continue;
                     }
 
-                    auto it = pdus.find(pair.first);
-                    if (it == pdus.end() || !it->second)
+                    auto it = pdus->find(pair.first);
+                    if (it == pdus->end() || !it->second)
                     {
                         status.result = VerificationResult::kFail;
                         if (callback) callback(status);
@@ -101,6 +106,189 @@ namespace ara
                     std::move(result));
             }
 
+            void SecOcPduCollective::runBatch(
+                core::Span<SecOcBatchEntry> entries,
+                core::Executor *executor,
+                const std::function<void(SecOcBatchEntry &)> &process)
+            {
+                // Entries of one PDU always land in the same shard, so a PDU's
+                // freshness counter advances in batch order.
+                const std::size_t cMaxShards{8U};
+                const std::size_t shards =
+                    executor == nullptr ? 1U : std::min(cMaxShards, entries.size());
+
+                auto runShard = [&entries, &process, shards](std::size_t shard)
+                {
+                    for (auto &entry : entries)
+                    {
+                        if (entry.pduId % shards == shard)
+                        {
+                            process(entry);
+                        }
+                    }
+                };
+
+                if (shards <= 1U)
+                {
+                    runShard(0U);
+                    return;
+                }
+
+                std::mutex doneMutex;
+                std::condition_variable doneCondition;
+                std::size_t pending = shards - 1U;
+                for (std::size_t shard = 1U; shard < shards; ++shard)
+                {
+                    executor->Execute(
+                        [&, shard]
+                        {
+                            runShard(shard);
+                            std::lock_guard<std::mutex> lock(doneMutex);
+                            if (--pending == 0U)
+                            {
+                                doneCondition.notify_one();
+                            }
+                        });
+                }
+                runShard(0U);
+
+                std::unique_lock<std::mutex> lock(doneMutex);
+                doneCondition.wait(lock, [&pending] { return pending == 0U; });
+            }
+
+            std::size_t SecOcPduCollective::ProtectBatch(
+                core::Span<SecOcBatchEntry> entries,
+                core::Executor *executor)
+            {
+                std::shared_ptr<const PduMap> pdus;
+                SecOcOverrideStatus overrideStatus;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    pdus = mPdus;
+                    overrideStatus = mOverrideStatus;
+                }
+
+                runBatch(
+                    entries, executor,
+                    [&pdus, overrideStatus](SecOcBatchEntry &entry)
+                    {
+                        entry.outputLength = 0U;
+                        entry.error = 0;
+
+                        if (overrideStatus == SecOcOverrideStatus::kSkipAll)
+                        {
+                            // Bypass: pass the payload through unchanged
+                            if (entry.outputCapacity < entry.inputLength)
+                            {
+                                entry.error = static_cast<core::ErrorDomain::CodeType>(
+                                    SecOcErrc::kInvalidPayloadLength);
+                                return;
+                            }
+                            std::memmove(entry.output, entry.input, entry.inputLength);
+                            entry.outputLength = entry.inputLength;
+                            return;
+                        }
+
+                        auto it = pdus->find(entry.pduId);
+                        if (it == pdus->end() || !it->second)
+                        {
+                            entry.error = static_cast<core::ErrorDomain::CodeType>(
+                                SecOcErrc::kAuthenticationFailed);
+                            return;
+                        }
+
+                        auto secured = it->second->ProtectInto(
+                            entry.input, entry.inputLength,
+                            entry.output, entry.outputCapacity);
+                        if (secured.HasValue())
+                        {
+                            entry.outputLength = secured.Value();
+                        }
+                        else
+                        {
+                            entry.error = secured.Error().Value();
+                        }
+                    });
+
+                return static_cast<std::size_t>(std::count_if(
+                    entries.begin(), entries.end(),
+                    [](const SecOcBatchEntry &entry) { return entry.error == 0; }));
+            }
+
+            std::size_t SecOcPduCollective::VerifyBatch(
+                core::Span<SecOcBatchEntry> entries,
+                core::Executor *executor)
+            {
+                std::shared_ptr<const PduMap> pdus;
+                VerificationStatusCallback callback;
+                SecOcOverrideStatus overrideStatus;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    pdus = mPdus;
+                    callback = mCallback;
+                    overrideStatus = mOverrideStatus;
+                }
+
+                runBatch(
+                    entries, executor,
+                    [&pdus, overrideStatus](SecOcBatchEntry &entry)
+                    {
+                        entry.outputLength = 0U;
+                        entry.error = 0;
+
+                        if (overrideStatus == SecOcOverrideStatus::kSkipAll ||
+                            overrideStatus == SecOcOverrideStatus::kSkipVerify)
+                        {
+                            entry.result = VerificationResult::kPass;
+                            entry.outputLength = entry.inputLength;
+                            return;
+                        }
+
+                        auto it = pdus->find(entry.pduId);
+                        if (it == pdus->end() || !it->second)
+                        {
+                            entry.result = VerificationResult::kFail;
+                            entry.error = static_cast<core::ErrorDomain::CodeType>(
+                                SecOcErrc::kAuthenticationFailed);
+                            return;
+                        }
+
+                        auto verified = it->second->VerifyInPlace(
+                            entry.input, entry.inputLength);
+                        if (verified.HasValue())
+                        {
+                            entry.result = VerificationResult::kPass;
+                            entry.outputLength = verified.Value();
+                        }
+                        else
+                        {
+                            entry.error = verified.Error().Value();
+                            entry.result =
+                                entry.error == static_cast<core::ErrorDomain::CodeType>(
+                                                   SecOcErrc::kFreshnessCounterFailed)
+                                    ? VerificationResult::kFreshnessFailure
+                                    : VerificationResult::kFail;
+                        }
+                    });
+
+                std::size_t passed = 0U;
+                for (const auto &entry : entries)
+                {
+                    if (entry.result == VerificationResult::kPass)
+                    {
+                        ++passed;
+                    }
+                    if (callback)
+                    {
+                        VerificationStatusIndication status;
+                        status.pduId = entry.pduId;
+                        status.result = entry.result;
+                        callback(status);
+                    }
+                }
+                return passed;
+            }
+
             void SecOcPduCollective::SetVerificationStatusCallback(
                 VerificationStatusCallback callback)
             {
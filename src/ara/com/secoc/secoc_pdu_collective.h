@@ -7,12 +7,16 @@
 #ifndef ARA_COM_SECOC_PDU_COLLECTIVE_H
 #define ARA_COM_SECOC_PDU_COLLECTIVE_H
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <vector>
+#include "../../core/executor.h"
 #include "../../core/result.h"
+#include "../../core/span.h"
 #include "./secoc_pdu.h"
 
 namespace ara
@@ -50,6 +54,25 @@ namespace ara
                 kSkipAll = 2        ///< Skip all SecOC processing
             };
 
+            /// @brief One PDU of a ProtectBatch() / VerifyBatch() call.
+            /// @details The caller owns both buffers. For VerifyBatch() the output
+            ///          buffer is unused: the authenticated payload is the first
+            ///          outputLength bytes of the input.
+            struct SecOcBatchEntry
+            {
+                PduId pduId{0};
+                const std::uint8_t *input{nullptr};
+                std::size_t inputLength{0};
+                std::uint8_t *output{nullptr};
+                std::size_t outputCapacity{0};
+
+                /// @brief Secured (protect) or payload (verify) length on success.
+                std::size_t outputLength{0};
+                VerificationResult result{VerificationResult::kNotVerified};
+                /// @brief SecOcErrc value of the failure, 0 on success.
+                core::ErrorDomain::CodeType error{0};
+            };
+
             /// @brief Collective PDU processor for grouped authentication (SWS_SecOC_00203).
             /// @details Processes multiple I-PDUs as a group, producing a single MAC
             ///          that covers all PDUs in the collection.
@@ -74,6 +97,26 @@ namespace ara
                 core::Result<std::map<PduId, std::vector<std::uint8_t>>> VerifyAll(
                     const std::map<PduId, std::vector<std::uint8_t>> &securedPdus);
 
+                /// @brief Protect a batch of PDUs into caller buffers.
+                /// @param entries Batch; each entry receives its own outcome.
+                /// @param executor Optional worker pool. Entries are sharded by PDU
+                ///        so each PDU keeps its order and freshness sequence.
+                ///        Null processes the batch in the calling thread.
+                /// @returns Number of entries protected successfully.
+                std::size_t ProtectBatch(
+                    core::Span<SecOcBatchEntry> entries,
+                    core::Executor *executor = nullptr);
+
+                /// @brief Verify a batch of secured PDUs in place.
+                /// @param entries Batch; each entry receives its own outcome.
+                /// @param executor Optional worker pool, as for ProtectBatch().
+                /// @returns Number of entries that passed verification.
+                /// @note The verification status callback is invoked for every entry
+                ///       in batch order in the calling thread once the batch is done.
+                std::size_t VerifyBatch(
+                    core::Span<SecOcBatchEntry> entries,
+                    core::Executor *executor = nullptr);
+
                 /// @brief Register a callback for per-PDU verification events.
                 void SetVerificationStatusCallback(VerificationStatusCallback callback);
 
@@ -83,7 +126,18 @@ namespace ara
                 SecOcOverrideStatus GetOverrideStatus() const noexcept;
 
             private:
-                std::map<PduId, SecOcPdu *> mPdus;
+                /// @brief Run @p process over the entries, sharded by PDU.
+                static void runBatch(
+                    core::Span<SecOcBatchEntry> entries,
+                    core::Executor *executor,
+                    const std::function<void(SecOcBatchEntry &)> &process);
+
+                using PduMap = std::map<PduId, SecOcPdu *>;
+
+                /// @brief Immutable PDU table, replaced as a whole by AddPdu().
+                /// @details Batches take a reference under the lock instead
+                ///          of copying the map.
+                std::shared_ptr<const PduMap> mPdus{std::make_shared<PduMap>()};
                 VerificationStatusCallback mCallback;
                 SecOcOverrideStatus mOverrideStatus{SecOcOverrideStatus::kNoOverride};
                 mutable std::mutex mMutex;
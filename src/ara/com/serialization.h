@@ -1,10 +1,18 @@
 /// @file src/ara/com/serialization.h
 /// @brief Declarations for serialization.
-/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+/// @details Every Serializer<T> offers two APIs:
+///          - Serialize()/Deserialize() return or consume a byte vector.
+///          - SerializedSize()/SerializeTo() compute the exact wire size up
+///            front and write through a bounded SerializeCursor into a
+///            caller-provided buffer (e.g. a loaned transport chunk), so
+///            nested containers are encoded with one allocation or none.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
 
 #ifndef ARA_COM_SERIALIZATION_H
 #define ARA_COM_SERIALIZATION_H
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <map>
@@ -18,14 +26,237 @@
 #endif
 
 #include "../core/result.h"
+#include "../core/span.h"
 #include "./com_error_domain.h"
 
 namespace ara
 {
     namespace com
     {
+        /// @brief Bounded write cursor over a caller-provided buffer.
+        ///        A write that does not fit marks the cursor as failed and
+        ///        every later write is ignored, so encoders only need to
+        ///        check Ok() once at the end.
+        class SerializeCursor
+        {
+        private:
+            std::uint8_t *mData;
+            std::size_t mSize;
+            std::size_t mOffset{0U};
+            bool mFailed{false};
+
+        public:
+            /// @brief Constructor
+            /// @param data Start of the writable buffer
+            /// @param size Buffer capacity in bytes
+            SerializeCursor(std::uint8_t *data, std::size_t size) noexcept
+                : mData{data}, mSize{data != nullptr ? size : 0U}
+            {
+            }
+
+            /// @brief Constructor
+            /// @param buffer Writable buffer
+            explicit SerializeCursor(core::Span<std::uint8_t> buffer) noexcept
+                : SerializeCursor{buffer.data(), buffer.size()}
+            {
+            }
+
+            /// @brief Reserve the next bytes of the buffer for direct writing
+            /// @param size Number of bytes
+            /// @returns Pointer to the reserved bytes, or nullptr if they do not fit
+            std::uint8_t *Reserve(std::size_t size) noexcept
+            {
+                if (mFailed || size > mSize - mOffset)
+                {
+                    mFailed = true;
+                    return nullptr;
+                }
+                std::uint8_t *position{mData + mOffset};
+                mOffset += size;
+                return position;
+            }
+
+            /// @brief Copy bytes to the buffer
+            /// @param source Bytes to copy
+            /// @param size Number of bytes
+            /// @returns False if the bytes did not fit
+            bool Write(const void *source, std::size_t size) noexcept
+            {
+                std::uint8_t *position{Reserve(size)};
+                if (position == nullptr)
+                {
+                    return false;
+                }
+                if (size > 0U)
+                {
+                    std::memcpy(position, source, size);
+                }
+                return true;
+            }
+
+            /// @brief Number of bytes written so far
+            std::size_t Offset() const noexcept
+            {
+                return mOffset;
+            }
+
+            /// @brief Number of bytes still available
+            std::size_t Remaining() const noexcept
+            {
+                return mSize - mOffset;
+            }
+
+            /// @brief Whether every write so far fitted into the buffer
+            bool Ok() const noexcept
+            {
+                return !mFailed;
+            }
+        };
+
+        /// @brief Bounded read cursor over a serialized byte span.
+        class DeserializeCursor
+        {
+        private:
+            const std::uint8_t *mData;
+            std::size_t mSize;
+            std::size_t mOffset{0U};
+
+        public:
+            /// @brief Constructor
+            /// @param data Start of the serialized bytes
+            /// @param size Number of readable bytes
+            DeserializeCursor(const std::uint8_t *data, std::size_t size) noexcept
+                : mData{data}, mSize{data != nullptr ? size : 0U}
+            {
+            }
+
+            /// @brief Constructor
+            /// @param buffer Serialized bytes
+            explicit DeserializeCursor(
+                core::Span<const std::uint8_t> buffer) noexcept
+                : DeserializeCursor{buffer.data(), buffer.size()}
+            {
+            }
+
+            /// @brief Current read position
+            const std::uint8_t *Current() const noexcept
+            {
+                return mData + mOffset;
+            }
+
+            /// @brief Consume bytes
+            /// @param size Number of bytes
+            /// @returns False (and nothing consumed) if fewer bytes remain
+            bool Advance(std::size_t size) noexcept
+            {
+                if (size > mSize - mOffset)
+                {
+                    return false;
+                }
+                mOffset += size;
+                return true;
+            }
+
+            /// @brief Number of bytes consumed so far
+            std::size_t Offset() const noexcept
+            {
+                return mOffset;
+            }
+
+            /// @brief Number of bytes still readable
+            std::size_t Remaining() const noexcept
+            {
+                return mSize - mOffset;
+            }
+        };
+
+        template <typename T, typename Enable = void>
+        struct Serializer;
+
         namespace detail
         {
+            /// @brief Detects Serializer<T> specializations that provide the
+            ///        SerializedSize()/SerializeTo() buffer API. Serializers
+            ///        written against the vector API only are still usable;
+            ///        they are encoded through a temporary vector.
+            template <typename T>
+            class HasSizedSerializer
+            {
+            private:
+                template <typename U>
+                static auto Test(int)
+                    -> decltype(
+                        Serializer<U>::SerializedSize(std::declval<const U &>()),
+                        Serializer<U>::SerializeTo(
+                            std::declval<const U &>(),
+                            std::declval<SerializeCursor &>()),
+                        std::true_type{});
+
+                template <typename>
+                static std::false_type Test(...);
+
+            public:
+                static constexpr bool value = decltype(Test<T>(0))::value;
+            };
+
+            /// @brief Element types whose std::vector is encoded as one
+            ///        memcpy. uint8_t keeps its raw passthrough format and
+            ///        vector<bool> has no contiguous storage.
+            template <typename T>
+            struct IsBulkCopyable
+                : std::integral_constant<
+                      bool,
+                      std::is_trivially_copyable<T>::value &&
+                          !std::is_same<T, std::uint8_t>::value &&
+                          !std::is_same<T, bool>::value>
+            {
+            };
+
+            template <typename T>
+            std::size_t WireSize(const T &value, std::true_type)
+            {
+                return Serializer<T>::SerializedSize(value);
+            }
+
+            template <typename T>
+            std::size_t WireSize(const T &value, std::false_type)
+            {
+                return Serializer<T>::Serialize(value).size();
+            }
+
+            /// @brief Exact number of bytes Serializer<T> writes for value.
+            template <typename T>
+            std::size_t WireSize(const T &value)
+            {
+                return WireSize(
+                    value,
+                    std::integral_constant<bool, HasSizedSerializer<T>::value>{});
+            }
+
+            template <typename T>
+            void WriteTo(const T &value, SerializeCursor &cursor, std::true_type)
+            {
+                Serializer<T>::SerializeTo(value, cursor);
+            }
+
+            template <typename T>
+            void WriteTo(const T &value, SerializeCursor &cursor, std::false_type)
+            {
+                const std::vector<std::uint8_t> bytes{
+                    Serializer<T>::Serialize(value)};
+                cursor.Write(bytes.data(), bytes.size());
+            }
+
+            /// @brief Encode value at the cursor position.
+            template <typename T>
+            void WriteTo(const T &value, SerializeCursor &cursor)
+            {
+                WriteTo(
+                    value,
+                    cursor,
+                    std::integral_constant<bool, HasSizedSerializer<T>::value>{});
+            }
+
 #if defined(ARA_COM_USE_CYCLONEDDS) && (ARA_COM_USE_CYCLONEDDS == 1)
             using org::eclipse::cyclonedds::core::cdr::move;
             using org::eclipse::cyclonedds::core::cdr::read;
@@ -70,13 +301,21 @@ namespace ara
 #endif
         } // namespace detail
 
-        template <typename T, typename Enable = void>
-        struct Serializer;
-
         /// @brief Default serializer for trivially-copyable types.
         template <typename T>
         struct Serializer<T, typename std::enable_if<std::is_trivially_copyable<T>::value>::type>
         {
+            /// @brief Wire size, known at compile time.
+            static constexpr std::size_t SerializedSize(const T &) noexcept
+            {
+                return sizeof(T);
+            }
+
+            static void SerializeTo(const T &value, SerializeCursor &cursor) noexcept
+            {
+                cursor.Write(&value, sizeof(T));
+            }
+
             static std::vector<std::uint8_t> Serialize(const T &value)
             {
                 std::vector<std::uint8_t> buffer(sizeof(T));
@@ -127,6 +366,41 @@ namespace ara
                 !std::is_trivially_copyable<T>::value &&
                 detail::HasCdrSerializerOps<T>::value>::type>
         {
+            /// @brief Wire size, including the 4-byte encapsulation header.
+            static std::size_t SerializedSize(const T &value)
+            {
+                using namespace org::eclipse::cyclonedds::core::cdr;
+
+                T mutable_value = value;
+                basic_cdr_stream sizer;
+                move(sizer, mutable_value, false);
+                return sizer.position() + 4U;
+            }
+
+            static void SerializeTo(const T &value, SerializeCursor &cursor)
+            {
+                using namespace org::eclipse::cyclonedds::core::cdr;
+
+                T mutable_value = value;
+                basic_cdr_stream sizer;
+                move(sizer, mutable_value, false);
+                const std::size_t payload_size = sizer.position();
+
+                std::uint8_t *buffer{cursor.Reserve(payload_size + 4U)};
+                if (buffer == nullptr)
+                {
+                    return;
+                }
+                buffer[0] = 0x00;
+                buffer[1] = 0x01;
+                buffer[2] = 0x00;
+                buffer[3] = 0x00;
+
+                basic_cdr_stream writer;
+                writer.set_buffer(reinterpret_cast<char *>(buffer + 4U), payload_size);
+                write(writer, mutable_value, false);
+            }
+
             static std::vector<std::uint8_t> Serialize(const T &value)
             {
                 using namespace org::eclipse::cyclonedds::core::cdr;
@@ -216,6 +490,19 @@ namespace ara
         template <>
         struct Serializer<std::string, void>
         {
+            static std::size_t SerializedSize(const std::string &value) noexcept
+            {
+                return sizeof(std::uint32_t) + value.size();
+            }
+
+            static void SerializeTo(
+                const std::string &value, SerializeCursor &cursor) noexcept
+            {
+                const std::uint32_t len = static_cast<std::uint32_t>(value.size());
+                cursor.Write(&len, sizeof(len));
+                cursor.Write(value.data(), len);
+            }
+
             static std::vector<std::uint8_t> Serialize(const std::string &value)
             {
                 std::vector<std::uint8_t> buffer;
@@ -283,6 +570,19 @@ namespace ara
         template <>
         struct Serializer<std::vector<std::uint8_t>, void>
         {
+            static std::size_t SerializedSize(
+                const std::vector<std::uint8_t> &value) noexcept
+            {
+                return value.size();
+            }
+
+            static void SerializeTo(
+                const std::vector<std::uint8_t> &value,
+                SerializeCursor &cursor) noexcept
+            {
+                cursor.Write(value.data(), value.size());
+            }
+
             static std::vector<std::uint8_t> Serialize(
                 const std::vector<std::uint8_t> &value)
             {
@@ -312,41 +612,44 @@ namespace ara
             }
         };
 
-        /// @brief Serializer for std::vector<T> where T is not uint8_t.
+        /// @brief Serializer for std::vector<T> of non-trivially-copyable T.
         ///        Format: [uint32_t count][element0][element1]...
         template <typename T>
         struct Serializer<
             std::vector<T>,
             typename std::enable_if<
-                !std::is_same<T, std::uint8_t>::value>::type>
+                !std::is_same<T, std::uint8_t>::value &&
+                !detail::IsBulkCopyable<T>::value>::type>
         {
-            static std::vector<std::uint8_t> Serialize(
-                const std::vector<T> &value)
+            static std::size_t SerializedSize(const std::vector<T> &value)
+            {
+                std::size_t size = sizeof(std::uint32_t);
+                for (const auto &elem : value)
+                {
+                    size += detail::WireSize(elem);
+                }
+                return size;
+            }
+
+            static void SerializeTo(
+                const std::vector<T> &value, SerializeCursor &cursor)
             {
-                std::vector<std::uint8_t> buffer;
                 const std::uint32_t count =
                     static_cast<std::uint32_t>(value.size());
+                cursor.Write(&count, sizeof(count));
 
-                if (std::is_trivially_copyable<T>::value && count > 0U)
+                for (const auto &elem : value)
                 {
-                    const std::size_t dataSize = count * sizeof(T);
-                    buffer.resize(sizeof(count) + dataSize);
-                    std::memcpy(buffer.data(), &count, sizeof(count));
-                    std::memcpy(buffer.data() + sizeof(count),
-                                value.data(), dataSize);
+                    detail::WriteTo(elem, cursor);
                 }
-                else
-                {
-                    buffer.resize(sizeof(count));
-                    std::memcpy(buffer.data(), &count, sizeof(count));
+            }
 
-                    for (const auto &elem : value)
-                    {
-                        auto elemBytes = Serializer<T>::Serialize(elem);
-                        buffer.insert(buffer.end(),
-                                      elemBytes.begin(), elemBytes.end());
-                    }
-                }
+            static std::vector<std::uint8_t> Serialize(
+                const std::vector<T> &value)
+            {
+                std::vector<std::uint8_t> buffer(SerializedSize(value));
+                SerializeCursor cursor{buffer.data(), buffer.size()};
+                SerializeTo(value, cursor);
                 return buffer;
             }
 
@@ -379,7 +682,9 @@ namespace ara
                 std::memcpy(&count, data, sizeof(count));
                 std::size_t offset = sizeof(count);
                 std::vector<T> result;
-                result.reserve(count);
+                // Only a hint: capped by the span so that a corrupt count
+                // cannot force a huge up-front allocation.
+                result.reserve(std::min<std::size_t>(count, maxSize - offset));
 
                 for (std::uint32_t i = 0; i < count; ++i)
                 {
@@ -395,8 +700,8 @@ namespace ara
                         return core::Result<std::pair<std::vector<T>, std::size_t>>::
                             FromError(elemResult.Error());
                     }
-                    result.push_back(std::move(elemResult).Value().first);
                     offset += elemResult.Value().second;
+                    result.push_back(std::move(elemResult).Value().first);
                 }
 
                 return core::Result<std::pair<std::vector<T>, std::size_t>>::
@@ -404,33 +709,139 @@ namespace ara
             }
         };
 
+        /// @brief Serializer for std::vector<T> of trivially-copyable T
+        ///        (point clouds, signal arrays, object lists).
+        ///        Same wire format as the element-wise serializer, but the
+        ///        body is a single memcpy on both encode and decode.
+        template <typename T>
+        struct Serializer<
+            std::vector<T>,
+            typename std::enable_if<detail::IsBulkCopyable<T>::value>::type>
+        {
+            static std::size_t SerializedSize(const std::vector<T> &value) noexcept
+            {
+                return sizeof(std::uint32_t) + value.size() * sizeof(T);
+            }
+
+            static void SerializeTo(
+                const std::vector<T> &value, SerializeCursor &cursor) noexcept
+            {
+                const std::uint32_t count =
+                    static_cast<std::uint32_t>(value.size());
+                cursor.Write(&count, sizeof(count));
+                cursor.Write(value.data(), value.size() * sizeof(T));
+            }
+
+            static std::vector<std::uint8_t> Serialize(
+                const std::vector<T> &value)
+            {
+                std::vector<std::uint8_t> buffer(SerializedSize(value));
+                SerializeCursor cursor{buffer.data(), buffer.size()};
+                SerializeTo(value, cursor);
+                return buffer;
+            }
+
+            static core::Result<std::vector<T>> Deserialize(
+                const std::uint8_t *data,
+                std::size_t size)
+            {
+                auto result = DeserializeAt(data, size);
+                if (!result.HasValue())
+                {
+                    return core::Result<std::vector<T>>::FromError(
+                        result.Error());
+                }
+                return core::Result<std::vector<T>>::FromValue(
+                    std::move(result).Value().first);
+            }
+
+            static core::Result<std::pair<std::vector<T>, std::size_t>>
+            DeserializeAt(
+                const std::uint8_t *data,
+                std::size_t maxSize)
+            {
+                if (data == nullptr || maxSize < sizeof(std::uint32_t))
+                {
+                    return core::Result<std::pair<std::vector<T>, std::size_t>>::
+                        FromError(MakeErrorCode(ComErrc::kFieldValueIsNotValid));
+                }
+
+                std::uint32_t count;
+                std::memcpy(&count, data, sizeof(count));
+
+                // Validate against the span before allocating, so a corrupt
+                // count cannot trigger a huge allocation.
+                const std::size_t available = maxSize - sizeof(count);
+                if (count > available / sizeof(T))
+                {
+                    return core::Result<std::pair<std::vector<T>, std::size_t>>::
+                        FromError(MakeErrorCode(ComErrc::kFieldValueIsNotValid));
+                }
+
+                // Build the vector from the bytes directly rather than
+                // zero-filling it first, which would also require T to be
+                // default-constructible.
+                const std::size_t bodySize = count * sizeof(T);
+                const std::uint8_t *body = data + sizeof(count);
+                std::vector<T> result;
+                if (reinterpret_cast<std::uintptr_t>(body) % alignof(T) == 0U)
+                {
+                    const T *first = reinterpret_cast<const T *>(body);
+                    result.assign(first, first + count);
+                }
+                else
+                {
+                    result.reserve(count);
+                    typename std::aligned_storage<sizeof(T), alignof(T)>::type element;
+                    for (std::uint32_t i = 0U; i < count; ++i)
+                    {
+                        std::memcpy(&element, body + i * sizeof(T), sizeof(T));
+                        result.push_back(*reinterpret_cast<const T *>(&element));
+                    }
+                }
+
+                return core::Result<std::pair<std::vector<T>, std::size_t>>::
+                    FromValue(std::make_pair(
+                        std::move(result), sizeof(count) + bodySize));
+            }
+        };
+
         /// @brief Serializer for std::map<K, V>.
         ///        Format: [uint32_t count][key0][val0][key1][val1]...
         template <typename K, typename V>
         struct Serializer<std::map<K, V>, void>
         {
-            static std::vector<std::uint8_t> Serialize(
-                const std::map<K, V> &value)
+            static std::size_t SerializedSize(const std::map<K, V> &value)
+            {
+                std::size_t size = sizeof(std::uint32_t);
+                for (const auto &kv : value)
+                {
+                    size += detail::WireSize(kv.first);
+                    size += detail::WireSize(kv.second);
+                }
+                return size;
+            }
+
+            static void SerializeTo(
+                const std::map<K, V> &value, SerializeCursor &cursor)
             {
-                std::vector<std::uint8_t> buffer;
                 const std::uint32_t count =
                     static_cast<std::uint32_t>(value.size());
-
-                // Estimate and pre-allocate to reduce reallocations.
-                buffer.reserve(sizeof(count) +
-                               count * (sizeof(K) + sizeof(V)));
-                buffer.resize(sizeof(count));
-                std::memcpy(buffer.data(), &count, sizeof(count));
+                cursor.Write(&count, sizeof(count));
 
                 for (const auto &kv : value)
                 {
-                    auto keyBytes = Serializer<K>::Serialize(kv.first);
-                    buffer.insert(buffer.end(),
-                                  keyBytes.begin(), keyBytes.end());
-                    auto valBytes = Serializer<V>::Serialize(kv.second);
-                    buffer.insert(buffer.end(),
-                                  valBytes.begin(), valBytes.end());
+                    detail::WriteTo(kv.first, cursor);
+                    detail::WriteTo(kv.second, cursor);
                 }
+            }
+
+            static std::vector<std::uint8_t> Serialize(
+                const std::map<K, V> &value)
+            {
+                std::vector<std::uint8_t> buffer(SerializedSize(value));
+                SerializeCursor cursor{buffer.data(), buffer.size()};
+                SerializeTo(value, cursor);
                 return buffer;
             }
 
@@ -498,6 +909,55 @@ namespace ara
                     FromValue(std::make_pair(std::move(result), offset));
             }
         };
+
+        /// @brief Exact wire size of a value.
+        /// @param value Value to measure
+        /// @returns Number of bytes Serializer<T> produces for value
+        template <typename T>
+        std::size_t SerializedSizeOf(const T &value)
+        {
+            return detail::WireSize(value);
+        }
+
+        /// @brief Serialize a value into a caller-provided buffer.
+        /// @param value Value to encode
+        /// @param buffer Destination, e.g. a loaned transport chunk
+        /// @returns Number of bytes written, or kSerializationError if the
+        ///          buffer is too small
+        template <typename T>
+        core::Result<std::size_t> SerializeInto(
+            const T &value, core::Span<std::uint8_t> buffer)
+        {
+            SerializeCursor cursor{buffer};
+            detail::WriteTo(value, cursor);
+            if (!cursor.Ok())
+            {
+                return core::Result<std::size_t>::FromError(
+                    MakeErrorCode(ComErrc::kSerializationError));
+            }
+            return core::Result<std::size_t>::FromValue(cursor.Offset());
+        }
+
+        /// @brief Decode the next value from a bounded cursor.
+        /// @param cursor Read cursor; advanced past the value on success
+        /// @returns Decoded value, or the decoding error (cursor unchanged)
+        template <typename T>
+        core::Result<T> DeserializeFrom(DeserializeCursor &cursor)
+        {
+            auto result = Serializer<T>::DeserializeAt(
+                cursor.Current(), cursor.Remaining());
+            if (!result.HasValue())
+            {
+                return core::Result<T>::FromError(result.Error());
+            }
+            if (!cursor.Advance(result.Value().second))
+            {
+                return core::Result<T>::FromError(
+                    MakeErrorCode(ComErrc::kFieldValueIsNotValid));
+            }
+            return core::Result<T>::FromValue(
+                std::move(result).Value().first);
+        }
     } // namespace com
 } // namespace ara
 
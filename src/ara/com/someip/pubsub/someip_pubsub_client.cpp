@@ -14,10 +14,8 @@ namespace ara
             {
                 SomeIpPubSubClient::SomeIpPubSubClient(
                     helper::NetworkLayer<sd::SomeIpSdMessage> *networkLayer,
-                    uint8_t counter) : mSubscriptionLock(mSubscriptionMutex, std::defer_lock),
-                                       mCommunicationLayer{networkLayer},
-                                       mCounter{counter},
-                                       mValidNotify{true}
+                    uint8_t counter) : mCommunicationLayer{networkLayer},
+                                       mCounter{counter}
                 {
                     auto _receiver =
                         std::bind(
@@ -34,12 +32,9 @@ namespace ara
                     {
                         if (entry->Type() == entry::EntryType::Acknowledging)
                         {
-                            bool _enqueued = mMessageBuffer.TryEnqueue(std::move(message));
-
-                            if (_enqueued)
-                            {
-                                mSubscriptionConditionVariable.notify_one();
-                            }
+                            // Waiters are woken by the queue itself.
+                            mMessageBuffer.TryEnqueue(std::move(message));
+                            break;
                         }
                     }
                 }
@@ -80,38 +75,14 @@ namespace ara
                     int duration,
                     sd::SomeIpSdMessage &message)
                 {
-                    bool _result;
-
-                    if (mMessageBuffer.Empty())
-                    {
-                        mSubscriptionLock.lock();
-                        std::cv_status _status =
-                            mSubscriptionConditionVariable.wait_for(
-                                mSubscriptionLock, std::chrono::milliseconds(duration));
-                        mSubscriptionLock.unlock();
-                        _result = mValidNotify && (_status != std::cv_status::timeout);
-                    }
-                    else
-                    {
-                        // There are still processed subscription messages in the buffer, so no need to wait.
-                        _result = true;
-                    }
-
-                    // In the case of successful get, set the first processed subscription to the output argument
-                    if (_result)
-                    {
-                        _result = mMessageBuffer.TryDequeue(message);
-                    }
-
-                    return _result;
+                    return mMessageBuffer.WaitDequeue(
+                        message, std::chrono::milliseconds(duration));
                 }
 
                 SomeIpPubSubClient::~SomeIpPubSubClient()
                 {
-                    // Condition variable notifications are not valid anymore during destruction.
-                    mValidNotify = false;
-                    // Release the threads waiting for the condition variables before desctruction
-                    mSubscriptionConditionVariable.notify_one();
+                    // Release the threads waiting for a subscription before destruction
+                    mMessageBuffer.Close();
                 }
             }
         }
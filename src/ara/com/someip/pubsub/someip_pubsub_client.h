@@ -5,7 +5,6 @@
 #ifndef SOMEIP_PUBSUB_CLIENT
 #define SOMEIP_PUBSUB_CLIENT
 
-#include <condition_variable>
 #include "../../entry/eventgroup_entry.h"
 #include "../../helper/network_layer.h"
 #include "../../helper/concurrent_queue.h"
@@ -24,12 +23,8 @@ namespace ara
                 {
                 private:
                     helper::ConcurrentQueue<sd::SomeIpSdMessage> mMessageBuffer;
-                    std::mutex mSubscriptionMutex;
-                    std::unique_lock<std::mutex> mSubscriptionLock;
-                    std::condition_variable mSubscriptionConditionVariable;
                     helper::NetworkLayer<sd::SomeIpSdMessage> *mCommunicationLayer;
                     uint8_t mCounter;
-                    bool mValidNotify;
 
                     void onMessageReceived(sd::SomeIpSdMessage &&message);
 
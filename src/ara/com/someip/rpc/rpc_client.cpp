@@ -26,24 +26,73 @@ namespace ara
                         const SomeIpRpcMessage _message{
                             SomeIpRpcMessage::Deserialize(payload)};
 
-                        auto _itr{mHandlers.find(_message.MessageId())};
-                        if (_itr != mHandlers.end())
-                        {
-                            _itr->second(_message);
-                        }
+                        InvokeHandler(_message.View());
                     }
-                    catch (std::out_of_range)
+                    catch (const std::out_of_range &)
                     {
                         // Ignore the corrupted RPC server response
                     }
                 }
 
+                void RpcClient::InvokeHandler(const SomeIpRpcMessageView &response) const
+                {
+                    auto _itr{mHandlers.find(response.MessageId)};
+                    if (_itr != mHandlers.end() && _itr->second)
+                    {
+                        _itr->second(response);
+                    }
+                }
+
+                void RpcClient::SendRequest(const SomeIpRpcMessageView &request)
+                {
+                    // Keeps a fire-and-forget request from turning into one
+                    // that expects a response; other types are rejected.
+                    const SomeIpRpcMessage cRequest(
+                        request.MessageId,
+                        request.ClientId,
+                        request.SessionId,
+                        request.ProtocolVersion,
+                        request.InterfaceVersion,
+                        request.MessageType,
+                        std::vector<uint8_t>(
+                            request.RpcPayload.begin(),
+                            request.RpcPayload.end()));
+
+                    Send(cRequest.Payload());
+                }
+
                 void RpcClient::SetHandler(
                     uint16_t serviceId, uint16_t methodId, HandlerType handler)
+                {
+                    ViewHandlerType _viewHandler;
+                    if (handler)
+                    {
+                        // Legacy handlers need an owning response message.
+                        _viewHandler = [handler](const SomeIpRpcMessageView &response)
+                        {
+                            const SomeIpRpcMessage cResponse(
+                                response.MessageId,
+                                response.ClientId,
+                                response.SessionId,
+                                response.ProtocolVersion,
+                                response.InterfaceVersion,
+                                response.ReturnCode,
+                                std::vector<uint8_t>(
+                                    response.RpcPayload.begin(),
+                                    response.RpcPayload.end()));
+                            handler(cResponse);
+                        };
+                    }
+
+                    SetViewHandler(serviceId, methodId, std::move(_viewHandler));
+                }
+
+                void RpcClient::SetViewHandler(
+                    uint16_t serviceId, uint16_t methodId, ViewHandlerType handler)
                 {
                     auto _messageId{static_cast<uint32_t>(serviceId << 16)};
                     _messageId |= methodId;
-                    mHandlers[_messageId] = handler;
+                    mHandlers[_messageId] = std::move(handler);
                 }
 
                 void RpcClient::Send(
@@ -61,19 +110,36 @@ namespace ara
                     uint16_t _sessionId{
                         (_itr != mSessionIds.end()) ? _itr->second : cInitialSessionId};
 
-                    SomeIpRpcMessage _request(
+                    Send(serviceId, methodId, clientId, _sessionId, rpcPayload);
+
+                    // Increment the session ID for that specific message ID for the next send
+                    // (wrapping from 0xFFFF back to 1 as SomeIpMessage does)
+                    _sessionId = _sessionId == 0xffff ? cInitialSessionId : _sessionId + 1;
+                    mSessionIds[_messageId] = _sessionId;
+                }
+
+                void RpcClient::Send(
+                    uint16_t serviceId,
+                    uint16_t methodId,
+                    uint16_t clientId,
+                    uint16_t sessionId,
+                    const std::vector<uint8_t> &rpcPayload)
+                {
+                    auto _messageId{static_cast<uint32_t>(serviceId << 16)};
+                    _messageId |= methodId;
+
+                    const SomeIpRpcMessageView cRequest{
                         _messageId,
                         clientId,
-                        _sessionId,
+                        sessionId,
                         mProtocolVersion,
                         mInterfaceVersion,
-                        rpcPayload);
+                        SomeIpMessageType::Request,
+                        SomeIpReturnCode::eOK,
+                        core::Span<const uint8_t>(
+                            rpcPayload.data(), rpcPayload.size())};
 
-                    Send(_request.Payload());
-
-                    // Increment the session ID for that specific message ID for the next send
-                    _request.IncrementSessionId();
-                    mSessionIds[_messageId] = _request.SessionId();
+                    SendRequest(cRequest);
                 }
             }
         }
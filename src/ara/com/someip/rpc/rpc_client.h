@@ -26,11 +26,14 @@ namespace ara
                     /// @brief SOME/IP RPC response handler type
                     using HandlerType = std::function<void(const SomeIpRpcMessage &)>;
 
+                    /// @brief SOME/IP RPC response handler type working on a response view
+                    using ViewHandlerType = std::function<void(const SomeIpRpcMessageView &)>;
+
                 private:
                     const uint8_t mProtocolVersion;
                     const uint8_t mInterfaceVersion;
                     std::map<uint32_t, uint16_t> mSessionIds;
-                    std::map<uint32_t, HandlerType> mHandlers;
+                    std::map<uint32_t, ViewHandlerType> mHandlers;
 
                 protected:
                     /// @brief Constructor
@@ -44,10 +47,23 @@ namespace ara
                     /// @param payload Serialized SOME/IP response payload byte vector
                     void InvokeHandler(const std::vector<uint8_t> &payload) const;
 
+                    /// @brief Invoke corresponding response handler without deserialization
+                    /// @param response Parsed response header and payload view
+                    void InvokeHandler(const SomeIpRpcMessageView &response) const;
+
                     /// @brief Send a SOME/IP request to the RPC server
                     /// @param payload Serialized SOME/IP request payload byte vector
                     virtual void Send(const std::vector<uint8_t> &payload) = 0;
 
+                    /// @brief Send a SOME/IP request given as header fields and payload view
+                    /// @param request Request to be sent
+                    /// @throws std::invalid_argument Throws when the message type is
+                    ///         neither a request nor a fire-and-forget request
+                    /// @remark The default implementation serializes the request and
+                    ///         calls Send(payload); transports that set the header
+                    ///         fields natively should override it.
+                    virtual void SendRequest(const SomeIpRpcMessageView &request);
+
                 public:
                     /// @brief Set a RPC response handler
                     /// @param serviceId Service ID that contains the requested method
@@ -56,6 +72,13 @@ namespace ara
                     void SetHandler(
                         uint16_t serviceId, uint16_t methodId, HandlerType handler);
 
+                    /// @brief Set a RPC response handler reading the response in place
+                    /// @param serviceId Service ID that contains the requested method
+                    /// @param methodId Requested method ID for invocation
+                    /// @param handler Handler to be invoked at the response arrival
+                    void SetViewHandler(
+                        uint16_t serviceId, uint16_t methodId, ViewHandlerType handler);
+
                     /// @brief Send a request to the RPC server
                     /// @param serviceId Service ID that contains the requested method
                     /// @param methodId Requested method ID for invocation
@@ -67,6 +90,20 @@ namespace ara
                         uint16_t clientId,
                         const std::vector<uint8_t> &rpcPayload);
 
+                    /// @brief Send a request with a caller-assigned session ID
+                    /// @param serviceId Service ID that contains the requested method
+                    /// @param methodId Requested method ID for invocation
+                    /// @param clientId Client ID that sends the request
+                    /// @param sessionId Session ID to correlate the response with
+                    /// @param rpcPayload Serialized RPC request payload byte vector
+                    /// @note Does not advance the internal per-method session counter.
+                    void Send(
+                        uint16_t serviceId,
+                        uint16_t methodId,
+                        uint16_t clientId,
+                        uint16_t sessionId,
+                        const std::vector<uint8_t> &rpcPayload);
+
                     virtual ~RpcClient() noexcept = default;
                 };
             }
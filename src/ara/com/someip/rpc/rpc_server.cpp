@@ -27,25 +27,25 @@ namespace ara
                 }
 
                 SomeIpReturnCode RpcServer::validate(
-                    const SomeIpRpcMessage &request) const
+                    const SomeIpRpcMessageView &request) const
                 {
-                    if (request.MessageType() != SomeIpMessageType::Request &&
-                        request.MessageType() != SomeIpMessageType::RequestNoReturn)
+                    if (request.MessageType != SomeIpMessageType::Request &&
+                        request.MessageType != SomeIpMessageType::RequestNoReturn)
                     {
                         return SomeIpReturnCode::eWrongMessageType;
                     }
 
-                    if (request.ProtocolVersion() != mProtocolVersion)
+                    if (request.ProtocolVersion != mProtocolVersion)
                     {
                         return SomeIpReturnCode::eWrongProtocolVersion;
                     }
 
-                    if (request.InterfaceVersion() != mInterfaceVersion)
+                    if (request.InterfaceVersion != mInterfaceVersion)
                     {
                         return SomeIpReturnCode::eWrongInterfaceVersion;
                     }
 
-                    auto _serviceId{static_cast<uint16_t>(request.MessageId() >> 16)};
+                    auto _serviceId{static_cast<uint16_t>(request.MessageId >> 16)};
                     if (mServices.find(_serviceId) == mServices.end())
                     {
                         return SomeIpReturnCode::eUnknownService;
@@ -55,30 +55,21 @@ namespace ara
                 }
 
                 void RpcServer::getResponsePayload(
-                    const SomeIpRpcMessage &request,
+                    const SomeIpRpcMessageView &request,
                     SomeIpReturnCode returnCode,
-                    const std::vector<uint8_t> &rpcPayload,
+                    std::vector<uint8_t> &&rpcPayload,
                     std::vector<uint8_t> &payload) const
                 {
                     SomeIpRpcMessage _errorMessage(
-                        request.MessageId(),
-                        request.ClientId(),
-                        request.SessionId(),
+                        request.MessageId,
+                        request.ClientId,
+                        request.SessionId,
                         mProtocolVersion,
                         mInterfaceVersion,
                         returnCode,
-                        rpcPayload);
+                        std::move(rpcPayload));
 
-                    payload = std::move(_errorMessage.Payload());
-                }
-
-                void RpcServer::getResponsePayload(
-                    const SomeIpRpcMessage &request,
-                    SomeIpReturnCode returnCode,
-                    std::vector<uint8_t> &payload) const
-                {
-                    const std::vector<uint8_t> cRpcPayload;
-                    getResponsePayload(request, returnCode, cRpcPayload, payload);
+                    payload = _errorMessage.Payload();
                 }
 
                 bool RpcServer::TryInvokeHandler(
@@ -89,58 +80,95 @@ namespace ara
                     {
                         const SomeIpRpcMessage _request{
                             SomeIpRpcMessage::Deserialize(requestPayload)};
+                        const SomeIpRpcMessageView _requestView{_request.View()};
 
-                        SomeIpReturnCode _returnCode{validate(_request)};
-                        if (_returnCode != SomeIpReturnCode::eOK)
+                        SomeIpReturnCode _returnCode;
+                        std::vector<uint8_t> _rpcResponsePdu;
+                        if (!TryInvokeHandler(
+                                _requestView, _returnCode, _rpcResponsePdu))
                         {
-                            getResponsePayload(
-                                _request, _returnCode,
-                                responsePayload);
+                            return false;
+                        }
+
+                        getResponsePayload(
+                            _requestView, _returnCode, std::move(_rpcResponsePdu),
+                            responsePayload);
+
+                        return true;
+                    }
+                    catch (const std::out_of_range &)
+                    {
+                        return false;
+                    }
+                }
 
+                bool RpcServer::TryInvokeHandler(
+                    const SomeIpRpcMessageView &request,
+                    SomeIpReturnCode &returnCode,
+                    std::vector<uint8_t> &rpcResponsePayload) const
+                {
+                    try
+                    {
+                        returnCode = validate(request);
+                        if (returnCode != SomeIpReturnCode::eOK)
+                        {
+                            rpcResponsePayload.clear();
                             return true;
                         }
 
-                        auto _itr{mHandlers.find(_request.MessageId())};
-                        if (_itr != mHandlers.end())
+                        auto _itr{mHandlers.find(request.MessageId)};
+                        if (_itr != mHandlers.end() && _itr->second)
                         {
-                            std::vector<uint8_t> _rpcResponsePdu;
-                            bool _handled{
-                                _itr->second(_request.RpcPayload(), _rpcResponsePdu)};
-
-                            if (_handled)
-                            {
-                                getResponsePayload(
-                                    _request, SomeIpReturnCode::eOK, _rpcResponsePdu,
-                                    responsePayload);
-                            }
-                            else
-                            {
-                                getResponsePayload(
-                                    _request, SomeIpReturnCode::eNotOk, _rpcResponsePdu,
-                                    responsePayload);
-                            }
+                            bool _handled{_itr->second(request, rpcResponsePayload)};
+                            returnCode =
+                                _handled ? SomeIpReturnCode::eOK : SomeIpReturnCode::eNotOk;
                         }
                         else
                         {
-                            getResponsePayload(
-                                _request, SomeIpReturnCode::eUnknownMethod,
-                                responsePayload);
+                            returnCode = SomeIpReturnCode::eUnknownMethod;
+                            rpcResponsePayload.clear();
                         }
 
                         return true;
                     }
-                    catch (std::out_of_range)
+                    catch (const std::out_of_range &)
                     {
                         return false;
                     }
                 }
 
+                uint8_t RpcServer::InterfaceVersion() const noexcept
+                {
+                    return mInterfaceVersion;
+                }
+
                 void RpcServer::SetHandler(
                     uint16_t serviceId, uint16_t methodId, HandlerType handler)
+                {
+                    ViewHandlerType _viewHandler;
+                    if (handler)
+                    {
+                        // Legacy handlers need an owning request payload copy.
+                        _viewHandler =
+                            [handler](const SomeIpRpcMessageView &request,
+                                      std::vector<uint8_t> &rpcResponsePayload)
+                        {
+                            const std::vector<uint8_t> cRpcRequestPayload(
+                                request.RpcPayload.begin(),
+                                request.RpcPayload.end());
+                            return handler(cRpcRequestPayload, rpcResponsePayload);
+                        };
+                    }
+
+                    SetViewHandler(serviceId, methodId, std::move(_viewHandler));
+                }
+
+                void RpcServer::SetViewHandler(
+                    uint16_t serviceId, uint16_t methodId, ViewHandlerType handler)
                 {
                     auto _messageId{static_cast<uint32_t>(serviceId << 16)};
                     _messageId |= methodId;
-                    mHandlers[_messageId] = handler;
+                    mHandlers[_messageId] = std::move(handler);
 
                     mServices.insert(serviceId);
                     OnHandlerRegistered(serviceId, methodId);
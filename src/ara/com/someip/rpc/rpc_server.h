@@ -30,24 +30,26 @@ namespace ara
                     using HandlerType =
                         std::function<bool(const std::vector<uint8_t> &, std::vector<uint8_t> &)>;
 
+                    /// @brief SOME/IP RPC request handler type working on a request view
+                    /// @details The handler reads the request payload in place and
+                    ///          appends its RPC response payload to the vector,
+                    ///          which the transport may adopt without copying.
+                    using ViewHandlerType =
+                        std::function<bool(const SomeIpRpcMessageView &, std::vector<uint8_t> &)>;
+
                 private:
                     const uint8_t mProtocolVersion;
                     const uint8_t mInterfaceVersion;
                     std::set<uint16_t> mServices;
-                    std::map<uint32_t, HandlerType> mHandlers;
+                    std::map<uint32_t, ViewHandlerType> mHandlers;
 
                     SomeIpReturnCode validate(
-                        const SomeIpRpcMessage &request) const;
+                        const SomeIpRpcMessageView &request) const;
 
                     void getResponsePayload(
-                        const SomeIpRpcMessage &request,
-                        SomeIpReturnCode returnCode,
-                        const std::vector<uint8_t>& rpcPayload,
-                        std::vector<uint8_t> &payload) const;
-
-                    void getResponsePayload(
-                        const SomeIpRpcMessage &request,
+                        const SomeIpRpcMessageView &request,
                         SomeIpReturnCode returnCode,
+                        std::vector<uint8_t> &&rpcPayload,
                         std::vector<uint8_t> &payload) const;
 
                 protected:
@@ -70,6 +72,21 @@ namespace ara
                         const std::vector<uint8_t> &requestPayload,
                         std::vector<uint8_t> &responsePayload) const;
 
+                    /// @brief Validate a request and invoke its handler without (de)serialization
+                    /// @param[in] request Parsed request header and payload view
+                    /// @param[out] returnCode Return code of the response to be sent
+                    /// @param[out] rpcResponsePayload RPC response payload written by the handler
+                    /// @returns True if the request is handled; otherwise false
+                    /// @remark The response SOME/IP header is left to the transport.
+                    bool TryInvokeHandler(
+                        const SomeIpRpcMessageView &request,
+                        SomeIpReturnCode &returnCode,
+                        std::vector<uint8_t> &rpcResponsePayload) const;
+
+                    /// @brief Get the service interface version put into responses
+                    /// @returns Interface version given at construction
+                    uint8_t InterfaceVersion() const noexcept;
+
                 public:
                     RpcServer() = delete;
                     RpcServer(const RpcServer &) = delete;
@@ -81,6 +98,13 @@ namespace ara
                     void SetHandler(
                         uint16_t serviceId, uint16_t methodId, HandlerType handler);
 
+                    /// @brief Set a RPC request handler reading the request in place
+                    /// @param serviceId Service ID that contains the requested method
+                    /// @param methodId Requested method ID for invocation
+                    /// @param handler Handler to be invoked at the request arrival
+                    void SetViewHandler(
+                        uint16_t serviceId, uint16_t methodId, ViewHandlerType handler);
+
                     virtual ~RpcServer() noexcept = default;
                 };
             }
@@ -78,21 +78,6 @@ namespace ara
                     }
                 }
 
-                std::vector<uint8_t> SocketRpcClient::ConvertPayload(
-                    const std::shared_ptr<vsomeip::payload> &payload)
-                {
-                    if (!payload)
-                    {
-                        return {};
-                    }
-
-                    const vsomeip::byte_t *cData{payload->get_data()};
-                    const auto cLength{
-                        static_cast<std::size_t>(payload->get_length())};
-
-                    return std::vector<uint8_t>(cData, cData + cLength);
-                }
-
                 void SocketRpcClient::onResponse(
                     const std::shared_ptr<vsomeip::message> &message)
                 {
@@ -105,21 +90,28 @@ namespace ara
                         (static_cast<uint32_t>(message->get_service()) << 16) |
                         static_cast<uint32_t>(message->get_method())};
 
+                    // Response handlers read the payload in place.
                     const auto cReturnCode{
                         ConvertReturnCode(message->get_return_code())};
-                    const auto cRpcPayload{
-                        ConvertPayload(message->get_payload())};
-
-                    SomeIpRpcMessage _response(
+                    const auto cRpcPayload{message->get_payload()};
+                    const SomeIpRpcMessageView cResponse{
                         cMessageId,
                         message->get_client(),
                         message->get_session(),
                         message->get_protocol_version(),
                         message->get_interface_version(),
+                        cReturnCode == SomeIpReturnCode::eOK
+                            ? SomeIpMessageType::Response
+                            : SomeIpMessageType::Error,
                         cReturnCode,
-                        cRpcPayload);
-
-                    InvokeHandler(_response.Payload());
+                        cRpcPayload
+                            ? core::Span<const uint8_t>(
+                                  cRpcPayload->get_data(),
+                                  static_cast<std::size_t>(
+                                      cRpcPayload->get_length()))
+                            : core::Span<const uint8_t>()};
+
+                    InvokeHandler(cResponse);
                 }
 
                 void SocketRpcClient::Send(const std::vector<uint8_t> &payload)
@@ -127,10 +119,21 @@ namespace ara
                     const SomeIpRpcMessage cRequest{
                         SomeIpRpcMessage::Deserialize(payload)};
 
+                    SendRequest(cRequest.View());
+                }
+
+                void SocketRpcClient::SendRequest(const SomeIpRpcMessageView &request)
+                {
+                    if (request.MessageType != SomeIpMessageType::Request &&
+                        request.MessageType != SomeIpMessageType::RequestNoReturn)
+                    {
+                        throw std::invalid_argument("Invalid message type.");
+                    }
+
                     const auto cService{
-                        static_cast<vsomeip::service_t>(cRequest.MessageId() >> 16)};
+                        static_cast<vsomeip::service_t>(request.MessageId >> 16)};
                     const auto cMethod{
-                        static_cast<vsomeip::method_t>(cRequest.MessageId() & 0xffff)};
+                        static_cast<vsomeip::method_t>(request.MessageId & 0xffff)};
 
                     {
                         std::lock_guard<std::mutex> _requestLock(mRequestMutex);
@@ -145,16 +148,20 @@ namespace ara
                     _request->set_service(cService);
                     _request->set_instance(mInstanceId);
                     _request->set_method(cMethod);
-                    _request->set_client(cRequest.ClientId());
-                    _request->set_session(cRequest.SessionId());
-                    _request->set_interface_version(cRequest.InterfaceVersion());
+                    _request->set_client(request.ClientId);
+                    _request->set_session(request.SessionId);
+                    _request->set_interface_version(request.InterfaceVersion);
+                    if (request.MessageType == SomeIpMessageType::RequestNoReturn)
+                    {
+                        _request->set_message_type(
+                            vsomeip::message_type_e::MT_REQUEST_NO_RETURN);
+                    }
 
+                    // The only copy on the request path: into the vsomeip payload.
                     auto _rpcPayload{vsomeip::runtime::get()->create_payload()};
-                    const auto &cRequestPayload{cRequest.RpcPayload()};
-                    const std::vector<vsomeip::byte_t> cPayloadBytes(
-                        cRequestPayload.begin(),
-                        cRequestPayload.end());
-                    _rpcPayload->set_data(cPayloadBytes);
+                    _rpcPayload->set_data(
+                        request.RpcPayload.data(),
+                        static_cast<vsomeip::length_t>(request.RpcPayload.size()));
                     _request->set_payload(_rpcPayload);
 
                     mApplication->send(_request);
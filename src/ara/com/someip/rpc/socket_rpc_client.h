@@ -38,15 +38,14 @@ namespace ara
                     static SomeIpReturnCode ConvertReturnCode(
                         vsomeip::return_code_e returnCode);
 
-                    static std::vector<uint8_t> ConvertPayload(
-                        const std::shared_ptr<vsomeip::payload> &payload);
-
                     void onResponse(
                         const std::shared_ptr<vsomeip::message> &message);
 
                 protected:
                     void Send(const std::vector<uint8_t> &payload) override;
 
+                    void SendRequest(const SomeIpRpcMessageView &request) override;
+
                 public:
                     /// @brief Constructor
                     /// @param poller BSD sockets poller
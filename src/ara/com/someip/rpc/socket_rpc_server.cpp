@@ -5,6 +5,7 @@
 #include "./socket_rpc_server.h"
 #include <functional>
 #include <stdexcept>
+#include <utility>
 
 #if ARA_COM_USE_VSOMEIP
 
@@ -69,21 +70,6 @@ namespace ara
                     }
                 }
 
-                std::vector<uint8_t> SocketRpcServer::ConvertPayload(
-                    const std::shared_ptr<vsomeip::payload> &payload)
-                {
-                    if (!payload)
-                    {
-                        return {};
-                    }
-
-                    const vsomeip::byte_t *cData{payload->get_data()};
-                    const auto cLength{
-                        static_cast<std::size_t>(payload->get_length())};
-
-                    return std::vector<uint8_t>(cData, cData + cLength);
-                }
-
                 void SocketRpcServer::OnHandlerRegistered(
                     uint16_t serviceId, uint16_t methodId)
                 {
@@ -123,41 +109,41 @@ namespace ara
                         (static_cast<uint32_t>(requestMessage->get_service()) << 16) |
                         static_cast<uint32_t>(requestMessage->get_method())};
 
-                    const auto cRequestPayload{
-                        ConvertPayload(requestMessage->get_payload())};
-
-                    SomeIpRpcMessage _request(
+                    // The handler reads the request straight from the vsomeip
+                    // payload and its response vector is moved into the reply.
+                    const auto cRequestPayload{requestMessage->get_payload()};
+                    const SomeIpRpcMessageView cRequest{
                         cMessageId,
                         requestMessage->get_client(),
                         requestMessage->get_session(),
                         requestMessage->get_protocol_version(),
                         requestMessage->get_interface_version(),
-                        cRequestPayload);
-
-                    std::vector<uint8_t> _serializedResponse;
+                        SomeIpMessageType::Request,
+                        SomeIpReturnCode::eOK,
+                        cRequestPayload
+                            ? core::Span<const uint8_t>(
+                                  cRequestPayload->get_data(),
+                                  static_cast<std::size_t>(
+                                      cRequestPayload->get_length()))
+                            : core::Span<const uint8_t>()};
+
+                    SomeIpReturnCode _returnCode;
+                    std::vector<vsomeip::byte_t> _rpcResponsePayload;
                     bool _handled{
-                        TryInvokeHandler(_request.Payload(), _serializedResponse)};
+                        TryInvokeHandler(cRequest, _returnCode, _rpcResponsePayload)};
                     if (!_handled)
                     {
                         return;
                     }
 
-                    SomeIpRpcMessage _response{
-                        SomeIpRpcMessage::Deserialize(_serializedResponse)};
-
                     auto _vsomeipResponse{
                         vsomeip::runtime::get()->create_response(requestMessage)};
                     _vsomeipResponse->set_return_code(
-                        ConvertReturnCode(_response.ReturnCode()));
-                    _vsomeipResponse->set_interface_version(
-                        _response.InterfaceVersion());
+                        ConvertReturnCode(_returnCode));
+                    _vsomeipResponse->set_interface_version(InterfaceVersion());
 
                     auto _vsomeipPayload{vsomeip::runtime::get()->create_payload()};
-                    const auto &cRpcPayload{_response.RpcPayload()};
-                    const std::vector<vsomeip::byte_t> cPayloadBytes(
-                        cRpcPayload.begin(),
-                        cRpcPayload.end());
-                    _vsomeipPayload->set_data(cPayloadBytes);
+                    _vsomeipPayload->set_data(std::move(_rpcResponsePayload));
                     _vsomeipResponse->set_payload(_vsomeipPayload);
 
                     mApplication->send(_vsomeipResponse);
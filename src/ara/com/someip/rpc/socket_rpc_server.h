@@ -39,9 +39,6 @@ namespace ara
                     static vsomeip::return_code_e ConvertReturnCode(
                         SomeIpReturnCode returnCode);
 
-                    static std::vector<uint8_t> ConvertPayload(
-                        const std::shared_ptr<vsomeip::payload> &payload);
-
                     void onRequest(
                         const std::shared_ptr<vsomeip::message> &requestMessage);
 
@@ -2,6 +2,7 @@
 /// @brief Implementation for someip rpc message.
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
+#include <stdexcept>
 #include <utility>
 #include "./someip_rpc_message.h"
 
@@ -51,6 +52,27 @@ namespace ara
                 {
                 }
 
+                SomeIpRpcMessage::SomeIpRpcMessage(uint32_t messageId,
+                                                   uint16_t clientId,
+                                                   uint16_t sessionId,
+                                                   uint8_t protocolVersion,
+                                                   uint8_t interfaceVersion,
+                                                   SomeIpMessageType messageType,
+                                                   std::vector<uint8_t> &&rpcPayload) : SomeIpMessage(messageId,
+                                                                                                      clientId,
+                                                                                                      protocolVersion,
+                                                                                                      interfaceVersion,
+                                                                                                      messageType,
+                                                                                                      sessionId),
+                                                                                        mRpcPayload{std::move(rpcPayload)}
+                {
+                    if (messageType != SomeIpMessageType::Request &&
+                        messageType != SomeIpMessageType::RequestNoReturn)
+                    {
+                        throw std::invalid_argument("Invalid message type.");
+                    }
+                }
+
                 SomeIpRpcMessage::SomeIpRpcMessage(uint32_t messageId,
                                                    uint16_t clientId,
                                                    uint16_t sessionId,
@@ -68,6 +90,23 @@ namespace ara
                 {
                 }
 
+                SomeIpRpcMessage::SomeIpRpcMessage(uint32_t messageId,
+                                                   uint16_t clientId,
+                                                   uint16_t sessionId,
+                                                   uint8_t protocolVersion,
+                                                   uint8_t interfaceVersion,
+                                                   SomeIpReturnCode returnCode,
+                                                   std::vector<uint8_t> &&rpcPayload) : SomeIpMessage(messageId,
+                                                                                                      clientId,
+                                                                                                      protocolVersion,
+                                                                                                      interfaceVersion,
+                                                                                                      returnCode == SomeIpReturnCode::eOK ? SomeIpMessageType::Response : SomeIpMessageType::Error,
+                                                                                                      returnCode,
+                                                                                                      sessionId),
+                                                                                        mRpcPayload{std::move(rpcPayload)}
+                {
+                }
+
                 uint32_t SomeIpRpcMessage::Length() const noexcept
                 {
                     const size_t cHeaderLength{8};
@@ -94,6 +133,20 @@ namespace ara
                     return mRpcPayload;
                 }
 
+                SomeIpRpcMessageView SomeIpRpcMessage::View() const noexcept
+                {
+                    return SomeIpRpcMessageView{
+                        MessageId(),
+                        ClientId(),
+                        SessionId(),
+                        ProtocolVersion(),
+                        InterfaceVersion(),
+                        MessageType(),
+                        ReturnCode(),
+                        core::Span<const uint8_t>(
+                            mRpcPayload.data(), mRpcPayload.size())};
+                }
+
                 SomeIpRpcMessage SomeIpRpcMessage::Deserialize(
                     const std::vector<uint8_t> &payload)
                 {
@@ -6,6 +6,7 @@
 #define SOMEIP_RPC_MESSAGE_H
 
 #include "../someip_message.h"
+#include "../../../core/span.h"
 
 namespace ara
 {
@@ -15,6 +16,31 @@ namespace ara
         {
             namespace rpc
             {
+                /// @brief Parsed header fields and a read-only RPC payload view
+                /// @details Lets transports hand a received message to the RPC
+                ///          handlers without serializing the SOME/IP header and
+                ///          copying the payload. The view is only valid for the
+                ///          duration of the handler call.
+                struct SomeIpRpcMessageView
+                {
+                    /// @brief Message ID consisting service and method/event ID
+                    uint32_t MessageId;
+                    /// @brief Client ID including ID prefix
+                    uint16_t ClientId;
+                    /// @brief Active session ID
+                    uint16_t SessionId;
+                    /// @brief SOME/IP protocol header version
+                    uint8_t ProtocolVersion;
+                    /// @brief Service interface version
+                    uint8_t InterfaceVersion;
+                    /// @brief Request, response or error message type
+                    SomeIpMessageType MessageType;
+                    /// @brief Response/error return code (eOK for requests)
+                    SomeIpReturnCode ReturnCode;
+                    /// @brief Serialized RPC object owned by the transport
+                    core::Span<const uint8_t> RpcPayload;
+                };
+
                 /// @brief SOME/IP remote procedure call message
                 class SomeIpRpcMessage : public SomeIpMessage
                 {
@@ -52,6 +78,23 @@ namespace ara
                                      uint8_t interfaceVersion,
                                      std::vector<uint8_t> &&rpcPayload);
 
+                    /// @brief Constructor for RPC request message of a given request type
+                    /// @param messageId Message ID consisting service and method/event ID
+                    /// @param clientId Client ID including ID prefix
+                    /// @param sessionId Active session ID
+                    /// @param protocolVersion SOME/IP protocol header version
+                    /// @param interfaceVersion Service interface version
+                    /// @param messageType Request or fire-and-forget request
+                    /// @param rpcPayload Serialized RPC request object byte vector
+                    /// @throws std::invalid_argument Throws when the message type is not a request
+                    SomeIpRpcMessage(uint32_t messageId,
+                                     uint16_t clientId,
+                                     uint16_t sessionId,
+                                     uint8_t protocolVersion,
+                                     uint8_t interfaceVersion,
+                                     SomeIpMessageType messageType,
+                                     std::vector<uint8_t> &&rpcPayload);
+
                     /// @brief Constructor for RPC response or error message
                     /// @param messageId Message ID consisting service and method/event ID
                     /// @param clientId Client ID including ID prefix
@@ -68,6 +111,22 @@ namespace ara
                                      SomeIpReturnCode returnCode,
                                      const std::vector<uint8_t> &rpcPayload);
 
+                    /// @brief Constructor for RPC response or error message by moving the RPC payload
+                    /// @param messageId Message ID consisting service and method/event ID
+                    /// @param clientId Client ID including ID prefix
+                    /// @param sessionId Active session ID
+                    /// @param protocolVersion SOME/IP protocol header version
+                    /// @param interfaceVersion Service interface version
+                    /// @param returnCode Message response/error return code
+                    /// @param rpcPayload Serialized RPC response/error object byte vector
+                    SomeIpRpcMessage(uint32_t messageId,
+                                     uint16_t clientId,
+                                     uint16_t sessionId,
+                                     uint8_t protocolVersion,
+                                     uint8_t interfaceVersion,
+                                     SomeIpReturnCode returnCode,
+                                     std::vector<uint8_t> &&rpcPayload);
+
                     virtual uint32_t Length() const noexcept override;
 
                     virtual std::vector<uint8_t> Payload() const override;
@@ -76,6 +135,10 @@ namespace ara
                     /// @returns Byte vector constant reference
                     const std::vector<uint8_t> &RpcPayload() const;
 
+                    /// @brief Get a view over the message fields and RPC payload
+                    /// @returns View that is valid as long as the message is alive
+                    SomeIpRpcMessageView View() const noexcept;
+
                     /// @brief Deserialize a SOME/IP RPC message payload
                     /// @param payload Serialized SOME/IP message payload byte array
                     /// @returns SOME/IP RPC message filled by deserializing the payload
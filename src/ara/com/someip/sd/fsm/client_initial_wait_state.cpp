@@ -44,20 +44,29 @@ namespace ara
                             this->InitialDelayMin, this->InitialDelayMax);
                         int _randomDely = _distribution(_generator);
 
-                        // Sleep for the initali random delay and
+                        // Wait for the initali random delay and
                         // then transit to the next state
                         auto _delay = std::chrono::milliseconds(_randomDely);
-                        bool _interrupted = this->WaitFor(_delay);
+                        ScheduleAfter(
+                            _delay,
+                            [this]()
+                            {
+                                if (Timer->GetOffered())
+                                {
+                                    SetNextState(helper::SdClientState::ServiceReady);
+                                }
+                                else
+                                {
+                                    // Invoke the on timer expiration callback
+                                    this->OnTimerExpired();
+                                }
+                                Complete();
+                            });
+                    }
 
-                        if (Timer->GetOffered())
-                        {
-                            SetNextState(helper::SdClientState::ServiceReady);
-                        }
-                        else if (!_interrupted)
-                        {
-                            // Invoke the on timer expiration callback
-                            this->OnTimerExpired();
-                        }
+                    ClientInitialWaitState::~ClientInitialWaitState()
+                    {
+                        DetachTimer();
                     }
                 }
             }
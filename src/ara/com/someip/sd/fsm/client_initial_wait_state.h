@@ -40,6 +40,7 @@ namespace ara
                         ClientInitialWaitState() = delete;
                         ClientInitialWaitState(const ClientInitialWaitState &) = delete;
                         ClientInitialWaitState &operator=(const ClientInitialWaitState &) = delete;
+                        ~ClientInitialWaitState() override;
                     };
                 }
             }
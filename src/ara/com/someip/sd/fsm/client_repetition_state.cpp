@@ -36,29 +36,35 @@ namespace ara
                         TimerSetState::Activate(previousState);
                     }
 
-                    void ClientRepetitionState::SetTimer()
+                    void ClientRepetitionState::ScheduleRepetition(int repetition)
                     {
-                        for (uint32_t i = 0; i < this->RepetitionsMax; ++i)
+                        if (repetition >= this->RepetitionsMax)
                         {
-                            int _doubledDelay = std::pow(2, i) * this->RepetitionsBaseDelay;
-                            auto _delay = std::chrono::milliseconds(_doubledDelay);
-                            bool _interrupted = this->WaitFor(_delay);
+                            Complete();
+                            return;
+                        }
 
-                            if (Timer->GetOffered())
-                            {
-                                SetNextState(helper::SdClientState::ServiceReady);
-                                break;
-                            }
-                            else if (_interrupted)
+                        ScheduleAfter(
+                            RepetitionDelay(repetition),
+                            [this, repetition]()
                             {
-                                break;
-                            }
-                            else
-                            {
-                                // Invoke the on timer expiration callback
-                                this->OnTimerExpired();
-                            }
-                        }
+                                if (Timer->GetOffered())
+                                {
+                                    SetNextState(helper::SdClientState::ServiceReady);
+                                    Complete();
+                                }
+                                else
+                                {
+                                    // Invoke the on timer expiration callback
+                                    this->OnTimerExpired();
+                                    ScheduleRepetition(repetition + 1);
+                                }
+                            });
+                    }
+
+                    ClientRepetitionState::~ClientRepetitionState()
+                    {
+                        DetachTimer();
                     }
                 }
             }
@@ -23,7 +23,7 @@ namespace ara
                     {
                     protected:
                         void Activate(helper::SdClientState previousState) override;
-                        void SetTimer() override;
+                        void ScheduleRepetition(int repetition) override;
 
                     public:
                         /// @brief Constructor
@@ -40,6 +40,7 @@ namespace ara
                         ClientRepetitionState() = delete;
                         ClientRepetitionState(const ClientRepetitionState &) = delete;
                         ClientRepetitionState &operator=(const ClientRepetitionState &) = delete;
+                        ~ClientRepetitionState() override;
                     };
                 }
             }
@@ -5,6 +5,10 @@
 #ifndef CLIENT_SERVICE_STATE_H
 #define CLIENT_SERVICE_STATE_H
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include "../../../helper/machine_state.h"
 #include "../../../helper/ttl_timer.h"
 
@@ -20,23 +24,113 @@ namespace ara
                 {
                     /// @brief Abstract client's service state
                     /// @details The class forces its children to react on service offering.
+                    ///          A state that waits for the offer or the request
+                    ///          to change watches the TTL timer with TransitWhen()
+                    ///          instead of blocking, so the transition that
+                    ///          activated it returns at once. This matters when
+                    ///          that transition runs on a timer wheel worker.
                     /// @note The state is not copyable
                     class ClientServiceState : virtual public helper::MachineState<helper::SdClientState>
                     {
+                    private:
+                        // Outlives the state so that a TTL timer notification
+                        // racing with the destructor finds no owner.
+                        struct Guard
+                        {
+                            std::recursive_mutex Mutex;
+                            ClientServiceState *Owner;
+                        };
+
+                        std::shared_ptr<Guard> mGuard;
+                        helper::TtlTimer::ListenerId mListener;
+                        uint64_t mWatchGeneration;
+
                     protected:
                         /// @brief Timer to handle service offer entry TTL
                         helper::TtlTimer *const Timer;
 
+                        /// @brief Transit as soon as the next state is decided
+                        /// @param decide Returns true and sets the next state once
+                        ///        the current state should be left
+                        /// @remark The condition is checked right away and then on
+                        ///         every TTL timer notification until the state
+                        ///         transits or StopWatching() is called.
+                        void TransitWhen(std::function<bool(helper::SdClientState &)> decide)
+                        {
+                            std::lock_guard<std::recursive_mutex> _lock(mGuard->Mutex);
+                            StopWatching();
+
+                            const uint64_t cGeneration{mWatchGeneration};
+                            std::weak_ptr<Guard> _weakGuard{mGuard};
+                            const helper::TtlTimer::Listener cCheck{
+                                [_weakGuard, cGeneration, decide]()
+                                {
+                                    std::shared_ptr<Guard> _guard{_weakGuard.lock()};
+                                    if (!_guard)
+                                    {
+                                        return;
+                                    }
+
+                                    std::lock_guard<std::recursive_mutex> _checkLock(_guard->Mutex);
+                                    ClientServiceState *_owner{_guard->Owner};
+                                    helper::SdClientState _nextState;
+                                    if (_owner != nullptr &&
+                                        _owner->mWatchGeneration == cGeneration &&
+                                        decide(_nextState))
+                                    {
+                                        _owner->StopWatching();
+                                        _owner->Transit(_nextState);
+                                    }
+                                }};
+
+                            // Subscribe before the first check so that no change is missed.
+                            mListener = Timer->Subscribe(cCheck);
+                            cCheck();
+                        }
+
+                        /// @brief Stop watching the TTL timer
+                        /// @remark A notification that is already running is
+                        ///         recognised by its generation and dropped.
+                        void StopWatching()
+                        {
+                            std::lock_guard<std::recursive_mutex> _lock(mGuard->Mutex);
+                            ++mWatchGeneration;
+                            if (mListener != 0)
+                            {
+                                Timer->Unsubscribe(mListener);
+                                mListener = 0;
+                            }
+                        }
+
+                        /// @brief Stop watching for good and wait for a running notification
+                        /// @remark Called first in the destructor of the most derived
+                        ///         state, so that no notification runs while that
+                        ///         state is torn down.
+                        void DetachTtlTimer()
+                        {
+                            std::lock_guard<std::recursive_mutex> _lock(mGuard->Mutex);
+                            mGuard->Owner = nullptr;
+                            StopWatching();
+                        }
+
                         /// @brief Constructor
                         /// @param timer Finite machine state global TTL timer pointer
-                        ClientServiceState(helper::TtlTimer *timer) : Timer{timer}
+                        ClientServiceState(helper::TtlTimer *timer) : mGuard{std::make_shared<Guard>()},
+                                                                      mListener{0},
+                                                                      mWatchGeneration{0},
+                                                                      Timer{timer}
                         {
+                            mGuard->Owner = this;
                         }
 
                     public:
                         ClientServiceState(const ClientServiceState &) = delete;
                         ClientServiceState &operator=(const ClientServiceState &) = delete;
-                        virtual ~ClientServiceState() noexcept = default;
+
+                        virtual ~ClientServiceState() noexcept
+                        {
+                            DetachTtlTimer();
+                        }
                     };
                 }
             }
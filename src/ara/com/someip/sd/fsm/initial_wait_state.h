@@ -6,7 +6,6 @@
 #define INITIAL_WAIT_STATE_H
 
 #include <random>
-#include <thread>
 #include <chrono>
 #include "./timer_set_state.h"
 
@@ -41,16 +40,17 @@ namespace ara
                                 InitialDelayMin, InitialDelayMax);
                             int _randomDely = _distribution(_generator);
 
-                            // Sleep for the initali random delay and
+                            // Wait for the initali random delay and
                             // then transit to the next state
                             auto _delay = std::chrono::milliseconds(_randomDely);
-                            bool _interrupted = this->WaitFor(_delay);
-
-                            if (!_interrupted)
-                            {
-                                // Invoke the on timer expiration callback
-                                this->OnTimerExpired();
-                            }
+                            this->ScheduleAfter(
+                                _delay,
+                                [this]()
+                                {
+                                    // Invoke the on timer expiration callback
+                                    this->OnTimerExpired();
+                                    this->Complete();
+                                });
                         }
 
                     public:
@@ -83,6 +83,11 @@ namespace ara
                         InitialWaitState() = delete;
                         InitialWaitState(const InitialWaitState &) = delete;
                         InitialWaitState &operator=(const InitialWaitState &) = delete;
+
+                        ~InitialWaitState() override
+                        {
+                            this->DetachTimer();
+                        }
                     };
                 }
             }
@@ -2,7 +2,6 @@
 /// @brief Implementation for main state.
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
-#include <thread>
 #include <chrono>
 #include "./main_state.h"
 
@@ -31,22 +30,27 @@ namespace ara
                         }
                     }
 
-                    void MainState::SetTimer()
+                    void MainState::scheduleOffer()
                     {
-                        while (true)
-                        {
-                            bool _interrupted = this->WaitFor(mCyclicOfferDelay);
-
-                            if (_interrupted)
-                            {
-                                break;
-                            }
-                            else
+                        // The cyclic offer re-arms itself until the service is stopped.
+                        this->ScheduleAfter(
+                            mCyclicOfferDelay,
+                            [this]()
                             {
                                 // Invoke the on timer expiration callback
                                 this->OnTimerExpired();
-                            }
-                        }
+                                scheduleOffer();
+                            });
+                    }
+
+                    void MainState::SetTimer()
+                    {
+                        scheduleOffer();
+                    }
+
+                    MainState::~MainState()
+                    {
+                        DetachTimer();
                     }
                 }
             }
@@ -24,6 +24,8 @@ namespace ara
                     private:
                         const std::chrono::milliseconds mCyclicOfferDelay;
 
+                        void scheduleOffer();
+
                     protected:
                         void SetTimer() override;
 
@@ -38,6 +40,7 @@ namespace ara
                         MainState() = delete;
                         MainState(const MainState &) = delete;
                         MainState &operator=(const MainState &) = delete;
+                        ~MainState() override;
                     };
                 }
             }
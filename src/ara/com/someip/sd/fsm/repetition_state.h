@@ -5,7 +5,6 @@
 #ifndef REPETITION_STATE_H
 #define REPETITION_STATE_H
 
-#include <thread>
 #include <cmath>
 #include <chrono>
 #include "./timer_set_state.h"
@@ -33,24 +32,39 @@ namespace ara
                         /// @brief Repetition iteration delay in milliseconds
                         const int RepetitionsBaseDelay;
 
-                        virtual void SetTimer() override
+                        /// @brief Delay before the given repetition
+                        /// @param repetition Zero-based repetition index
+                        /// @returns Base delay doubled per repetition
+                        std::chrono::milliseconds RepetitionDelay(int repetition) const
+                        {
+                            int _doubledDelay = std::pow(2, repetition) * RepetitionsBaseDelay;
+                            return std::chrono::milliseconds(_doubledDelay);
+                        }
+
+                        /// @brief Arm the given repetition, or complete the phase
+                        ///        after the last one
+                        /// @param repetition Zero-based repetition index
+                        virtual void ScheduleRepetition(int repetition)
                         {
-                            for (uint32_t i = 0; i < RepetitionsMax; ++i)
+                            if (repetition >= RepetitionsMax)
                             {
-                                int _doubledDelay = std::pow(2, i) * RepetitionsBaseDelay;
-                                auto _delay = std::chrono::milliseconds(_doubledDelay);
-                                bool _interrupted = this->WaitFor(_delay);
+                                this->Complete();
+                                return;
+                            }
 
-                                if (_interrupted)
-                                {
-                                    break;
-                                }
-                                else
+                            this->ScheduleAfter(
+                                RepetitionDelay(repetition),
+                                [this, repetition]()
                                 {
                                     // Invoke the on timer expiration callback
                                     this->OnTimerExpired();
-                                }
-                            }
+                                    ScheduleRepetition(repetition + 1);
+                                });
+                        }
+
+                        virtual void SetTimer() override
+                        {
+                            ScheduleRepetition(0);
                         }
 
                     public:
@@ -81,6 +95,11 @@ namespace ara
                         RepetitionState() = delete;
                         RepetitionState(const RepetitionState &) = delete;
                         RepetitionState &operator=(const RepetitionState &) = delete;
+
+                        ~RepetitionState() override
+                        {
+                            this->DetachTimer();
+                        }
                     };
                 }
             }
@@ -25,20 +25,21 @@ namespace ara
                     {
                     }
 
-                    helper::SdClientState ServiceNotseenState::waitForNextState()
+                    bool ServiceNotseenState::tryGetNextState(helper::SdClientState &nextState) const
                     {
-                        if (!Timer->GetRequested() && !Timer->GetOffered())
+                        if (Timer->GetRequested())
                         {
-                            Timer->WaitForSignal();
+                            nextState = helper::SdClientState::InitialWaitPhase;
+                            return true;
                         }
-
-                        if (Timer->GetRequested())
+                        else if (Timer->GetOffered())
                         {
-                            return helper::SdClientState::InitialWaitPhase;
+                            nextState = helper::SdClientState::ServiceSeen;
+                            return true;
                         }
                         else
                         {
-                            return helper::SdClientState::ServiceSeen;
+                            return false;
                         }
                     }
 
@@ -47,28 +48,35 @@ namespace ara
                         mConditionVariable->notify_one();
 
                         // If the sevice client has ever been requested and it is no disposing,
-                        // keep the state flow in the loop by waiting for the timer
+                        // keep the state flow in the loop by watching the timer
                         if (mEverRequested && !mDisposing)
                         {
-                            helper::SdClientState _nextState = waitForNextState();
-                            Transit(_nextState);
+                            TransitWhen(
+                                [this](helper::SdClientState &nextState)
+                                { return tryGetNextState(nextState); });
                         }
                     }
 
                     void ServiceNotseenState::RequestService()
                     {
                         mEverRequested = true;
-                        // Due to calling from a separate thread, it is safe to directly transit.
                         Transit(helper::SdClientState::InitialWaitPhase);
                     }
 
                     void ServiceNotseenState::Dispose() noexcept
                     {
                         mDisposing = true;
+                        StopWatching();
                     }
 
                     void ServiceNotseenState::Deactivate(helper::SdClientState nextState)
                     {
+                        StopWatching();
+                    }
+
+                    ServiceNotseenState::~ServiceNotseenState() noexcept
+                    {
+                        DetachTtlTimer();
                     }
                 }
             }
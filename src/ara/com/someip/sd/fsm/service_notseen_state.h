@@ -5,6 +5,7 @@
 #ifndef SERVICE_NOTSEEN_STATE_H
 #define SERVICE_NOTSEEN_STATE_H
 
+#include <condition_variable>
 #include "./client_service_state.h"
 
 namespace ara
@@ -27,7 +28,7 @@ namespace ara
                         bool mDisposing;
                         bool mEverRequested;
 
-                        helper::SdClientState waitForNextState();
+                        bool tryGetNextState(helper::SdClientState &nextState) const;
 
                     protected:
                         void Deactivate(helper::SdClientState nextState) override;
@@ -43,16 +44,16 @@ namespace ara
                         ServiceNotseenState() = delete;
                         ServiceNotseenState(const ServiceNotseenState &) = delete;
                         ServiceNotseenState &operator=(const ServiceNotseenState &) = delete;
+                        ~ServiceNotseenState() noexcept override;
 
                         void Activate(helper::SdClientState previousState) override;
 
                         /// @brief Request service client for the first time
-                        /// @note Due to blocking, this function should be called from a separate thread.
                         void RequestService();
 
-                        /// @brief Dispose the state to end the blocking caused by ServiceRequested
+                        /// @brief Dispose the state to stop watching the TTL timer
                         /// @remarks The side effect of this function call is irreversible.
-                        /// @see ServiceRequested
+                        /// @see RequestService
                         void Dispose() noexcept;
                     };
                 }
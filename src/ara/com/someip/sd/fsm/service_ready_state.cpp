@@ -22,31 +22,23 @@ namespace ara
                     {
                     }
 
-                    helper::SdClientState ServiceReadyState::waitForNextState()
+                    bool ServiceReadyState::tryGetNextState(helper::SdClientState &nextState) const
                     {
-                        bool _expired = false;
-
-                        while (Timer->GetRequested() && Timer->GetOffered())
-                        {
-                            _expired = Timer->WaitForExpiration();
-
-                            if (_expired)
-                            {
-                                break;
-                            }
-                        }
-
                         if (!Timer->GetRequested())
                         {
-                            return helper::SdClientState::ServiceSeen;
+                            nextState = helper::SdClientState::ServiceSeen;
+                            return true;
                         }
-                        else if (_expired)
+                        else if (!Timer->GetOffered())
                         {
-                            return helper::SdClientState::InitialWaitPhase;
+                            // The offer is stopped or its TTL is expired
+                            nextState = helper::SdClientState::InitialWaitPhase;
+                            return true;
                         }
                         else
                         {
-                            return helper::SdClientState::Stopped;
+                            // Still requested and offered, or the TTL is reset
+                            return false;
                         }
                     }
 
@@ -54,12 +46,27 @@ namespace ara
                     {
                         // Notify the condition variable that the service has been offered
                         mConditionVariable->notify_one();
-                        helper::SdClientState _nextState = waitForNextState();
-                        Transit(_nextState);
+
+                        if (Timer->GetRequested() && !Timer->GetOffered())
+                        {
+                            Transit(helper::SdClientState::Stopped);
+                        }
+                        else
+                        {
+                            TransitWhen(
+                                [this](helper::SdClientState &nextState)
+                                { return tryGetNextState(nextState); });
+                        }
                     }
 
                     void ServiceReadyState::Deactivate(helper::SdClientState nextState)
                     {
+                        StopWatching();
+                    }
+
+                    ServiceReadyState::~ServiceReadyState() noexcept
+                    {
+                        DetachTtlTimer();
                     }
                 }
             }
@@ -5,6 +5,7 @@
 #ifndef SERVICE_READY_STATE_H
 #define SERVICE_READY_STATE_H
 
+#include <condition_variable>
 #include "./client_service_state.h"
 
 namespace ara
@@ -24,7 +25,7 @@ namespace ara
                     private:
                         std::condition_variable *const mConditionVariable;
 
-                        helper::SdClientState waitForNextState();
+                        bool tryGetNextState(helper::SdClientState &nextState) const;
 
                     protected:
                         void Deactivate(helper::SdClientState nextState) override;
@@ -40,6 +41,7 @@ namespace ara
                         ServiceReadyState() = delete;
                         ServiceReadyState(const ServiceReadyState &) = delete;
                         ServiceReadyState &operator=(const ServiceReadyState &) = delete;
+                        ~ServiceReadyState() noexcept override;
 
                         void Activate(helper::SdClientState previousState) override;
                     };
@@ -22,38 +22,41 @@ namespace ara
                     {
                     }
 
-                    helper::SdClientState ServiceSeenState::waitForNextState()
+                    bool ServiceSeenState::tryGetNextState(helper::SdClientState &nextState) const
                     {
-                        while (!Timer->GetRequested() && Timer->GetOffered())
+                        if (Timer->GetRequested())
                         {
-                            bool _expired = Timer->WaitForExpiration();
-
-                            if (_expired)
-                            {
-                                break;
-                            }
+                            nextState = helper::SdClientState::ServiceReady;
+                            return true;
                         }
-
-                        if (Timer->GetRequested())
+                        else if (!Timer->GetOffered())
                         {
-                            return helper::SdClientState::ServiceReady;
+                            // The service is not offering anymore or the TTL is expired:
+                            nextState = helper::SdClientState::ServiceNotSeen;
+                            return true;
                         }
                         else
                         {
-                            // The service is not offering anymore or the TTL is expired:
-                            return helper::SdClientState::ServiceNotSeen;
+                            return false;
                         }
                     }
 
                     void ServiceSeenState::Activate(helper::SdClientState previousState)
                     {
                         mConditionVariable->notify_one();
-                        helper::SdClientState _nextState = waitForNextState();
-                        Transit(_nextState);
+                        TransitWhen(
+                            [this](helper::SdClientState &nextState)
+                            { return tryGetNextState(nextState); });
                     }
 
                     void ServiceSeenState::Deactivate(helper::SdClientState nextState)
                     {
+                        StopWatching();
+                    }
+
+                    ServiceSeenState::~ServiceSeenState() noexcept
+                    {
+                        DetachTtlTimer();
                     }
                 }
             }
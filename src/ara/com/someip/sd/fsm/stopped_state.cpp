@@ -22,20 +22,22 @@ namespace ara
                     {
                     }
 
-                    helper::SdClientState StoppedState::waitForNextState()
+                    bool StoppedState::tryGetNextState(helper::SdClientState &nextState) const
                     {
-                        if (Timer->GetRequested() && !Timer->GetOffered())
+                        if (!Timer->GetRequested())
                         {
-                            Timer->WaitForSignal();
+                            nextState = helper::SdClientState::ServiceNotSeen;
+                            return true;
                         }
-
-                        if (!Timer->GetRequested())
+                        else if (Timer->GetOffered())
                         {
-                            return helper::SdClientState::ServiceNotSeen;
+                            nextState = helper::SdClientState::ServiceReady;
+                            return true;
                         }
                         else
                         {
-                            return helper::SdClientState::ServiceReady;
+                            // Still requested, but not offered yet
+                            return false;
                         }
                     }
 
@@ -43,12 +45,19 @@ namespace ara
                     {
                         // Notify the condition variable that the service is not offered yet
                         mConditionVariable->notify_one();
-                        helper::SdClientState _nextState = waitForNextState();
-                        Transit(_nextState);
+                        TransitWhen(
+                            [this](helper::SdClientState &nextState)
+                            { return tryGetNextState(nextState); });
                     }
 
                     void StoppedState::Deactivate(helper::SdClientState nextState)
                     {
+                        StopWatching();
+                    }
+
+                    StoppedState::~StoppedState() noexcept
+                    {
+                        DetachTtlTimer();
                     }
                 };
             }
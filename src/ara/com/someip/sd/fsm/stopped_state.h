@@ -5,6 +5,7 @@
 #ifndef STOPPED_STATE_H
 #define STOPPED_STATE_H
 
+#include <condition_variable>
 #include "./client_service_state.h"
 
 namespace ara
@@ -24,7 +25,7 @@ namespace ara
                     private:
                         std::condition_variable *const mConditionVariable;
 
-                        helper::SdClientState waitForNextState();
+                        bool tryGetNextState(helper::SdClientState &nextState) const;
 
                     protected:
                         void Deactivate(helper::SdClientState nextState) override;
@@ -40,6 +41,7 @@ namespace ara
                         StoppedState() = delete;
                         StoppedState(const StoppedState &) = delete;
                         StoppedState &operator=(const StoppedState &) = delete;
+                        ~StoppedState() noexcept override;
 
                         void Activate(helper::SdClientState previousState) override;
                     };
@@ -5,7 +5,13 @@
 #ifndef TIMER_SET_STATE_H
 #define TIMER_SET_STATE_H
 
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include "../../../../core/timer_wheel.h"
 #include "../../../helper/machine_state.h"
 
 namespace ara
@@ -22,64 +28,130 @@ namespace ara
                 {
                     /// @brief Server's or client's service timer set state
                     /// @tparam T Server's or client state enumeration type
+                    /// @details Phase timing runs on the process-wide timer
+                    ///          wheel: SetTimer() arms the first timer and each
+                    ///          expiry arms the next one, so no thread sleeps
+                    ///          while a phase is in progress. A phase ends with
+                    ///          Complete(), which transits to the next state.
                     /// @note The state is not copyable
                     template <typename T>
                     class TimerSetState : virtual public helper::MachineState<T>
                     {
                     private:
+                        // Outlives the state so that an expiry racing with
+                        // the destructor finds no owner instead of a dangling one.
+                        struct Guard
+                        {
+                            std::recursive_mutex Mutex;
+                            TimerSetState *Owner;
+                        };
+
                         const T mStoppedState;
                         T mNextState;
                         bool mStopped;
                         bool mInterrupted;
+                        core::TimerWheel &mWheel;
+                        std::shared_ptr<Guard> mGuard;
+                        core::TimerWheel::TimerId mTimer;
+                        uint64_t mTimerGeneration;
 
                         void setTimerBase()
                         {
+                            std::lock_guard<std::recursive_mutex> _lock(mGuard->Mutex);
                             SetTimer();
-                            // Transition to the next state or to the stopped state
-                            if (mStopped)
-                            {
-                                helper::MachineState<T>::Transit(mStoppedState);
-                            }
-                            else
+                        }
+
+                        void cancelTimer()
+                        {
+                            // A dispatched but not yet run expiry is recognised
+                            // by its generation and dropped.
+                            ++mTimerGeneration;
+                            if (mTimer != 0)
                             {
-                                helper::MachineState<T>::Transit(mNextState);
+                                mWheel.Cancel(mTimer);
+                                mTimer = 0;
                             }
                         }
 
                     protected:
-                        /// @brief Wait for certian period of time
-                        /// @param duration Waiting duration
-                        /// @returns True if waiting is interrupted; otherwise false if timeout occurs
-                        bool WaitFor(std::chrono::milliseconds duration)
+                        /// @brief Arm the phase timer
+                        /// @param duration Delay until the handler runs
+                        /// @param handler Invoked on expiry unless the timer is
+                        ///        cancelled, interrupted or the service is stopped
+                        void ScheduleAfter(
+                            std::chrono::milliseconds duration,
+                            std::function<void()> handler)
                         {
-                            std::this_thread::sleep_for(duration);
-                            bool _result = mStopped || mInterrupted;
-
-                            return _result;
+                            cancelTimer();
+                            const uint64_t cGeneration{mTimerGeneration};
+                            std::weak_ptr<Guard> _weakGuard{mGuard};
+                            mTimer = mWheel.Schedule(
+                                duration,
+                                [_weakGuard, cGeneration, handler]()
+                                {
+                                    std::shared_ptr<Guard> _guard{_weakGuard.lock()};
+                                    if (!_guard)
+                                    {
+                                        return;
+                                    }
+
+                                    std::lock_guard<std::recursive_mutex> _lock(_guard->Mutex);
+                                    TimerSetState *_owner{_guard->Owner};
+                                    if (_owner != nullptr &&
+                                        _owner->mTimerGeneration == cGeneration)
+                                    {
+                                        _owner->mTimer = 0;
+                                        handler();
+                                    }
+                                });
                         }
 
-                        /// @brief Wait for certian period of time
-                        /// @param duration Waiting duration in milliseconds
-                        /// @returns True if waiting is interrupted; otherwise false if timeout occurs
-                        bool WaitFor(int duration)
+                        /// @brief End the phase
+                        /// @remark Transits to the next state, or to the stopped state
+                        ///         if the service is stopped meanwhile.
+                        void Complete()
                         {
-                            auto _milliseconds = std::chrono::milliseconds(duration);
-                            bool _result = WaitFor(_milliseconds);
-
-                            return _result;
+                            if (mStopped)
+                            {
+                                helper::MachineState<T>::Transit(mStoppedState);
+                            }
+                            else
+                            {
+                                helper::MachineState<T>::Transit(mNextState);
+                            }
                         }
 
                         /// @brief Interrupt the timer
                         /// @remark If the timer is interrupted, it should transit to the next state.
-                        void Interrupt() noexcept
+                        void Interrupt()
+                        {
+                            std::lock_guard<std::recursive_mutex> _lock(mGuard->Mutex);
+                            if (mTimer != 0)
+                            {
+                                cancelTimer();
+                                mInterrupted = true;
+                                Complete();
+                            }
+                        }
+
+                        /// @brief Cancel the phase for good and wait for a running expiry
+                        /// @remark Called first in the destructor of the most derived
+                        ///         state, so that no expiry handler runs while that
+                        ///         state is torn down.
+                        void DetachTimer()
                         {
-                            mInterrupted = true;
+                            std::lock_guard<std::recursive_mutex> _lock(mGuard->Mutex);
+                            mGuard->Owner = nullptr;
+                            mStopped = true;
+                            cancelTimer();
                         }
 
                         /// @brief Delegate which is invoked by timer's thread when the timer is expired
                         const std::function<void()> OnTimerExpired;
 
                         /// @brief Set the phase time on state activation
+                        /// @remark The implementation arms the phase via ScheduleAfter
+                        ///         and calls Complete once the phase is over.
                         virtual void SetTimer() = 0;
 
                         /// @brief Constructor
@@ -93,12 +165,19 @@ namespace ara
                                                                     mStoppedState{stoppedState},
                                                                     OnTimerExpired{onTimerExpired},
                                                                     mStopped{false},
-                                                                    mInterrupted{false}
+                                                                    mInterrupted{false},
+                                                                    mWheel{core::TimerWheel::Instance()},
+                                                                    mGuard{std::make_shared<Guard>()},
+                                                                    mTimer{0},
+                                                                    mTimerGeneration{0}
                         {
+                            mGuard->Owner = this;
                         }
 
                         void Deactivate(T nextState) override
                         {
+                            std::lock_guard<std::recursive_mutex> _lock(mGuard->Mutex);
+                            cancelTimer();
                             // Reset 'service interrupted' flag
                             mInterrupted = false;
                             // Reset 'service stopped' flag
@@ -118,9 +197,17 @@ namespace ara
                         }
 
                         /// @brief Inform the state that the server's service is stopped
-                        void ServiceStopped() noexcept
+                        /// @remark A phase in progress ends immediately with a
+                        ///         transition to the stopped state.
+                        void ServiceStopped()
                         {
+                            std::lock_guard<std::recursive_mutex> _lock(mGuard->Mutex);
                             mStopped = true;
+                            if (mTimer != 0)
+                            {
+                                cancelTimer();
+                                Complete();
+                            }
                         }
 
                         /// @brief Set next state
@@ -132,8 +219,7 @@ namespace ara
 
                         virtual ~TimerSetState() override
                         {
-                            // Set a fake stop signal, otherwise the timer loop may never end (e.g., in the main phase).
-                            ServiceStopped();
+                            DetachTimer();
                         }
                     };
                 }
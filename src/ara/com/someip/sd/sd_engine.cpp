@@ -0,0 +1,722 @@
+/// @file src/ara/com/someip/sd/sd_engine.cpp
+/// @brief Implementation for the per-node SOME/IP service discovery engine.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include "../../entry/service_entry.h"
+#include "./sd_engine.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                namespace
+                {
+                    const std::uint32_t cInfiniteTtl{0xffffffU};
+                    const std::uint16_t cMaxSessionId{0xffffU};
+
+                    inline bool instanceMatches(
+                        std::uint16_t wanted, std::uint16_t actual) noexcept
+                    {
+                        return wanted == entry::Entry::cAnyInstanceId || wanted == actual;
+                    }
+
+                    inline bool versionsMatch(
+                        std::uint8_t wantedMajor,
+                        std::uint32_t wantedMinor,
+                        std::uint8_t major,
+                        std::uint32_t minor) noexcept
+                    {
+                        return (wantedMajor == entry::Entry::cAnyMajorVersion ||
+                                wantedMajor == major) &&
+                               (wantedMinor == entry::ServiceEntry::cAnyMinorVersion ||
+                                wantedMinor == minor);
+                    }
+                }
+
+                SdEngine::SdEngine(
+                    Transmitter transmitter,
+                    SdNetworkConfig config,
+                    SdEngineTiming timing,
+                    std::size_t maxMessageSize) : mTransmitter{std::move(transmitter)},
+                                                  mConfig{std::move(config)},
+                                                  mTiming{timing},
+                                                  mPacker{maxMessageSize,
+                                                          mConfig.MaxEntriesPerMessage},
+                                                  mRebooted{mConfig.RebootDetection}
+                {
+                    resetPacker();
+                }
+
+                void SdEngine::resetPacker() noexcept
+                {
+                    mPacker.Reset(mSessionId, mRebooted);
+                }
+
+                void SdEngine::flush(std::vector<std::vector<std::uint8_t>> &messages)
+                {
+                    if (mPacker.EntryCount() == 0U)
+                    {
+                        return;
+                    }
+
+                    messages.emplace_back();
+                    mPacker.Finish(messages.back());
+                    ++mStatistics.MessagesSent;
+                    mStatistics.EntriesSent += mPacker.EntryCount();
+
+                    // The reboot flag is cleared once the session ID wraps.
+                    if (mSessionId == cMaxSessionId)
+                    {
+                        mSessionId = 1U;
+                        mRebooted = false;
+                    }
+                    else
+                    {
+                        ++mSessionId;
+                    }
+                    resetPacker();
+                }
+
+                void SdEngine::pack(
+                    entry::EntryType type,
+                    std::uint16_t serviceId,
+                    std::uint16_t instanceId,
+                    std::uint8_t majorVersion,
+                    std::uint32_t ttl,
+                    std::uint32_t minorVersion,
+                    const SdEndpoint *endpoint,
+                    std::vector<std::vector<std::uint8_t>> &messages)
+                {
+                    if (!mPacker.AddServiceEntry(
+                            type, serviceId, instanceId, majorVersion,
+                            ttl, minorVersion, endpoint))
+                    {
+                        // The current message is full; continue in a new one.
+                        flush(messages);
+                        if (!mPacker.AddServiceEntry(
+                                type, serviceId, instanceId, majorVersion,
+                                ttl, minorVersion, endpoint))
+                        {
+                            // Not even an empty message holds it.
+                            ++mStatistics.EntriesDropped;
+                        }
+                    }
+                }
+
+                void SdEngine::packOffer(
+                    const SdServiceOffer &offer,
+                    std::vector<std::vector<std::uint8_t>> &messages)
+                {
+                    pack(entry::EntryType::Offering,
+                         offer.ServiceId,
+                         offer.InstanceId,
+                         offer.MajorVersion,
+                         offer.Ttl,
+                         offer.MinorVersion,
+                         &offer.Endpoint,
+                         messages);
+                }
+
+                void SdEngine::advance(
+                    Phase &state,
+                    std::uint32_t &repetitions,
+                    Clock::time_point &due,
+                    Clock::time_point now,
+                    bool cyclic) noexcept
+                {
+                    const Phase cFinalPhase{cyclic ? Phase::Main : Phase::Done};
+
+                    if (state == Phase::InitialWait)
+                    {
+                        repetitions = 0U;
+                        state = Phase::Repetition;
+                    }
+                    else
+                    {
+                        ++repetitions;
+                    }
+
+                    if (repetitions >= mTiming.RepetitionMax)
+                    {
+                        state = cFinalPhase;
+                    }
+                    else
+                    {
+                        // Repetition k waits 2^k times the base delay.
+                        due = now + mTiming.RepetitionBaseDelay * (1U << repetitions);
+                    }
+                }
+
+                bool SdEngine::OfferService(
+                    const SdServiceOffer &offer, Clock::time_point now)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    auto &_bucket = mOffers[offer.ServiceId];
+                    for (const auto &local : _bucket)
+                    {
+                        if (local.Offer.InstanceId == offer.InstanceId)
+                        {
+                            return false;
+                        }
+                    }
+
+                    _bucket.push_back(
+                        LocalOffer{offer, Phase::InitialWait, 0U, now + mTiming.InitialDelay});
+                    return true;
+                }
+
+                bool SdEngine::StopOfferService(
+                    std::uint16_t serviceId, std::uint16_t instanceId)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    auto _bucket = mOffers.find(serviceId);
+                    if (_bucket == mOffers.end())
+                    {
+                        return false;
+                    }
+
+                    auto &_offers = _bucket->second;
+                    for (auto _it = _offers.begin(); _it != _offers.end(); ++_it)
+                    {
+                        if (_it->Offer.InstanceId != instanceId)
+                        {
+                            continue;
+                        }
+
+                        if (_it->State == Phase::Main)
+                        {
+                            --mMainPhaseOffers;
+                        }
+                        // An offer that was never sent needs no stop offer.
+                        if (_it->State != Phase::InitialWait)
+                        {
+                            mPendingStopOffers.push_back(_it->Offer);
+                        }
+
+                        _offers.erase(_it);
+                        if (_offers.empty())
+                        {
+                            mOffers.erase(_bucket);
+                        }
+                        return true;
+                    }
+
+                    return false;
+                }
+
+                bool SdEngine::FindService(
+                    const SdServiceFind &find, Clock::time_point now)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    auto &_bucket = mFinds[find.ServiceId];
+                    for (const auto &local : _bucket)
+                    {
+                        if (local.Find.InstanceId == find.InstanceId)
+                        {
+                            return false;
+                        }
+                    }
+
+                    LocalFind _find{find, Phase::InitialWait, 0U, now + mTiming.InitialDelay};
+
+                    // No need to ask for what is already known.
+                    auto _remotes = mRemotes.find(find.ServiceId);
+                    if (_remotes != mRemotes.end())
+                    {
+                        for (const auto &remote : _remotes->second)
+                        {
+                            if (instanceMatches(find.InstanceId, remote.InstanceId))
+                            {
+                                _find.State = Phase::Done;
+                                break;
+                            }
+                        }
+                    }
+
+                    _bucket.push_back(_find);
+                    return true;
+                }
+
+                bool SdEngine::StopFindService(
+                    std::uint16_t serviceId, std::uint16_t instanceId)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    auto _bucket = mFinds.find(serviceId);
+                    if (_bucket == mFinds.end())
+                    {
+                        return false;
+                    }
+
+                    auto &_finds = _bucket->second;
+                    for (auto _it = _finds.begin(); _it != _finds.end(); ++_it)
+                    {
+                        if (_it->Find.InstanceId == instanceId)
+                        {
+                            _finds.erase(_it);
+                            if (_finds.empty())
+                            {
+                                mFinds.erase(_bucket);
+                            }
+                            return true;
+                        }
+                    }
+
+                    return false;
+                }
+
+                void SdEngine::Process(Clock::time_point now)
+                {
+                    std::vector<std::vector<std::uint8_t>> _messages;
+                    std::vector<AvailabilityEvent> _events;
+                    AvailabilityHandler _handler;
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+
+                        for (const auto &offer : mPendingStopOffers)
+                        {
+                            pack(entry::EntryType::Offering,
+                                 offer.ServiceId,
+                                 offer.InstanceId,
+                                 offer.MajorVersion,
+                                 0U,
+                                 offer.MinorVersion,
+                                 nullptr,
+                                 _messages);
+                        }
+                        mPendingStopOffers.clear();
+
+                        // One shared cycle for every offer in the main phase, so
+                        // their cyclic offers always travel together. It runs
+                        // before the phase transitions below; an offer that
+                        // enters the main phase now is not sent twice.
+                        if (mMainPhaseOffers > 0U && mNextCycle <= now)
+                        {
+                            for (const auto &bucket : mOffers)
+                            {
+                                for (const auto &local : bucket.second)
+                                {
+                                    if (local.State == Phase::Main)
+                                    {
+                                        packOffer(local.Offer, _messages);
+                                    }
+                                }
+                            }
+
+                            mNextCycle += mTiming.CyclicOfferDelay;
+                            if (mNextCycle <= now)
+                            {
+                                mNextCycle = now + mTiming.CyclicOfferDelay;
+                            }
+                        }
+
+                        for (auto &bucket : mOffers)
+                        {
+                            for (auto &local : bucket.second)
+                            {
+                                if (local.State == Phase::Main || local.Due > now)
+                                {
+                                    continue;
+                                }
+
+                                packOffer(local.Offer, _messages);
+                                advance(local.State, local.Repetitions, local.Due, now, true);
+                                if (local.State == Phase::Main && ++mMainPhaseOffers == 1U)
+                                {
+                                    mNextCycle = now + mTiming.CyclicOfferDelay;
+                                }
+                            }
+                        }
+
+                        for (auto &bucket : mFinds)
+                        {
+                            for (auto &local : bucket.second)
+                            {
+                                if (local.State == Phase::Done || local.Due > now)
+                                {
+                                    continue;
+                                }
+
+                                pack(entry::EntryType::Finding,
+                                     local.Find.ServiceId,
+                                     local.Find.InstanceId,
+                                     local.Find.MajorVersion,
+                                     local.Find.Ttl,
+                                     local.Find.MinorVersion,
+                                     nullptr,
+                                     _messages);
+                                advance(local.State, local.Repetitions, local.Due, now, false);
+                            }
+                        }
+
+                        flush(_messages);
+                        expireRemotes(now, _events);
+                        if (!_events.empty())
+                        {
+                            _handler = mAvailabilityHandler;
+                        }
+                    }
+
+                    dispatch(_messages, _events, _handler);
+                }
+
+                SdEngine::Clock::time_point SdEngine::NextDeadline() const
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    if (!mPendingStopOffers.empty())
+                    {
+                        return Clock::time_point::min();
+                    }
+
+                    Clock::time_point _result{Clock::time_point::max()};
+                    if (mMainPhaseOffers > 0U)
+                    {
+                        _result = mNextCycle;
+                    }
+
+                    for (const auto &bucket : mOffers)
+                    {
+                        for (const auto &local : bucket.second)
+                        {
+                            if (local.State != Phase::Main)
+                            {
+                                _result = std::min(_result, local.Due);
+                            }
+                        }
+                    }
+
+                    for (const auto &bucket : mFinds)
+                    {
+                        for (const auto &local : bucket.second)
+                        {
+                            if (local.State != Phase::Done)
+                            {
+                                _result = std::min(_result, local.Due);
+                            }
+                        }
+                    }
+
+                    for (const auto &bucket : mRemotes)
+                    {
+                        for (const auto &remote : bucket.second)
+                        {
+                            _result = std::min(_result, remote.Expiry);
+                        }
+                    }
+
+                    return _result;
+                }
+
+                void SdEngine::setFindsSatisfied(
+                    std::uint16_t serviceId,
+                    std::uint16_t instanceId,
+                    bool satisfied,
+                    Clock::time_point now)
+                {
+                    auto _finds = mFinds.find(serviceId);
+                    if (_finds == mFinds.end())
+                    {
+                        return;
+                    }
+
+                    const auto _remotes = mRemotes.find(serviceId);
+                    for (auto &local : _finds->second)
+                    {
+                        if (!instanceMatches(local.Find.InstanceId, instanceId))
+                        {
+                            continue;
+                        }
+
+                        if (satisfied)
+                        {
+                            local.State = Phase::Done;
+                            continue;
+                        }
+
+                        // A wildcard find stays satisfied by another instance.
+                        bool _stillSeen{false};
+                        if (_remotes != mRemotes.end())
+                        {
+                            for (const auto &remote : _remotes->second)
+                            {
+                                if (instanceMatches(local.Find.InstanceId, remote.InstanceId))
+                                {
+                                    _stillSeen = true;
+                                    break;
+                                }
+                            }
+                        }
+
+                        if (!_stillSeen && local.State == Phase::Done)
+                        {
+                            local.State = Phase::InitialWait;
+                            local.Repetitions = 0U;
+                            local.Due = now;
+                        }
+                    }
+                }
+
+                void SdEngine::onOffer(
+                    const SdEntryRecord &record,
+                    Clock::time_point now,
+                    std::vector<AvailabilityEvent> &events)
+                {
+                    const Clock::time_point cExpiry{
+                        record.Ttl == cInfiniteTtl
+                            ? Clock::time_point::max()
+                            : now + std::chrono::seconds{record.Ttl}};
+
+                    auto &_bucket = mRemotes[record.ServiceId];
+                    for (auto &remote : _bucket)
+                    {
+                        if (remote.InstanceId == record.InstanceId)
+                        {
+                            // Renewal: refresh the lifetime and the endpoint.
+                            remote.MajorVersion = record.MajorVersion;
+                            remote.MinorVersion = record.MinorVersion;
+                            remote.HasEndpoint = mReceived.TryGetEndpoint(record, remote.Endpoint);
+                            remote.Expiry = cExpiry;
+                            return;
+                        }
+                    }
+
+                    SdRemoteService _remote;
+                    _remote.ServiceId = record.ServiceId;
+                    _remote.InstanceId = record.InstanceId;
+                    _remote.MajorVersion = record.MajorVersion;
+                    _remote.MinorVersion = record.MinorVersion;
+                    _remote.HasEndpoint = mReceived.TryGetEndpoint(record, _remote.Endpoint);
+                    _remote.Expiry = cExpiry;
+                    _bucket.push_back(_remote);
+                    ++mRemoteCount;
+
+                    events.push_back(AvailabilityEvent{_remote, true});
+                    setFindsSatisfied(record.ServiceId, record.InstanceId, true, now);
+                }
+
+                void SdEngine::onStopOffer(
+                    const SdEntryRecord &record,
+                    Clock::time_point now,
+                    std::vector<AvailabilityEvent> &events)
+                {
+                    auto _bucket = mRemotes.find(record.ServiceId);
+                    if (_bucket == mRemotes.end())
+                    {
+                        return;
+                    }
+
+                    auto &_remotes = _bucket->second;
+                    for (auto _it = _remotes.begin(); _it != _remotes.end(); ++_it)
+                    {
+                        if (_it->InstanceId == record.InstanceId)
+                        {
+                            events.push_back(AvailabilityEvent{*_it, false});
+                            _remotes.erase(_it);
+                            --mRemoteCount;
+                            if (_remotes.empty())
+                            {
+                                mRemotes.erase(_bucket);
+                            }
+                            setFindsSatisfied(record.ServiceId, record.InstanceId, false, now);
+                            return;
+                        }
+                    }
+                }
+
+                void SdEngine::onFind(
+                    const SdEntryRecord &record,
+                    std::vector<std::vector<std::uint8_t>> &messages)
+                {
+                    auto _bucket = mOffers.find(record.ServiceId);
+                    if (_bucket == mOffers.end())
+                    {
+                        return;
+                    }
+
+                    for (const auto &local : _bucket->second)
+                    {
+                        // Offers still in their initial wait are not announced yet.
+                        if (local.State != Phase::InitialWait &&
+                            instanceMatches(record.InstanceId, local.Offer.InstanceId) &&
+                            versionsMatch(
+                                record.MajorVersion,
+                                record.MinorVersion,
+                                local.Offer.MajorVersion,
+                                local.Offer.MinorVersion))
+                        {
+                            packOffer(local.Offer, messages);
+                        }
+                    }
+                }
+
+                void SdEngine::expireRemotes(
+                    Clock::time_point now,
+                    std::vector<AvailabilityEvent> &events)
+                {
+                    for (auto _bucket = mRemotes.begin(); _bucket != mRemotes.end();)
+                    {
+                        const std::uint16_t cServiceId{_bucket->first};
+                        auto &_remotes = _bucket->second;
+                        std::size_t _expired{0U};
+                        for (auto _it = _remotes.begin(); _it != _remotes.end();)
+                        {
+                            if (_it->Expiry <= now)
+                            {
+                                events.push_back(AvailabilityEvent{*_it, false});
+                                _it = _remotes.erase(_it);
+                                ++_expired;
+                            }
+                            else
+                            {
+                                ++_it;
+                            }
+                        }
+
+                        mRemoteCount -= _expired;
+                        _bucket = _remotes.empty() ? mRemotes.erase(_bucket) : std::next(_bucket);
+
+                        if (_expired > 0U)
+                        {
+                            const std::size_t cFirst{events.size() - _expired};
+                            for (std::size_t i = cFirst; i < events.size(); ++i)
+                            {
+                                setFindsSatisfied(
+                                    cServiceId, events[i].Service.InstanceId, false, now);
+                            }
+                        }
+                    }
+                }
+
+                void SdEngine::dispatch(
+                    const std::vector<std::vector<std::uint8_t>> &messages,
+                    const std::vector<AvailabilityEvent> &events,
+                    const AvailabilityHandler &handler) const
+                {
+                    if (mTransmitter)
+                    {
+                        for (const auto &message : messages)
+                        {
+                            mTransmitter(message);
+                        }
+                    }
+
+                    if (handler)
+                    {
+                        for (const auto &event : events)
+                        {
+                            handler(event.Service, event.Available);
+                        }
+                    }
+                }
+
+                bool SdEngine::OnMessage(
+                    const std::uint8_t *data,
+                    std::size_t length,
+                    Clock::time_point now)
+                {
+                    std::vector<std::vector<std::uint8_t>> _messages;
+                    std::vector<AvailabilityEvent> _events;
+                    AvailabilityHandler _handler;
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        ++mStatistics.MessagesReceived;
+                        if (!mReceived.Parse(data, length))
+                        {
+                            ++mStatistics.MalformedMessages;
+                            return false;
+                        }
+                        mStatistics.EntriesReceived += mReceived.Entries().size();
+
+                        for (const auto &record : mReceived.Entries())
+                        {
+                            switch (record.Type)
+                            {
+                            case entry::EntryType::Offering:
+                                if (record.Ttl > 0U)
+                                {
+                                    onOffer(record, now, _events);
+                                }
+                                else
+                                {
+                                    onStopOffer(record, now, _events);
+                                }
+                                break;
+
+                            case entry::EntryType::Finding:
+                                onFind(record, _messages);
+                                break;
+
+                            default:
+                                // Eventgroup entries are handled by the event bindings.
+                                break;
+                            }
+                        }
+
+                        // All answers to the finds of this message travel together.
+                        flush(_messages);
+                        if (!_events.empty())
+                        {
+                            _handler = mAvailabilityHandler;
+                        }
+                    }
+
+                    dispatch(_messages, _events, _handler);
+                    return true;
+                }
+
+                bool SdEngine::OnMessage(
+                    const std::vector<std::uint8_t> &payload,
+                    Clock::time_point now)
+                {
+                    return OnMessage(payload.data(), payload.size(), now);
+                }
+
+                bool SdEngine::TryGetRemoteService(
+                    std::uint16_t serviceId,
+                    std::uint16_t instanceId,
+                    SdRemoteService &service) const
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    auto _bucket = mRemotes.find(serviceId);
+                    if (_bucket == mRemotes.end())
+                    {
+                        return false;
+                    }
+
+                    for (const auto &remote : _bucket->second)
+                    {
+                        if (instanceMatches(instanceId, remote.InstanceId))
+                        {
+                            service = remote;
+                            return true;
+                        }
+                    }
+
+                    return false;
+                }
+
+                std::size_t SdEngine::RemoteServiceCount() const
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    return mRemoteCount;
+                }
+
+                void SdEngine::SetAvailabilityHandler(AvailabilityHandler handler)
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    mAvailabilityHandler = std::move(handler);
+                }
+
+                SdEngineStatistics SdEngine::GetStatistics() const
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    return mStatistics;
+                }
+            }
+        }
+    }
+}
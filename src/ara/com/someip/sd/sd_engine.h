@@ -0,0 +1,310 @@
+/// @file src/ara/com/someip/sd/sd_engine.h
+/// @brief Per-node SOME/IP service discovery engine.
+/// @details SomeIpSdServer and SomeIpSdClient run one state machine and send
+///          one SD message per service. SdEngine instead owns the offers and
+///          finds of the whole node: every cycle it packs the entries of all
+///          due services into as few SD messages as the size limit allows,
+///          with one shared endpoint option per distinct endpoint. Incoming
+///          messages are parsed into a reused flat arena, and remote offers
+///          are kept in a table hashed by service ID, so matching a find or
+///          an offer does not depend on the number of known services.
+///
+///          The engine owns no thread. Its owner calls Process() at
+///          NextDeadline() (or periodically) and forwards received
+///          datagrams to OnMessage().
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_SOMEIP_SD_ENGINE_H
+#define ARA_COM_SOMEIP_SD_ENGINE_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "./sd_network_config.h"
+#include "./sd_packed_message.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                /// @brief Phase timing shared by all services of an engine
+                struct SdEngineTiming
+                {
+                    /// @brief Delay before the first offer/find of a service
+                    std::chrono::milliseconds InitialDelay{10};
+
+                    /// @brief Base delay of the repetition phase; doubles per repetition
+                    std::chrono::milliseconds RepetitionBaseDelay{30};
+
+                    /// @brief Number of repetitions before the main phase
+                    std::uint32_t RepetitionMax{3U};
+
+                    /// @brief Period of the cyclic offers in the main phase
+                    std::chrono::milliseconds CyclicOfferDelay{1000};
+                };
+
+                /// @brief Service instance offered by the local node
+                struct SdServiceOffer
+                {
+                    std::uint16_t ServiceId{0U};
+                    std::uint16_t InstanceId{0U};
+                    std::uint8_t MajorVersion{0U};
+                    std::uint32_t MinorVersion{0U};
+                    /// @brief Offer lifetime in seconds (0xffffff = until stopped)
+                    std::uint32_t Ttl{0xffffffU};
+                    SdEndpoint Endpoint;
+                };
+
+                /// @brief Service instance the local node looks for
+                struct SdServiceFind
+                {
+                    std::uint16_t ServiceId{0U};
+                    std::uint16_t InstanceId{entry::Entry::cAnyInstanceId};
+                    std::uint8_t MajorVersion{entry::Entry::cAnyMajorVersion};
+                    std::uint32_t MinorVersion{0xffffffffU};
+                    /// @brief Find lifetime in seconds
+                    std::uint32_t Ttl{0xffffffU};
+                };
+
+                /// @brief Service instance offered by a remote node
+                struct SdRemoteService
+                {
+                    std::uint16_t ServiceId{0U};
+                    std::uint16_t InstanceId{0U};
+                    std::uint8_t MajorVersion{0U};
+                    std::uint32_t MinorVersion{0U};
+                    /// @brief Announced endpoint; valid if HasEndpoint is set
+                    SdEndpoint Endpoint;
+                    bool HasEndpoint{false};
+                    /// @brief Point in time the offer expires without renewal
+                    std::chrono::steady_clock::time_point Expiry;
+                };
+
+                /// @brief SD engine counters
+                struct SdEngineStatistics
+                {
+                    std::uint64_t MessagesSent{0U};
+                    std::uint64_t EntriesSent{0U};
+                    std::uint64_t MessagesReceived{0U};
+                    std::uint64_t EntriesReceived{0U};
+                    std::uint64_t MalformedMessages{0U};
+                    /// @brief Entries too large for even an empty message
+                    std::uint64_t EntriesDropped{0U};
+                };
+
+                /// @brief Aggregated SOME/IP-SD engine for all services of a node
+                class SdEngine
+                {
+                public:
+                    using Clock = std::chrono::steady_clock;
+
+                    /// @brief Sends one serialized SD message
+                    using Transmitter =
+                        std::function<void(const std::vector<std::uint8_t> &)>;
+
+                    /// @brief Notified when a remote service appears (true) or
+                    ///        disappears (false); never called under the engine lock
+                    using AvailabilityHandler =
+                        std::function<void(const SdRemoteService &, bool)>;
+
+                private:
+                    enum class Phase : std::uint8_t
+                    {
+                        InitialWait,
+                        Repetition,
+                        Main,
+                        Done
+                    };
+
+                    struct LocalOffer
+                    {
+                        SdServiceOffer Offer;
+                        Phase State;
+                        std::uint32_t Repetitions;
+                        Clock::time_point Due;
+                    };
+
+                    struct LocalFind
+                    {
+                        SdServiceFind Find;
+                        Phase State;
+                        std::uint32_t Repetitions;
+                        Clock::time_point Due;
+                    };
+
+                    struct AvailabilityEvent
+                    {
+                        SdRemoteService Service;
+                        bool Available;
+                    };
+
+                    const Transmitter mTransmitter;
+                    const SdNetworkConfig mConfig;
+                    const SdEngineTiming mTiming;
+
+                    mutable std::mutex mMutex;
+                    // All three tables are hashed by service ID; a bucket holds
+                    // the (few) instances of that service.
+                    std::unordered_map<std::uint16_t, std::vector<LocalOffer>> mOffers;
+                    std::unordered_map<std::uint16_t, std::vector<LocalFind>> mFinds;
+                    std::unordered_map<std::uint16_t, std::vector<SdRemoteService>> mRemotes;
+                    std::vector<SdServiceOffer> mPendingStopOffers;
+                    std::size_t mMainPhaseOffers{0U};
+                    Clock::time_point mNextCycle;
+                    std::size_t mRemoteCount{0U};
+
+                    SdPackedMessage mReceived;
+                    SdMessagePacker mPacker;
+                    std::uint16_t mSessionId{1U};
+                    bool mRebooted{true};
+                    SdEngineStatistics mStatistics;
+                    AvailabilityHandler mAvailabilityHandler;
+
+                    void resetPacker() noexcept;
+                    void pack(
+                        entry::EntryType type,
+                        std::uint16_t serviceId,
+                        std::uint16_t instanceId,
+                        std::uint8_t majorVersion,
+                        std::uint32_t ttl,
+                        std::uint32_t minorVersion,
+                        const SdEndpoint *endpoint,
+                        std::vector<std::vector<std::uint8_t>> &messages);
+                    void flush(std::vector<std::vector<std::uint8_t>> &messages);
+                    void packOffer(
+                        const SdServiceOffer &offer,
+                        std::vector<std::vector<std::uint8_t>> &messages);
+                    void advance(
+                        Phase &state,
+                        std::uint32_t &repetitions,
+                        Clock::time_point &due,
+                        Clock::time_point now,
+                        bool cyclic) noexcept;
+                    void onOffer(
+                        const SdEntryRecord &record,
+                        Clock::time_point now,
+                        std::vector<AvailabilityEvent> &events);
+                    void onStopOffer(
+                        const SdEntryRecord &record,
+                        Clock::time_point now,
+                        std::vector<AvailabilityEvent> &events);
+                    void onFind(
+                        const SdEntryRecord &record,
+                        std::vector<std::vector<std::uint8_t>> &messages);
+                    void setFindsSatisfied(
+                        std::uint16_t serviceId,
+                        std::uint16_t instanceId,
+                        bool satisfied,
+                        Clock::time_point now);
+                    void expireRemotes(
+                        Clock::time_point now,
+                        std::vector<AvailabilityEvent> &events);
+                    void dispatch(
+                        const std::vector<std::vector<std::uint8_t>> &messages,
+                        const std::vector<AvailabilityEvent> &events,
+                        const AvailabilityHandler &handler) const;
+
+                public:
+                    /// @brief Constructor
+                    /// @param transmitter Sends the packed SD messages
+                    /// @param config Network configuration; MaxEntriesPerMessage and
+                    ///        RebootDetection are honoured
+                    /// @param timing Phase timing of all services
+                    /// @param maxMessageSize Upper bound of a packed message in bytes
+                    explicit SdEngine(
+                        Transmitter transmitter,
+                        SdNetworkConfig config = SdNetworkConfig{},
+                        SdEngineTiming timing = SdEngineTiming{},
+                        std::size_t maxMessageSize =
+                            SdMessagePacker::cDefaultMaxMessageSize);
+
+                    SdEngine(const SdEngine &) = delete;
+                    SdEngine &operator=(const SdEngine &) = delete;
+
+                    /// @brief Start offering a service instance
+                    /// @param offer Offered instance
+                    /// @param now Current time
+                    /// @returns False if the instance is already offered
+                    bool OfferService(
+                        const SdServiceOffer &offer,
+                        Clock::time_point now = Clock::now());
+
+                    /// @brief Stop offering a service instance
+                    /// @details The stop offer is sent with the next Process() call,
+                    ///          packed with every other due entry.
+                    /// @returns False if the instance is not offered
+                    bool StopOfferService(std::uint16_t serviceId, std::uint16_t instanceId);
+
+                    /// @brief Start looking for a service instance
+                    /// @details Finds are repeated until a matching offer is seen
+                    ///          and re-armed when that offer disappears.
+                    /// @param find Service instance of interest
+                    /// @param now Current time
+                    /// @returns False if the same find is already active
+                    bool FindService(
+                        const SdServiceFind &find,
+                        Clock::time_point now = Clock::now());
+
+                    /// @brief Stop looking for a service instance
+                    /// @returns False if no such find is active
+                    bool StopFindService(std::uint16_t serviceId, std::uint16_t instanceId);
+
+                    /// @brief Send all due entries and expire stale remote offers
+                    /// @param now Current time
+                    void Process(Clock::time_point now = Clock::now());
+
+                    /// @brief Earliest point in time Process() has work to do
+                    /// @returns Clock::time_point::max() if nothing is scheduled
+                    Clock::time_point NextDeadline() const;
+
+                    /// @brief Handle a received SD message
+                    /// @details Offers update the remote table, stop offers remove
+                    ///          from it, and finds for local offers are answered with
+                    ///          one packed message.
+                    /// @param data Received datagram
+                    /// @param length Datagram length
+                    /// @param now Current time
+                    /// @returns False if the message was malformed and ignored
+                    bool OnMessage(
+                        const std::uint8_t *data,
+                        std::size_t length,
+                        Clock::time_point now = Clock::now());
+
+                    /// @brief Handle a received SD message
+                    bool OnMessage(
+                        const std::vector<std::uint8_t> &payload,
+                        Clock::time_point now = Clock::now());
+
+                    /// @brief Look up a remote service instance
+                    /// @param serviceId Service ID
+                    /// @param instanceId Instance ID or cAnyInstanceId
+                    /// @param[out] service Matching remote service
+                    /// @returns False if no live offer matches
+                    bool TryGetRemoteService(
+                        std::uint16_t serviceId,
+                        std::uint16_t instanceId,
+                        SdRemoteService &service) const;
+
+                    /// @brief Number of known remote service instances
+                    std::size_t RemoteServiceCount() const;
+
+                    /// @brief Set the remote availability handler
+                    void SetAvailabilityHandler(AvailabilityHandler handler);
+
+                    /// @brief Snapshot of the engine counters
+                    SdEngineStatistics GetStatistics() const;
+                };
+            }
+        }
+    }
+}
+
+#endif
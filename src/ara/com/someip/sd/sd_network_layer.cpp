@@ -3,6 +3,7 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
 #include <algorithm>
+#include <arpa/inet.h>
 #include "./sd_network_layer.h"
 
 namespace ara
@@ -32,6 +33,17 @@ namespace ara
                         throw std::runtime_error("UDP socket setup failed.");
                     }
 
+                    sockaddr_in _multicastAddress{};
+                    _multicastAddress.sin_family = AF_INET;
+                    _multicastAddress.sin_port = htons(cPort);
+                    ::inet_pton(AF_INET, cMulticastGroup.c_str(), &_multicastAddress.sin_addr);
+                    mSender.reset(
+                        new helper::UdpBatchSender(
+                            mUdpSocket.Descriptor(), _multicastAddress, helper::UdpBatchSender::cDefaultBatchSize, cBufferSize));
+                    mReceiver.reset(
+                        new helper::UdpBatchReceiver(
+                            mUdpSocket.Descriptor(), helper::UdpBatchReceiver::cDefaultBatchSize, cBufferSize));
+
                     auto _receiver{std::bind(&SdNetworkLayer::onReceive, this)};
                     _successful = mPoller->TryAddReceiver(&mUdpSocket, _receiver);
                     if (!_successful)
@@ -49,40 +61,42 @@ namespace ara
 
                 void SdNetworkLayer::onReceive()
                 {
-                    std::array<uint8_t, cBufferSize> _buffer;
-                    std::string _ipAddress;
-                    uint16_t _port;
-                    ssize_t _receivedSize{
-                        mUdpSocket.Receive(_buffer, _ipAddress, _port)};
-
-                    if (_receivedSize > 0 &&
-                        _port == cPort && _ipAddress == cNicIpAddress)
+                    // Drain everything that queued up since the last poll.
+                    const size_t cCount{mReceiver->Receive()};
+                    for (size_t i = 0; i < cCount; ++i)
                     {
-                        const std::vector<uint8_t> cRequestPayload(
-                            std::make_move_iterator(_buffer.begin()),
-                            std::make_move_iterator(_buffer.begin() + _receivedSize));
+                        const sockaddr_in &cSource{mReceiver->Source(i)};
+                        char _ipAddress[INET_ADDRSTRLEN];
+                        ::inet_ntop(AF_INET, &cSource.sin_addr, _ipAddress, sizeof(_ipAddress));
+
+                        if (ntohs(cSource.sin_port) == cPort &&
+                            cNicIpAddress == _ipAddress)
+                        {
+                            const uint8_t *cData{mReceiver->Data(i)};
+                            const std::vector<uint8_t> cRequestPayload(
+                                cData, cData + mReceiver->Size(i));
 
-                        FireReceiverCallbacks(cRequestPayload);
+                            FireReceiverCallbacks(cRequestPayload);
+                        }
                     }
                 }
 
                 void SdNetworkLayer::onSend()
                 {
+                    // Stage the whole queue and hand it over in as few
+                    // sendmmsg() calls as the batch size allows.
                     while (!mSendingQueue.Empty())
                     {
                         std::vector<uint8_t> _payload;
                         bool _dequeued{mSendingQueue.TryDequeue(_payload)};
                         if (_dequeued)
                         {
-                            std::array<uint8_t, cBufferSize> _buffer;
-                            std::copy_n(
-                                std::make_move_iterator(_payload.begin()),
-                                _payload.size(),
-                                _buffer.begin());
-
-                            mUdpSocket.Send(_buffer, cMulticastGroup, cPort);
+                            // Messages are cut at the buffer size as before.
+                            const size_t cSize{std::min(_payload.size(), cBufferSize)};
+                            mSender->Send(_payload.data(), cSize);
                         }
                     }
+                    mSender->Flush();
                 }
 
                 void SdNetworkLayer::Send(const SomeIpSdMessage &message)
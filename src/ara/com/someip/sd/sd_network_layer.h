@@ -7,8 +7,10 @@
 
 #include <asyncbsdsocket/poller.h>
 #include <asyncbsdsocket/udp_client.h>
+#include <memory>
 #include "../../helper/concurrent_queue.h"
 #include "../../helper/network_layer.h"
+#include "../../helper/udp_batch.h"
 #include "./someip_sd_message.h"
 
 namespace ara
@@ -35,6 +37,8 @@ namespace ara
                     helper::ConcurrentQueue<std::vector<uint8_t>> mSendingQueue;
                     AsyncBsdSocketLib::Poller *const mPoller;
                     AsyncBsdSocketLib::UdpClient mUdpSocket;
+                    std::unique_ptr<helper::UdpBatchSender> mSender;
+                    std::unique_ptr<helper::UdpBatchReceiver> mReceiver;
 
                     void onReceive();
                     void onSend();
@@ -0,0 +1,434 @@
+/// @file src/ara/com/someip/sd/sd_packed_message.cpp
+/// @brief Implementation for the flat SD message parser and packer.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include "./sd_packed_message.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                namespace
+                {
+                    const std::uint32_t cSdMessageId{0xffff8100U};
+                    const std::size_t cSomeIpHeaderSize{16U};
+                    const std::size_t cLengthCoveredOffset{8U};
+                    const std::uint8_t cRebootBit{0x80U};
+                    const std::uint8_t cUnicastBit{0x40U};
+                    const std::uint8_t cTtlShift{24U};
+                    const std::uint32_t cTtlMask{0x00ffffffU};
+                    const std::size_t cOptionHeaderSize{3U};
+                    const std::uint16_t cIpv4EndpointLength{9U};
+
+                    inline std::uint16_t readShort(const std::uint8_t *data) noexcept
+                    {
+                        return static_cast<std::uint16_t>(
+                            (static_cast<std::uint16_t>(data[0]) << 8) | data[1]);
+                    }
+
+                    inline std::uint32_t readInteger(const std::uint8_t *data) noexcept
+                    {
+                        return (static_cast<std::uint32_t>(data[0]) << 24) |
+                               (static_cast<std::uint32_t>(data[1]) << 16) |
+                               (static_cast<std::uint32_t>(data[2]) << 8) |
+                               static_cast<std::uint32_t>(data[3]);
+                    }
+
+                    inline std::uint8_t *writeShort(
+                        std::uint8_t *data, std::uint16_t value) noexcept
+                    {
+                        data[0] = static_cast<std::uint8_t>(value >> 8);
+                        data[1] = static_cast<std::uint8_t>(value);
+                        return data + 2;
+                    }
+
+                    inline std::uint8_t *writeInteger(
+                        std::uint8_t *data, std::uint32_t value) noexcept
+                    {
+                        data[0] = static_cast<std::uint8_t>(value >> 24);
+                        data[1] = static_cast<std::uint8_t>(value >> 16);
+                        data[2] = static_cast<std::uint8_t>(value >> 8);
+                        data[3] = static_cast<std::uint8_t>(value);
+                        return data + 4;
+                    }
+
+                    inline bool isIpv4Endpoint(option::OptionType type) noexcept
+                    {
+                        return type == option::OptionType::IPv4Endpoint ||
+                               type == option::OptionType::IPv4Multicast ||
+                               type == option::OptionType::IPv4SdEndpoint;
+                    }
+                }
+
+                bool SdPackedMessage::parseOptions(
+                    const std::uint8_t *data,
+                    std::size_t begin,
+                    std::size_t end)
+                {
+                    std::size_t _offset{begin};
+                    while (_offset < end)
+                    {
+                        if (end - _offset < cOptionHeaderSize + 1U)
+                        {
+                            return false;
+                        }
+
+                        SdOptionRecord _record;
+                        _record.Length = readShort(data + _offset);
+                        _record.Type = static_cast<option::OptionType>(data[_offset + 2U]);
+                        // The length field covers the discardable flag byte.
+                        if (_record.Length == 0U ||
+                            end - _offset - cOptionHeaderSize < _record.Length)
+                        {
+                            return false;
+                        }
+                        _record.Discardable = data[_offset + 3U] != 0U;
+                        _record.Offset = _offset + cOptionHeaderSize + 1U;
+
+                        if (isIpv4Endpoint(_record.Type))
+                        {
+                            if (_record.Length != cIpv4EndpointLength)
+                            {
+                                return false;
+                            }
+
+                            const std::uint8_t *cBody{data + _record.Offset};
+                            _record.Endpoint.Address =
+                                helper::Ipv4Address(cBody[0], cBody[1], cBody[2], cBody[3]);
+                            _record.Endpoint.Protocol =
+                                static_cast<option::Layer4ProtocolType>(cBody[5]);
+                            _record.Endpoint.Port = readShort(cBody + 6);
+                        }
+
+                        mOptions.push_back(_record);
+                        _offset += cOptionHeaderSize + _record.Length;
+                    }
+
+                    return true;
+                }
+
+                bool SdPackedMessage::parseEntries(
+                    const std::uint8_t *data,
+                    std::size_t begin,
+                    std::size_t end)
+                {
+                    const std::size_t cOptionCount{mOptions.size()};
+
+                    for (std::size_t _offset = begin; _offset < end;
+                         _offset += SdMessagePacker::cEntrySize)
+                    {
+                        const std::uint8_t *cEntry{data + _offset};
+
+                        SdEntryRecord _record;
+                        _record.Type = static_cast<entry::EntryType>(cEntry[0]);
+                        _record.FirstOptionIndex = cEntry[1];
+                        _record.SecondOptionIndex = cEntry[2];
+                        _record.FirstOptionCount =
+                            static_cast<std::uint8_t>(cEntry[3] >> entry::Entry::cOptionSizeBitLength);
+                        _record.SecondOptionCount =
+                            static_cast<std::uint8_t>(cEntry[3] & 0x0fU);
+
+                        // Every referenced option run has to exist.
+                        if ((_record.FirstOptionCount > 0U &&
+                             static_cast<std::size_t>(_record.FirstOptionIndex) +
+                                     _record.FirstOptionCount >
+                                 cOptionCount) ||
+                            (_record.SecondOptionCount > 0U &&
+                             static_cast<std::size_t>(_record.SecondOptionIndex) +
+                                     _record.SecondOptionCount >
+                                 cOptionCount))
+                        {
+                            return false;
+                        }
+
+                        _record.ServiceId = readShort(cEntry + 4);
+                        _record.InstanceId = readShort(cEntry + 6);
+                        const std::uint32_t cVersionTtl{readInteger(cEntry + 8)};
+                        _record.MajorVersion =
+                            static_cast<std::uint8_t>(cVersionTtl >> cTtlShift);
+                        _record.Ttl = cVersionTtl & cTtlMask;
+
+                        switch (_record.Type)
+                        {
+                        case entry::EntryType::Finding:
+                        case entry::EntryType::Offering:
+                            _record.MinorVersion = readInteger(cEntry + 12);
+                            break;
+
+                        case entry::EntryType::Subscribing:
+                        case entry::EntryType::Acknowledging:
+                            _record.Counter = static_cast<std::uint8_t>(cEntry[13] & 0x0fU);
+                            _record.EventgroupId = readShort(cEntry + 14);
+                            break;
+
+                        default:
+                            return false;
+                        }
+
+                        mEntries.push_back(_record);
+                    }
+
+                    return true;
+                }
+
+                bool SdPackedMessage::Parse(const std::uint8_t *data, std::size_t length)
+                {
+                    mEntries.clear();
+                    mOptions.clear();
+
+                    const std::size_t cMinimumSize{
+                        SdMessagePacker::cHeaderSize + 4U};
+                    if (data == nullptr || length < cMinimumSize ||
+                        readInteger(data) != cSdMessageId)
+                    {
+                        return false;
+                    }
+
+                    // Trailing bytes beyond the SOME/IP length are ignored.
+                    const std::size_t cLength{readInteger(data + 4)};
+                    if (cLength > length - cLengthCoveredOffset ||
+                        cLength + cLengthCoveredOffset < cMinimumSize)
+                    {
+                        return false;
+                    }
+                    const std::size_t cEnd{cLength + cLengthCoveredOffset};
+
+                    mSessionId = readShort(data + 10);
+                    mRebooted = (data[cSomeIpHeaderSize] & cRebootBit) != 0U;
+
+                    const std::size_t cEntriesBegin{SdMessagePacker::cHeaderSize};
+                    const std::size_t cEntriesLength{readInteger(data + cEntriesBegin - 4U)};
+                    if (cEntriesLength % SdMessagePacker::cEntrySize != 0U ||
+                        cEntriesLength > cEnd - cEntriesBegin - 4U)
+                    {
+                        return false;
+                    }
+                    const std::size_t cEntriesEnd{cEntriesBegin + cEntriesLength};
+
+                    const std::size_t cOptionsBegin{cEntriesEnd + 4U};
+                    const std::size_t cOptionsLength{readInteger(data + cEntriesEnd)};
+                    if (cOptionsLength > cEnd - cOptionsBegin)
+                    {
+                        return false;
+                    }
+
+                    // Options first, so entries can validate their option runs.
+                    if (!parseOptions(data, cOptionsBegin, cOptionsBegin + cOptionsLength) ||
+                        !parseEntries(data, cEntriesBegin, cEntriesEnd))
+                    {
+                        mEntries.clear();
+                        mOptions.clear();
+                        return false;
+                    }
+
+                    return true;
+                }
+
+                bool SdPackedMessage::Parse(const std::vector<std::uint8_t> &payload)
+                {
+                    return Parse(payload.data(), payload.size());
+                }
+
+                std::uint16_t SdPackedMessage::SessionId() const noexcept
+                {
+                    return mSessionId;
+                }
+
+                bool SdPackedMessage::Rebooted() const noexcept
+                {
+                    return mRebooted;
+                }
+
+                const std::vector<SdEntryRecord> &SdPackedMessage::Entries() const noexcept
+                {
+                    return mEntries;
+                }
+
+                const std::vector<SdOptionRecord> &SdPackedMessage::Options() const noexcept
+                {
+                    return mOptions;
+                }
+
+                bool SdPackedMessage::TryGetEndpoint(
+                    const SdEntryRecord &record,
+                    SdEndpoint &endpoint) const noexcept
+                {
+                    const std::size_t cRuns[2][2]{
+                        {record.FirstOptionIndex, record.FirstOptionCount},
+                        {record.SecondOptionIndex, record.SecondOptionCount}};
+
+                    for (const auto &run : cRuns)
+                    {
+                        for (std::size_t i = run[0]; i < run[0] + run[1] && i < mOptions.size(); ++i)
+                        {
+                            if (mOptions[i].Type == option::OptionType::IPv4Endpoint)
+                            {
+                                endpoint = mOptions[i].Endpoint;
+                                return true;
+                            }
+                        }
+                    }
+
+                    return false;
+                }
+
+                const std::size_t SdMessagePacker::cHeaderSize{24U};
+                const std::size_t SdMessagePacker::cEntrySize{16U};
+                const std::size_t SdMessagePacker::cEndpointOptionSize{12U};
+                const std::size_t SdMessagePacker::cDefaultMaxMessageSize{1400U};
+
+                SdMessagePacker::SdMessagePacker(
+                    std::size_t maxMessageSize,
+                    std::size_t maxEntries) : mMaxMessageSize{maxMessageSize},
+                                              mMaxEntries{maxEntries}
+                {
+                }
+
+                void SdMessagePacker::Reset(std::uint16_t sessionId, bool rebooted) noexcept
+                {
+                    mSessionId = sessionId;
+                    mRebooted = rebooted;
+                    mEntries.clear();
+                    mOptions.clear();
+                    mSharedOptions.clear();
+                }
+
+                bool SdMessagePacker::AddServiceEntry(
+                    entry::EntryType type,
+                    std::uint16_t serviceId,
+                    std::uint16_t instanceId,
+                    std::uint8_t majorVersion,
+                    std::uint32_t ttl,
+                    std::uint32_t minorVersion,
+                    const SdEndpoint *endpoint)
+                {
+                    if (mMaxEntries > 0U && EntryCount() >= mMaxEntries)
+                    {
+                        return false;
+                    }
+
+                    const SharedOption *_shared{nullptr};
+                    if (endpoint != nullptr)
+                    {
+                        for (const auto &sharedOption : mSharedOptions)
+                        {
+                            if (sharedOption.Endpoint == *endpoint)
+                            {
+                                _shared = &sharedOption;
+                                break;
+                            }
+                        }
+                    }
+
+                    const bool cNewOption{endpoint != nullptr && _shared == nullptr};
+                    const std::size_t cGrowth{
+                        cEntrySize + (cNewOption ? cEndpointOptionSize : 0U)};
+                    // Option indices are 8-bit.
+                    if (Size() + cGrowth > mMaxMessageSize ||
+                        (cNewOption && mSharedOptions.size() > UINT8_MAX))
+                    {
+                        return false;
+                    }
+
+                    std::uint8_t _optionIndex{0U};
+                    std::uint8_t _optionCount{0U};
+                    if (cNewOption)
+                    {
+                        _optionIndex = static_cast<std::uint8_t>(mSharedOptions.size());
+                        mSharedOptions.push_back(SharedOption{*endpoint, _optionIndex});
+
+                        const std::size_t cOffset{mOptions.size()};
+                        mOptions.resize(cOffset + cEndpointOptionSize);
+                        std::uint8_t *_option{writeShort(&mOptions[cOffset], cIpv4EndpointLength)};
+                        *_option++ = static_cast<std::uint8_t>(option::OptionType::IPv4Endpoint);
+                        *_option++ = 0x00U;
+                        for (std::uint8_t octet : endpoint->Address.Octets)
+                        {
+                            *_option++ = octet;
+                        }
+                        *_option++ = 0x00U;
+                        *_option++ = static_cast<std::uint8_t>(endpoint->Protocol);
+                        writeShort(_option, endpoint->Port);
+                        _optionCount = 1U;
+                    }
+                    else if (_shared != nullptr)
+                    {
+                        _optionIndex = _shared->Index;
+                        _optionCount = 1U;
+                    }
+
+                    const std::size_t cOffset{mEntries.size()};
+                    mEntries.resize(cOffset + cEntrySize);
+                    std::uint8_t *_entry{&mEntries[cOffset]};
+                    _entry[0] = static_cast<std::uint8_t>(type);
+                    _entry[1] = _optionIndex;
+                    _entry[2] = 0x00U;
+                    _entry[3] = static_cast<std::uint8_t>(
+                        _optionCount << entry::Entry::cOptionSizeBitLength);
+                    writeShort(_entry + 4, serviceId);
+                    writeShort(_entry + 6, instanceId);
+                    writeInteger(
+                        _entry + 8,
+                        (static_cast<std::uint32_t>(majorVersion) << cTtlShift) |
+                            (ttl & cTtlMask));
+                    writeInteger(_entry + 12, minorVersion);
+
+                    return true;
+                }
+
+                std::size_t SdMessagePacker::EntryCount() const noexcept
+                {
+                    return mEntries.size() / cEntrySize;
+                }
+
+                std::size_t SdMessagePacker::OptionCount() const noexcept
+                {
+                    return mSharedOptions.size();
+                }
+
+                std::size_t SdMessagePacker::Size() const noexcept
+                {
+                    // Header, entries, options length field, options
+                    return cHeaderSize + mEntries.size() + 4U + mOptions.size();
+                }
+
+                void SdMessagePacker::Finish(std::vector<std::uint8_t> &message) const
+                {
+                    const std::uint8_t cProtocolVersion{0x01U};
+                    const std::uint8_t cInterfaceVersion{0x01U};
+                    const std::uint8_t cNotification{0x02U};
+
+                    message.resize(Size());
+                    std::uint8_t *_cursor{message.data()};
+                    _cursor = writeInteger(_cursor, cSdMessageId);
+                    _cursor = writeInteger(
+                        _cursor, static_cast<std::uint32_t>(Size() - cLengthCoveredOffset));
+                    // Client ID 0 and the session ID
+                    _cursor = writeShort(_cursor, 0x0000U);
+                    _cursor = writeShort(_cursor, mSessionId);
+                    *_cursor++ = cProtocolVersion;
+                    *_cursor++ = cInterfaceVersion;
+                    *_cursor++ = cNotification;
+                    *_cursor++ = 0x00U;
+
+                    // Unicast support is always announced.
+                    *_cursor++ = static_cast<std::uint8_t>(
+                        (mRebooted ? cRebootBit : 0x00U) | cUnicastBit);
+                    *_cursor++ = 0x00U;
+                    *_cursor++ = 0x00U;
+                    *_cursor++ = 0x00U;
+
+                    _cursor = writeInteger(_cursor, static_cast<std::uint32_t>(mEntries.size()));
+                    _cursor = std::copy(mEntries.begin(), mEntries.end(), _cursor);
+                    _cursor = writeInteger(_cursor, static_cast<std::uint32_t>(mOptions.size()));
+                    std::copy(mOptions.begin(), mOptions.end(), _cursor);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,218 @@
+/// @file src/ara/com/someip/sd/sd_packed_message.h
+/// @brief Flat SOME/IP-SD message parser and multi-entry packer.
+/// @details SomeIpSdMessage models every entry and option as its own heap
+///          object, which is convenient for a single service but costly for
+///          a node that offers or tracks dozens of them. SdPackedMessage
+///          parses an SD message into two flat record arrays that are reused
+///          from one message to the next, and SdMessagePacker writes many
+///          service entries into one message, sharing a single endpoint
+///          option between all entries that announce the same endpoint.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_COM_SOMEIP_SD_PACKED_MESSAGE_H
+#define ARA_COM_SOMEIP_SD_PACKED_MESSAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../../entry/entry.h"
+#include "../../helper/ipv4_address.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                /// @brief IPv4 endpoint announced by a service entry
+                struct SdEndpoint
+                {
+                    /// @brief Unicast IPv4 address
+                    helper::Ipv4Address Address{0U, 0U, 0U, 0U};
+
+                    /// @brief Transport protocol
+                    option::Layer4ProtocolType Protocol{option::Layer4ProtocolType::Udp};
+
+                    /// @brief Transport port
+                    std::uint16_t Port{0U};
+                };
+
+                /// @brief Equality of two SD endpoints
+                inline bool operator==(const SdEndpoint &lhs, const SdEndpoint &rhs) noexcept
+                {
+                    return lhs.Address == rhs.Address &&
+                           lhs.Protocol == rhs.Protocol &&
+                           lhs.Port == rhs.Port;
+                }
+
+                /// @brief One entry of a parsed SD message
+                struct SdEntryRecord
+                {
+                    entry::EntryType Type{entry::EntryType::Finding};
+                    /// @brief Index of the first option of the first run
+                    std::uint8_t FirstOptionIndex{0U};
+                    /// @brief Index of the first option of the second run
+                    std::uint8_t SecondOptionIndex{0U};
+                    std::uint8_t FirstOptionCount{0U};
+                    std::uint8_t SecondOptionCount{0U};
+                    std::uint16_t ServiceId{0U};
+                    std::uint16_t InstanceId{0U};
+                    std::uint8_t MajorVersion{0U};
+                    /// @brief Time to live in seconds (24 bits)
+                    std::uint32_t Ttl{0U};
+                    /// @brief Minor version; service entries only
+                    std::uint32_t MinorVersion{0U};
+                    /// @brief Eventgroup ID; eventgroup entries only
+                    std::uint16_t EventgroupId{0U};
+                    /// @brief Subscription counter; eventgroup entries only
+                    std::uint8_t Counter{0U};
+                };
+
+                /// @brief One option of a parsed SD message
+                struct SdOptionRecord
+                {
+                    option::OptionType Type{option::OptionType::Configuration};
+                    bool Discardable{false};
+                    /// @brief Option length field value
+                    std::uint16_t Length{0U};
+                    /// @brief Offset of the option body in the parsed buffer
+                    std::size_t Offset{0U};
+                    /// @brief Decoded endpoint; valid for IPv4 endpoint options only
+                    SdEndpoint Endpoint;
+                };
+
+                /// @brief SD message parsed into flat, reusable record arrays
+                /// @note Parsing does not allocate once the arrays have grown
+                ///       to the largest message seen.
+                class SdPackedMessage
+                {
+                private:
+                    std::uint16_t mSessionId{0U};
+                    bool mRebooted{false};
+                    std::vector<SdEntryRecord> mEntries;
+                    std::vector<SdOptionRecord> mOptions;
+
+                    bool parseOptions(
+                        const std::uint8_t *data,
+                        std::size_t begin,
+                        std::size_t end);
+
+                    bool parseEntries(
+                        const std::uint8_t *data,
+                        std::size_t begin,
+                        std::size_t end);
+
+                public:
+                    /// @brief Parse a serialized SD message
+                    /// @param data Message bytes including the SOME/IP header
+                    /// @param length Number of bytes at @p data
+                    /// @returns False if the message is truncated or malformed,
+                    ///          in which case no entry is exposed
+                    bool Parse(const std::uint8_t *data, std::size_t length);
+
+                    /// @brief Parse a serialized SD message
+                    bool Parse(const std::vector<std::uint8_t> &payload);
+
+                    /// @brief Session ID of the last parsed message
+                    std::uint16_t SessionId() const noexcept;
+
+                    /// @brief Reboot flag of the last parsed message
+                    bool Rebooted() const noexcept;
+
+                    /// @brief Entries of the last parsed message
+                    const std::vector<SdEntryRecord> &Entries() const noexcept;
+
+                    /// @brief Options of the last parsed message
+                    const std::vector<SdOptionRecord> &Options() const noexcept;
+
+                    /// @brief Find the first IPv4 unicast endpoint an entry refers to
+                    /// @param record Entry of the last parsed message
+                    /// @param[out] endpoint Decoded endpoint
+                    /// @returns False if neither option run holds such an option
+                    bool TryGetEndpoint(
+                        const SdEntryRecord &record,
+                        SdEndpoint &endpoint) const noexcept;
+                };
+
+                /// @brief Packs service entries of many services into SD messages
+                /// @details All entries announcing the same endpoint reference one
+                ///          shared endpoint option run instead of repeating it.
+                class SdMessagePacker
+                {
+                private:
+                    struct SharedOption
+                    {
+                        SdEndpoint Endpoint;
+                        std::uint8_t Index;
+                    };
+
+                    const std::size_t mMaxMessageSize;
+                    const std::size_t mMaxEntries;
+                    std::uint16_t mSessionId{1U};
+                    bool mRebooted{true};
+                    std::vector<std::uint8_t> mEntries;
+                    std::vector<std::uint8_t> mOptions;
+                    std::vector<SharedOption> mSharedOptions;
+
+                public:
+                    /// @brief Serialized size of the SOME/IP and SD headers
+                    static const std::size_t cHeaderSize;
+                    /// @brief Serialized size of one entry
+                    static const std::size_t cEntrySize;
+                    /// @brief Serialized size of one IPv4 endpoint option
+                    static const std::size_t cEndpointOptionSize;
+                    /// @brief Default message size limit that fits an Ethernet MTU
+                    static const std::size_t cDefaultMaxMessageSize;
+
+                    /// @brief Constructor
+                    /// @param maxMessageSize Upper bound of a packed message in bytes
+                    /// @param maxEntries Upper bound of entries per message (0 = unlimited)
+                    explicit SdMessagePacker(
+                        std::size_t maxMessageSize = cDefaultMaxMessageSize,
+                        std::size_t maxEntries = 0U);
+
+                    /// @brief Drop the packed entries and start a new message
+                    /// @param sessionId Session ID of the new message
+                    /// @param rebooted Reboot flag of the new message
+                    void Reset(std::uint16_t sessionId, bool rebooted) noexcept;
+
+                    /// @brief Append a service (find/offer) entry
+                    /// @param type Finding or Offering
+                    /// @param serviceId Service ID
+                    /// @param instanceId Instance ID
+                    /// @param majorVersion Major version
+                    /// @param ttl Time to live in seconds; 0 stops an offer
+                    /// @param minorVersion Minor version
+                    /// @param endpoint Endpoint to announce, or nullptr for none
+                    /// @returns False if the entry does not fit into the message
+                    bool AddServiceEntry(
+                        entry::EntryType type,
+                        std::uint16_t serviceId,
+                        std::uint16_t instanceId,
+                        std::uint8_t majorVersion,
+                        std::uint32_t ttl,
+                        std::uint32_t minorVersion,
+                        const SdEndpoint *endpoint);
+
+                    /// @brief Number of packed entries
+                    std::size_t EntryCount() const noexcept;
+
+                    /// @brief Number of packed (shared) options
+                    std::size_t OptionCount() const noexcept;
+
+                    /// @brief Serialized size of the packed message
+                    std::size_t Size() const noexcept;
+
+                    /// @brief Serialize the packed message
+                    /// @param[out] message Replaced by the serialized message
+                    void Finish(std::vector<std::uint8_t> &message) const;
+                };
+            }
+        }
+    }
+}
+
+#endif
@@ -13,8 +13,9 @@ namespace ara
     {
         namespace someip
         {
-            std::vector<TpSegment> SegmentPayload(
-                const std::vector<uint8_t> &payload,
+            std::vector<TpSegmentView> SegmentPayloadViews(
+                const uint8_t *payload,
+                std::size_t size,
                 std::size_t maxSegmentPayload)
             {
                 // Per PRS_SOMEIP_00724 the segment payload size must be
@@ -25,41 +26,64 @@ namespace ara
                         "maxSegmentPayload must be a positive multiple of 16");
                 }
 
-                std::vector<TpSegment> segments;
+                std::vector<TpSegmentView> segments;
 
-                if (payload.empty())
+                if (size == 0U)
                 {
                     // Edge case: empty payload → single segment with no data
-                    TpSegment seg;
-                    seg.Offset = 0U;
-                    seg.MoreSegments = false;
-                    segments.push_back(std::move(seg));
+                    TpSegmentView seg;
+                    seg.Data = payload;
+                    segments.push_back(seg);
                     return segments;
                 }
 
+                segments.reserve((size + maxSegmentPayload - 1U) / maxSegmentPayload);
+
                 std::size_t offset = 0U;
-                while (offset < payload.size())
+                while (offset < size)
                 {
-                    const std::size_t remaining = payload.size() - offset;
                     const std::size_t chunkSize =
-                        std::min(maxSegmentPayload, remaining);
+                        std::min(maxSegmentPayload, size - offset);
 
-                    TpSegment seg;
+                    TpSegmentView seg;
                     seg.Offset = static_cast<uint32_t>(offset);
-                    seg.MoreSegments = (offset + chunkSize) < payload.size();
-                    seg.Payload.assign(
-                        payload.begin() + offset,
-                        payload.begin() + offset + chunkSize);
+                    seg.MoreSegments = (offset + chunkSize) < size;
+                    seg.Data = payload + offset;
+                    seg.Length = chunkSize;
 
-                    segments.push_back(std::move(seg));
+                    segments.push_back(seg);
                     offset += chunkSize;
                 }
 
                 return segments;
             }
 
-            TpReassembler::TpReassembler(std::chrono::seconds timeout) noexcept
-                : mTimeout{timeout}
+            std::vector<TpSegment> SegmentPayload(
+                const std::vector<uint8_t> &payload,
+                std::size_t maxSegmentPayload)
+            {
+                const std::vector<TpSegmentView> views =
+                    SegmentPayloadViews(payload.data(), payload.size(), maxSegmentPayload);
+
+                std::vector<TpSegment> segments;
+                segments.reserve(views.size());
+                for (const auto &view : views)
+                {
+                    TpSegment seg;
+                    seg.Offset = view.Offset;
+                    seg.MoreSegments = view.MoreSegments;
+                    seg.Payload.assign(view.Data, view.Data + view.Length);
+                    segments.push_back(std::move(seg));
+                }
+
+                return segments;
+            }
+
+            TpReassembler::TpReassembler(
+                std::chrono::seconds timeout,
+                std::size_t maxPayloadSize) noexcept
+                : mMaxPayloadSize{maxPayloadSize},
+                  mTimeout{timeout}
             {
             }
 
@@ -68,25 +92,94 @@ namespace ara
                 bool moreSegments,
                 const std::vector<uint8_t> &segmentPayload)
             {
+                AddSegment(
+                    offset, moreSegments, segmentPayload.data(), segmentPayload.size());
+            }
+
+            bool TpReassembler::AddSegment(
+                uint32_t offset,
+                bool moreSegments,
+                const uint8_t *data,
+                std::size_t length)
+            {
+                const std::size_t end = static_cast<std::size_t>(offset) + length;
+                if (mMaxPayloadSize != 0U && end > mMaxPayloadSize)
+                {
+                    return false;
+                }
+
                 if (!mStarted)
                 {
                     mFirstSegmentTime = std::chrono::steady_clock::now();
                     mStarted = true;
                 }
 
-                mSegments[offset] = segmentPayload;
+                if (end > mBuffer.size())
+                {
+                    mBuffer.resize(end);
+                }
+                if (length > 0U)
+                {
+                    std::memcpy(mBuffer.data() + offset, data, length);
+                }
+
+                // Segments mostly arrive in order, so this is usually an append.
+                auto it = std::lower_bound(
+                    mSegments.begin(), mSegments.end(), offset,
+                    [](const std::pair<uint32_t, uint32_t> &segment, uint32_t value)
+                    {
+                        return segment.first < value;
+                    });
+                if (it != mSegments.end() && it->first == offset)
+                {
+                    // A repeated offset replaces the earlier segment.
+                    mReceivedBytes -= it->second;
+                    it->second = static_cast<uint32_t>(length);
+                }
+                else
+                {
+                    mSegments.emplace(it, offset, static_cast<uint32_t>(length));
+                }
+                mReceivedBytes += length;
 
                 if (!moreSegments)
                 {
                     mLastSegmentReceived = true;
-                    mExpectedSize =
-                        static_cast<std::size_t>(offset) + segmentPayload.size();
+                    mExpectedSize = end;
+                }
+
+                return true;
+            }
+
+            void TpReassembler::Reserve(std::size_t expectedSize)
+            {
+                if (mMaxPayloadSize != 0U)
+                {
+                    expectedSize = std::min(expectedSize, mMaxPayloadSize);
                 }
+                mBuffer.reserve(expectedSize);
+            }
+
+            bool TpReassembler::HasSegmentAt(uint32_t offset) const noexcept
+            {
+                auto it = std::lower_bound(
+                    mSegments.begin(), mSegments.end(), offset,
+                    [](const std::pair<uint32_t, uint32_t> &segment, uint32_t value)
+                    {
+                        return segment.first < value;
+                    });
+                return it != mSegments.end() && it->first == offset;
+            }
+
+            std::size_t TpReassembler::BufferedBytes() const noexcept
+            {
+                return mBuffer.capacity();
             }
 
             bool TpReassembler::IsComplete() const noexcept
             {
-                if (!mLastSegmentReceived)
+                // Cheap pre-check before walking the ranges.
+                if (!mLastSegmentReceived || mReceivedBytes < mExpectedSize)
                 {
                     return false;
                 }
@@ -99,7 +192,7 @@ namespace ara
                     {
                         return false; // gap detected
                     }
-                    covered += entry.second.size();
+                    covered += entry.second;
                 }
 
                 return covered == mExpectedSize;
@@ -114,23 +207,31 @@ namespace ara
                         "segments are available");
                 }
 
-                std::vector<uint8_t> result;
-                result.reserve(mExpectedSize);
+                return std::vector<uint8_t>(
+                    mBuffer.begin(),
+                    mBuffer.begin() + static_cast<std::ptrdiff_t>(mExpectedSize));
+            }
 
-                for (const auto &entry : mSegments)
+            std::vector<uint8_t> TpReassembler::TakePayload()
+            {
+                if (!IsComplete())
                 {
-                    result.insert(
-                        result.end(),
-                        entry.second.begin(),
-                        entry.second.end());
+                    throw std::logic_error(
+                        "TpReassembler::TakePayload() called before all "
+                        "segments are available");
                 }
 
+                std::vector<uint8_t> result{std::move(mBuffer)};
+                result.resize(mExpectedSize);
+                Reset();
                 return result;
             }
 
             void TpReassembler::Reset() noexcept
             {
+                mBuffer.clear();
                 mSegments.clear();
+                mReceivedBytes = 0U;
                 mLastSegmentReceived = false;
                 mExpectedSize = 0U;
                 mStarted = false;
@@ -10,8 +10,9 @@
 #define ARA_COM_SOMEIP_SOMEIP_TP_H
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
-#include <map>
+#include <utility>
 #include <vector>
 
 namespace ara
@@ -37,15 +38,47 @@ namespace ara
                 std::vector<uint8_t> Payload;
             };
 
+            /// @brief SOME/IP-TP segment as a view into the caller's payload.
+            /// @details Data/Length form an iovec-style entry that can go straight
+            ///          into a scatter/gather send next to the SOME/IP and TP headers.
+            struct TpSegmentView
+            {
+                /// @brief Byte offset of this segment within the reassembled payload.
+                uint32_t Offset{0U};
+
+                /// @brief True if more segments follow.
+                bool MoreSegments{false};
+
+                /// @brief First segment byte inside the original payload.
+                const uint8_t *Data{nullptr};
+
+                /// @brief Segment length in bytes.
+                std::size_t Length{0U};
+            };
+
             /// @brief Split a large payload into SOME/IP-TP segments.
             /// @param payload Full payload to segment
             /// @param maxSegmentPayload Maximum per-segment payload size
             ///        (must be a multiple of 16; default 1392)
             /// @returns Ordered vector of TpSegment descriptors
+            /// @note Copies every byte; prefer SegmentPayloadViews() on hot paths.
             std::vector<TpSegment> SegmentPayload(
                 const std::vector<uint8_t> &payload,
                 std::size_t maxSegmentPayload = cDefaultTpSegmentSize);
 
+            /// @brief Split a payload into segment views without copying it.
+            /// @param payload Full payload to segment
+            /// @param size Payload size in bytes
+            /// @param maxSegmentPayload Maximum per-segment payload size
+            ///        (must be a multiple of 16; default 1392)
+            /// @returns Ordered segment views, valid while the payload is
+            /// @throws std::invalid_argument If the segment size is not a
+            ///         positive multiple of 16
+            std::vector<TpSegmentView> SegmentPayloadViews(
+                const uint8_t *payload,
+                std::size_t size,
+                std::size_t maxSegmentPayload = cDefaultTpSegmentSize);
+
             /// @brief Default SOME/IP-TP reassembly timeout (seconds).
             ///        Per PRS_SOMEIP_00730, incomplete reassembly should be
             ///        discarded after a configurable timeout.
@@ -53,11 +86,24 @@ namespace ara
 
             /// @brief Stateful reassembler that collects SOME/IP-TP segments
             ///        and reconstructs the original payload.
+            /// @details Every segment is copied once, straight to its offset in a
+            ///          single destination buffer. The buffer is sized by the
+            ///          highest offset seen so far, which is the full payload as
+            ///          soon as the last segment arrives, or up front by Reserve().
             class TpReassembler
             {
             private:
-                /// @brief Collected segments keyed by byte offset.
-                std::map<uint32_t, std::vector<uint8_t>> mSegments;
+                /// @brief Destination buffer for the reassembled payload.
+                std::vector<uint8_t> mBuffer;
+
+                /// @brief Received ranges as (offset, length), sorted by offset.
+                std::vector<std::pair<uint32_t, uint32_t>> mSegments;
+
+                /// @brief Sum of the lengths in mSegments.
+                std::size_t mReceivedBytes{0U};
+
+                /// @brief Largest payload this reassembler will buffer.
+                std::size_t mMaxPayloadSize{0U};
 
                 /// @brief True once the final segment (more=false) has been received.
                 bool mLastSegmentReceived{false};
@@ -79,7 +125,10 @@ namespace ara
 
                 /// @brief Constructor with configurable timeout.
                 /// @param timeout Reassembly timeout duration
-                explicit TpReassembler(std::chrono::seconds timeout) noexcept;
+                /// @param maxPayloadSize Largest payload to accept (0 = unlimited)
+                explicit TpReassembler(
+                    std::chrono::seconds timeout,
+                    std::size_t maxPayloadSize = 0U) noexcept;
 
                 /// @brief Feed a segment into the reassembler.
                 /// @param offset Byte offset from the TP header
@@ -89,6 +138,28 @@ namespace ara
                                 bool moreSegments,
                                 const std::vector<uint8_t> &segmentPayload);
 
+                /// @brief Copy a segment to its place in the destination buffer.
+                /// @param offset Byte offset from the TP header
+                /// @param moreSegments More-segments flag from the TP header
+                /// @param data Segment payload bytes
+                /// @param length Segment payload length
+                /// @returns False if the segment would exceed the payload limit;
+                ///          the reassembler is left unchanged then.
+                bool AddSegment(uint32_t offset,
+                                bool moreSegments,
+                                const uint8_t *data,
+                                std::size_t length);
+
+                /// @brief Size the destination buffer for an expected payload.
+                /// @param expectedSize Payload size known from configuration
+                void Reserve(std::size_t expectedSize);
+
+                /// @brief Check whether a segment starting at an offset was received.
+                bool HasSegmentAt(uint32_t offset) const noexcept;
+
+                /// @brief Bytes allocated for the destination buffer.
+                std::size_t BufferedBytes() const noexcept;
+
                 /// @brief Check whether all segments have been received
                 ///        and the payload can be reassembled.
                 /// @returns True when the full payload is available.
@@ -107,6 +178,11 @@ namespace ara
                 /// @returns The reassembled payload byte vector.
                 std::vector<uint8_t> Reassemble() const;
 
+                /// @brief Move the reassembled payload out without copying it.
+                /// @pre IsComplete() must return true.
+                /// @returns The reassembled payload; the reassembler is reset.
+                std::vector<uint8_t> TakePayload();
+
                 /// @brief Reset the reassembler to accept a new message.
                 void Reset() noexcept;
             };
@@ -12,10 +12,81 @@ namespace ara
         {
             TpReassemblyManager::TpReassemblyManager(
                 std::chrono::seconds timeout) noexcept
-                : mTimeout{timeout}
+                : TpReassemblyManager(timeout, TpReassemblyLimits{})
             {
             }
 
+            TpReassemblyManager::TpReassemblyManager(
+                std::chrono::seconds timeout,
+                const TpReassemblyLimits &limits) noexcept
+                : mTimeout{timeout},
+                  mLimits(limits)
+            {
+            }
+
+            std::size_t TpReassemblyManager::shardIndex(
+                const TpStreamKey &key) noexcept
+            {
+                // Mix the key first: std::hash<uint64_t> is often the identity.
+                const std::uint64_t hash{
+                    static_cast<std::uint64_t>(TpStreamKeyHash{}(key)) *
+                    0x9E3779B97F4A7C15ULL};
+                return static_cast<std::size_t>(hash >> 32U) % cShardCount;
+            }
+
+            void TpReassemblyManager::eraseStream(
+                Shard &shard,
+                std::unordered_map<TpStreamKey, Stream, TpStreamKeyHash>::iterator it) noexcept
+            {
+                mBufferedBytes.fetch_sub(it->second.AccountedBytes);
+                mStreamCount.fetch_sub(1U);
+                shard.Streams.erase(it);
+            }
+
+            bool TpReassemblyManager::evictOldest(
+                Shard &shard, const TpStreamKey &keep) noexcept
+            {
+                // The caller holds its own shard; the others are only tried,
+                // so two evicting threads cannot deadlock on each other.
+                std::array<std::unique_lock<std::mutex>, cShardCount> locks;
+                Shard *oldestShard{nullptr};
+                auto oldest = shard.Streams.end();
+
+                for (std::size_t index = 0U; index < cShardCount; ++index)
+                {
+                    Shard &candidate = mShards[index];
+                    if (&candidate != &shard)
+                    {
+                        locks[index] = std::unique_lock<std::mutex>(
+                            candidate.Mutex, std::try_to_lock);
+                        if (!locks[index].owns_lock())
+                        {
+                            continue;
+                        }
+                    }
+
+                    for (auto it = candidate.Streams.begin();
+                         it != candidate.Streams.end(); ++it)
+                    {
+                        if (!(it->first == keep) &&
+                            (oldestShard == nullptr ||
+                             it->second.Created < oldest->second.Created))
+                        {
+                            oldestShard = &candidate;
+                            oldest = it;
+                        }
+                    }
+                }
+
+                if (oldestShard == nullptr)
+                {
+                    return false;
+                }
+                eraseStream(*oldestShard, oldest);
+                mEvictedStreams.fetch_add(1U);
+                return true;
+            }
+
             bool TpReassemblyManager::FeedSegment(
                 const TpStreamKey &key,
                 std::uint32_t offset,
@@ -23,31 +94,98 @@ namespace ara
                 const std::vector<std::uint8_t> &segmentPayload,
                 TpReassemblyCallback callback)
             {
-                std::lock_guard<std::mutex> lock(mMutex);
+                return FeedSegment(
+                    key, offset, moreSegments,
+                    segmentPayload.data(), segmentPayload.size(),
+                    std::move(callback));
+            }
+
+            bool TpReassemblyManager::FeedSegment(
+                const TpStreamKey &key,
+                std::uint32_t offset,
+                bool moreSegments,
+                const std::uint8_t *data,
+                std::size_t length,
+                TpReassemblyCallback callback)
+            {
+                Shard &shard = mShards[shardIndex(key)];
+                std::vector<std::uint8_t> payload;
+                bool completed = false;
 
-                auto it = mStreams.find(key);
-                if (it == mStreams.end())
                 {
-                    auto result = mStreams.emplace(
-                        key, TpReassembler{mTimeout});
-                    it = result.first;
-                }
+                    std::lock_guard<std::mutex> lock(shard.Mutex);
 
-                auto &reassembler = it->second;
+                    auto it = shard.Streams.find(key);
+                    if (static_cast<std::size_t>(offset) + length > mLimits.MaxStreamBytes)
+                    {
+                        // The stream can never complete within bounds.
+                        if (it != shard.Streams.end())
+                        {
+                            eraseStream(shard, it);
+                        }
+                        mOversizedStreams.fetch_add(1U);
+                        return false;
+                    }
 
-                // Duplicate segment detection
-                // Check existing map entries in the reassembler
-                // We track this externally since TpReassembler doesn't expose its map
-                reassembler.AddSegment(offset, moreSegments, segmentPayload);
+                    if (it == shard.Streams.end())
+                    {
+                        while (mStreamCount.load() >= mLimits.MaxStreams &&
+                               evictOldest(shard, key))
+                        {
+                        }
+                        if (mStreamCount.load() >= mLimits.MaxStreams)
+                        {
+                            mRejectedStreams.fetch_add(1U);
+                            return false;
+                        }
 
-                if (reassembler.IsComplete())
-                {
-                    if (callback)
+                        Stream stream{
+                            TpReassembler{mTimeout, mLimits.MaxStreamBytes},
+                            std::chrono::steady_clock::now(),
+                            0U};
+                        it = shard.Streams.emplace(key, std::move(stream)).first;
+                        mStreamCount.fetch_add(1U);
+                    }
+                    else if (it->second.Reassembler.HasSegmentAt(offset))
+                    {
+                        mDuplicateSegments.fetch_add(1U);
+                        return false;
+                    }
+
+                    Stream &stream = it->second;
+                    stream.Reassembler.AddSegment(offset, moreSegments, data, length);
+
+                    const std::size_t buffered = stream.Reassembler.BufferedBytes();
+                    mBufferedBytes.fetch_add(buffered - stream.AccountedBytes);
+                    stream.AccountedBytes = buffered;
+
+                    while (mBufferedBytes.load() > mLimits.MaxTotalBytes &&
+                           evictOldest(shard, key))
+                    {
+                    }
+                    if (mBufferedBytes.load() > mLimits.MaxTotalBytes)
+                    {
+                        eraseStream(shard, it);
+                        mRejectedStreams.fetch_add(1U);
+                        return false;
+                    }
+
+                    if (stream.Reassembler.IsComplete())
                     {
-                        auto payload = reassembler.Reassemble();
-                        callback(key, std::move(payload));
+                        if (callback)
+                        {
+                            payload = stream.Reassembler.TakePayload();
+                        }
+                        eraseStream(shard, it);
+                        mCompletedStreams.fetch_add(1U);
+                        completed = true;
                     }
-                    mStreams.erase(it);
+                }
+
+                // Deliver outside the lock so the callback may feed the manager.
+                if (completed && callback)
+                {
+                    callback(key, std::move(payload));
                 }
 
                 return true;
@@ -55,57 +193,81 @@ namespace ara
 
             std::size_t TpReassemblyManager::CleanupTimedOut() noexcept
             {
-                std::lock_guard<std::mutex> lock(mMutex);
                 std::size_t removed = 0U;
 
-                for (auto it = mStreams.begin(); it != mStreams.end();)
+                for (auto &shard : mShards)
                 {
-                    if (it->second.IsTimedOut())
-                    {
-                        it = mStreams.erase(it);
-                        ++removed;
-                    }
-                    else
+                    std::lock_guard<std::mutex> lock(shard.Mutex);
+                    for (auto it = shard.Streams.begin(); it != shard.Streams.end();)
                     {
-                        ++it;
+                        if (it->second.Reassembler.IsTimedOut())
+                        {
+                            auto expired = it++;
+                            eraseStream(shard, expired);
+                            ++removed;
+                        }
+                        else
+                        {
+                            ++it;
+                        }
                     }
                 }
 
+                mTimedOutStreams.fetch_add(removed);
                 return removed;
             }
 
             std::size_t TpReassemblyManager::ActiveStreamCount() const noexcept
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                return mStreams.size();
+                return mStreamCount.load();
             }
 
             bool TpReassemblyManager::HasSegmentAt(
                 const TpStreamKey &key,
                 std::uint32_t offset) const noexcept
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                auto it = mStreams.find(key);
-                if (it == mStreams.end())
-                {
-                    return false;
-                }
-                // We cannot directly query TpReassembler for a specific offset,
-                // but we can check if the stream exists and has segments
-                return it->second.SegmentCount() > 0U;
+                const Shard &shard = mShards[shardIndex(key)];
+                std::lock_guard<std::mutex> lock(shard.Mutex);
+                auto it = shard.Streams.find(key);
+                return it != shard.Streams.end() &&
+                       it->second.Reassembler.HasSegmentAt(offset);
             }
 
             void TpReassemblyManager::RemoveStream(
                 const TpStreamKey &key) noexcept
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                mStreams.erase(key);
+                Shard &shard = mShards[shardIndex(key)];
+                std::lock_guard<std::mutex> lock(shard.Mutex);
+                auto it = shard.Streams.find(key);
+                if (it != shard.Streams.end())
+                {
+                    eraseStream(shard, it);
+                }
             }
 
             void TpReassemblyManager::Clear() noexcept
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                mStreams.clear();
+                for (auto &shard : mShards)
+                {
+                    std::lock_guard<std::mutex> lock(shard.Mutex);
+                    while (!shard.Streams.empty())
+                    {
+                        eraseStream(shard, shard.Streams.begin());
+                    }
+                }
+            }
+
+            TpReassemblyStatistics TpReassemblyManager::GetStatistics() const noexcept
+            {
+                TpReassemblyStatistics statistics;
+                statistics.CompletedStreams = mCompletedStreams.load();
+                statistics.TimedOutStreams = mTimedOutStreams.load();
+                statistics.EvictedStreams = mEvictedStreams.load();
+                statistics.RejectedStreams = mRejectedStreams.load();
+                statistics.OversizedStreams = mOversizedStreams.load();
+                statistics.DuplicateSegments = mDuplicateSegments.load();
+                statistics.BufferedBytes = mBufferedBytes.load();
+                return statistics;
             }
         }
     }
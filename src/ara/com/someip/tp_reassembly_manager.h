@@ -7,11 +7,16 @@
 ///          timeout cleanup, duplicate segment detection, and stream
 ///          lifecycle management.
 ///
+///          Streams are spread over independently locked shards by key
+///          hash, and buffered memory is bounded per stream and in total.
+///
 ///          This file is part of the Adaptive AUTOSAR educational implementation.
 
 #ifndef ARA_COM_SOMEIP_TP_REASSEMBLY_MANAGER_H
 #define ARA_COM_SOMEIP_TP_REASSEMBLY_MANAGER_H
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <functional>
@@ -66,14 +71,88 @@ namespace ara
                 const TpStreamKey &key,
                 std::vector<std::uint8_t> payload)>;
 
+            /// @brief Memory bounds of a TpReassemblyManager.
+            struct TpReassemblyLimits
+            {
+                /// @brief Largest payload a single stream may reassemble.
+                std::size_t MaxStreamBytes{16U * 1024U * 1024U};
+
+                /// @brief Buffered bytes across all streams before eviction.
+                std::size_t MaxTotalBytes{64U * 1024U * 1024U};
+
+                /// @brief Concurrent streams before eviction.
+                std::size_t MaxStreams{256U};
+            };
+
+            /// @brief Counters describing a TpReassemblyManager's activity.
+            struct TpReassemblyStatistics
+            {
+                /// @brief Streams delivered in full.
+                std::uint64_t CompletedStreams{0U};
+                /// @brief Streams dropped by CleanupTimedOut().
+                std::uint64_t TimedOutStreams{0U};
+                /// @brief Oldest streams dropped to admit new data.
+                std::uint64_t EvictedStreams{0U};
+                /// @brief Streams refused or dropped because no other stream
+                ///        could be evicted to stay within the limits.
+                std::uint64_t RejectedStreams{0U};
+                /// @brief Streams dropped for exceeding MaxStreamBytes.
+                std::uint64_t OversizedStreams{0U};
+                /// @brief Segments ignored because their offset was already received.
+                std::uint64_t DuplicateSegments{0U};
+                /// @brief Bytes currently held by stream buffers.
+                std::size_t BufferedBytes{0U};
+            };
+
             /// @brief Manages multiple concurrent SOME/IP-TP reassembly streams.
-            ///        Thread-safe — all public methods are mutex-protected.
+            ///        Thread-safe — streams live in independently locked shards,
+            ///        so segments of different streams rarely contend.
+            /// @note Eviction drops the oldest stream of all shards. Shards
+            ///       that another thread holds are skipped rather than
+            ///       waited for, so eviction never blocks on a second lock.
             class TpReassemblyManager
             {
             private:
-                std::unordered_map<TpStreamKey, TpReassembler, TpStreamKeyHash> mStreams;
+                static constexpr std::size_t cShardCount{16U};
+
+                struct Stream
+                {
+                    TpReassembler Reassembler;
+                    std::chrono::steady_clock::time_point Created;
+                    std::size_t AccountedBytes{0U};
+                };
+
+                struct Shard
+                {
+                    mutable std::mutex Mutex;
+                    std::unordered_map<TpStreamKey, Stream, TpStreamKeyHash> Streams;
+                };
+
+                std::array<Shard, cShardCount> mShards;
                 std::chrono::seconds mTimeout;
-                mutable std::mutex mMutex;
+                TpReassemblyLimits mLimits;
+
+                std::atomic<std::size_t> mStreamCount{0U};
+                std::atomic<std::size_t> mBufferedBytes{0U};
+                std::atomic<std::uint64_t> mCompletedStreams{0U};
+                std::atomic<std::uint64_t> mTimedOutStreams{0U};
+                std::atomic<std::uint64_t> mEvictedStreams{0U};
+                std::atomic<std::uint64_t> mRejectedStreams{0U};
+                std::atomic<std::uint64_t> mOversizedStreams{0U};
+                std::atomic<std::uint64_t> mDuplicateSegments{0U};
+
+                static std::size_t shardIndex(const TpStreamKey &key) noexcept;
+
+                /// @brief Drop a stream and release its accounted bytes.
+                void eraseStream(
+                    Shard &shard,
+                    std::unordered_map<TpStreamKey, Stream, TpStreamKeyHash>::iterator it) noexcept;
+
+                /// @brief Evict the oldest stream other than @p keep.
+                /// @param shard Shard of @p keep, already locked by the caller
+                /// @param keep Stream that must survive
+                /// @returns False if no stream could be evicted
+                bool evictOldest(Shard &shard, const TpStreamKey &keep) noexcept;
 
             public:
                 /// @brief Constructor with configurable timeout.
@@ -81,6 +160,13 @@ namespace ara
                 explicit TpReassemblyManager(
                     std::chrono::seconds timeout = cDefaultTpTimeout) noexcept;
 
+                /// @brief Constructor with configurable timeout and memory bounds.
+                /// @param timeout Per-stream reassembly timeout
+                /// @param limits Memory bounds
+                TpReassemblyManager(
+                    std::chrono::seconds timeout,
+                    const TpReassemblyLimits &limits) noexcept;
+
                 /// @brief Feed a TP segment into the appropriate stream.
                 /// @param key Stream identifier (MessageId + ClientId)
                 /// @param offset Segment byte offset
@@ -95,6 +181,24 @@ namespace ara
                     const std::vector<std::uint8_t> &segmentPayload,
                     TpReassemblyCallback callback = nullptr);
 
+                /// @brief Feed a TP segment straight from a receive buffer.
+                /// @param key Stream identifier (MessageId + ClientId)
+                /// @param offset Segment byte offset
+                /// @param moreSegments True if more segments follow
+                /// @param data Segment data bytes
+                /// @param length Segment data length
+                /// @param callback Optional callback when reassembly completes;
+                ///        it runs without any manager lock held
+                /// @returns true if the segment was accepted (not a duplicate and
+                ///          within the memory bounds)
+                bool FeedSegment(
+                    const TpStreamKey &key,
+                    std::uint32_t offset,
+                    bool moreSegments,
+                    const std::uint8_t *data,
+                    std::size_t length,
+                    TpReassemblyCallback callback = nullptr);
+
                 /// @brief Remove all timed-out streams.
                 /// @returns Number of streams removed
                 std::size_t CleanupTimedOut() noexcept;
@@ -113,6 +217,9 @@ namespace ara
 
                 /// @brief Remove all streams.
                 void Clear() noexcept;
+
+                /// @brief Snapshot of the activity counters.
+                TpReassemblyStatistics GetStatistics() const noexcept;
             };
         }
     }
@@ -5,8 +5,10 @@
 #ifndef ARA_COM_TYPES_H
 #define ARA_COM_TYPES_H
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <vector>
 
 namespace ara
@@ -43,7 +45,25 @@ namespace ara
             kNone = 0U,        ///< No filtering, all samples are received.
             kThreshold = 1U,   ///< Only samples exceeding a threshold.
             kRange = 2U,       ///< Only samples within a value range.
-            kOneEveryN = 3U    ///< Decimation: receive one sample every N.
+            kOneEveryN = 3U,   ///< Decimation: receive one sample every N.
+            kContent = 4U      ///< Raw payload field compared against bounds.
+        };
+
+        /// @brief Encoding of the payload field inspected by a kContent filter.
+        ///        Fields are read in host byte order, matching the default
+        ///        Serializer for trivially copyable types.
+        enum class FilterFieldType : std::uint8_t
+        {
+            kUInt8 = 0U,
+            kUInt16 = 1U,
+            kUInt32 = 2U,
+            kUInt64 = 3U,
+            kInt8 = 4U,
+            kInt16 = 5U,
+            kInt32 = 6U,
+            kInt64 = 7U,
+            kFloat32 = 8U,
+            kFloat64 = 9U
         };
 
         /// @brief Event subscription filter configuration per SWS_CM_00702.
@@ -66,6 +86,12 @@ namespace ara
             /// @brief Decimation factor (used when Type == kOneEveryN).
             std::uint32_t DecimationFactor{1U};
 
+            /// @brief Byte offset of the inspected field (used when Type == kContent).
+            std::size_t FieldOffset{0U};
+
+            /// @brief Encoding of the inspected field (used when Type == kContent).
+            FilterFieldType FieldType{FilterFieldType::kUInt32};
+
             /// @brief Creates a pass-through (no filtering) config.
             static FilterConfig None() noexcept
             {
@@ -103,6 +129,44 @@ namespace ara
                 cfg.DecimationFactor = (n > 0U) ? n : 1U;
                 return cfg;
             }
+
+            /// @brief Creates a content filter on a raw payload field.
+            ///        Samples pass when RangeLow <= field <= RangeHigh; samples
+            ///        too short to contain the field are dropped.
+            /// @param offset Byte offset of the field in the serialized payload.
+            /// @param fieldType Encoding of the field.
+            /// @param low Lower bound (inclusive).
+            /// @param high Upper bound (inclusive).
+            static FilterConfig Content(
+                std::size_t offset,
+                FilterFieldType fieldType,
+                double low,
+                double high) noexcept
+            {
+                FilterConfig cfg;
+                cfg.Type = FilterType::kContent;
+                cfg.FieldOffset = offset;
+                cfg.FieldType = fieldType;
+                cfg.RangeLow = low;
+                cfg.RangeHigh = high;
+                return cfg;
+            }
+
+            /// @brief Creates a content filter passing fields at or above a threshold.
+            /// @param offset Byte offset of the field in the serialized payload.
+            /// @param fieldType Encoding of the field.
+            /// @param threshold Minimum field value to pass through.
+            static FilterConfig ContentThreshold(
+                std::size_t offset,
+                FilterFieldType fieldType,
+                double threshold) noexcept
+            {
+                FilterConfig cfg{Content(
+                    offset, fieldType, threshold,
+                    std::numeric_limits<double>::infinity())};
+                cfg.ThresholdValue = threshold;
+                return cfg;
+            }
         };
 
         /// @brief Handle returned by StartFindService for stopping the search
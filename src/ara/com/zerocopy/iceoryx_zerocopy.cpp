@@ -6,6 +6,7 @@
 #include <limits>
 #include <mutex>
 #include <utility>
+#include <vector>
 #include "./zero_copy.h"
 #include "../com_error_domain.h"
 
@@ -13,6 +14,8 @@
 #include <iceoryx_posh/capro/service_description.hpp>
 #include <iceoryx_posh/iceoryx_posh_types.hpp>
 #include <iceoryx_posh/mepoo/chunk_header.hpp>
+#include <iceoryx_posh/popo/listener.hpp>
+#include <iceoryx_posh/popo/notification_callback.hpp>
 #include <iceoryx_posh/popo/publisher_options.hpp>
 #include <iceoryx_posh/popo/subscriber_options.hpp>
 #include <iceoryx_posh/popo/untyped_publisher.hpp>
@@ -86,6 +89,18 @@ namespace ara
                         cInstance,
                         cEvent};
                 }
+
+                std::mutex sListenerMutex;
+
+                /// @brief Listeners shared by every subscriber of the process.
+                /// @details Intentionally leaked so that subscribers destroyed
+                ///          during static destruction can still detach.
+                std::vector<std::unique_ptr<iox::popo::Listener>> &SharedListeners()
+                {
+                    static auto *sListeners{
+                        new std::vector<std::unique_ptr<iox::popo::Listener>>{}};
+                    return *sListeners;
+                }
 #endif
             }
 
@@ -397,15 +412,77 @@ namespace ara
             public:
 #if defined(ARA_COM_USE_ICEORYX) && (ARA_COM_USE_ICEORYX == 1)
                 std::shared_ptr<iox::popo::UntypedSubscriber> Subscriber;
-                iox::popo::WaitSet<1U> WaitSet;
+                std::unique_ptr<iox::popo::WaitSet<1U>> WaitSet;
+                std::function<void()> DataCallback;
+                iox::popo::Listener *Listener{nullptr};
 
                 explicit Impl(
                     std::shared_ptr<iox::popo::UntypedSubscriber> subscriber) noexcept : Subscriber{
                                                                                               std::move(subscriber)}
                 {
-                    WaitSet
-                        .attachState(*Subscriber, iox::popo::SubscriberState::HAS_DATA)
-                        .or_else([](auto &) {});
+                }
+
+                ~Impl() noexcept
+                {
+                    // Received samples may keep the subscriber alive beyond
+                    // this object, so the listener must stop calling back now.
+                    DetachListener();
+                }
+
+                static void OnDataReceived(
+                    iox::popo::UntypedSubscriber *const,
+                    Impl *const self)
+                {
+                    self->DataCallback();
+                }
+
+                /// @brief Attach to the first shared listener with a free slot.
+                bool AttachListener()
+                {
+                    // A subscriber signals a single WaitSet or Listener.
+                    WaitSet.reset();
+
+                    std::lock_guard<std::mutex> _listenerLock(sListenerMutex);
+                    auto &_listeners = SharedListeners();
+                    for (std::size_t i = 0U; i <= _listeners.size(); ++i)
+                    {
+                        if (i == _listeners.size())
+                        {
+                            _listeners.emplace_back(new iox::popo::Listener{});
+                        }
+
+                        const auto _attached{
+                            _listeners[i]->attachEvent(
+                                *Subscriber,
+                                iox::popo::SubscriberEvent::DATA_RECEIVED,
+                                iox::popo::createNotificationCallback(
+                                    OnDataReceived, *this))};
+                        if (!_attached.has_error())
+                        {
+                            Listener = _listeners[i].get();
+                            return true;
+                        }
+                        if (_attached.get_error() !=
+                            iox::popo::ListenerError::LISTENER_FULL)
+                        {
+                            return false;
+                        }
+                    }
+
+                    return false;
+                }
+
+                void DetachListener() noexcept
+                {
+                    // Not under sListenerMutex: detaching waits for a running
+                    // callback, which may itself attach another subscriber.
+                    if (Listener != nullptr)
+                    {
+                        Listener->detachEvent(
+                            *Subscriber,
+                            iox::popo::SubscriberEvent::DATA_RECEIVED);
+                        Listener = nullptr;
+                    }
                 }
 #else
                 Impl() noexcept
@@ -504,6 +581,63 @@ namespace ara
 #endif
             }
 
+            core::Result<bool> ZeroCopySubscriber::TryTakeChunk(
+                const std::uint8_t *&payload,
+                std::size_t &payloadSize) noexcept
+            {
+                payload = nullptr;
+                payloadSize = 0U;
+
+#if defined(ARA_COM_USE_ICEORYX) && (ARA_COM_USE_ICEORYX == 1)
+                if (!IsBindingActive())
+                {
+                    return MakeComBoolErrorResult(ComErrc::kNetworkBindingFailure);
+                }
+
+                auto _takeResult{mImpl->Subscriber->take()};
+                if (_takeResult.has_error())
+                {
+                    if (_takeResult.get_error() ==
+                        iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE)
+                    {
+                        return core::Result<bool>::FromValue(false);
+                    }
+                    else
+                    {
+                        return MakeComBoolErrorResult(ComErrc::kMaxSamplesExceeded);
+                    }
+                }
+
+                const void *cPayload{_takeResult.value()};
+                const iox::mepoo::ChunkHeader *cChunkHeader{
+                    iox::mepoo::ChunkHeader::fromUserPayload(cPayload)};
+                if (!cChunkHeader)
+                {
+                    mImpl->Subscriber->release(cPayload);
+                    return MakeComBoolErrorResult(ComErrc::kCommunicationStackError);
+                }
+
+                payload = static_cast<const std::uint8_t *>(cPayload);
+                payloadSize = cChunkHeader->userPayloadSize();
+                return core::Result<bool>::FromValue(true);
+#else
+                return MakeComBoolErrorResult(ComErrc::kCommunicationStackError);
+#endif
+            }
+
+            void ZeroCopySubscriber::ReleaseChunk(
+                const std::uint8_t *payload) noexcept
+            {
+#if defined(ARA_COM_USE_ICEORYX) && (ARA_COM_USE_ICEORYX == 1)
+                if (IsBindingActive() && payload != nullptr)
+                {
+                    mImpl->Subscriber->release(payload);
+                }
+#else
+                (void)payload;
+#endif
+            }
+
             bool ZeroCopySubscriber::WaitForData(std::chrono::milliseconds timeout) noexcept
             {
 #if defined(ARA_COM_USE_ICEORYX) && (ARA_COM_USE_ICEORYX == 1)
@@ -512,14 +646,56 @@ namespace ara
                     return false;
                 }
 
+                if (mImpl->Listener != nullptr)
+                {
+                    return false;
+                }
+
+                if (!mImpl->WaitSet)
+                {
+                    mImpl->WaitSet.reset(new iox::popo::WaitSet<1U>{});
+                    mImpl->WaitSet
+                        ->attachState(*mImpl->Subscriber, iox::popo::SubscriberState::HAS_DATA)
+                        .or_else([](auto &) {});
+                }
+
                 const auto notifs{
-                    mImpl->WaitSet.timedWait(
+                    mImpl->WaitSet->timedWait(
                         iox::units::Duration::fromMilliseconds(
                             static_cast<uint64_t>(timeout.count())))};
                 return !notifs.empty();
 #else
                 (void)timeout;
                 return false;
+#endif
+            }
+
+            bool ZeroCopySubscriber::SetDataCallback(
+                std::function<void()> callback) noexcept
+            {
+#if defined(ARA_COM_USE_ICEORYX) && (ARA_COM_USE_ICEORYX == 1)
+                if (!IsBindingActive() || !callback)
+                {
+                    return false;
+                }
+
+                mImpl->DetachListener();
+                mImpl->DataCallback = std::move(callback);
+                return mImpl->AttachListener();
+#else
+                (void)callback;
+                return false;
+#endif
+            }
+
+            void ZeroCopySubscriber::UnsetDataCallback() noexcept
+            {
+#if defined(ARA_COM_USE_ICEORYX) && (ARA_COM_USE_ICEORYX == 1)
+                if (IsBindingActive())
+                {
+                    mImpl->DetachListener();
+                    mImpl->DataCallback = nullptr;
+                }
 #endif
             }
         }
@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -148,11 +149,48 @@ namespace ara
                 /// @returns Result with 'true' when a sample is available, 'false' when no data is available
                 core::Result<bool> TryTake(ReceivedSample &sample) noexcept;
 
+                /// @brief Try to take one chunk without wrapping it in a ReceivedSample.
+                /// @details Allocation-free variant of TryTake() for callers that
+                ///          manage chunk lifetime themselves. Every taken chunk must
+                ///          be handed back with ReleaseChunk() before this
+                ///          subscriber is destroyed. Not thread-safe with respect to
+                ///          concurrent TryTakeChunk()/ReleaseChunk() calls.
+                /// @param[out] payload User payload of the taken chunk
+                /// @param[out] payloadSize User payload size in bytes
+                /// @returns Result with 'true' when a chunk was taken, 'false' when no data is available
+                core::Result<bool> TryTakeChunk(
+                    const std::uint8_t *&payload,
+                    std::size_t &payloadSize) noexcept;
+
+                /// @brief Return a chunk obtained from TryTakeChunk().
+                /// @param payload User payload pointer returned by TryTakeChunk()
+                void ReleaseChunk(const std::uint8_t *payload) noexcept;
+
                 /// @brief Block until new data is available or the timeout expires.
                 /// @details Uses the iceoryx WaitSet mechanism — no busy-wait or sleep.
+                ///          Not available while a data callback is set.
                 /// @param timeout Maximum time to wait.
                 /// @returns true when data is available, false on timeout or error.
                 bool WaitForData(std::chrono::milliseconds timeout) noexcept;
+
+                /// @brief Get called back as soon as new data arrives.
+                /// @details Attaches the subscriber to a process-wide iceoryx
+                ///          Listener, so all subscribers of a process share one
+                ///          dispatch thread (a further one is added only once a
+                ///          listener is full). The callback runs on that thread,
+                ///          so it must return quickly; a long drain with
+                ///          TryTake() belongs on another thread. Only arrivals after
+                ///          attaching are signalled, so the caller should drain
+                ///          once after this call returns.
+                /// @param callback Data-arrival callback; replaces a previous one
+                /// @returns false if the binding is inactive or the listener
+                ///          rejected the subscriber
+                bool SetDataCallback(std::function<void()> callback) noexcept;
+
+                /// @brief Detach the data callback from the shared listener.
+                /// @details Returns once the callback is no longer running, so it
+                ///          must not be called from within the callback itself.
+                void UnsetDataCallback() noexcept;
             };
         }
     }
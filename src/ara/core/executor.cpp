@@ -0,0 +1,117 @@
+/// @file src/ara/core/executor.cpp
+/// @brief Implementation for executors that run Future continuations.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include <utility>
+#include "./executor.h"
+
+namespace ara
+{
+    namespace core
+    {
+        namespace
+        {
+            const std::size_t cMinDefaultWorkers{2U};
+            const std::size_t cDefaultQueueCapacity{1024U};
+        }
+
+        void InlineExecutor::Execute(std::function<void()> task)
+        {
+            task();
+        }
+
+        ThreadPoolExecutor::ThreadPoolExecutor(
+            std::size_t workerCount,
+            std::size_t queueCapacity)
+            : mQueueCapacity{std::max<std::size_t>(1U, queueCapacity)}
+        {
+            const std::size_t cCount{std::max<std::size_t>(1U, workerCount)};
+            mWorkers.reserve(cCount);
+            for (std::size_t i = 0U; i < cCount; ++i)
+            {
+                mWorkers.emplace_back(&ThreadPoolExecutor::workerLoop, this);
+            }
+        }
+
+        ThreadPoolExecutor::~ThreadPoolExecutor() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mStopping = true;
+            }
+            mWork.notify_all();
+
+            for (auto &worker : mWorkers)
+            {
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        void ThreadPoolExecutor::Execute(std::function<void()> task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (!mStopping && mQueue.size() < mQueueCapacity)
+                {
+                    mQueue.push_back(std::move(task));
+                    task = nullptr;
+                }
+            }
+
+            if (task)
+            {
+                task();
+            }
+            else
+            {
+                mWork.notify_one();
+            }
+        }
+
+        std::size_t ThreadPoolExecutor::WorkerCount() const noexcept
+        {
+            return mWorkers.size();
+        }
+
+        std::size_t ThreadPoolExecutor::QueueCapacity() const noexcept
+        {
+            return mQueueCapacity;
+        }
+
+        void ThreadPoolExecutor::workerLoop()
+        {
+            while (true)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(mMutex);
+                    mWork.wait(
+                        lock, [this] { return mStopping || !mQueue.empty(); });
+                    if (mQueue.empty())
+                    {
+                        return;
+                    }
+                    task = std::move(mQueue.front());
+                    mQueue.pop_front();
+                }
+
+                task();
+            }
+        }
+
+        Executor &GetDefaultExecutor()
+        {
+            static auto *sInstance{
+                new ThreadPoolExecutor{
+                    std::max<std::size_t>(
+                        cMinDefaultWorkers,
+                        std::thread::hardware_concurrency()),
+                    cDefaultQueueCapacity}};
+            return *sInstance;
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/// @file src/ara/core/executor.h
+/// @brief Declarations for executors that run Future continuations.
+/// @details A continuation attached with Future::then runs inline in the
+///          thread that fulfils the Promise. Passing an Executor to then()
+///          moves it elsewhere instead. No executor in this file creates a
+///          thread per task: ThreadPoolExecutor owns a fixed set of workers
+///          and a bounded queue.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_CORE_EXECUTOR_H
+#define ARA_CORE_EXECUTOR_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ara
+{
+    namespace core
+    {
+        /// @brief Interface of a task execution context
+        class Executor
+        {
+        public:
+            virtual ~Executor() noexcept = default;
+
+            /// @brief Run a task at the discretion of the executor
+            /// @param task Task to run exactly once
+            virtual void Execute(std::function<void()> task) = 0;
+        };
+
+        /// @brief Executor that runs each task in the submitting thread
+        class InlineExecutor final : public Executor
+        {
+        public:
+            void Execute(std::function<void()> task) override;
+        };
+
+        /// @brief Executor with a fixed number of worker threads and a
+        ///        bounded task queue
+        /// @details When the queue is full, Execute() runs the task in the
+        ///          submitting thread. This throttles the producer without
+        ///          blocking it on a worker that may itself be waiting on
+        ///          the producer.
+        class ThreadPoolExecutor final : public Executor
+        {
+        private:
+            const std::size_t mQueueCapacity;
+            std::mutex mMutex;
+            std::condition_variable mWork;
+            std::deque<std::function<void()>> mQueue;
+            std::vector<std::thread> mWorkers;
+            bool mStopping{false};
+
+            void workerLoop();
+
+        public:
+            /// @brief Start the worker threads
+            /// @param workerCount Number of worker threads (at least one)
+            /// @param queueCapacity Maximum number of queued tasks (at least one)
+            ThreadPoolExecutor(
+                std::size_t workerCount,
+                std::size_t queueCapacity);
+
+            /// @brief Run the queued tasks and join the workers
+            ~ThreadPoolExecutor() noexcept override;
+
+            ThreadPoolExecutor(const ThreadPoolExecutor &) = delete;
+            ThreadPoolExecutor &operator=(const ThreadPoolExecutor &) = delete;
+
+            void Execute(std::function<void()> task) override;
+
+            /// @brief Number of worker threads
+            std::size_t WorkerCount() const noexcept;
+
+            /// @brief Maximum number of queued tasks
+            std::size_t QueueCapacity() const noexcept;
+        };
+
+        /// @brief Process-wide thread pool for Future continuations
+        /// @details Sized to the hardware concurrency (at least two workers)
+        ///          with a queue of 1024 tasks. Created on first use and
+        ///          never destroyed, so continuations may still be posted
+        ///          during static destruction.
+        /// @returns Shared executor instance
+        Executor &GetDefaultExecutor();
+    }
+}
+
+#endif
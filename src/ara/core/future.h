@@ -1,15 +1,28 @@
 /// @file src/ara/core/future.h
 /// @brief Declarations for future.
-/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+/// @details Future and Promise share a reference-counted state object
+///          instead of wrapping std::future/std::promise. A continuation
+///          attached with then() is stored in that state and started by
+///          whoever makes it ready, so chaining never spawns a thread.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
 
 #ifndef FUTURE_H
 #define FUTURE_H
 
 #include <future>
 #include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <type_traits>
+#include <utility>
 #include "./result.h"
 #include "./error_code.h"
+#include "./executor.h"
 
 namespace ara
 {
@@ -30,186 +43,319 @@ namespace ara
         template <typename T, typename E>
         class Promise;
 
-        /// @brief AUTOSAR AP Future type providing a mechanism to access the result of asynchronous operations
-        /// @tparam T Value type
-        /// @tparam E Error type
-        template <typename T, typename E = ErrorCode>
-        class Future final
+        namespace internal
         {
-            template <typename U, typename G>
-            friend class Future;
-            friend class Promise<T, E>;
+            /// @brief State shared between one Promise and one Future
+            /// @tparam T Value type
+            /// @tparam E Error type
+            template <typename T, typename E>
+            class FutureState final
+                : public std::enable_shared_from_this<FutureState<T, E>>
+            {
+            public:
+                /// @brief Continuation invoked with the ready state
+                using Continuation =
+                    std::function<void(std::shared_ptr<FutureState>)>;
+
+            private:
+                using StorageType = typename std::aligned_storage<
+                    sizeof(Result<T, E>),
+                    alignof(Result<T, E>)>::type;
+
+                mutable std::mutex mMutex;
+                mutable std::condition_variable mReadyCondition;
+                StorageType mStorage;
+                bool mHasResult{false};
+                bool mReady{false};
+                std::exception_ptr mException;
+                Continuation mContinuation;
+                Executor *mExecutor{nullptr};
+
+                Result<T, E> *resultPtr() noexcept
+                {
+                    return reinterpret_cast<Result<T, E> *>(&mStorage);
+                }
 
-        private:
-            std::future<Result<T, E>> mFuture;
+                void dispatch(Continuation continuation, Executor *executor)
+                {
+                    std::shared_ptr<FutureState> _self{this->shared_from_this()};
+                    if (executor == nullptr)
+                    {
+                        continuation(std::move(_self));
+                    }
+                    else
+                    {
+                        executor->Execute(
+                            [continuation, _self]()
+                            {
+                                continuation(_self);
+                            });
+                    }
+                }
 
-            template <typename R, typename FCallable>
-            static typename std::enable_if<!std::is_void<R>::value, Result<R, E>>::type
-            InvokeContinuation(FCallable &func, Future<T, E> &&readyFuture)
-            {
-                return Result<R, E>::FromValue(func(std::move(readyFuture)));
-            }
+                template <typename FStore>
+                void satisfy(FStore &&store)
+                {
+                    Continuation _continuation;
+                    Executor *_executor{nullptr};
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        if (mReady)
+                        {
+                            throw std::future_error(
+                                std::future_errc::promise_already_satisfied);
+                        }
+
+                        store();
+                        mReady = true;
+                        _continuation = std::move(mContinuation);
+                        mContinuation = nullptr;
+                        _executor = mExecutor;
+                    }
+                    mReadyCondition.notify_all();
+
+                    if (_continuation)
+                    {
+                        dispatch(std::move(_continuation), _executor);
+                    }
+                }
 
-            template <typename R, typename FCallable>
-            static typename std::enable_if<std::is_void<R>::value, Result<R, E>>::type
-            InvokeContinuation(FCallable &func, Future<T, E> &&readyFuture)
-            {
-                func(std::move(readyFuture));
-                return Result<void, E>::FromValue();
-            }
+            public:
+                FutureState() noexcept = default;
 
-            Future(std::future<Result<T, E>> &&future) noexcept
-                : mFuture{std::move(future)}
-            {
-            }
+                ~FutureState() noexcept
+                {
+                    if (mHasResult)
+                    {
+                        resultPtr()->~Result();
+                    }
+                }
 
-        public:
-            /// @brief Constructs an empty future.
-            Future() noexcept = default;
-            /// @brief Destructor.
-            ~Future() noexcept = default;
+                FutureState(const FutureState &) = delete;
+                FutureState &operator=(const FutureState &) = delete;
 
-            Future(const Future &) = delete;
-            Future &operator=(const Future &) = delete;
+                /// @brief Make the state ready with a copy of a result
+                void SetResult(const Result<T, E> &result)
+                {
+                    satisfy(
+                        [this, &result]()
+                        {
+                            new (&mStorage) Result<T, E>(result);
+                            mHasResult = true;
+                        });
+                }
 
-            /// @brief Move constructor.
-            /// @param other Source future.
-            Future(Future &&other) noexcept
-                : mFuture{std::move(other.mFuture)}
-            {
-            }
+                /// @brief Make the state ready with a result
+                void SetResult(Result<T, E> &&result)
+                {
+                    satisfy(
+                        [this, &result]()
+                        {
+                            new (&mStorage) Result<T, E>(std::move(result));
+                            mHasResult = true;
+                        });
+                }
 
-            /// @brief Move assignment.
-            /// @param other Source future.
-            /// @returns Reference to `*this`.
-            Future &operator=(Future &&other) noexcept
-            {
-                if (this != &other)
+                /// @brief Make the state ready with an exception
+                void SetException(std::exception_ptr exception)
                 {
-                    mFuture = std::move(other.mFuture);
+                    satisfy(
+                        [this, &exception]()
+                        {
+                            mException = std::move(exception);
+                        });
                 }
-                return *this;
-            }
 
-            /// @brief Get the result, blocking until it becomes available
-            /// @returns Result containing either the value or an error
-            Result<T, E> GetResult()
-            {
-                return mFuture.get();
-            }
+                /// @brief Make the state ready with a broken-promise error
+                ///        unless it is ready already
+                void Abandon() noexcept
+                {
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        if (mReady)
+                        {
+                            return;
+                        }
+                    }
+
+                    try
+                    {
+                        SetException(
+                            std::make_exception_ptr(
+                                std::future_error(
+                                    std::future_errc::broken_promise)));
+                    }
+                    catch (...)
+                    {
+                        // Only the abandoning promise can fulfil the state.
+                    }
+                }
 
-            /// @brief Check if the Future has a valid shared state
-            /// @returns True if the Future is valid
-            bool valid() const noexcept
-            {
-                return mFuture.valid();
-            }
+                /// @brief Check readiness without blocking
+                bool IsReady() const
+                {
+                    std::lock_guard<std::mutex> _lock(mMutex);
+                    return mReady;
+                }
 
-            /// @brief Check whether the shared state is already ready without blocking.
-            /// @returns True if result is ready; otherwise false.
-            bool is_ready() const
-            {
-                if (!mFuture.valid())
+                /// @brief Block until the state is ready
+                void Wait() const
                 {
-                    return false;
+                    std::unique_lock<std::mutex> _lock(mMutex);
+                    mReadyCondition.wait(_lock, [this]() { return mReady; });
                 }
 
-                const auto cStatus{mFuture.wait_for(std::chrono::milliseconds(0))};
-                return cStatus == std::future_status::ready;
-            }
+                /// @brief Block until the state is ready or a timeout elapses
+                /// @returns True if the state is ready
+                template <typename Rep, typename Period>
+                bool WaitFor(
+                    const std::chrono::duration<Rep, Period> &timeoutDuration) const
+                {
+                    std::unique_lock<std::mutex> _lock(mMutex);
+                    return mReadyCondition.wait_for(
+                        _lock, timeoutDuration, [this]() { return mReady; });
+                }
 
-            /// @brief Block until the shared state is ready
-            void wait() const
-            {
-                mFuture.wait();
-            }
+                /// @brief Block until the state is ready or a deadline passes
+                /// @returns True if the state is ready
+                template <typename Clock, typename Duration>
+                bool WaitUntil(
+                    const std::chrono::time_point<Clock, Duration> &deadline) const
+                {
+                    std::unique_lock<std::mutex> _lock(mMutex);
+                    return mReadyCondition.wait_until(
+                        _lock, deadline, [this]() { return mReady; });
+                }
 
-            /// @brief Wait for a specified duration
-            /// @tparam Rep Duration arithmetic type
-            /// @tparam Period Duration period type
-            /// @param timeoutDuration Maximum duration to wait
-            /// @returns Status of the shared state
-            template <typename Rep, typename Period>
-            future_status wait_for(
-                const std::chrono::duration<Rep, Period> &timeoutDuration) const
+                /// @brief Wait for the state and move its result out
+                /// @throws Any exception stored in the state
+                Result<T, E> TakeResult()
+                {
+                    std::unique_lock<std::mutex> _lock(mMutex);
+                    mReadyCondition.wait(_lock, [this]() { return mReady; });
+                    if (mException)
+                    {
+                        std::rethrow_exception(mException);
+                    }
+                    if (!mHasResult)
+                    {
+                        throw std::future_error(std::future_errc::no_state);
+                    }
+
+                    Result<T, E> _result{std::move(*resultPtr())};
+                    resultPtr()->~Result();
+                    mHasResult = false;
+                    return _result;
+                }
+
+                /// @brief Attach the single continuation of this state
+                /// @param continuation Callable invoked once the state is ready
+                /// @param executor Executor to run it on, or nullptr to run it
+                ///        in the thread that makes the state ready (or in the
+                ///        calling thread if the state is ready already)
+                void SetContinuation(
+                    Continuation continuation, Executor *executor)
+                {
+                    {
+                        std::lock_guard<std::mutex> _lock(mMutex);
+                        if (!mReady)
+                        {
+                            mContinuation = std::move(continuation);
+                            mExecutor = executor;
+                            return;
+                        }
+                    }
+
+                    dispatch(std::move(continuation), executor);
+                }
+            };
+
+            template <typename R, typename E, typename FCallable, typename FFuture>
+            typename std::enable_if<!std::is_void<R>::value, Result<R, E>>::type
+            InvokeContinuation(FCallable &func, FFuture &&readyFuture)
             {
-                auto _status = mFuture.wait_for(timeoutDuration);
-                return _status == std::future_status::ready
-                           ? future_status::ready
-                           : future_status::timeout;
+                return Result<R, E>::FromValue(func(std::move(readyFuture)));
             }
 
-            /// @brief Wait until a specified time point
-            /// @tparam Clock Clock type
-            /// @tparam Duration Duration type
-            /// @param deadline Time point to wait until
-            /// @returns Status of the shared state
-            template <typename Clock, typename Duration>
-            future_status wait_until(
-                const std::chrono::time_point<Clock, Duration> &deadline) const
+            template <typename R, typename E, typename FCallable, typename FFuture>
+            typename std::enable_if<std::is_void<R>::value, Result<R, E>>::type
+            InvokeContinuation(FCallable &func, FFuture &&readyFuture)
             {
-                auto _status = mFuture.wait_until(deadline);
-                return _status == std::future_status::ready
-                           ? future_status::ready
-                           : future_status::timeout;
+                func(std::move(readyFuture));
+                return Result<void, E>::FromValue();
             }
 
-            /// @brief Apply a continuation to the Future
-            /// @tparam F Callable type that takes a Future<T,E> and returns a value
-            /// @param func Callable to apply when the Future becomes ready
-            /// @returns A new Future containing the result of the continuation
-            template <typename F>
-            auto then(F &&func) -> Future<decltype(func(std::move(*this))), E>
+            /// @brief Access to the shared state of futures for then()
+            struct FutureAccess
             {
-                using ResultType = decltype(func(std::move(*this)));
-
-                auto _sharedFuture =
-                    std::make_shared<std::future<Result<T, E>>>(std::move(mFuture));
-                auto _task =
-                    std::async(std::launch::async,
-                               [_sharedFuture, func = std::forward<F>(func)]() mutable
-                               {
-                                   _sharedFuture->wait();
-                                   Future<T, E> _readyFuture(std::move(*_sharedFuture));
-                                   return InvokeContinuation<ResultType>(
-                                       func,
-                                       std::move(_readyFuture));
-                               });
-
-                return Future<ResultType, E>(std::move(_task));
-            }
-        };
+                template <typename R, typename T, typename E, typename F>
+                static Future<R, E> Chain(
+                    std::shared_ptr<FutureState<T, E>> state,
+                    Executor *executor,
+                    F &&func)
+                {
+                    using CallableType = typename std::decay<F>::type;
+
+                    auto _next = std::make_shared<FutureState<R, E>>();
+                    // Held by pointer so that move-only callables fit into
+                    // the copyable continuation.
+                    auto _callable =
+                        std::make_shared<CallableType>(std::forward<F>(func));
+
+                    state->SetContinuation(
+                        [_next, _callable](std::shared_ptr<FutureState<T, E>> ready)
+                        {
+                            try
+                            {
+                                _next->SetResult(
+                                    InvokeContinuation<R, E>(
+                                        *_callable,
+                                        Future<T, E>(std::move(ready))));
+                            }
+                            catch (...)
+                            {
+                                _next->SetException(std::current_exception());
+                            }
+                        },
+                        executor);
+
+                    return Future<R, E>(std::move(_next));
+                }
+            };
+        }
 
-        /// @brief Specialization of Future for void value type
+        /// @brief AUTOSAR AP Future type providing a mechanism to access the result of asynchronous operations
+        /// @tparam T Value type
         /// @tparam E Error type
-        template <typename E>
-        class Future<void, E> final
+        template <typename T, typename E = ErrorCode>
+        class Future final
         {
-            template <typename U, typename G>
-            friend class Future;
-            friend class Promise<void, E>;
+            friend class Promise<T, E>;
+            friend struct internal::FutureAccess;
 
         private:
-            std::future<Result<void, E>> mFuture;
+            using StateType = internal::FutureState<T, E>;
+
+            std::shared_ptr<StateType> mState;
 
-            template <typename R, typename FCallable>
-            static typename std::enable_if<!std::is_void<R>::value, Result<R, E>>::type
-            InvokeContinuation(FCallable &func, Future<void, E> &&readyFuture)
+            explicit Future(std::shared_ptr<StateType> state) noexcept
+                : mState{std::move(state)}
             {
-                return Result<R, E>::FromValue(func(std::move(readyFuture)));
             }
 
-            template <typename R, typename FCallable>
-            static typename std::enable_if<std::is_void<R>::value, Result<R, E>>::type
-            InvokeContinuation(FCallable &func, Future<void, E> &&readyFuture)
+            StateType &checkedState() const
             {
-                func(std::move(readyFuture));
-                return Result<void, E>::FromValue();
+                if (!mState)
+                {
+                    throw std::future_error(std::future_errc::no_state);
+                }
+                return *mState;
             }
 
-            Future(std::future<Result<void, E>> &&future) noexcept
-                : mFuture{std::move(future)}
+            std::shared_ptr<StateType> releaseState()
             {
+                checkedState();
+                return std::move(mState);
             }
 
         public:
@@ -224,7 +370,7 @@ namespace ara
             /// @brief Move constructor.
             /// @param other Source future.
             Future(Future &&other) noexcept
-                : mFuture{std::move(other.mFuture)}
+                : mState{std::move(other.mState)}
             {
             }
 
@@ -235,89 +381,100 @@ namespace ara
             {
                 if (this != &other)
                 {
-                    mFuture = std::move(other.mFuture);
+                    mState = std::move(other.mState);
                 }
                 return *this;
             }
 
             /// @brief Get the result, blocking until it becomes available
-            /// @returns Result containing either void success or an error
-            Result<void, E> GetResult()
+            /// @returns Result containing either the value or an error
+            /// @note The Future is no longer valid afterwards.
+            Result<T, E> GetResult()
             {
-                return mFuture.get();
+                return releaseState()->TakeResult();
             }
 
             /// @brief Check if the Future has a valid shared state
             /// @returns True if the Future is valid
             bool valid() const noexcept
             {
-                return mFuture.valid();
+                return static_cast<bool>(mState);
             }
 
             /// @brief Check whether the shared state is already ready without blocking.
             /// @returns True if result is ready; otherwise false.
             bool is_ready() const
             {
-                if (!mFuture.valid())
-                {
-                    return false;
-                }
-
-                const auto cStatus{mFuture.wait_for(std::chrono::milliseconds(0))};
-                return cStatus == std::future_status::ready;
+                return mState && mState->IsReady();
             }
 
             /// @brief Block until the shared state is ready
             void wait() const
             {
-                mFuture.wait();
+                checkedState().Wait();
             }
 
             /// @brief Wait for a specified duration
+            /// @tparam Rep Duration arithmetic type
+            /// @tparam Period Duration period type
+            /// @param timeoutDuration Maximum duration to wait
+            /// @returns Status of the shared state
             template <typename Rep, typename Period>
             future_status wait_for(
                 const std::chrono::duration<Rep, Period> &timeoutDuration) const
             {
-                auto _status = mFuture.wait_for(timeoutDuration);
-                return _status == std::future_status::ready
+                return checkedState().WaitFor(timeoutDuration)
                            ? future_status::ready
                            : future_status::timeout;
             }
 
             /// @brief Wait until a specified time point
+            /// @tparam Clock Clock type
+            /// @tparam Duration Duration type
+            /// @param deadline Time point to wait until
+            /// @returns Status of the shared state
             template <typename Clock, typename Duration>
             future_status wait_until(
                 const std::chrono::time_point<Clock, Duration> &deadline) const
             {
-                auto _status = mFuture.wait_until(deadline);
-                return _status == std::future_status::ready
+                return checkedState().WaitUntil(deadline)
                            ? future_status::ready
                            : future_status::timeout;
             }
 
-            /// @brief Apply a continuation to the Future<void, E>
-            /// @tparam F Callable type that takes a Future<void,E>
+            /// @brief Apply a continuation to the Future
+            /// @details The continuation runs in the thread that fulfils the
+            ///          Promise, or in the calling thread if the Future is
+            ///          ready already. It should not block; use the executor
+            ///          overload to move longer work off that thread.
+            /// @tparam F Callable type that takes a Future<T,E> and returns a value
             /// @param func Callable to apply when the Future becomes ready
-            /// @returns A new Future containing the continuation result
+            /// @returns A new Future containing the result of the continuation
+            /// @note The Future is no longer valid afterwards.
             template <typename F>
             auto then(F &&func) -> Future<decltype(func(std::move(*this))), E>
             {
                 using ResultType = decltype(func(std::move(*this)));
 
-                auto _sharedFuture =
-                    std::make_shared<std::future<Result<void, E>>>(std::move(mFuture));
-                auto _task =
-                    std::async(std::launch::async,
-                               [_sharedFuture, func = std::forward<F>(func)]() mutable
-                               {
-                                   _sharedFuture->wait();
-                                   Future<void, E> _readyFuture(std::move(*_sharedFuture));
-                                   return InvokeContinuation<ResultType>(
-                                       func,
-                                       std::move(_readyFuture));
-                               });
-
-                return Future<ResultType, E>(std::move(_task));
+                return internal::FutureAccess::Chain<ResultType>(
+                    releaseState(), nullptr, std::forward<F>(func));
+            }
+
+            /// @brief Apply a continuation that runs on an executor
+            /// @tparam F Callable type that takes a Future<T,E> and returns a value
+            /// @param executor Executor to run the continuation on; must
+            ///        outlive the Future becoming ready
+            /// @param func Callable to apply when the Future becomes ready
+            /// @returns A new Future containing the result of the continuation
+            /// @note The Future is no longer valid afterwards.
+            template <typename F>
+            auto then(Executor &executor, F &&func)
+                -> Future<decltype(func(std::move(*this))), E>
+            {
+                using ResultType = decltype(func(std::move(*this)));
+
+                return internal::FutureAccess::Chain<ResultType>(
+                    releaseState(), &executor, std::forward<F>(func));
             }
         };
     }
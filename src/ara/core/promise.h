@@ -6,6 +6,7 @@
 #define PROMISE_H
 
 #include <future>
+#include <memory>
 #include "./result.h"
 #include "./future.h"
 
@@ -21,17 +22,42 @@ namespace ara
         class Promise final
         {
         private:
-            std::promise<Result<T, E>> mPromise;
+            using StateType = internal::FutureState<T, E>;
+
+            std::shared_ptr<StateType> mState;
+            bool mFutureRetrieved;
+
+            StateType &checkedState() const
+            {
+                if (!mState)
+                {
+                    throw std::future_error(std::future_errc::no_state);
+                }
+                return *mState;
+            }
 
         public:
-            Promise() = default;
-            ~Promise() = default;
+            Promise()
+                : mState{std::make_shared<StateType>()},
+                  mFutureRetrieved{false}
+            {
+            }
+
+            /// @brief Destructor; an unfulfilled Future reports a broken promise.
+            ~Promise() noexcept
+            {
+                if (mState)
+                {
+                    mState->Abandon();
+                }
+            }
 
             Promise(const Promise &) = delete;
             Promise &operator=(const Promise &) = delete;
 
             Promise(Promise &&other) noexcept
-                : mPromise{std::move(other.mPromise)}
+                : mState{std::move(other.mState)},
+                  mFutureRetrieved{other.mFutureRetrieved}
             {
             }
 
@@ -39,7 +65,12 @@ namespace ara
             {
                 if (this != &other)
                 {
-                    mPromise = std::move(other.mPromise);
+                    if (mState)
+                    {
+                        mState->Abandon();
+                    }
+                    mState = std::move(other.mState);
+                    mFutureRetrieved = other.mFutureRetrieved;
                 }
                 return *this;
             }
@@ -48,49 +79,56 @@ namespace ara
             /// @returns A Future that shares state with this Promise
             Future<T, E> get_future()
             {
-                return Future<T, E>(mPromise.get_future());
+                StateType &_state{checkedState()};
+                if (mFutureRetrieved)
+                {
+                    throw std::future_error(
+                        std::future_errc::future_already_retrieved);
+                }
+                mFutureRetrieved = true;
+                return Future<T, E>(_state.shared_from_this());
             }
 
             /// @brief Set a Result as the shared state
             /// @param result The Result to store
             void SetResult(const Result<T, E> &result)
             {
-                mPromise.set_value(result);
+                checkedState().SetResult(result);
             }
 
             /// @brief Move a Result into the shared state
             /// @param result The Result to store
             void SetResult(Result<T, E> &&result)
             {
-                mPromise.set_value(std::move(result));
+                checkedState().SetResult(std::move(result));
             }
 
             /// @brief Set a value as the shared state
             /// @param value The value to store
             void set_value(const T &value)
             {
-                mPromise.set_value(Result<T, E>::FromValue(value));
+                checkedState().SetResult(Result<T, E>::FromValue(value));
             }
 
             /// @brief Move a value into the shared state
             /// @param value The value to store
             void set_value(T &&value)
             {
-                mPromise.set_value(Result<T, E>::FromValue(std::move(value)));
+                checkedState().SetResult(Result<T, E>::FromValue(std::move(value)));
             }
 
             /// @brief Set an error as the shared state
             /// @param error The error to store
             void SetError(const E &error)
             {
-                mPromise.set_value(Result<T, E>::FromError(error));
+                checkedState().SetResult(Result<T, E>::FromError(error));
             }
 
             /// @brief Move an error into the shared state
             /// @param error The error to store
             void SetError(E &&error)
             {
-                mPromise.set_value(Result<T, E>::FromError(std::move(error)));
+                checkedState().SetResult(Result<T, E>::FromError(std::move(error)));
             }
         };
 
@@ -100,17 +138,42 @@ namespace ara
         class Promise<void, E> final
         {
         private:
-            std::promise<Result<void, E>> mPromise;
+            using StateType = internal::FutureState<void, E>;
+
+            std::shared_ptr<StateType> mState;
+            bool mFutureRetrieved;
+
+            StateType &checkedState() const
+            {
+                if (!mState)
+                {
+                    throw std::future_error(std::future_errc::no_state);
+                }
+                return *mState;
+            }
 
         public:
-            Promise() = default;
-            ~Promise() = default;
+            Promise()
+                : mState{std::make_shared<StateType>()},
+                  mFutureRetrieved{false}
+            {
+            }
+
+            /// @brief Destructor; an unfulfilled Future reports a broken promise.
+            ~Promise() noexcept
+            {
+                if (mState)
+                {
+                    mState->Abandon();
+                }
+            }
 
             Promise(const Promise &) = delete;
             Promise &operator=(const Promise &) = delete;
 
             Promise(Promise &&other) noexcept
-                : mPromise{std::move(other.mPromise)}
+                : mState{std::move(other.mState)},
+                  mFutureRetrieved{other.mFutureRetrieved}
             {
             }
 
@@ -118,7 +181,12 @@ namespace ara
             {
                 if (this != &other)
                 {
-                    mPromise = std::move(other.mPromise);
+                    if (mState)
+                    {
+                        mState->Abandon();
+                    }
+                    mState = std::move(other.mState);
+                    mFutureRetrieved = other.mFutureRetrieved;
                 }
                 return *this;
             }
@@ -127,41 +195,48 @@ namespace ara
             /// @returns A Future that shares state with this Promise
             Future<void, E> get_future()
             {
-                return Future<void, E>(mPromise.get_future());
+                StateType &_state{checkedState()};
+                if (mFutureRetrieved)
+                {
+                    throw std::future_error(
+                        std::future_errc::future_already_retrieved);
+                }
+                mFutureRetrieved = true;
+                return Future<void, E>(_state.shared_from_this());
             }
 
             /// @brief Set a void Result as the shared state
             void set_value()
             {
-                mPromise.set_value(Result<void, E>::FromValue());
+                checkedState().SetResult(Result<void, E>::FromValue());
             }
 
             /// @brief Set a Result as the shared state
             /// @param result The Result to store
             void SetResult(const Result<void, E> &result)
             {
-                mPromise.set_value(result);
+                checkedState().SetResult(result);
             }
 
             /// @brief Move a Result into the shared state
             /// @param result The Result to store
             void SetResult(Result<void, E> &&result)
             {
-                mPromise.set_value(std::move(result));
+                checkedState().SetResult(std::move(result));
             }
 
             /// @brief Set an error as the shared state
             /// @param error The error to store
             void SetError(const E &error)
             {
-                mPromise.set_value(Result<void, E>::FromError(error));
+                checkedState().SetResult(Result<void, E>::FromError(error));
             }
 
             /// @brief Move an error into the shared state
             /// @param error The error to store
             void SetError(E &&error)
             {
-                mPromise.set_value(Result<void, E>::FromError(std::move(error)));
+                checkedState().SetResult(Result<void, E>::FromError(std::move(error)));
             }
         };
     }
@@ -0,0 +1,406 @@
+/// @file src/ara/core/timer_wheel.cpp
+/// @brief Implementation for the hierarchical timer wheel.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include "./timer_wheel.h"
+
+namespace ara
+{
+    namespace core
+    {
+        const std::size_t TimerWheel::cLevelCount{4U};
+
+        TimerWheel::TimerWheel(
+            Clock::duration tick,
+            std::size_t slotCount,
+            Executor *executor)
+            : mTick{std::max<Clock::duration>(Clock::duration{1}, tick)},
+              mEpoch{Clock::now()},
+              mSlotCount{std::max<std::size_t>(2U, slotCount)},
+              mExecutor{executor},
+              mLevels(cLevelCount, std::vector<Slot>(mSlotCount))
+        {
+            // One span past the top level bounds the wheel's horizon.
+            const std::uint64_t cMax{std::numeric_limits<std::uint64_t>::max()};
+            std::uint64_t span{1U};
+            for (std::size_t level = 0U; level <= cLevelCount; ++level)
+            {
+                mSpans.push_back(span);
+                span = span > cMax / mSlotCount ? cMax : span * mSlotCount;
+            }
+
+            mThread = std::thread(&TimerWheel::loop, this);
+        }
+
+        TimerWheel::~TimerWheel() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mStopping = true;
+            }
+            mWakeup.notify_all();
+
+            if (mThread.joinable())
+            {
+                mThread.join();
+            }
+        }
+
+        TimerWheel &TimerWheel::Instance()
+        {
+            static auto *sInstance{
+                new TimerWheel{
+                    std::chrono::milliseconds{5}, 512U, &GetDefaultExecutor()}};
+            return *sInstance;
+        }
+
+        std::uint64_t TimerWheel::tickAt(Clock::time_point time) const noexcept
+        {
+            if (time <= mEpoch)
+            {
+                return 0U;
+            }
+            return static_cast<std::uint64_t>((time - mEpoch) / mTick);
+        }
+
+        void TimerWheel::place(Slot &source, Slot::iterator timer)
+        {
+            const std::uint64_t cExpiry{timer->ExpiryTick};
+            std::size_t level{0U};
+            std::size_t slotIndex{
+                static_cast<std::size_t>(mCurrentTick % mSlotCount)};
+
+            if (cExpiry > mCurrentTick)
+            {
+                // The lowest level whose slot for the expiry is visited
+                // within one revolution from now.
+                level = cLevelCount;
+                for (std::size_t k = 0U; k < cLevelCount; ++k)
+                {
+                    const std::uint64_t cAhead{
+                        cExpiry / mSpans[k] - mCurrentTick / mSpans[k]};
+                    if (cAhead <= mSlotCount)
+                    {
+                        level = k;
+                        slotIndex = static_cast<std::size_t>(
+                            (cExpiry / mSpans[k]) % mSlotCount);
+                        break;
+                    }
+                }
+
+                if (level == cLevelCount)
+                {
+                    // Beyond the horizon: park in the top-level slot visited
+                    // last, and place again from there.
+                    level = cLevelCount - 1U;
+                    slotIndex = static_cast<std::size_t>(
+                        (mCurrentTick / mSpans[level]) % mSlotCount);
+                }
+            }
+
+            Slot &target{mLevels[level][slotIndex]};
+            target.splice(target.end(), source, timer);
+            mIndex[timer->Id] = Location{level, slotIndex, timer};
+        }
+
+        void TimerWheel::advance(std::vector<Callback> &expired)
+        {
+            // Cascade from the top so that every timer lands in its final
+            // slot before level 0 is expired.
+            for (std::size_t level = cLevelCount - 1U; level > 0U; --level)
+            {
+                if (mCurrentTick % mSpans[level] != 0U)
+                {
+                    continue;
+                }
+
+                // Detach the slot first: a parked timer that is still beyond
+                // the horizon goes straight back into it.
+                Slot due;
+                due.splice(
+                    due.end(),
+                    mLevels[level][static_cast<std::size_t>(
+                        (mCurrentTick / mSpans[level]) % mSlotCount)]);
+                while (!due.empty())
+                {
+                    place(due, due.begin());
+                }
+            }
+
+            Slot &slot{mLevels[0U][static_cast<std::size_t>(
+                mCurrentTick % mSlotCount)]};
+            for (auto it = slot.begin(); it != slot.end();)
+            {
+                if (it->ExpiryTick <= mCurrentTick)
+                {
+                    expired.push_back(std::move(it->Handler));
+                    mIndex.erase(it->Id);
+                    it = slot.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        std::uint64_t TimerWheel::nextEventTick() const noexcept
+        {
+            // Level 0 holds everything due within one revolution; the first
+            // level-1 boundary is where higher levels may cascade.
+            for (std::uint64_t tick = mCurrentTick + 1U;; ++tick)
+            {
+                const bool cBoundary{tick % mSpans[1U] == 0U};
+                if (cBoundary ||
+                    !mLevels[0U][static_cast<std::size_t>(tick % mSlotCount)].empty())
+                {
+                    return tick;
+                }
+            }
+        }
+
+        TimerWheel::TimerId TimerWheel::Schedule(
+            Clock::duration delay, Callback callback)
+        {
+            const Clock::time_point cDeadline{
+                Clock::now() + std::max(Clock::duration::zero(), delay)};
+
+            TimerId id;
+            bool wake{false};
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (mIndex.empty())
+                {
+                    // The thread was idle; resynchronise before placing.
+                    mCurrentTick = std::max(mCurrentTick, tickAt(Clock::now()));
+                    wake = true;
+                }
+
+                // Round up so that a timer never fires early.
+                std::uint64_t expiryTick{tickAt(cDeadline) + 1U};
+                expiryTick = std::max(expiryTick, mCurrentTick + 1U);
+
+                id = mNextId++;
+                Slot pending;
+                pending.push_back(Timer{id, expiryTick, std::move(callback)});
+                place(pending, pending.begin());
+
+                // The thread sleeps until the next occupied slot; an earlier
+                // timer has to wake it.
+                wake = wake || expiryTick < mWaitTick;
+            }
+
+            if (wake)
+            {
+                mWakeup.notify_one();
+            }
+            return id;
+        }
+
+        bool TimerWheel::Cancel(TimerId id)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto it = mIndex.find(id);
+            if (it == mIndex.end())
+            {
+                return false;
+            }
+            const Location &location{it->second};
+            mLevels[location.Level][location.SlotIndex].erase(location.Position);
+            mIndex.erase(it);
+            return true;
+        }
+
+        std::size_t TimerWheel::PendingCount()
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return mIndex.size();
+        }
+
+        void TimerWheel::loop()
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            while (!mStopping)
+            {
+                if (mIndex.empty())
+                {
+                    mWakeup.wait(
+                        lock, [this] { return mStopping || !mIndex.empty(); });
+                    continue;
+                }
+
+                const std::uint64_t nowTick{tickAt(Clock::now())};
+                const std::uint64_t nextTick{nextEventTick()};
+                if (nextTick > nowTick)
+                {
+                    mWaitTick = nextTick;
+                    mWakeup.wait_until(
+                        lock, mEpoch + mTick * static_cast<Clock::rep>(nextTick));
+                    continue;
+                }
+
+                // Jump from event to event; the ticks in between are empty.
+                std::vector<Callback> expired;
+                while (!mIndex.empty())
+                {
+                    const std::uint64_t cNext{nextEventTick()};
+                    if (cNext > nowTick)
+                    {
+                        break;
+                    }
+                    mCurrentTick = cNext;
+                    advance(expired);
+                }
+                mCurrentTick = std::max(mCurrentTick, nowTick);
+
+                lock.unlock();
+                for (auto &callback : expired)
+                {
+                    if (mExecutor != nullptr)
+                    {
+                        mExecutor->Execute(std::move(callback));
+                    }
+                    else
+                    {
+                        callback();
+                    }
+                }
+                lock.lock();
+            }
+        }
+
+        PeriodicTimer::PeriodicTimer(
+            TimerWheel &wheel,
+            TimerWheel::Clock::duration period,
+            TimerWheel::Callback callback)
+            : mWheel{wheel},
+              mPeriod{period},
+              mCallback{std::move(callback)},
+              mState{std::make_shared<State>()}
+        {
+        }
+
+        PeriodicTimer::~PeriodicTimer() noexcept
+        {
+            Stop();
+        }
+
+        void PeriodicTimer::arm(
+            TimerWheel &wheel,
+            TimerWheel::Clock::duration period,
+            TimerWheel::Callback callback,
+            const std::shared_ptr<State> &state)
+        {
+            const std::uint64_t cGeneration{state->Generation};
+            std::weak_ptr<State> weakState{state};
+            state->Timer = wheel.Schedule(
+                period,
+                [&wheel, period, callback, weakState, cGeneration]()
+                {
+                    std::shared_ptr<State> state{weakState.lock()};
+                    if (!state)
+                    {
+                        return;
+                    }
+
+                    std::lock_guard<std::recursive_mutex> lock(state->Mutex);
+                    if (!state->Running || state->Generation != cGeneration)
+                    {
+                        return;
+                    }
+
+                    // Re-arm first so that a Stop() from the callback cancels
+                    // the next period.
+                    arm(wheel, period, callback, state);
+                    callback();
+                });
+        }
+
+        void PeriodicTimer::Start()
+        {
+            std::lock_guard<std::recursive_mutex> lock(mState->Mutex);
+            if (!mState->Running)
+            {
+                mState->Running = true;
+                arm(mWheel, mPeriod, mCallback, mState);
+            }
+        }
+
+        void PeriodicTimer::Stop() noexcept
+        {
+            std::lock_guard<std::recursive_mutex> lock(mState->Mutex);
+            if (mState->Running)
+            {
+                mState->Running = false;
+                ++mState->Generation;
+                mWheel.Cancel(mState->Timer);
+                mState->Timer = 0U;
+            }
+        }
+
+        bool PeriodicTimer::IsRunning()
+        {
+            std::lock_guard<std::recursive_mutex> lock(mState->Mutex);
+            return mState->Running;
+        }
+
+        DeadlineTimer::DeadlineTimer(TimerWheel &wheel) : mWheel{wheel}
+        {
+        }
+
+        DeadlineTimer::~DeadlineTimer() noexcept
+        {
+            Cancel();
+        }
+
+        bool DeadlineTimer::Arm(
+            TimerWheel::Clock::duration delay,
+            std::weak_ptr<std::mutex> mutex,
+            TimerWheel::Callback callback)
+        {
+            if (mTimer != 0U)
+            {
+                return false;
+            }
+
+            const std::uint64_t cGeneration{++mGeneration};
+            mTimer = mWheel.Schedule(
+                delay,
+                [this, mutex, cGeneration, callback]()
+                {
+                    // The mutex shares the owner's lifetime, and the owner
+                    // holds this deadline.
+                    std::shared_ptr<std::mutex> _mutex{mutex.lock()};
+                    if (!_mutex)
+                    {
+                        return;
+                    }
+
+                    std::lock_guard<std::mutex> _lock(*_mutex);
+                    if (mTimer != 0U && mGeneration == cGeneration)
+                    {
+                        mTimer = 0U;
+                        callback();
+                    }
+                });
+            return true;
+        }
+
+        void DeadlineTimer::Cancel() noexcept
+        {
+            if (mTimer != 0U)
+            {
+                mWheel.Cancel(mTimer);
+                mTimer = 0U;
+            }
+        }
+
+        bool DeadlineTimer::IsArmed() const noexcept
+        {
+            return mTimer != 0U;
+        }
+    }
+}
@@ -0,0 +1,227 @@
+/// @file src/ara/core/timer_wheel.h
+/// @brief Hierarchical timer wheel shared by the whole process.
+/// @details Timers are hashed into a small number of wheel levels by their
+///          expiry tick. Level k has the same number of slots as level 0, but
+///          each of its slots spans slotCount^k ticks; when the lower level
+///          wraps, the due slot of the next level is redistributed
+///          ("cascaded") downwards. Arming and cancelling are O(1), and one
+///          thread serves every timer of the process regardless of how far
+///          in the future it expires. The thread sleeps until the next
+///          occupied slot instead of waking on every tick.
+///
+///          Expiry callbacks are handed to an Executor when one is given,
+///          so slow callbacks never delay other timers; otherwise they run
+///          on the wheel thread and must not block.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_CORE_TIMER_WHEEL_H
+#define ARA_CORE_TIMER_WHEEL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "./executor.h"
+
+namespace ara
+{
+    namespace core
+    {
+        /// @brief Single-threaded hierarchical timer wheel
+        class TimerWheel
+        {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            /// @brief Handle of an armed timer (never 0)
+            using TimerId = std::uint64_t;
+
+            /// @brief Expiry callback
+            using Callback = std::function<void()>;
+
+            /// @brief Number of wheel levels
+            static const std::size_t cLevelCount;
+
+        private:
+            struct Timer
+            {
+                TimerId Id;
+                std::uint64_t ExpiryTick;
+                Callback Handler;
+            };
+
+            using Slot = std::list<Timer>;
+
+            struct Location
+            {
+                std::size_t Level;
+                std::size_t SlotIndex;
+                Slot::iterator Position;
+            };
+
+            const Clock::duration mTick;
+            const Clock::time_point mEpoch;
+            const std::size_t mSlotCount;
+            Executor *const mExecutor;
+            // Ticks spanned by one slot of each level
+            std::vector<std::uint64_t> mSpans;
+            std::vector<std::vector<Slot>> mLevels;
+            std::unordered_map<TimerId, Location> mIndex;
+            std::uint64_t mCurrentTick{0U};
+            // Tick the thread sleeps until while timers are pending
+            std::uint64_t mWaitTick{0U};
+            TimerId mNextId{1U};
+            std::mutex mMutex;
+            std::condition_variable mWakeup;
+            bool mStopping{false};
+            std::thread mThread;
+
+            std::uint64_t tickAt(Clock::time_point time) const noexcept;
+            void place(Slot &source, Slot::iterator timer);
+            void advance(std::vector<Callback> &expired);
+            std::uint64_t nextEventTick() const noexcept;
+            void loop();
+
+        public:
+            /// @brief Start the wheel thread
+            /// @param tick Timer resolution; expiries are rounded up to it
+            /// @param slotCount Number of slots per level (at least two)
+            /// @param executor Runs the expiry callbacks; nullptr runs them
+            ///        on the wheel thread
+            TimerWheel(
+                Clock::duration tick,
+                std::size_t slotCount,
+                Executor *executor = nullptr);
+
+            /// @brief Stop the thread; pending timers never fire
+            ~TimerWheel() noexcept;
+
+            TimerWheel(const TimerWheel &) = delete;
+            TimerWheel &operator=(const TimerWheel &) = delete;
+
+            /// @brief Process-wide wheel with a 5 ms tick and 512 slots per
+            ///        level, dispatching through GetDefaultExecutor()
+            /// @note Never destroyed, so timers may still be cancelled during
+            ///       static destruction.
+            static TimerWheel &Instance();
+
+            /// @brief Arm a one-shot timer
+            /// @param delay Time until expiry
+            /// @param callback Invoked once on expiry
+            /// @returns Handle for Cancel()
+            TimerId Schedule(Clock::duration delay, Callback callback);
+
+            /// @brief Disarm a timer
+            /// @returns False if the timer already fired or is unknown
+            bool Cancel(TimerId id);
+
+            /// @brief Number of armed timers
+            std::size_t PendingCount();
+        };
+
+        /// @brief Fixed-delay periodic callback on a timer wheel
+        /// @details The callback runs with an internal lock held, so once
+        ///          Stop() returns it is neither running nor going to run.
+        ///          Stop() may also be called from within the callback.
+        class PeriodicTimer
+        {
+        private:
+            struct State
+            {
+                std::recursive_mutex Mutex;
+                bool Running{false};
+                std::uint64_t Generation{0U};
+                TimerWheel::TimerId Timer{0U};
+            };
+
+            TimerWheel &mWheel;
+            const TimerWheel::Clock::duration mPeriod;
+            const TimerWheel::Callback mCallback;
+            std::shared_ptr<State> mState;
+
+            static void arm(
+                TimerWheel &wheel,
+                TimerWheel::Clock::duration period,
+                TimerWheel::Callback callback,
+                const std::shared_ptr<State> &state);
+
+        public:
+            /// @brief Constructor; the timer starts stopped
+            /// @param wheel Wheel to schedule on; must outlive the timer
+            /// @param period Delay between two invocations
+            /// @param callback Invoked once per period
+            PeriodicTimer(
+                TimerWheel &wheel,
+                TimerWheel::Clock::duration period,
+                TimerWheel::Callback callback);
+
+            /// @brief Stop the timer
+            ~PeriodicTimer() noexcept;
+
+            PeriodicTimer(const PeriodicTimer &) = delete;
+            PeriodicTimer &operator=(const PeriodicTimer &) = delete;
+
+            /// @brief Start invoking the callback; no-op if already running
+            void Start();
+
+            /// @brief Stop invoking the callback
+            void Stop() noexcept;
+
+            /// @brief Indicate whether the timer is running
+            bool IsRunning();
+        };
+
+        /// @brief One-shot deadline that fires under its owner's mutex
+        /// @details Meant as a member of an object shared with the wheel,
+        ///          such as a write batch flushed at the latest after a
+        ///          delay. Arm() and Cancel() must be called with the owner's
+        ///          mutex held. The callback runs with that mutex held, and
+        ///          only while the owner is alive and the deadline it was
+        ///          armed for has been neither cancelled nor replaced, so an
+        ///          expiry that raced with Cancel() does nothing.
+        class DeadlineTimer
+        {
+        private:
+            TimerWheel &mWheel;
+            TimerWheel::TimerId mTimer{0U};
+            // Tells a dispatched expiry from the deadline armed now.
+            std::uint64_t mGeneration{0U};
+
+        public:
+            /// @brief Constructor; the deadline starts disarmed
+            /// @param wheel Wheel to schedule on; must outlive the deadline
+            explicit DeadlineTimer(TimerWheel &wheel = TimerWheel::Instance());
+
+            /// @brief Disarm the deadline
+            ~DeadlineTimer() noexcept;
+
+            DeadlineTimer(const DeadlineTimer &) = delete;
+            DeadlineTimer &operator=(const DeadlineTimer &) = delete;
+
+            /// @brief Arm the deadline unless it is already armed
+            /// @param delay Time until expiry
+            /// @param mutex Owner's mutex, usually aliasing the shared owner
+            /// @param callback Invoked once on expiry with the mutex held
+            /// @returns False if an earlier deadline was still armed
+            bool Arm(
+                TimerWheel::Clock::duration delay,
+                std::weak_ptr<std::mutex> mutex,
+                TimerWheel::Callback callback);
+
+            /// @brief Disarm the deadline; no-op if it is not armed
+            void Cancel() noexcept;
+
+            /// @brief Indicate whether the deadline is armed
+            bool IsArmed() const noexcept;
+        };
+    }
+}
+
+#endif
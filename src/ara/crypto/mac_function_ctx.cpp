@@ -19,6 +19,7 @@ namespace ara
             HMAC_CTX *ctx{nullptr};
 #endif
             const EVP_MD *md{nullptr};
+            bool keyed{false};
             bool started{false};
         };
 
@@ -113,6 +114,25 @@ namespace ara
                 return core::Result<void>::FromError(
                     MakeErrorCode(CryptoErrc::kProcessingNotStarted));
 #endif
+            mImpl->keyed = true;
+            mImpl->started = true;
+            return core::Result<void>{};
+        }
+
+        core::Result<void> MessageAuthenticationCodeCtx::Restart()
+        {
+            if (!mImpl || !mImpl->ctx || !mImpl->keyed)
+                return core::Result<void>::FromError(
+                    MakeErrorCode(CryptoErrc::kProcessingNotStarted));
+
+            // A null key keeps the one given to the last Start().
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+            if (EVP_MAC_init(mImpl->ctx, nullptr, 0, nullptr) != 1)
+#else
+            if (HMAC_Init_ex(mImpl->ctx, nullptr, 0, nullptr, nullptr) != 1)
+#endif
+                return core::Result<void>::FromError(
+                    MakeErrorCode(CryptoErrc::kProcessingNotStarted));
             mImpl->started = true;
             return core::Result<void>{};
         }
@@ -165,6 +185,34 @@ namespace ara
             return core::Result<std::vector<std::uint8_t>>::FromValue(std::move(tag));
         }
 
+        core::Result<void> MessageAuthenticationCodeCtx::Finish(
+            std::uint8_t *tag, std::size_t length)
+        {
+            if (!mImpl || !mImpl->started)
+                return core::Result<void>::FromError(
+                    MakeErrorCode(CryptoErrc::kProcessingNotStarted));
+
+            std::uint8_t full[EVP_MAX_MD_SIZE];
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+            std::size_t len = 0;
+            const bool finished =
+                EVP_MAC_final(mImpl->ctx, full, &len, sizeof(full)) == 1;
+#else
+            unsigned int len = 0;
+            const bool finished = HMAC_Final(mImpl->ctx, full, &len) == 1;
+#endif
+            mImpl->started = false;
+            if (!finished)
+                return core::Result<void>::FromError(
+                    MakeErrorCode(CryptoErrc::kProcessingNotStarted));
+            if (tag == nullptr || length == 0U || length > len)
+                return core::Result<void>::FromError(
+                    MakeErrorCode(CryptoErrc::kInvalidArgument));
+
+            std::memcpy(tag, full, length);
+            return core::Result<void>{};
+        }
+
         core::Result<std::vector<std::uint8_t>>
         MessageAuthenticationCodeCtx::FinishTruncated(size_t truncatedLength)
         {
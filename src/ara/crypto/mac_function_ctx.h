@@ -31,6 +31,11 @@ namespace ara
             /// @brief Initialize HMAC with a key.
             core::Result<void> Start(const std::vector<std::uint8_t> &key);
 
+            /// @brief Start another MAC under the key of the last Start().
+            /// @details Reuses the keyed inner/outer digest states, so the key
+            ///          schedule is not redone per message.
+            core::Result<void> Restart();
+
             /// @brief Feed data into the running HMAC.
             core::Result<void> Update(const std::vector<std::uint8_t> &data);
 
@@ -40,6 +45,12 @@ namespace ara
             /// @brief Finalize and return the MAC tag.
             core::Result<std::vector<std::uint8_t>> Finish();
 
+            /// @brief Finalize into a caller buffer, truncating the tag to its size.
+            /// @param tag Output buffer.
+            /// @param length Number of leading tag bytes to write (1..digest size).
+            /// @returns Ok, or kInvalidArgument if the length exceeds the tag.
+            core::Result<void> Finish(std::uint8_t *tag, std::size_t length);
+
             /// @brief Finalize and return a truncated MAC tag (SWS_CRYPT_22250).
             /// @param truncatedLength Desired MAC length in bytes.
             /// @returns Truncated MAC tag, or error.
@@ -33,6 +33,13 @@ namespace ara
             kDlt = 0x08         ///< DLT (Diagnostic Log and Trace) UDP sink — compatible with dlt-viewer
         };
 
+        /// @brief DLT message mode of a log context
+        enum class LogMessageMode : std::uint8_t
+        {
+            kVerbose = 0x00,    ///< Arguments are sent with their type information
+            kNonVerbose = 0x01  ///< Only a message ID and the raw argument values are sent
+        };
+
         /// @brief Logging client connection state
         enum class ClientState : std::int8_t
         {
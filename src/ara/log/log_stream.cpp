@@ -2,235 +2,522 @@
 /// @brief Implementation for log stream.
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
+#include <cstdio>
 #include "./log_stream.h"
 
 namespace ara
 {
     namespace log
     {
-        void LogStream::concat(std::string &&log)
+        const std::size_t LogStream::cInlineCapacity;
+        const std::size_t LogStream::cRecordHeaderSize;
+        const std::size_t LogStream::cMaxRecordSize;
+        const std::size_t LogStream::cMaxStringRecordSize;
+
+        namespace
+        {
+            template <typename T>
+            T readValue(const LogArgument &argument) noexcept
+            {
+                T _result;
+                std::memcpy(&_result, argument.Data, sizeof(T));
+                return _result;
+            }
+
+            void appendDecimal(std::uint64_t magnitude, bool negative, std::string &output)
+            {
+                char _digits[20];
+                std::size_t _count{0U};
+                do
+                {
+                    _digits[_count++] = static_cast<char>('0' + magnitude % 10U);
+                    magnitude /= 10U;
+                } while (magnitude > 0U);
+
+                if (negative)
+                {
+                    output += '-';
+                }
+                while (_count > 0U)
+                {
+                    output += _digits[--_count];
+                }
+            }
+
+            void appendSigned(std::int64_t value, std::string &output)
+            {
+                // Negate in unsigned arithmetic so INT64_MIN does not overflow.
+                const std::uint64_t cMagnitude{
+                    value < 0
+                        ? 0U - static_cast<std::uint64_t>(value)
+                        : static_cast<std::uint64_t>(value)};
+                appendDecimal(cMagnitude, value < 0, output);
+            }
+
+            void appendFixed(double value, std::string &output)
+            {
+                // Large enough for %f of DBL_MAX: 309 digits and 7 more.
+                char _text[320];
+                const int cLength{std::snprintf(_text, sizeof(_text), "%f", value)};
+                if (cLength > 0)
+                {
+                    output.append(
+                        _text,
+                        std::min(static_cast<std::size_t>(cLength), sizeof(_text) - 1U));
+                }
+            }
+
+            const char *appendLiteral(const char *format, std::string &output)
+            {
+                const char *_end{format};
+                while (*_end != '\0' && *_end != '{')
+                {
+                    ++_end;
+                }
+                output.append(format, _end);
+
+                return _end;
+            }
+
+            const char *skipPlaceholder(const char *format) noexcept
+            {
+                while (*format != '\0' && *format != '}')
+                {
+                    ++format;
+                }
+
+                return *format == '}' ? format + 1 : format;
+            }
+
+            const char *appendRemainder(const char *format, std::string &output)
+            {
+                // Placeholders without an argument are kept as they are.
+                if (format != nullptr)
+                {
+                    output += format;
+                }
+
+                return nullptr;
+            }
+
+            void appendHex(const LogArgument &argument, std::string &output)
+            {
+                const char cDigits[]{"0123456789abcdef"};
+                for (std::size_t i = 0U; i < argument.Size; ++i)
+                {
+                    output += cDigits[argument.Data[i] >> 4U];
+                    output += cDigits[argument.Data[i] & 0x0FU];
+                }
+            }
+        }
+
+        LogStream::LogStream() noexcept : mSize{0U},
+                                          mArgumentCount{0U},
+                                          mMessageId{0U}
         {
-            mLogs += log;
         }
 
-        void LogStream::Flush() noexcept
+        LogStream::LogStream(const LogStream &other) : mOverflow(other.mOverflow),
+                                                       mSize{other.mSize},
+                                                       mArgumentCount{other.mArgumentCount},
+                                                       mMessageId{other.mMessageId}
         {
-            mLogs.clear();
+            if (mOverflow.empty())
+            {
+                std::memcpy(mInline.data(), other.mInline.data(), mSize);
+            }
         }
 
-        LogStream &LogStream::operator<<(const LogStream &value)
+        LogStream &LogStream::operator=(const LogStream &other)
         {
-            mLogs += value.mLogs;
+            if (this != &other)
+            {
+                mOverflow = other.mOverflow;
+                mSize = other.mSize;
+                mArgumentCount = other.mArgumentCount;
+                mMessageId = other.mMessageId;
+                if (mOverflow.empty())
+                {
+                    std::memcpy(mInline.data(), other.mInline.data(), mSize);
+                }
+            }
 
             return *this;
         }
 
-        LogStream &LogStream::operator<<(bool value)
+        LogStream::LogStream(LogStream &&other) noexcept : mOverflow(std::move(other.mOverflow)),
+                                                           mSize{other.mSize},
+                                                           mArgumentCount{other.mArgumentCount},
+                                                           mMessageId{other.mMessageId}
         {
-            const std::string cTrueString = "true";
-            const std::string cFalseString = "false";
+            if (mOverflow.empty())
+            {
+                std::memcpy(mInline.data(), other.mInline.data(), mSize);
+            }
+            other.Flush();
+        }
 
-            std::string _valueString;
-            if (value)
+        LogStream &LogStream::operator=(LogStream &&other) noexcept
+        {
+            if (this != &other)
             {
-                _valueString = cTrueString;
+                mOverflow = std::move(other.mOverflow);
+                mSize = other.mSize;
+                mArgumentCount = other.mArgumentCount;
+                mMessageId = other.mMessageId;
+                if (mOverflow.empty())
+                {
+                    std::memcpy(mInline.data(), other.mInline.data(), mSize);
+                }
+                other.Flush();
             }
-            else
+
+            return *this;
+        }
+
+        const std::uint8_t *LogStream::data() const noexcept
+        {
+            return mOverflow.empty() ? mInline.data() : mOverflow.data();
+        }
+
+        std::uint8_t *LogStream::reserve(std::size_t size)
+        {
+            if (mOverflow.empty())
             {
-                _valueString = cFalseString;
+                if (mSize + size <= cInlineCapacity)
+                {
+                    std::uint8_t *_result{mInline.data() + mSize};
+                    mSize += size;
+                    return _result;
+                }
+
+                mOverflow.reserve(2U * (mSize + size));
+                mOverflow.assign(mInline.data(), mInline.data() + mSize);
+            }
+
+            mOverflow.resize(mSize + size);
+            std::uint8_t *_result{mOverflow.data() + mSize};
+            mSize += size;
+            return _result;
+        }
+
+        void LogStream::append(LogArgumentType type, const void *value, std::size_t size)
+        {
+            const std::uint16_t cSize{static_cast<std::uint16_t>(size)};
+            std::uint8_t *_record{reserve(cRecordHeaderSize + size)};
+            _record[0U] = static_cast<std::uint8_t>(type);
+            std::memcpy(_record + 1U, &cSize, sizeof(cSize));
+            if (size > 0U)
+            {
+                std::memcpy(_record + cRecordHeaderSize, value, size);
+            }
+            ++mArgumentCount;
+        }
+
+        void LogStream::appendSequence(
+            LogArgumentType type, const void *value, std::size_t size)
+        {
+            // Longer sequences become consecutive records; their text forms
+            // concatenate to the same result.
+            const std::uint8_t *_bytes{static_cast<const std::uint8_t *>(value)};
+            const std::size_t cMaxChunk{
+                type == LogArgumentType::kString ? cMaxStringRecordSize : cMaxRecordSize};
+            do
+            {
+                const std::size_t cChunk{std::min(size, cMaxChunk)};
+                append(type, _bytes, cChunk);
+                _bytes += cChunk;
+                size -= cChunk;
+            } while (size > 0U);
+        }
+
+        void LogStream::Flush() noexcept
+        {
+            mOverflow.clear();
+            mOverflow.shrink_to_fit();
+            mSize = 0U;
+            mArgumentCount = 0U;
+            mMessageId = 0U;
+        }
+
+        LogStream &LogStream::operator<<(const LogStream &value)
+        {
+            if (&value == this)
+            {
+                const LogStream cCopy{value};
+                return *this << cCopy;
+            }
+
+            if (value.mSize > 0U)
+            {
+                std::memcpy(reserve(value.mSize), value.data(), value.mSize);
+                mArgumentCount += value.mArgumentCount;
+            }
+
+            if (mMessageId == 0U)
+            {
+                mMessageId = value.mMessageId;
             }
-            concat(std::move(_valueString));
 
             return *this;
         }
 
+        LogStream &LogStream::operator<<(bool value)
+        {
+            const std::uint8_t cValue{static_cast<std::uint8_t>(value ? 1U : 0U)};
+            return appendValue(LogArgumentType::kBool, cValue);
+        }
+
         LogStream &LogStream::operator<<(int8_t value)
         {
-            std::string _valueString = std::to_string(static_cast<int>(value));
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kInt8, value);
         }
 
         LogStream &LogStream::operator<<(uint8_t value)
         {
-            std::string _valueString = std::to_string(static_cast<unsigned>(value));
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kUInt8, value);
         }
 
         LogStream &LogStream::operator<<(int16_t value)
         {
-            std::string _valueString = std::to_string(value);
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kInt16, value);
         }
 
         LogStream &LogStream::operator<<(uint16_t value)
         {
-            std::string _valueString = std::to_string(value);
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kUInt16, value);
         }
 
         LogStream &LogStream::operator<<(int32_t value)
         {
-            std::string _valueString = std::to_string(value);
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kInt32, value);
         }
 
         LogStream &LogStream::operator<<(uint32_t value)
         {
-            std::string _valueString = std::to_string(value);
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kUInt32, value);
         }
 
         LogStream &LogStream::operator<<(int64_t value)
         {
-            std::string _valueString = std::to_string(value);
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kInt64, value);
         }
 
         LogStream &LogStream::operator<<(uint64_t value)
         {
-            std::string _valueString = std::to_string(value);
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kUInt64, value);
         }
 
         LogStream &LogStream::operator<<(float value)
         {
-            std::string _valueString = std::to_string(value);
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kFloat32, value);
         }
 
         LogStream &LogStream::operator<<(double value)
         {
-            std::string _valueString = std::to_string(value);
-            concat(std::move(_valueString));
-            return *this;
+            return appendValue(LogArgumentType::kFloat64, value);
         }
 
         LogStream &LogStream::operator<<(const std::string &value)
         {
-            mLogs += value;
-
+            appendSequence(LogArgumentType::kString, value.data(), value.size());
             return *this;
         }
 
         LogStream &LogStream::operator<<(const char *value)
         {
-            std::string _valueString{value};
-            concat(std::move(_valueString));
-
+            appendSequence(LogArgumentType::kString, value, std::strlen(value));
             return *this;
         }
 
         LogStream &LogStream::operator<<(LogLevel value)
         {
-            switch (value)
-            {
-            case LogLevel::kOff:
-                mLogs += "Off";
-                break;
-            case LogLevel::kFatal:
-                mLogs += "Fatal";
-                break;
-            case LogLevel::kError:
-                mLogs += "Error";
-                break;
-            case LogLevel::kWarn:
-                mLogs += "Warning";
-                break;
-            case LogLevel::kInfo:
-                mLogs += "Info";
-                break;
-            case LogLevel::kDebug:
-                mLogs += "Debug";
-                break;
-            case LogLevel::kVerbose:
-                mLogs += "Verbose";
-                break;
-            }
+            return appendValue(LogArgumentType::kLogLevel, value);
+        }
 
+        LogStream &LogStream::operator<<(const ara::core::ErrorCode &value)
+        {
+            const std::string cMessage{value.Message()};
+            appendSequence(LogArgumentType::kString, cMessage.data(), cMessage.size());
             return *this;
         }
 
-        LogStream &LogStream::operator<<(const ara::core::ErrorCode &value)
+        LogStream &LogStream::operator<<(const ara::core::InstanceSpecifier &value) noexcept
         {
-            std::string _valueString = value.Message();
-            concat(std::move(_valueString));
+            const std::string cPath{value.ToString()};
+            appendSequence(LogArgumentType::kString, cPath.data(), cPath.size());
+            return *this;
+        }
 
+        LogStream &LogStream::operator<<(const std::vector<std::uint8_t> &value)
+        {
+            appendSequence(LogArgumentType::kRaw, value.data(), value.size());
             return *this;
         }
 
-        LogStream &LogStream::operator<<(const ara::core::InstanceSpecifier &value) noexcept
+        LogStream &LogStream::operator<<(core::Span<const core::Byte> data)
         {
-            std::string _valueString = value.ToString();
-            concat(std::move(_valueString));
+            appendSequence(LogArgumentType::kRaw, data.data(), data.size());
+            return *this;
+        }
 
+        LogStream &LogStream::operator<<(const core::StringView &value)
+        {
+            appendSequence(LogArgumentType::kString, value.data(), value.size());
             return *this;
         }
 
-        LogStream &LogStream::operator<<(std::vector<std::uint8_t> value)
+        LogStream &LogStream::WithMessage(std::uint32_t messageId, const char *format)
         {
-            std::stringstream _stringstream;
-            // Store bytes in the stream in hexadecimal format and fill with '0'.
-            _stringstream << std::hex << std::setfill('0');
+            // The record holds the ID followed by the literal's address.
+            std::uint8_t _value[sizeof(messageId) + sizeof(format)];
+            std::memcpy(_value, &messageId, sizeof(messageId));
+            std::memcpy(_value + sizeof(messageId), &format, sizeof(format));
+            append(LogArgumentType::kFormat, _value, sizeof(_value));
 
-            for (uint8_t _byte : value)
+            if (mMessageId == 0U)
             {
-                uint32_t _byteInteger = static_cast<uint32_t>(_byte);
-                // Set width to two characters (0x00).
-                _stringstream << std::setw(2) << _byteInteger;
+                mMessageId = messageId;
             }
 
-            std::string _valueString = _stringstream.str();
-            concat(std::move(_valueString));
-
             return *this;
         }
 
-        LogStream &LogStream::WithLocation(std::string file, int line)
+        std::uint32_t LogStream::MessageId() const noexcept
         {
-            const std::string cSeparator = ":";
-            std::string _lineString = std::to_string(line);
-            std::string _locationString = file + cSeparator + _lineString;
-            concat(std::move(_locationString));
+            return mMessageId;
+        }
 
-            return *this;
+        const char *LogStream::FormatString(const LogArgument &argument) noexcept
+        {
+            const char *_result;
+            std::memcpy(&_result, argument.Data + sizeof(std::uint32_t), sizeof(_result));
+            return _result;
         }
 
-        std::string LogStream::ToString() const noexcept
+        LogStream &LogStream::WithLocation(std::string file, int line)
         {
-            return mLogs;
+            *this << file << ":" << static_cast<int32_t>(line);
+            return *this;
         }
 
-        LogStream &LogStream::operator<<(core::Span<const core::Byte> data)
+        void LogStream::FormatArgument(const LogArgument &argument, std::string &output)
         {
-            std::stringstream _stringstream;
-            _stringstream << std::hex << std::setfill('0');
-            for (std::size_t i = 0; i < data.size(); ++i)
+            // Same text as std::to_string() produced before.
+            switch (argument.Type)
             {
-                _stringstream << std::setw(2)
-                              << static_cast<unsigned>(
-                                     core::to_integer<std::uint8_t>(data[i]));
+            case LogArgumentType::kBool:
+                output += argument.Data[0U] != 0U ? "true" : "false";
+                break;
+            case LogArgumentType::kInt8:
+                appendSigned(readValue<int8_t>(argument), output);
+                break;
+            case LogArgumentType::kInt16:
+                appendSigned(readValue<int16_t>(argument), output);
+                break;
+            case LogArgumentType::kInt32:
+                appendSigned(readValue<int32_t>(argument), output);
+                break;
+            case LogArgumentType::kInt64:
+                appendSigned(readValue<int64_t>(argument), output);
+                break;
+            case LogArgumentType::kUInt8:
+                appendDecimal(readValue<uint8_t>(argument), false, output);
+                break;
+            case LogArgumentType::kUInt16:
+                appendDecimal(readValue<uint16_t>(argument), false, output);
+                break;
+            case LogArgumentType::kUInt32:
+                appendDecimal(readValue<uint32_t>(argument), false, output);
+                break;
+            case LogArgumentType::kUInt64:
+                appendDecimal(readValue<uint64_t>(argument), false, output);
+                break;
+            case LogArgumentType::kFloat32:
+                appendFixed(readValue<float>(argument), output);
+                break;
+            case LogArgumentType::kFloat64:
+                appendFixed(readValue<double>(argument), output);
+                break;
+            case LogArgumentType::kString:
+                output.append(reinterpret_cast<const char *>(argument.Data), argument.Size);
+                break;
+            case LogArgumentType::kRaw:
+                appendHex(argument, output);
+                break;
+            case LogArgumentType::kFormat:
+                output += FormatString(argument);
+                break;
+            case LogArgumentType::kLogLevel:
+                switch (readValue<LogLevel>(argument))
+                {
+                case LogLevel::kOff:
+                    output += "Off";
+                    break;
+                case LogLevel::kFatal:
+                    output += "Fatal";
+                    break;
+                case LogLevel::kError:
+                    output += "Error";
+                    break;
+                case LogLevel::kWarn:
+                    output += "Warning";
+                    break;
+                case LogLevel::kInfo:
+                    output += "Info";
+                    break;
+                case LogLevel::kDebug:
+                    output += "Debug";
+                    break;
+                case LogLevel::kVerbose:
+                    output += "Verbose";
+                    break;
+                }
+                break;
             }
-            std::string _valueString = _stringstream.str();
-            concat(std::move(_valueString));
-            return *this;
         }
 
-        LogStream &LogStream::operator<<(const core::StringView &value)
+        void LogStream::FormatTo(std::string &output) const
         {
-            std::string _valueString(value.data(), value.size());
-            concat(std::move(_valueString));
-            return *this;
+            // Text of the current format up to its next placeholder is
+            // emitted before the argument that fills the placeholder.
+            const char *_format{nullptr};
+            ForEachArgument(
+                [&output, &_format](const LogArgument &argument)
+                {
+                    if (argument.Type == LogArgumentType::kFormat)
+                    {
+                        _format = appendRemainder(_format, output);
+                        _format = appendLiteral(FormatString(argument), output);
+                        return;
+                    }
+
+                    FormatArgument(argument, output);
+                    if (_format != nullptr && *_format == '{')
+                    {
+                        _format = appendLiteral(skipPlaceholder(_format), output);
+                    }
+                });
+            appendRemainder(_format, output);
+        }
+
+        std::string LogStream::ToString() const noexcept
+        {
+            std::string _result;
+            _result.reserve(mSize);
+            FormatTo(_result);
+            return _result;
+        }
+
+        std::size_t LogStream::ArgumentCount() const noexcept
+        {
+            return mArgumentCount;
+        }
+
+        std::size_t LogStream::ByteSize() const noexcept
+        {
+            return mSize;
         }
     }
 }
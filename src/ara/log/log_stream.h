@@ -1,11 +1,21 @@
 /// @file src/ara/log/log_stream.h
 /// @brief Declarations for log stream.
-/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+/// @details A LogStream records its arguments in binary form - a type tag,
+///          a length and the raw value - in a fixed inline buffer, so
+///          building a log message does not allocate for typical message
+///          sizes. Only longer messages spill to the heap. Text is produced
+///          lazily by ToString()/FormatTo() for the sinks that need it,
+///          while binary sinks such as DLT walk the typed arguments.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
 
 #ifndef LOG_STREAM_H
 #define LOG_STREAM_H
 
+#include <array>
 #include <cstdint>
+#include <cstring>
+#include <string>
 #include <vector>
 #include <utility>
 #include "../core/error_code.h"
@@ -20,14 +30,77 @@ namespace ara
 {
     namespace log
     {
+        /// @brief Type tag of a recorded log argument
+        enum class LogArgumentType : std::uint8_t
+        {
+            kBool = 0x00,     ///< Boolean, one byte
+            kInt8 = 0x01,     ///< Signed 8-bit integer
+            kInt16 = 0x02,    ///< Signed 16-bit integer
+            kInt32 = 0x03,    ///< Signed 32-bit integer
+            kInt64 = 0x04,    ///< Signed 64-bit integer
+            kUInt8 = 0x05,    ///< Unsigned 8-bit integer
+            kUInt16 = 0x06,   ///< Unsigned 16-bit integer
+            kUInt32 = 0x07,   ///< Unsigned 32-bit integer
+            kUInt64 = 0x08,   ///< Unsigned 64-bit integer
+            kFloat32 = 0x09,  ///< Single-precision float
+            kFloat64 = 0x0A,  ///< Double-precision float
+            kString = 0x0B,   ///< Character sequence without terminator
+            kRaw = 0x0C,      ///< Byte sequence, formatted as hexadecimal text
+            kLogLevel = 0x0D, ///< LogLevel, one byte
+            kFormat = 0x0E    ///< Message ID and format string pointer of a log site
+        };
+
+        /// @brief Read-only view of one recorded argument
+        struct LogArgument
+        {
+            /// @brief Argument type
+            LogArgumentType Type;
+            /// @brief Value in host byte order, or the sequence bytes
+            const std::uint8_t *Data;
+            /// @brief Value or sequence size in bytes
+            std::size_t Size;
+        };
+
         /// @brief A stream pipeline to combine log entities
         class LogStream final
         {
+        public:
+            /// @brief Bytes recorded before the stream spills to the heap
+            static const std::size_t cInlineCapacity{512U};
+
         private:
-            std::string mLogs;
-            void concat(std::string &&log);
+            // Tag byte followed by a 16-bit host-order length
+            static const std::size_t cRecordHeaderSize{3U};
+            static const std::size_t cMaxRecordSize{0xFFFFU};
+            // DLT adds a terminator to strings within the same 16-bit length.
+            static const std::size_t cMaxStringRecordSize{cMaxRecordSize - 1U};
+
+            std::array<std::uint8_t, cInlineCapacity> mInline;
+            std::vector<std::uint8_t> mOverflow;
+            std::size_t mSize;
+            std::size_t mArgumentCount;
+            std::uint32_t mMessageId;
+
+            const std::uint8_t *data() const noexcept;
+            std::uint8_t *reserve(std::size_t size);
+            void append(LogArgumentType type, const void *value, std::size_t size);
+            void appendSequence(LogArgumentType type, const void *value, std::size_t size);
+
+            template <typename T>
+            LogStream &appendValue(LogArgumentType type, T value)
+            {
+                append(type, &value, sizeof(T));
+                return *this;
+            }
 
         public:
+            LogStream() noexcept;
+            LogStream(const LogStream &other);
+            LogStream &operator=(const LogStream &other);
+            LogStream(LogStream &&other) noexcept;
+            LogStream &operator=(LogStream &&other) noexcept;
+            ~LogStream() noexcept = default;
+
             /// @brief Clear the stream
             void Flush() noexcept;
 
@@ -39,7 +112,10 @@ namespace ara
             LogStream &operator<<(const Argument<T> &arg)
             {
                 std::string _argumentString = arg.ToString();
-                concat(std::move(_argumentString));
+                appendSequence(
+                    LogArgumentType::kString,
+                    _argumentString.data(),
+                    _argumentString.size());
 
                 return *this;
             }
@@ -116,7 +192,7 @@ namespace ara
             /// @brief Data array insertion operator
             /// @param value Data byte vector
             /// @returns Reference to the current log stream
-            LogStream &operator<<(std::vector<std::uint8_t> value);
+            LogStream &operator<<(const std::vector<std::uint8_t> &value);
 
             /// @brief Insert a raw-byte span as hexadecimal (SWS_LOG_00101).
             LogStream &operator<<(core::Span<const core::Byte> data);
@@ -124,6 +200,24 @@ namespace ara
             /// @brief StringView insertion operator (SWS_LOG_00029).
             LogStream &operator<<(const core::StringView &value);
 
+            /// @brief Mark the stream as a log site with a message ID
+            /// @param messageId Compile-time message ID, see ARA_LOG_MESSAGE
+            /// @param format Format string literal; it must outlive the stream
+            /// @returns Reference to the current log stream
+            /// @note Only the ID and the literal's address are recorded. The
+            ///       text form substitutes the following arguments for the
+            ///       format's placeholders.
+            LogStream &WithMessage(std::uint32_t messageId, const char *format);
+
+            /// @brief Message ID of the log site
+            /// @returns ID given to WithMessage, or 0 for a verbose-only stream
+            std::uint32_t MessageId() const noexcept;
+
+            /// @brief Format string of a kFormat argument
+            /// @param argument Recorded kFormat argument
+            /// @returns Format string literal
+            static const char *FormatString(const LogArgument &argument) noexcept;
+
             /// @brief Log stream at a certian file and a certian line within the file
             /// @param file File name
             /// @param line Line number
@@ -133,6 +227,44 @@ namespace ara
             /// @brief Convert the current log stream to a standard string
             /// @returns Serialized log stream string
             std::string ToString() const noexcept;
+
+            /// @brief Append the text form of the stream to a string
+            /// @param output String to append to; its capacity is reused
+            void FormatTo(std::string &output) const;
+
+            /// @brief Append the text form of a single argument to a string
+            /// @param argument Recorded argument
+            /// @param output String to append to
+            static void FormatArgument(const LogArgument &argument, std::string &output);
+
+            /// @brief Number of recorded arguments
+            std::size_t ArgumentCount() const noexcept;
+
+            /// @brief Number of recorded bytes, including the record headers
+            std::size_t ByteSize() const noexcept;
+
+            /// @brief Visit the recorded arguments in insertion order
+            /// @tparam Visitor Callable taking a const LogArgument &
+            /// @param visitor Argument visitor
+            template <typename Visitor>
+            void ForEachArgument(Visitor &&visitor) const
+            {
+                const std::uint8_t *const cData{data()};
+                std::size_t _offset{0U};
+                while (_offset < mSize)
+                {
+                    std::uint16_t _size;
+                    std::memcpy(&_size, cData + _offset + 1U, sizeof(_size));
+
+                    LogArgument _argument;
+                    _argument.Type = static_cast<LogArgumentType>(cData[_offset]);
+                    _argument.Data = cData + _offset + cRecordHeaderSize;
+                    _argument.Size = _size;
+                    visitor(_argument);
+
+                    _offset += cRecordHeaderSize + _size;
+                }
+            }
         };
     }
 }
@@ -11,9 +11,11 @@ namespace ara
     {
         Logger::Logger(std::string ctxId,
                        std::string ctxDescription,
-                       LogLevel ctxDefLogLevel) : mContextId{ctxId},
-                                                  mContextDescription{ctxDescription},
-                                                  mContextDefaultLogLevel{ctxDefLogLevel}
+                       LogLevel ctxDefLogLevel,
+                       LogMessageMode messageMode) : mContextId{ctxId},
+                                                     mContextDescription{ctxDescription},
+                                                     mContextDefaultLogLevel{ctxDefLogLevel},
+                                                     mMessageMode{messageMode}
         {
         }
 
@@ -90,6 +92,16 @@ namespace ara
             return mContextDefaultLogLevel;
         }
 
+        void Logger::SetMessageMode(LogMessageMode messageMode) noexcept
+        {
+            mMessageMode = messageMode;
+        }
+
+        LogMessageMode Logger::GetMessageMode() const noexcept
+        {
+            return mMessageMode;
+        }
+
         const std::string &Logger::GetContextId() const noexcept
         {
             return mContextId;
@@ -109,14 +121,11 @@ namespace ara
                 return _result;
             }
 
-            const std::string cContextId{"Context ID:"};
-            const std::string cContextDescription{"Context Description:"};
-            const std::string cLogLevel{"Log Level:"};
-            const std::string cSeperator{";"};
-
-            _result << cContextId << mContextId << cSeperator;
-            _result << cContextDescription << mContextDescription << cSeperator;
-            _result << cLogLevel << logLevel << cSeperator;
+            // Literals and member strings are copied into the stream's
+            // inline buffer; no temporary strings are built.
+            _result << "Context ID:" << mContextId << ";";
+            _result << "Context Description:" << mContextDescription << ";";
+            _result << "Log Level:" << logLevel << ";";
 
             return _result;
         }
@@ -124,9 +133,10 @@ namespace ara
         Logger Logger::CreateLogger(
             std::string ctxId,
             std::string ctxDescription,
-            LogLevel ctxDefLogLevel)
+            LogLevel ctxDefLogLevel,
+            LogMessageMode messageMode)
         {
-            Logger _result(ctxId, ctxDescription, ctxDefLogLevel);
+            Logger _result(ctxId, ctxDescription, ctxDefLogLevel, messageMode);
             return _result;
         }
     }
@@ -18,9 +18,11 @@ namespace ara
             std::string mContextId;
             std::string mContextDescription;
             LogLevel mContextDefaultLogLevel;
+            LogMessageMode mMessageMode;
             Logger(std::string ctxId,
                    std::string ctxDescription,
-                   LogLevel ctxDefLogLevel);
+                   LogLevel ctxDefLogLevel,
+                   LogMessageMode messageMode);
 
         public:
             Logger() = delete;
@@ -73,6 +75,16 @@ namespace ara
             /// @returns Effective log level
             LogLevel GetLogLevel() const noexcept;
 
+            /// @brief Select verbose or non-verbose DLT messages for this context
+            /// @param messageMode New message mode
+            /// @note Only streams started with ARA_LOG_MESSAGE can be sent
+            ///       non-verbose; other streams stay verbose.
+            void SetMessageMode(LogMessageMode messageMode) noexcept;
+
+            /// @brief Get the DLT message mode of this logger context
+            /// @returns Message mode
+            LogMessageMode GetMessageMode() const noexcept;
+
             /// @brief Get logger context identifier
             /// @returns Context ID string
             const std::string &GetContextId() const noexcept;
@@ -90,12 +102,14 @@ namespace ara
             /// @param ctxId Context ID
             /// @param ctxDescription Context description
             /// @param ctxDefLogLevel Context default log level
+            /// @param messageMode Context DLT message mode
             /// @returns A new logger for that specifc context
             /// @note Log with less severity than the default log level are ignored.
             static Logger CreateLogger(
                 std::string ctxId,
                 std::string ctxDescription,
-                LogLevel ctxDefLogLevel);
+                LogLevel ctxDefLogLevel,
+                LogMessageMode messageMode = LogMessageMode::kVerbose);
         };
     }
 }
@@ -42,6 +42,20 @@ namespace ara
             }
         }
 
+        const Logger &LoggingFramework::CreateLogger(
+            std::string ctxId,
+            std::string ctxDescription,
+            LogLevel ctxDefLogLevel,
+            LogMessageMode messageMode)
+        {
+            Logger _logger = Logger::CreateLogger(
+                ctxId, ctxDescription, ctxDefLogLevel, messageMode);
+            mLoggers.push_back(std::move(_logger));
+            const Logger &_result = mLoggers.back();
+
+            return _result;
+        }
+
         void LoggingFramework::Log(
             const Logger &logger,
             LogLevel logLevel,
@@ -49,7 +63,13 @@ namespace ara
         {
             bool _isLevelEnabled = logger.IsEnabled(logLevel);
 
-            if (_isLevelEnabled)
+            if (_isLevelEnabled &&
+                logger.GetMessageMode() == LogMessageMode::kNonVerbose &&
+                logStream.MessageId() != 0U)
+            {
+                mLogSink->LogNonVerbose(logger, logLevel, logStream);
+            }
+            else if (_isLevelEnabled)
             {
                 LogStream _logStreamContex = logger.WithLevel(logLevel);
                 _logStreamContex << logStream;
@@ -89,12 +109,19 @@ namespace ara
             }
             else if (logMode == LogMode::kDlt)
             {
-                // DLT sink: sends DLT-protocol UDP datagrams to dlt-daemon or dlt-viewer.
-                // Default target: localhost:3490 (standard DLT port).
+                // DLT sink: hands DLT-protocol messages to the local DLT
+                // daemon through shared memory, or sends UDP datagrams to
+                // localhost:3490 (standard DLT port) if the daemon is absent.
                 // To change host/port, construct DltLogSink manually and use
                 // the lower-level LoggingFramework constructor.
                 sink::LogSink *_logSink =
-                    new sink::DltLogSink(appId, appDescription);
+                    new sink::DltLogSink(
+                        appId,
+                        appDescription,
+                        "ECU1",
+                        "127.0.0.1",
+                        3490U,
+                        sink::ShmLogTransport::cDefaultSocketPath);
                 LoggingFramework *_result =
                     new LoggingFramework(_logSink, logLevel);
 
@@ -114,7 +141,7 @@ namespace ara
             std::string appDescription)
         {
             sink::LogSink *_logSink =
-                new sink::FileLogSink(filePath, appId, appDescription);
+                new sink::FileLogSink(appId, appDescription, filePath);
             LoggingFramework *_result =
                 new LoggingFramework(_logSink, logLevel);
 
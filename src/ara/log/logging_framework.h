@@ -50,6 +50,18 @@ namespace ara
                 std::string ctxDescription,
                 LogLevel ctxDefLogLevel);
 
+            /// @brief Create a logger
+            /// @param ctxId Log context ID
+            /// @param ctxDescription Log context description
+            /// @param ctxDefLogLevel Log context default log level
+            /// @param messageMode Log context DLT message mode
+            /// @returns A logger
+            const Logger &CreateLogger(
+                std::string ctxId,
+                std::string ctxDescription,
+                LogLevel ctxDefLogLevel,
+                LogMessageMode messageMode);
+
             /// @brief Log a stream to the determined sink
             /// @param logger A logger
             /// @param logLevel Log severity level
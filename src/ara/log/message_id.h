@@ -0,0 +1,100 @@
+/// @file src/ara/log/message_id.h
+/// @brief Compile-time message IDs for non-verbose DLT logging.
+/// @details A log site is identified by the FNV-1a hash of its format string,
+///          the file name (without directories) and the line number. The
+///          hash is evaluated at compile time, so a non-verbose log call only
+///          records the ID and the argument values:
+///
+///          @code
+///          logging->Log(
+///              logger, ara::log::LogLevel::kInfo,
+///              ARA_LOG_MESSAGE("speed={u32} temperature={f64}") << speed << temperature);
+///          @endcode
+///
+///          Placeholders name the argument types in insertion order: bool,
+///          i8, i16, i32, i64, u8, u16, u32, u64, f32, f64, str, raw and
+///          level. tools/log_catalog/generate_log_catalog.py computes the same
+///          IDs from the sources and writes the JSON catalog that viewers use
+///          to decode non-verbose messages.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_LOG_MESSAGE_ID_H
+#define ARA_LOG_MESSAGE_ID_H
+
+#include <cstdint>
+#include <type_traits>
+#include "./log_stream.h"
+
+namespace ara
+{
+    namespace log
+    {
+        /// @brief File name part of a path
+        /// @param path File path, e.g. __FILE__
+        /// @returns Pointer past the last directory separator
+        constexpr const char *LogSiteFileName(const char *path) noexcept
+        {
+            const char *_result{path};
+            for (const char *_current = path; *_current != '\0'; ++_current)
+            {
+                if (*_current == '/' || *_current == '\\')
+                {
+                    _result = _current + 1;
+                }
+            }
+
+            return _result;
+        }
+
+        /// @brief Message ID of a log site
+        /// @param format Format string
+        /// @param file File path of the log site
+        /// @param line Line number of the log site
+        /// @returns 32-bit FNV-1a hash of the format, the file name and the
+        ///          little-endian line number, each string followed by a zero
+        ///          byte; never 0, which marks verbose streams
+        constexpr std::uint32_t HashLogSite(
+            const char *format, const char *file, std::uint32_t line) noexcept
+        {
+            const std::uint32_t cPrime{16777619U};
+            std::uint32_t _hash{2166136261U};
+
+            for (const char *_current = format; *_current != '\0'; ++_current)
+            {
+                _hash = (_hash ^ static_cast<std::uint8_t>(*_current)) * cPrime;
+            }
+            _hash *= cPrime;
+
+            for (const char *_current = LogSiteFileName(file); *_current != '\0'; ++_current)
+            {
+                _hash = (_hash ^ static_cast<std::uint8_t>(*_current)) * cPrime;
+            }
+            _hash *= cPrime;
+
+            for (std::uint32_t i = 0U; i < 4U; ++i)
+            {
+                _hash = (_hash ^ ((line >> (8U * i)) & 0xFFU)) * cPrime;
+            }
+
+            return _hash == 0U ? 1U : _hash;
+        }
+    }
+}
+
+/// @brief Compile-time message ID of the log site at the current line
+/// @param format Format string literal
+#define ARA_LOG_MESSAGE_ID(format)                  \
+    (std::integral_constant<                        \
+        std::uint32_t,                              \
+        ::ara::log::HashLogSite(                    \
+            format, __FILE__, __LINE__)>::value)
+
+/// @brief Start a log stream for a non-verbose capable log site
+/// @param format Format string literal with typed placeholders
+/// @note The macro name and the format literal must be on the same line,
+///       the catalog generator reads the line of the macro name.
+#define ARA_LOG_MESSAGE(format) \
+    (::ara::log::LogStream{}.WithMessage(ARA_LOG_MESSAGE_ID(format), "" format ""))
+
+#endif
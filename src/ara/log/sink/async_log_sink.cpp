@@ -2,6 +2,7 @@
 /// @brief Implementation for AsyncLogSink.
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 
+#include <utility>
 #include "./async_log_sink.h"
 
 namespace ara
@@ -10,6 +11,8 @@ namespace ara
     {
         namespace sink
         {
+            const std::size_t AsyncLogSink::cBatchSize;
+
             // -----------------------------------------------------------------------
             // Constructor / Destructor
             // -----------------------------------------------------------------------
@@ -21,16 +24,15 @@ namespace ara
                 std::size_t capacity)
                 : LogSink{std::move(appId), std::move(appDescription)}
                 , mInnerSink{innerSink}
-                , mCapacity{(capacity > 0U) ? capacity : 1U}
-                , mBuffer(mCapacity)
+                , mQueue{(capacity > 0U) ? capacity : 1U}
             {
                 mFlushThread = std::thread{[this] { flushLoop(); }};
             }
 
             AsyncLogSink::~AsyncLogSink() noexcept
             {
-                mRunning.store(false, std::memory_order_relaxed);
-                mNotEmpty.notify_all();
+                // The flush thread drains what is left, then leaves its loop.
+                mQueue.Close();
                 if (mFlushThread.joinable())
                 {
                     mFlushThread.join();
@@ -43,79 +45,105 @@ namespace ara
 
             void AsyncLogSink::Log(const LogStream &logStream) const
             {
-                const std::string message{logStream.ToString()};
+                Entry _entry;
+                _entry.Stream = logStream;
+                enqueue(std::move(_entry));
+            }
 
-                {
-                    std::unique_lock<std::mutex> lock{mMutex};
+            void AsyncLogSink::LogNonVerbose(
+                const Logger &logger,
+                LogLevel logLevel,
+                const LogStream &logStream) const
+            {
+                Entry _entry;
+                _entry.Stream = logStream;
+                _entry.ContextId = logger.GetContextId();
+                _entry.Level = logLevel;
+                _entry.NonVerbose = true;
+                enqueue(std::move(_entry));
+            }
 
-                    const bool full{mSize == mCapacity};
-                    if (full)
-                    {
-                        // Overwrite oldest entry (lossy drop)
-                        ++mDropCount;
-                        mTail = (mTail + 1U) % mCapacity;
-                        --mSize;
-                    }
+            void AsyncLogSink::enqueue(Entry &&entry) const
+            {
+                if (!mQueue.TryEnqueue(std::move(entry)))
+                {
+                    mDropCount.fetch_add(1U, std::memory_order_relaxed);
+                    return;
+                }
 
-                    mBuffer[mHead].valid = true;
-                    mBuffer[mHead].message = message;
-                    mHead = (mHead + 1U) % mCapacity;
-                    ++mSize;
+                // The flush thread may already have written this entry, so
+                // the written count can be ahead of the enqueued count here.
+                const std::uint64_t cEnqueued{
+                    mEnqueued.fetch_add(1U, std::memory_order_relaxed) + 1U};
+                const std::uint64_t cWritten{mWritten.load(std::memory_order_relaxed)};
+                const std::uint64_t cPending{
+                    cEnqueued > cWritten ? cEnqueued - cWritten : 0U};
+                std::uint64_t _highWatermark{
+                    mHighWatermark.load(std::memory_order_relaxed)};
+                while (cPending > _highWatermark &&
+                       !mHighWatermark.compare_exchange_weak(
+                           _highWatermark, cPending, std::memory_order_relaxed))
+                {
                 }
-                mNotEmpty.notify_one();
             }
 
             // -----------------------------------------------------------------------
             // Flush thread (consumer side)
             // -----------------------------------------------------------------------
 
-            void AsyncLogSink::flushLoop()
+            void AsyncLogSink::write(
+                const Entry &entry,
+                std::unordered_map<std::string, Logger> &loggers) const
             {
-                while (mRunning.load(std::memory_order_relaxed) || [this]
+                if (mInnerSink == nullptr)
+                {
+                    return;
+                }
+
+                if (!entry.NonVerbose)
                 {
-                    std::unique_lock<std::mutex> lock{mMutex};
-                    return mSize > 0U;
-                }())
+                    mInnerSink->Log(entry.Stream);
+                    return;
+                }
+
+                // One logger per context is enough to carry the context ID.
+                auto _logger{loggers.find(entry.ContextId)};
+                if (_logger == loggers.end())
                 {
-                    std::string message;
-                    bool hasEntry{false};
+                    _logger = loggers.emplace(
+                                         entry.ContextId,
+                                         Logger::CreateLogger(
+                                             entry.ContextId,
+                                             "",
+                                             LogLevel::kVerbose,
+                                             LogMessageMode::kNonVerbose))
+                                  .first;
+                }
+                mInnerSink->LogNonVerbose(_logger->second, entry.Level, entry.Stream);
+            }
 
-                    {
-                        std::unique_lock<std::mutex> lock{mMutex};
-                        mNotEmpty.wait(lock, [this]
-                        {
-                            return mSize > 0U ||
-                                   !mRunning.load(std::memory_order_relaxed);
-                        });
-
-                        if (mSize > 0U)
-                        {
-                            message = std::move(mBuffer[mTail].message);
-                            mBuffer[mTail].valid = false;
-                            mTail = (mTail + 1U) % mCapacity;
-                            --mSize;
-                            mInFlight = true;
-                            hasEntry = true;
-                        }
-                    }
+            void AsyncLogSink::flushLoop()
+            {
+                Entry _record;
+                std::unordered_map<std::string, Logger> _loggers;
 
-                    if (hasEntry && mInnerSink != nullptr)
+                // Sleep until the first entry of a batch arrives; Dequeue only
+                // fails once the queue is closed and drained.
+                while (mQueue.Dequeue(_record))
+                {
+                    std::uint64_t _count{0U};
+                    do
                     {
-                        // Re-create a LogStream from the stored string and forward it.
-                        LogStream wrapper;
-                        wrapper << message;
-                        mInnerSink->Log(wrapper);
-                    }
+                        write(_record, _loggers);
+                        ++_count;
+                    } while (_count < cBatchSize && mQueue.TryDequeue(_record));
 
-                    if (hasEntry)
+                    mBatches.fetch_add(1U, std::memory_order_relaxed);
                     {
-                        std::unique_lock<std::mutex> lock{mMutex};
-                        mInFlight = false;
-                        if (mSize == 0U)
-                        {
-                            mDrained.notify_all();
-                        }
+                        std::lock_guard<std::mutex> _lock{mDrainedMutex};
+                        mWritten.fetch_add(_count, std::memory_order_release);
                     }
+                    mDrained.notify_all();
                 }
             }
 
@@ -130,24 +158,33 @@ namespace ara
 
             std::size_t AsyncLogSink::GetPendingCount() const noexcept
             {
-                std::unique_lock<std::mutex> lock{mMutex};
-                return mSize;
+                // The written count can briefly be ahead, see Log().
+                const std::uint64_t cWritten{mWritten.load(std::memory_order_acquire)};
+                const std::uint64_t cEnqueued{mEnqueued.load(std::memory_order_relaxed)};
+                return cEnqueued > cWritten
+                           ? static_cast<std::size_t>(cEnqueued - cWritten)
+                           : 0U;
+            }
+
+            AsyncLogSinkStatistics AsyncLogSink::GetStatistics() const noexcept
+            {
+                AsyncLogSinkStatistics _result;
+                _result.Written = mWritten.load(std::memory_order_acquire);
+                _result.Enqueued = mEnqueued.load(std::memory_order_relaxed);
+                _result.Dropped = mDropCount.load(std::memory_order_relaxed);
+                _result.Batches = mBatches.load(std::memory_order_relaxed);
+                _result.HighWatermark = mHighWatermark.load(std::memory_order_relaxed);
+
+                return _result;
             }
 
             void AsyncLogSink::Flush()
             {
-                std::unique_lock<std::mutex> lock{mMutex};
-                if (mSize == 0U && !mInFlight)
-                {
-                    return;
-                }
-                // Wake the flush thread in case it is sleeping.
-                // notify_all is called while holding the lock; the flush thread
-                // will re-acquire after mDrained.wait() releases it below.
-                mNotEmpty.notify_all();
-                // Block until the background thread has drained the buffer.
-                mDrained.wait(lock, [this] {
-                    return mSize == 0U && !mInFlight;
+                const std::uint64_t cTarget{mEnqueued.load(std::memory_order_relaxed)};
+                std::unique_lock<std::mutex> _lock{mDrainedMutex};
+                // Block until the background thread has written the entries.
+                mDrained.wait(_lock, [this, cTarget] {
+                    return mWritten.load(std::memory_order_acquire) >= cTarget;
                 });
             }
 
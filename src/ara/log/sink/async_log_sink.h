@@ -3,10 +3,11 @@
 /// @details This file is part of the Adaptive AUTOSAR educational implementation.
 ///
 /// `AsyncLogSink` wraps any other `LogSink` and decouples the calling thread
-/// from the I/O operation. Log entries are pushed into a fixed-size ring
-/// buffer; a background flush thread drains the buffer and calls the inner
-/// sink. When the buffer is full, the oldest entry is overwritten (lossy)
-/// so that callers are never blocked.
+/// from the I/O operation. Log streams are copied, still in their binary
+/// record form, into a multi-producer ring; a background flush
+/// thread drains the ring in batches and hands each stream to the inner
+/// sink, which formats it only if it needs text. When the ring is full, the
+/// new entry is dropped so that callers are never blocked.
 
 #ifndef ASYNC_LOG_SINK_H
 #define ASYNC_LOG_SINK_H
@@ -14,11 +15,13 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
-#include <memory>
+#include <cstdint>
 #include <mutex>
+#include <string>
 #include <thread>
-#include <vector>
+#include <unordered_map>
 
+#include "../../com/helper/concurrent_queue.h"
 #include "./log_sink.h"
 
 namespace ara
@@ -27,15 +30,33 @@ namespace ara
     {
         namespace sink
         {
+            /// @brief Counters of an asynchronous log sink
+            struct AsyncLogSinkStatistics
+            {
+                /// @brief Entries accepted into the ring buffer
+                std::uint64_t Enqueued;
+                /// @brief Entries dropped because the ring buffer was full
+                std::uint64_t Dropped;
+                /// @brief Entries handed to the inner sink
+                std::uint64_t Written;
+                /// @brief Flush thread wake-ups that wrote at least one entry
+                std::uint64_t Batches;
+                /// @brief Most entries waiting at the same time
+                std::uint64_t HighWatermark;
+            };
+
             /// @brief Asynchronous (non-blocking) log sink backed by a ring buffer.
             ///
             /// ### Thread safety
             /// `Log()` is safe to call from multiple threads simultaneously.
+            /// Producers claim a ring slot with a compare-and-swap. The only
+            /// lock a producer takes is the queue's wait mutex, and only when
+            /// its entry turns the ring non-empty while the flush thread is
+            /// parked, so a burst of entries wakes the flush thread once.
             ///
             /// ### Drop policy
-            /// When the ring buffer is full, the oldest unread slot is silently
-            /// overwritten. The overwrite count can be retrieved via
-            /// `GetDropCount()`.
+            /// When the ring buffer is full, the new entry is dropped. The drop
+            /// count can be retrieved via `GetDropCount()`.
             ///
             /// ### Shutdown
             /// The background flush thread stops and drains the remaining queue
@@ -43,12 +64,16 @@ namespace ara
             class AsyncLogSink final : public LogSink
             {
             public:
+                /// @brief Most entries handed to the inner sink per wake-up
+                static const std::size_t cBatchSize{64U};
+
                 /// @brief Construct an async sink wrapping an inner sink.
                 ///
                 /// @param innerSink      Underlying sink (must outlive this object).
                 /// @param appId          Application ID (passed to LogSink base).
                 /// @param appDescription Application description.
-                /// @param capacity       Ring buffer capacity (number of log entries).
+                /// @param capacity       Ring buffer capacity (number of log
+                ///                       entries), rounded up to a power of two.
                 AsyncLogSink(LogSink *innerSink,
                              std::string appId,
                              std::string appDescription,
@@ -59,44 +84,60 @@ namespace ara
                 /// @brief Push a log entry into the ring buffer (non-blocking).
                 void Log(const LogStream &logStream) const override;
 
-                /// @brief Number of entries overwritten due to buffer overflow.
+                /// @brief Push a non-verbose log entry into the ring buffer (non-blocking).
+                /// @details The context ID and the level are queued with the
+                ///          stream, and the flush thread hands them to the
+                ///          inner sink's LogNonVerbose(). The logger passed
+                ///          on has an empty context description.
+                void LogNonVerbose(
+                    const Logger &logger,
+                    LogLevel logLevel,
+                    const LogStream &logStream) const override;
+
+                /// @brief Number of entries dropped due to buffer overflow.
                 std::uint64_t GetDropCount() const noexcept;
 
-                /// @brief Number of entries currently waiting in the ring buffer.
+                /// @brief Number of entries not yet written by the inner sink.
                 std::size_t GetPendingCount() const noexcept;
 
+                /// @brief Snapshot of the sink counters.
+                AsyncLogSinkStatistics GetStatistics() const noexcept;
+
                 /// @brief Flush all pending entries synchronously.
                 ///
-                /// Blocks until the background thread has drained the buffer.
+                /// Blocks until the background thread has written every entry
+                /// that was accepted before the call.
                 void Flush();
 
             private:
-                LogSink *mInnerSink;
-                const std::size_t mCapacity;
-
-                // Ring buffer stored as vector of optional log messages.
-                // We copy the LogStream payload string for simplicity.
+                // A queued stream and what LogNonVerbose() needs besides it
                 struct Entry
                 {
-                    bool valid{false};
-                    std::string message;
+                    LogStream Stream;
+                    std::string ContextId;
+                    LogLevel Level{LogLevel::kInfo};
+                    bool NonVerbose{false};
                 };
 
-                mutable std::vector<Entry> mBuffer;
-                mutable std::size_t mHead{0U}; ///< Next write position.
-                mutable std::size_t mTail{0U}; ///< Next read position.
-                mutable std::size_t mSize{0U}; ///< Current number of entries.
-                mutable bool mInFlight{false}; ///< Entry currently being written.
+                LogSink *mInnerSink;
 
-                mutable std::mutex mMutex;
-                mutable std::condition_variable mNotEmpty;
-                mutable std::condition_variable mDrained;
+                mutable com::helper::ConcurrentQueue<Entry> mQueue;
 
+                mutable std::atomic<std::uint64_t> mEnqueued{0U};
                 mutable std::atomic<std::uint64_t> mDropCount{0U};
+                std::atomic<std::uint64_t> mWritten{0U};
+                std::atomic<std::uint64_t> mBatches{0U};
+                mutable std::atomic<std::uint64_t> mHighWatermark{0U};
+
+                std::mutex mDrainedMutex;
+                std::condition_variable mDrained;
 
-                std::atomic<bool> mRunning{true};
                 std::thread mFlushThread;
 
+                void enqueue(Entry &&entry) const;
+                void write(
+                    const Entry &entry,
+                    std::unordered_map<std::string, Logger> &loggers) const;
                 void flushLoop();
             };
 
@@ -1,10 +1,12 @@
 /// @file src/ara/log/sink/dlt_log_sink.cpp
 /// @brief Implementation for DLT protocol log sink.
 /// @details Builds a simplified DLT message (storage header + standard header
-///          + extended header + string payload) and sends it over UDP.
+///          + extended header + typed verbose arguments, or a message ID and
+///          raw values in non-verbose mode) and sends it over UDP.
 
 #include "./dlt_log_sink.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <stdexcept>
@@ -21,13 +23,70 @@ namespace ara
     {
         namespace sink
         {
+            namespace
+            {
+                struct PlaceholderType
+                {
+                    const char *Name;
+                    LogArgumentType Type;
+                };
+
+                // Placeholder names as documented in message_id.h
+                const PlaceholderType cPlaceholderTypes[]{
+                    {"bool", LogArgumentType::kBool},
+                    {"i8", LogArgumentType::kInt8},
+                    {"i16", LogArgumentType::kInt16},
+                    {"i32", LogArgumentType::kInt32},
+                    {"i64", LogArgumentType::kInt64},
+                    {"u8", LogArgumentType::kUInt8},
+                    {"u16", LogArgumentType::kUInt16},
+                    {"u32", LogArgumentType::kUInt32},
+                    {"u64", LogArgumentType::kUInt64},
+                    {"f32", LogArgumentType::kFloat32},
+                    {"f64", LogArgumentType::kFloat64},
+                    {"str", LogArgumentType::kString},
+                    {"raw", LogArgumentType::kRaw},
+                    {"level", LogArgumentType::kLogLevel}};
+
+                // Reads the next placeholder and moves the format past it.
+                // Returns false at the end of the format or on an unknown name.
+                bool takePlaceholder(const char *&format, LogArgumentType &type) noexcept
+                {
+                    const char *const cOpen{std::strchr(format, '{')};
+                    const char *const cClose{
+                        cOpen == nullptr ? nullptr : std::strchr(cOpen, '}')};
+                    if (cClose == nullptr)
+                    {
+                        return false;
+                    }
+
+                    format = cClose + 1;
+                    const std::size_t cLength{static_cast<std::size_t>(cClose - cOpen - 1)};
+                    for (const PlaceholderType &placeholder : cPlaceholderTypes)
+                    {
+                        if (std::strlen(placeholder.Name) == cLength &&
+                            std::strncmp(placeholder.Name, cOpen + 1, cLength) == 0)
+                        {
+                            type = placeholder.Type;
+                            return true;
+                        }
+                    }
+
+                    return false;
+                }
+            }
+
+            const std::chrono::milliseconds DltLogSink::cFlushDelay{5};
+
             DltLogSink::DltLogSink(
                 std::string appId,
                 std::string appDescription,
                 std::string ecuId,
                 std::string host,
-                std::uint16_t port)
+                std::uint16_t port,
+                std::string shmSocketPath)
                 : LogSink{appId, appDescription},
+                  mShortAppId{appId.substr(0U, 4U)},
                   mEcuId{std::move(ecuId)},
                   mHost{std::move(host)},
                   mPort{port},
@@ -35,10 +94,16 @@ namespace ara
                   mMessageCounter{0U}
             {
                 OpenSocket();
+                if (!shmSocketPath.empty())
+                {
+                    mShmTransport.reset(
+                        new ShmLogTransport(mShortAppId, std::move(shmSocketPath)));
+                }
             }
 
             DltLogSink::~DltLogSink() noexcept
             {
+                mShmTransport.reset();
                 CloseSocket();
             }
 
@@ -50,10 +115,24 @@ namespace ara
                     throw std::runtime_error(
                         "Failed to create UDP socket for DLT log sink.");
                 }
+
+                struct sockaddr_in destAddr {};
+                destAddr.sin_family = AF_INET;
+                destAddr.sin_port = htons(mPort);
+                ::inet_pton(AF_INET, mHost.c_str(), &destAddr.sin_addr);
+
+                mSender.reset(new com::helper::UdpBatchSender{
+                    mSocketFd,
+                    destAddr,
+                    com::helper::UdpBatchSender::cDefaultBatchSize,
+                    com::helper::UdpBatchSender::cDefaultSlotSize,
+                    cFlushDelay});
             }
 
             void DltLogSink::CloseSocket() noexcept
             {
+                // Flush the pending messages before the socket goes away.
+                mSender.reset();
                 if (mSocketFd >= 0)
                 {
                     ::close(mSocketFd);
@@ -61,6 +140,19 @@ namespace ara
                 }
             }
 
+            void DltLogSink::SendMessage(const std::vector<std::uint8_t> &msg) const
+            {
+                if (!mShmTransport || !mShmTransport->Send(msg.data(), msg.size()))
+                {
+                    mSender->Send(msg.data(), msg.size());
+                }
+            }
+
+            bool DltLogSink::IsUsingSharedMemory() const
+            {
+                return mShmTransport && mShmTransport->IsConnected();
+            }
+
             void DltLogSink::Write4CharId(
                 std::vector<std::uint8_t> &buffer,
                 const std::string &id)
@@ -98,10 +190,198 @@ namespace ara
                     static_cast<std::uint8_t>(value & 0xFFU));
             }
 
-            std::vector<std::uint8_t> DltLogSink::BuildDltMessage(
-                const std::string &appId,
-                const std::string &contextId,
-                const std::string &payload) const
+            void DltLogSink::WriteLE(
+                std::vector<std::uint8_t> &buffer,
+                std::uint64_t value,
+                std::size_t size)
+            {
+                for (std::size_t i = 0U; i < size; ++i)
+                {
+                    buffer.push_back(
+                        static_cast<std::uint8_t>((value >> (8U * i)) & 0xFFU));
+                }
+            }
+
+            void DltLogSink::WriteArgument(
+                std::vector<std::uint8_t> &buffer,
+                const LogArgument &argument)
+            {
+                // Type info bits (PRS_Dlt_00135): TYLE in bits 0-3, then
+                // BOOL 0x10, SINT 0x20, UINT 0x40, FLOA 0x80, STRG 0x200,
+                // RAWD 0x400; SCOD UTF-8 is bit 15.
+                const std::uint32_t cBool{0x10U};
+                const std::uint32_t cSigned{0x20U};
+                const std::uint32_t cUnsigned{0x40U};
+                const std::uint32_t cFloat{0x80U};
+                const std::uint32_t cString{0x200U | 0x8000U};
+                const std::uint32_t cRaw{0x400U};
+
+                std::uint32_t _typeInfo;
+                switch (argument.Type)
+                {
+                case LogArgumentType::kBool:
+                    _typeInfo = cBool | 0x01U;
+                    break;
+                case LogArgumentType::kInt8:
+                case LogArgumentType::kInt16:
+                case LogArgumentType::kInt32:
+                case LogArgumentType::kInt64:
+                    _typeInfo = cSigned;
+                    break;
+                case LogArgumentType::kUInt8:
+                case LogArgumentType::kUInt16:
+                case LogArgumentType::kUInt32:
+                case LogArgumentType::kUInt64:
+                    _typeInfo = cUnsigned;
+                    break;
+                case LogArgumentType::kFloat32:
+                case LogArgumentType::kFloat64:
+                    _typeInfo = cFloat;
+                    break;
+                case LogArgumentType::kRaw:
+                    _typeInfo = cRaw;
+                    break;
+                default:
+                    // Strings, levels as their names and format strings.
+                    _typeInfo = cString;
+                    break;
+                }
+
+                if (_typeInfo == cString || _typeInfo == cRaw)
+                {
+                    // Levels are the only arguments turned into text here;
+                    // format strings are sent as they are.
+                    static thread_local std::string tLevelName;
+                    const std::uint8_t *_data{argument.Data};
+                    std::size_t _size{argument.Size};
+                    if (argument.Type == LogArgumentType::kLogLevel)
+                    {
+                        tLevelName.clear();
+                        LogStream::FormatArgument(argument, tLevelName);
+                        _data = reinterpret_cast<const std::uint8_t *>(tLevelName.data());
+                        _size = tLevelName.size();
+                    }
+                    else if (argument.Type == LogArgumentType::kFormat)
+                    {
+                        const char *const cFormat{LogStream::FormatString(argument)};
+                        _data = reinterpret_cast<const std::uint8_t *>(cFormat);
+                        _size = std::strlen(cFormat);
+                    }
+
+                    // The length field is 16 bits wide, terminator included.
+                    const std::size_t cTerminator{_typeInfo == cString ? 1U : 0U};
+                    _size = std::min<std::size_t>(_size, 0xFFFFU - cTerminator);
+                    WriteLE(buffer, _typeInfo, 4U);
+                    WriteLE(buffer, _size + cTerminator, 2U);
+                    buffer.insert(buffer.end(), _data, _data + _size);
+                    if (cTerminator > 0U)
+                    {
+                        buffer.push_back(0U);
+                    }
+                    return;
+                }
+
+                // Fixed-size values: TYLE 1..4 encodes 8..64 bits.
+                std::uint32_t _length{1U};
+                for (std::size_t _bytes = 1U; _bytes < argument.Size; _bytes <<= 1U)
+                {
+                    ++_length;
+                }
+                std::uint64_t _value{0U};
+                if (argument.Size == 4U && _typeInfo == cFloat)
+                {
+                    std::uint32_t _bits;
+                    std::memcpy(&_bits, argument.Data, sizeof(_bits));
+                    _value = _bits;
+                }
+                else if (argument.Size == 1U)
+                {
+                    _value = argument.Data[0U];
+                }
+                else if (argument.Size == 2U)
+                {
+                    std::uint16_t _bits;
+                    std::memcpy(&_bits, argument.Data, sizeof(_bits));
+                    _value = _bits;
+                }
+                else if (argument.Size == 4U)
+                {
+                    std::uint32_t _bits;
+                    std::memcpy(&_bits, argument.Data, sizeof(_bits));
+                    _value = _bits;
+                }
+                else
+                {
+                    std::memcpy(&_value, argument.Data, sizeof(_value));
+                }
+
+                WriteLE(buffer, _typeInfo | _length, 4U);
+                WriteLE(buffer, _value, argument.Size);
+            }
+
+            void DltLogSink::WriteNonVerboseArgument(
+                std::vector<std::uint8_t> &buffer,
+                const LogArgument &argument)
+            {
+                switch (argument.Type)
+                {
+                case LogArgumentType::kFormat:
+                    // Identified by the message ID already.
+                    break;
+                case LogArgumentType::kString:
+                case LogArgumentType::kRaw:
+                    WriteLE(buffer, argument.Size, 2U);
+                    buffer.insert(
+                        buffer.end(), argument.Data, argument.Data + argument.Size);
+                    break;
+                default:
+                    // Fixed-size values in host (little-endian) order, as
+                    // declared by the MSBF bit of the standard header.
+                    buffer.insert(
+                        buffer.end(), argument.Data, argument.Data + argument.Size);
+                    break;
+                }
+            }
+
+            bool DltLogSink::MatchesPlaceholders(const LogStream &logStream)
+            {
+                // The catalog decodes the raw values by the placeholders of
+                // the log site, so each value needs the type its placeholder
+                // names. Only the first log site of a stream has its ID sent.
+                const char *_format{nullptr};
+                bool _matches{true};
+                logStream.ForEachArgument(
+                    [&_format, &_matches](const LogArgument &argument)
+                    {
+                        if (!_matches)
+                        {
+                            return;
+                        }
+
+                        if (argument.Type == LogArgumentType::kFormat)
+                        {
+                            _matches = _format == nullptr;
+                            _format = LogStream::FormatString(argument);
+                            return;
+                        }
+
+                        LogArgumentType _expected;
+                        _matches = _format != nullptr &&
+                                   takePlaceholder(_format, _expected) &&
+                                   _expected == argument.Type;
+                    });
+
+                // A placeholder left without a value would shift the decoding too.
+                return _matches &&
+                       _format != nullptr &&
+                       std::strchr(_format, '{') == nullptr;
+            }
+
+            std::size_t DltLogSink::BeginDltMessage(
+                std::vector<std::uint8_t> &msg,
+                std::uint8_t msin,
+                std::uint8_t noar,
+                const std::string &contextId) const
             {
                 // DLT message structure (simplified):
                 //
@@ -119,18 +399,18 @@ namespace ara
                 //   Timestamp (4B BE) — 0.1ms resolution
                 //
                 // [Extended Header 10 bytes]
-                //   MSIN (1B): verbose=1, MSTP=log, MTIN=info
-                //   NOAR (1B): number of arguments = 1
+                //   MSIN (1B): verbose flag, MSTP=log, MTIN=log level
+                //   NOAR (1B): number of arguments
                 //   APID (4B)
                 //   CTID (4B)
                 //
                 // [Payload]
-                //   Type info (4B): string type
-                //   String length (2B LE)
-                //   String data (NUL terminated)
+                //   Verbose: one typed argument (type info 4B LE + value)
+                //   per recorded log stream argument.
+                //   Non-verbose: message ID (4B LE) followed by the raw
+                //   argument values.
 
-                std::vector<std::uint8_t> msg;
-                msg.reserve(64U + payload.size());
+                msg.clear();
 
                 // --- Storage Header (16 bytes) ---
                 msg.push_back('D');
@@ -149,27 +429,9 @@ namespace ara
                         .count() %
                     1000000LL};
 
-                // Seconds (4B little-endian).
-                const std::uint32_t secU32{
-                    static_cast<std::uint32_t>(secs & 0xFFFFFFFFULL)};
-                msg.push_back(static_cast<std::uint8_t>(secU32 & 0xFFU));
-                msg.push_back(
-                    static_cast<std::uint8_t>((secU32 >> 8U) & 0xFFU));
-                msg.push_back(
-                    static_cast<std::uint8_t>((secU32 >> 16U) & 0xFFU));
-                msg.push_back(
-                    static_cast<std::uint8_t>((secU32 >> 24U) & 0xFFU));
-
-                // Microseconds (4B little-endian).
-                const std::uint32_t usecU32{
-                    static_cast<std::uint32_t>(usecs & 0xFFFFFFFFLL)};
-                msg.push_back(static_cast<std::uint8_t>(usecU32 & 0xFFU));
-                msg.push_back(
-                    static_cast<std::uint8_t>((usecU32 >> 8U) & 0xFFU));
-                msg.push_back(
-                    static_cast<std::uint8_t>((usecU32 >> 16U) & 0xFFU));
-                msg.push_back(
-                    static_cast<std::uint8_t>((usecU32 >> 24U) & 0xFFU));
+                // Seconds and microseconds (4B little-endian each).
+                WriteLE(msg, static_cast<std::uint64_t>(secs) & 0xFFFFFFFFULL, 4U);
+                WriteLE(msg, static_cast<std::uint64_t>(usecs) & 0xFFFFFFFFULL, 4U);
 
                 // ECU ID (4B).
                 Write4CharId(msg, mEcuId);
@@ -191,8 +453,7 @@ namespace ara
                 msg.push_back(
                     static_cast<std::uint8_t>(counter & 0xFFU));
 
-                // LEN placeholder (2B BE) — will be patched.
-                const std::size_t lenPos{msg.size()};
+                // LEN placeholder (2B BE) — patched by FinishDltMessage.
                 msg.push_back(0U);
                 msg.push_back(0U);
 
@@ -207,51 +468,101 @@ namespace ara
                                     tsMs & 0xFFFFFFFFULL));
 
                 // --- Extended Header (10 bytes) ---
-                // MSIN: verbose=1 (bit0), MSTP=Log=0x0 (bits1-3),
-                //        MTIN=Info=0x4 (bits4-7)
-                const std::uint8_t msin{0x01U | (0x04U << 4U)};
                 msg.push_back(msin);
-
-                // NOAR: 1 argument (the string payload).
-                msg.push_back(0x01U);
+                msg.push_back(noar);
 
                 // APID.
-                Write4CharId(msg, appId);
+                Write4CharId(msg, mShortAppId);
 
                 // CTID.
                 Write4CharId(msg, contextId);
 
-                // --- Payload ---
-                // Type info for string (4B LE): 0x00000200 (DLT_TYPE_INFO_STRG)
-                msg.push_back(0x00U);
-                msg.push_back(0x02U);
-                msg.push_back(0x00U);
-                msg.push_back(0x00U);
-
-                // String length including NUL (2B LE).
-                const std::uint16_t strLen{
-                    static_cast<std::uint16_t>(payload.size() + 1U)};
-                msg.push_back(
-                    static_cast<std::uint8_t>(strLen & 0xFFU));
-                msg.push_back(
-                    static_cast<std::uint8_t>((strLen >> 8U) & 0xFFU));
-
-                // String data.
-                for (const char ch : payload)
-                {
-                    msg.push_back(static_cast<std::uint8_t>(ch));
-                }
-                msg.push_back(0U); // NUL terminator.
+                return stdHeaderStart;
+            }
 
+            void DltLogSink::FinishDltMessage(
+                std::vector<std::uint8_t> &msg,
+                std::size_t stdHeaderStart)
+            {
                 // Patch LEN field (total from standard header to end).
+                const std::size_t cLenPos{stdHeaderStart + 2U};
                 const std::uint16_t totalLen{
                     static_cast<std::uint16_t>(msg.size() - stdHeaderStart)};
-                msg[lenPos] = static_cast<std::uint8_t>(
+                msg[cLenPos] = static_cast<std::uint8_t>(
                     (totalLen >> 8U) & 0xFFU);
-                msg[lenPos + 1U] = static_cast<std::uint8_t>(
+                msg[cLenPos + 1U] = static_cast<std::uint8_t>(
                     totalLen & 0xFFU);
+            }
+
+            void DltLogSink::BuildDltMessage(
+                std::vector<std::uint8_t> &msg,
+                const std::string &contextId,
+                const LogStream &logStream,
+                LogLevel defaultLevel) const
+            {
+                // MSIN: verbose=1 (bit0), MSTP=Log=0x0 (bits1-3),
+                //        MTIN=log level (bits4-7), the default level unless
+                //        the stream carries a level.
+                std::uint8_t _level{static_cast<std::uint8_t>(defaultLevel)};
+                bool _levelFound{false};
+                logStream.ForEachArgument(
+                    [&_level, &_levelFound](const LogArgument &argument)
+                    {
+                        if (!_levelFound && argument.Type == LogArgumentType::kLogLevel)
+                        {
+                            _level = argument.Data[0U];
+                            _levelFound = true;
+                        }
+                    });
+                const std::uint8_t msin{
+                    static_cast<std::uint8_t>(0x01U | ((_level & 0x0FU) << 4U))};
+
+                const std::size_t cArgumentCount{
+                    std::min<std::size_t>(logStream.ArgumentCount(), 0xFFU)};
+                const std::size_t stdHeaderStart{
+                    BeginDltMessage(
+                        msg,
+                        msin,
+                        static_cast<std::uint8_t>(cArgumentCount),
+                        contextId)};
+
+                // --- Payload ---
+                std::size_t _written{0U};
+                logStream.ForEachArgument(
+                    [&msg, &_written, cArgumentCount](const LogArgument &argument)
+                    {
+                        if (_written < cArgumentCount)
+                        {
+                            WriteArgument(msg, argument);
+                            ++_written;
+                        }
+                    });
+
+                FinishDltMessage(msg, stdHeaderStart);
+            }
+
+            void DltLogSink::BuildNonVerboseMessage(
+                std::vector<std::uint8_t> &msg,
+                const std::string &contextId,
+                LogLevel logLevel,
+                const LogStream &logStream) const
+            {
+                // MSIN: verbose=0, MSTP=Log, MTIN=log level; NOAR is unused
+                // in non-verbose mode.
+                const std::uint8_t msin{static_cast<std::uint8_t>(
+                    (static_cast<std::uint8_t>(logLevel) & 0x0FU) << 4U)};
+                const std::size_t stdHeaderStart{
+                    BeginDltMessage(msg, msin, 0U, contextId)};
 
-                return msg;
+                // --- Payload ---
+                WriteLE(msg, logStream.MessageId(), 4U);
+                logStream.ForEachArgument(
+                    [&msg](const LogArgument &argument)
+                    {
+                        WriteNonVerboseArgument(msg, argument);
+                    });
+
+                FinishDltMessage(msg, stdHeaderStart);
             }
 
             void DltLogSink::Log(const LogStream &logStream) const
@@ -261,33 +572,38 @@ namespace ara
                     return;
                 }
 
-                LogStream timestamp{GetTimestamp()};
-                LogStream appstamp{GetAppstamp()};
-                timestamp << cWhitespace << appstamp
-                          << cWhitespace << logStream;
-                const std::string payload{timestamp.ToString()};
+                // The message buffer keeps its capacity between calls.
+                static thread_local std::vector<std::uint8_t> tMessage;
+                static const std::string cContextId{"DFLT"};
+                BuildDltMessage(tMessage, cContextId, logStream, LogLevel::kInfo);
 
-                // Extract app ID from appstamp (first 4 chars).
-                const std::string appStr{appstamp.ToString()};
-                std::string shortAppId{appStr.substr(
-                    0U, std::min<std::size_t>(appStr.size(), 4U))};
-                const std::string ctxId{"DFLT"};
+                SendMessage(tMessage);
+            }
 
-                const auto dltMsg{
-                    BuildDltMessage(shortAppId, ctxId, payload)};
+            void DltLogSink::LogNonVerbose(
+                const Logger &logger,
+                LogLevel logLevel,
+                const LogStream &logStream) const
+            {
+                if (mSocketFd < 0)
+                {
+                    return;
+                }
 
-                struct sockaddr_in destAddr {};
-                destAddr.sin_family = AF_INET;
-                destAddr.sin_port = htons(mPort);
-                ::inet_pton(AF_INET, mHost.c_str(), &destAddr.sin_addr);
+                static thread_local std::vector<std::uint8_t> tMessage;
+                if (MatchesPlaceholders(logStream))
+                {
+                    BuildNonVerboseMessage(
+                        tMessage, logger.GetContextId(), logLevel, logStream);
+                }
+                else
+                {
+                    // A value the catalog cannot decode is sent self-describing.
+                    BuildDltMessage(
+                        tMessage, logger.GetContextId(), logStream, logLevel);
+                }
 
-                ::sendto(
-                    mSocketFd,
-                    dltMsg.data(),
-                    dltMsg.size(),
-                    0,
-                    reinterpret_cast<const struct sockaddr *>(&destAddr),
-                    sizeof(destAddr));
+                SendMessage(tMessage);
             }
         }
     }
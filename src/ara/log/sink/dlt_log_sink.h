@@ -7,11 +7,15 @@
 #define DLT_LOG_SINK_H
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "../../com/helper/udp_batch.h"
 #include "./log_sink.h"
+#include "./shm_log_transport.h"
 
 namespace ara
 {
@@ -19,35 +23,96 @@ namespace ara
     {
         namespace sink
         {
+            /// @details Each argument of a log stream is sent as a typed DLT
+            ///          verbose argument, so no text is formatted on the way.
+            ///          Non-verbose contexts send the message ID of the log
+            ///          site and the raw argument values instead; the catalog
+            ///          from tools/log_catalog decodes them. A stream whose
+            ///          values do not match the typed placeholders of its
+            ///          format is sent verbose instead.
+            ///          Messages are batched per sendmmsg() call and flushed
+            ///          at the latest cFlushDelay after the first one of a batch.
+            ///          If a shared-memory socket path is given and the local
+            ///          DLT daemon accepts the registration, messages go into
+            ///          a shared-memory ring instead, and UDP is only the
+            ///          fallback while the daemon is unavailable.
             class DltLogSink : public LogSink
             {
             public:
+                /// @brief Longest time a message waits for its batch to fill
+                static const std::chrono::milliseconds cFlushDelay;
+
                 DltLogSink(
                     std::string appId,
                     std::string appDescription,
                     std::string ecuId = "ECU1",
                     std::string host = "127.0.0.1",
-                    std::uint16_t port = 3490U);
+                    std::uint16_t port = 3490U,
+                    std::string shmSocketPath = "");
 
                 DltLogSink() = delete;
                 ~DltLogSink() noexcept override;
 
                 void Log(const LogStream &logStream) const override;
 
+                void LogNonVerbose(
+                    const Logger &logger,
+                    LogLevel logLevel,
+                    const LogStream &logStream) const override;
+
+                /// @brief Whether messages currently go through shared memory
+                bool IsUsingSharedMemory() const;
+
             private:
+                std::string mShortAppId;
                 std::string mEcuId;
                 std::string mHost;
                 std::uint16_t mPort;
                 int mSocketFd;
                 mutable std::atomic<std::uint32_t> mMessageCounter;
+                std::unique_ptr<com::helper::UdpBatchSender> mSender;
+                std::unique_ptr<ShmLogTransport> mShmTransport;
 
                 void OpenSocket();
                 void CloseSocket() noexcept;
+                void SendMessage(const std::vector<std::uint8_t> &msg) const;
+
+                std::size_t BeginDltMessage(
+                    std::vector<std::uint8_t> &msg,
+                    std::uint8_t msin,
+                    std::uint8_t noar,
+                    const std::string &contextId) const;
+
+                static void FinishDltMessage(
+                    std::vector<std::uint8_t> &msg,
+                    std::size_t stdHeaderStart);
+
+                void BuildNonVerboseMessage(
+                    std::vector<std::uint8_t> &msg,
+                    const std::string &contextId,
+                    LogLevel logLevel,
+                    const LogStream &logStream) const;
 
-                std::vector<std::uint8_t> BuildDltMessage(
-                    const std::string &appId,
+                void BuildDltMessage(
+                    std::vector<std::uint8_t> &msg,
                     const std::string &contextId,
-                    const std::string &payload) const;
+                    const LogStream &logStream,
+                    LogLevel defaultLevel) const;
+
+                static bool MatchesPlaceholders(const LogStream &logStream);
+
+                static void WriteArgument(
+                    std::vector<std::uint8_t> &buffer,
+                    const LogArgument &argument);
+
+                static void WriteNonVerboseArgument(
+                    std::vector<std::uint8_t> &buffer,
+                    const LogArgument &argument);
+
+                static void WriteLE(
+                    std::vector<std::uint8_t> &buffer,
+                    std::uint64_t value,
+                    std::size_t size);
 
                 static void Write4CharId(
                     std::vector<std::uint8_t> &buffer,
@@ -13,25 +13,32 @@ namespace ara
             FileLogSink::FileLogSink(
                 std::string appId,
                 std::string appDescription,
-                std::string logFilePath) : LogSink(appId, appDescription),
-                                           mLogFilePath{logFilePath}
+                std::string logFilePath,
+                LogFileWriterOptions options) : LogSink(appId, appDescription),
+                                                mLogFilePath{logFilePath},
+                                                mWriter{new LogFileWriter(logFilePath, options)}
             {
             }
 
             void FileLogSink::Log(const LogStream &logStream) const
             {
-                const std::string cNewline{"\n"};
+                // Reused per thread so that a line costs no allocation.
+                static thread_local std::string tLine;
 
                 LogStream _timestamp = GetTimestamp();
                 LogStream _appstamp = GetAppstamp();
                 _timestamp << cWhitespace << _appstamp  << cWhitespace << logStream;
-                std::string _logString = _timestamp.ToString();
 
-                std::ofstream logFileStream(
-                    mLogFilePath, std::ofstream::out | std::ofstream::app);
-                logFileStream << _logString << cNewline;
-                logFileStream.close();
+                tLine.clear();
+                _timestamp.FormatTo(tLine);
+                tLine.push_back('\n');
+                mWriter->Write(tLine.data(), tLine.size());
+            }
+
+            void FileLogSink::Flush() const
+            {
+                mWriter->Flush();
             }
         }
     }
-}
\ No newline at end of file
+}
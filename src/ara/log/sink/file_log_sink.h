@@ -5,8 +5,9 @@
 #ifndef FILE_LOG_SINK_H
 #define FILE_LOG_SINK_H
 
-#include <fstream>
+#include <memory>
 #include "./log_sink.h"
+#include "./log_file_writer.h"
 
 namespace ara
 {
@@ -15,23 +16,32 @@ namespace ara
         namespace sink
         {
             /// @brief Log sink implementation that appends logs to a file.
+            /// @details Lines are collected by a buffered LogFileWriter that
+            ///          keeps the file open; they reach the file within the
+            ///          writer's maximum delay or on Flush().
             class FileLogSink : public LogSink
             {
             private:
                 std::string mLogFilePath;
+                std::unique_ptr<LogFileWriter> mWriter;
 
             public:
                 /// @brief Constructor
                 /// @param appId Application ID
                 /// @param appDescription Application description
                 /// @param logFilePath Logging file sink path
+                /// @param options Buffering, rotation and sync configuration
                 FileLogSink(
                     std::string appId,
                     std::string appDescription,
-                    std::string logFilePath);
+                    std::string logFilePath,
+                    LogFileWriterOptions options = LogFileWriterOptions());
 
                 FileLogSink() = delete;
                 void Log(const LogStream &logStream) const override;
+
+                /// @brief Write the buffered lines to the file
+                void Flush() const;
             };
         }
     }
@@ -0,0 +1,332 @@
+/// @file src/ara/log/sink/log_file_writer.cpp
+/// @brief Implementation for the buffered, rotating log file writer.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "./log_file_writer.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace sink
+        {
+            namespace
+            {
+                constexpr std::size_t cMaxBlockCount{64U};
+
+                std::size_t pageSize()
+                {
+                    const long cPageSize{::sysconf(_SC_PAGESIZE)};
+                    return cPageSize > 0 ? static_cast<std::size_t>(cPageSize) : 4096U;
+                }
+            }
+
+            void LogFileWriter::BlockDeleter::operator()(std::uint8_t *block) const noexcept
+            {
+                std::free(block);
+            }
+
+            LogFileWriter::LogFileWriter(
+                std::string path,
+                LogFileWriterOptions options) : mState{std::make_shared<State>()}
+            {
+                State &_state{*mState};
+                _state.Path = std::move(path);
+                _state.Options = options;
+
+                // Whole pages keep every block boundary page-aligned.
+                const std::size_t cPageSize{pageSize()};
+                const std::size_t cBlockSize{std::max<std::size_t>(1U, options.BlockSize)};
+                _state.BlockSize = (cBlockSize + cPageSize - 1U) / cPageSize * cPageSize;
+                const std::size_t cBlockCount{
+                    std::min(std::max<std::size_t>(1U, options.BlockCount), cMaxBlockCount)};
+                for (std::size_t i = 0U; i < cBlockCount; ++i)
+                {
+                    void *_block{nullptr};
+                    if (::posix_memalign(&_block, cPageSize, _state.BlockSize) != 0)
+                    {
+                        throw std::bad_alloc();
+                    }
+                    _state.Blocks.emplace_back(static_cast<std::uint8_t *>(_block));
+                }
+
+                open(_state);
+            }
+
+            LogFileWriter::~LogFileWriter() noexcept
+            {
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                flush(*mState);
+                if (mState->Options.SyncPolicy == LogFileSyncPolicy::kOnRotate)
+                {
+                    sync(*mState);
+                }
+                close(*mState);
+            }
+
+            void LogFileWriter::open(State &state)
+            {
+                state.Fd = ::open(
+                    state.Path.c_str(),
+                    O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+                    0644);
+                if (state.Fd < 0)
+                {
+                    ++state.Statistics.Errors;
+                    return;
+                }
+
+                // The only stat of the file; from here on its size is tracked.
+                struct stat _status;
+                state.FileSize =
+                    ::fstat(state.Fd, &_status) == 0
+                        ? static_cast<std::size_t>(_status.st_size)
+                        : 0U;
+            }
+
+            void LogFileWriter::close(State &state)
+            {
+                if (state.Fd >= 0)
+                {
+                    ::close(state.Fd);
+                    state.Fd = -1;
+                }
+            }
+
+            void LogFileWriter::sync(State &state)
+            {
+                if (state.Fd >= 0)
+                {
+                    ::fdatasync(state.Fd);
+                    ++state.Statistics.Syncs;
+                }
+            }
+
+            void LogFileWriter::flush(State &state)
+            {
+                state.FlushDeadline.Cancel();
+
+                if (state.Buffered == 0U)
+                {
+                    return;
+                }
+
+                iovec _vectors[cMaxBlockCount];
+                std::size_t _count{0U};
+                for (std::size_t _offset = 0U; _offset < state.Buffered; _offset += state.BlockSize)
+                {
+                    _vectors[_count].iov_base = state.Blocks[_count].get();
+                    _vectors[_count].iov_len =
+                        std::min(state.BlockSize, state.Buffered - _offset);
+                    ++_count;
+                }
+
+                iovec *_next{_vectors};
+                std::size_t _written{0U};
+                while (state.Fd >= 0 && _count > 0U)
+                {
+                    const ssize_t _result{
+                        ::writev(state.Fd, _next, static_cast<int>(_count))};
+                    ++state.Statistics.Writes;
+                    if (_result < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                        ++state.Statistics.Errors;
+                        break;
+                    }
+
+                    // Resume a short write after the last complete byte.
+                    std::size_t _remaining{static_cast<std::size_t>(_result)};
+                    _written += _remaining;
+                    while (_count > 0U && _remaining >= _next->iov_len)
+                    {
+                        _remaining -= _next->iov_len;
+                        ++_next;
+                        --_count;
+                    }
+                    if (_count > 0U)
+                    {
+                        _next->iov_base = static_cast<std::uint8_t *>(_next->iov_base) + _remaining;
+                        _next->iov_len -= _remaining;
+                    }
+                }
+
+                // Bytes that could not be written are not part of the file.
+                state.FileSize -= state.Buffered - _written;
+                state.Statistics.Bytes += _written;
+                state.Buffered = 0U;
+
+                if (state.Options.SyncPolicy == LogFileSyncPolicy::kOnFlush)
+                {
+                    sync(state);
+                }
+            }
+
+            void LogFileWriter::rotate(State &state)
+            {
+                flush(state);
+                if (state.Options.SyncPolicy == LogFileSyncPolicy::kOnRotate)
+                {
+                    sync(state);
+                }
+                close(state);
+
+                // path.N-2 -> path.N-1, ..., path -> path.0
+                const std::size_t cRotatedFiles{state.Options.MaxRotatedFiles};
+                if (cRotatedFiles == 0U)
+                {
+                    std::remove(state.Path.c_str());
+                }
+                else
+                {
+                    for (std::size_t i = cRotatedFiles - 1U; i > 0U; --i)
+                    {
+                        const std::string cFrom{state.Path + "." + std::to_string(i - 1U)};
+                        const std::string cTo{state.Path + "." + std::to_string(i)};
+                        std::rename(cFrom.c_str(), cTo.c_str());
+                    }
+                    const std::string cFirst{state.Path + ".0"};
+                    std::rename(state.Path.c_str(), cFirst.c_str());
+                }
+
+                ++state.Statistics.Rotations;
+                open(state);
+            }
+
+            void LogFileWriter::writeDirect(
+                State &state, const std::uint8_t *data, std::size_t size)
+            {
+                std::size_t _written{0U};
+                while (_written < size)
+                {
+                    const ssize_t _result{
+                        ::write(state.Fd, data + _written, size - _written)};
+                    ++state.Statistics.Writes;
+                    if (_result < 0)
+                    {
+                        if (errno == EINTR)
+                        {
+                            continue;
+                        }
+                        ++state.Statistics.Errors;
+                        break;
+                    }
+                    _written += static_cast<std::size_t>(_result);
+                }
+
+                state.FileSize += _written;
+                state.Statistics.Bytes += _written;
+                if (state.Options.SyncPolicy == LogFileSyncPolicy::kOnFlush)
+                {
+                    sync(state);
+                }
+            }
+
+            void LogFileWriter::Write(const void *data, std::size_t size)
+            {
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                State &_state{*mState};
+                const auto *cData = static_cast<const std::uint8_t *>(data);
+
+                if (_state.Fd < 0)
+                {
+                    open(_state);
+                    if (_state.Fd < 0)
+                    {
+                        return;
+                    }
+                }
+
+                // Rotate on a record boundary; a record alone in a file is
+                // kept even if it exceeds the size limit.
+                const std::size_t cMaxFileSize{_state.Options.MaxFileSize};
+                if (cMaxFileSize > 0U && _state.FileSize > 0U &&
+                    _state.FileSize + size > cMaxFileSize)
+                {
+                    rotate(_state);
+                    if (_state.Fd < 0)
+                    {
+                        return;
+                    }
+                }
+
+                ++_state.Statistics.Records;
+                const std::size_t cCapacity{_state.BlockSize * _state.Blocks.size()};
+                if (_state.Buffered + size > cCapacity)
+                {
+                    flush(_state);
+                    if (size > cCapacity)
+                    {
+                        writeDirect(_state, cData, size);
+                        return;
+                    }
+                }
+
+                const bool cWasEmpty{_state.Buffered == 0U};
+                std::size_t _copied{0U};
+                while (_copied < size)
+                {
+                    const std::size_t cBlock{_state.Buffered / _state.BlockSize};
+                    const std::size_t cOffset{_state.Buffered % _state.BlockSize};
+                    const std::size_t cChunk{
+                        std::min(size - _copied, _state.BlockSize - cOffset)};
+                    std::memcpy(_state.Blocks[cBlock].get() + cOffset, cData + _copied, cChunk);
+                    _copied += cChunk;
+                    _state.Buffered += cChunk;
+                }
+                _state.FileSize += size;
+
+                if (_state.Buffered == cCapacity)
+                {
+                    flush(_state);
+                }
+                else if (cWasEmpty &&
+                         _state.Options.MaxDelay > std::chrono::milliseconds::zero())
+                {
+                    State *const cState{mState.get()};
+                    _state.FlushDeadline.Arm(
+                        _state.Options.MaxDelay,
+                        std::shared_ptr<std::mutex>(mState, &mState->Mutex),
+                        [cState]() { flush(*cState); });
+                }
+            }
+
+            void LogFileWriter::Flush()
+            {
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                flush(*mState);
+            }
+
+            bool LogFileWriter::IsOpen() const
+            {
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                return mState->Fd >= 0;
+            }
+
+            std::size_t LogFileWriter::FileSize() const
+            {
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                return mState->FileSize;
+            }
+
+            LogFileWriterStatistics LogFileWriter::GetStatistics() const
+            {
+                std::lock_guard<std::mutex> _lock(mState->Mutex);
+                return mState->Statistics;
+            }
+        }
+    }
+}
@@ -15,6 +15,16 @@ namespace ara
             {
             }
 
+            void LogSink::LogNonVerbose(
+                const Logger &logger,
+                LogLevel logLevel,
+                const LogStream &logStream) const
+            {
+                LogStream _record = logger.WithLevel(logLevel);
+                _record << logStream;
+                Log(_record);
+            }
+
             LogStream LogSink::GetAppstamp() const
             {
                 LogStream _result;
@@ -6,7 +6,7 @@
 #define LOG_SINK_H
 
 #include <ctime>
-#include "../log_stream.h"
+#include "../logger.h"
 
 namespace ara
 {
@@ -44,6 +44,17 @@ namespace ara
                 /// @brief Log a stream corresponds to the current application
                 /// @param logStream Input log stream
                 virtual void Log(const LogStream &logStream) const = 0;
+
+                /// @brief Log a stream of a non-verbose log context
+                /// @param logger Logger of the context
+                /// @param logLevel Log severity level
+                /// @param logStream Stream started with ARA_LOG_MESSAGE
+                /// @note The default implementation logs the stream verbosely
+                ///       with the context prefix of Logger::WithLevel.
+                virtual void LogNonVerbose(
+                    const Logger &logger,
+                    LogLevel logLevel,
+                    const LogStream &logStream) const;
             };
         }
     }
@@ -15,6 +15,7 @@ namespace ara
         namespace sink
         {
             const char *const NetworkLogSink::cDefaultHost{"127.0.0.1"};
+            const std::chrono::milliseconds NetworkLogSink::cFlushDelay{5};
 
             NetworkLogSink::NetworkLogSink(
                 std::string appId,
@@ -42,10 +43,25 @@ namespace ara
                     throw std::runtime_error(
                         "Failed to create UDP socket for network log sink.");
                 }
+
+                struct sockaddr_in _destAddr;
+                std::memset(&_destAddr, 0, sizeof(_destAddr));
+                _destAddr.sin_family = AF_INET;
+                _destAddr.sin_port = htons(mPort);
+                inet_pton(AF_INET, mHost.c_str(), &_destAddr.sin_addr);
+
+                mSender.reset(new com::helper::UdpBatchSender{
+                    mSocketFd,
+                    _destAddr,
+                    com::helper::UdpBatchSender::cDefaultBatchSize,
+                    com::helper::UdpBatchSender::cDefaultSlotSize,
+                    cFlushDelay});
             }
 
             void NetworkLogSink::closeSocket() noexcept
             {
+                // Flush the pending lines before the socket goes away.
+                mSender.reset();
                 if (mSocketFd >= 0)
                 {
                     close(mSocketFd);
@@ -65,19 +81,9 @@ namespace ara
                 _timestamp << cWhitespace << _appstamp << cWhitespace << logStream;
                 std::string _message = _timestamp.ToString();
 
-                struct sockaddr_in _destAddr;
-                std::memset(&_destAddr, 0, sizeof(_destAddr));
-                _destAddr.sin_family = AF_INET;
-                _destAddr.sin_port = htons(mPort);
-                inet_pton(AF_INET, mHost.c_str(), &_destAddr.sin_addr);
-
-                sendto(
-                    mSocketFd,
-                    _message.c_str(),
-                    _message.size(),
-                    0,
-                    reinterpret_cast<const struct sockaddr *>(&_destAddr),
-                    sizeof(_destAddr));
+                mSender->Send(
+                    reinterpret_cast<const uint8_t *>(_message.data()),
+                    _message.size());
             }
         }
     }
@@ -1,7 +1,10 @@
 #ifndef NETWORK_LOG_SINK_H
 #define NETWORK_LOG_SINK_H
 
+#include <chrono>
+#include <memory>
 #include <string>
+#include "../../com/helper/udp_batch.h"
 #include "./log_sink.h"
 
 namespace ara
@@ -13,15 +16,19 @@ namespace ara
             /// @brief Log sink implementation that sends logs via UDP.
             /// @note Uses plain-text format for educational purposes
             ///       (not the binary DLT wire protocol).
+            /// @details Lines are batched per sendmmsg() call and flushed at
+            ///          the latest cFlushDelay after the first one of a batch.
             class NetworkLogSink : public LogSink
             {
             private:
                 static const uint16_t cDefaultPort{3490U};
                 static const char *const cDefaultHost;
+                static const std::chrono::milliseconds cFlushDelay;
 
                 std::string mHost;
                 uint16_t mPort;
                 int mSocketFd;
+                std::unique_ptr<com::helper::UdpBatchSender> mSender;
 
                 void openSocket();
                 void closeSocket() noexcept;
@@ -0,0 +1,929 @@
+/// @file src/ara/log/sink/shm_log_transport.cpp
+/// @brief Implementation for the shared-memory log transport.
+/// @details This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <new>
+#include "./shm_log_transport.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace ara
+{
+    namespace log
+    {
+        namespace sink
+        {
+            namespace
+            {
+                constexpr std::uint32_t cMagic{0x41524C47U}; // "ARLG"
+                constexpr std::uint32_t cVersion{1U};
+                constexpr std::uint32_t cWrapMarker{0xFFFFFFFFU};
+                constexpr std::uint64_t cMinCapacity{4096U};
+                constexpr std::uint64_t cMaxCapacity{64U * 1024U * 1024U};
+                constexpr std::uint8_t cAck{0x06U};
+
+                // Sent once over the Unix socket together with the memfd and
+                // the eventfd.
+                struct RegisterRequest
+                {
+                    std::uint32_t Magic;
+                    std::uint32_t Version;
+                    std::uint64_t Capacity;
+                    char AppId[4];
+                };
+
+                static_assert(
+                    ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+                    "The shared ring needs address-free atomics.");
+
+                std::uint64_t alignRecord(std::uint64_t size) noexcept
+                {
+                    return (size + 7U) & ~static_cast<std::uint64_t>(7U);
+                }
+
+                std::uint64_t roundCapacity(std::size_t capacity) noexcept
+                {
+                    std::uint64_t _result{cMinCapacity};
+                    while (_result < capacity && _result < cMaxCapacity)
+                    {
+                        _result <<= 1U;
+                    }
+                    return _result;
+                }
+
+#if defined(__linux__)
+                bool makeAddress(const std::string &path, sockaddr_un &address) noexcept
+                {
+                    std::memset(&address, 0, sizeof(address));
+                    address.sun_family = AF_UNIX;
+                    if (path.empty() || path.size() >= sizeof(address.sun_path))
+                    {
+                        return false;
+                    }
+                    std::memcpy(address.sun_path, path.c_str(), path.size());
+                    return true;
+                }
+
+                void closeFd(int &fd) noexcept
+                {
+                    if (fd >= 0)
+                    {
+                        ::close(fd);
+                        fd = -1;
+                    }
+                }
+#endif
+            }
+
+            // -----------------------------------------------------------------------
+            // ShmLogRing
+            // -----------------------------------------------------------------------
+
+            const std::size_t ShmLogRing::cHeaderSize{4096U};
+
+            ShmLogRing::ShmLogRing(void *mapping, std::uint64_t capacity) noexcept
+                : mHeader{static_cast<ShmLogRingHeader *>(mapping)},
+                  mData{static_cast<std::uint8_t *>(mapping) + cHeaderSize},
+                  mCapacity{capacity}
+            {
+            }
+
+            void ShmLogRing::Initialize() noexcept
+            {
+                new (mHeader) ShmLogRingHeader();
+                mHeader->Capacity = mCapacity;
+                mHeader->Version = cVersion;
+                mHeader->Head.store(0U, std::memory_order_relaxed);
+                mHeader->Records.store(0U, std::memory_order_relaxed);
+                mHeader->Dropped.store(0U, std::memory_order_relaxed);
+                mHeader->Tail.store(0U, std::memory_order_relaxed);
+                mHeader->Waiting.store(0U, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                mHeader->Magic = cMagic;
+            }
+
+            bool ShmLogRing::IsValid() const noexcept
+            {
+                return mHeader->Magic == cMagic &&
+                       mHeader->Version == cVersion &&
+                       mHeader->Capacity == mCapacity;
+            }
+
+            bool ShmLogRing::TryWrite(const void *data, std::size_t size) noexcept
+            {
+                const std::uint64_t cNeed{alignRecord(sizeof(std::uint32_t) + size)};
+                if (size >= cWrapMarker || cNeed > mCapacity / 2U)
+                {
+                    mHeader->Dropped.fetch_add(1U, std::memory_order_relaxed);
+                    return false;
+                }
+
+                std::uint64_t _head{mHeader->Head.load(std::memory_order_relaxed)};
+                const std::uint64_t cTail{mHeader->Tail.load(std::memory_order_acquire)};
+                std::uint64_t _offset{_head & (mCapacity - 1U)};
+                const std::uint64_t cContiguous{mCapacity - _offset};
+                const std::uint64_t cSkip{cNeed > cContiguous ? cContiguous : 0U};
+                if (_head - cTail + cSkip + cNeed > mCapacity)
+                {
+                    mHeader->Dropped.fetch_add(1U, std::memory_order_relaxed);
+                    return false;
+                }
+
+                // A record never wraps; the tail end of the ring is skipped.
+                if (cSkip > 0U)
+                {
+                    std::memcpy(mData + _offset, &cWrapMarker, sizeof(cWrapMarker));
+                    _head += cSkip;
+                    _offset = 0U;
+                }
+
+                const std::uint32_t cSize{static_cast<std::uint32_t>(size)};
+                std::memcpy(mData + _offset, &cSize, sizeof(cSize));
+                std::memcpy(mData + _offset + sizeof(cSize), data, size);
+                mHeader->Head.store(_head + cNeed, std::memory_order_release);
+                mHeader->Records.fetch_add(1U, std::memory_order_relaxed);
+
+                return true;
+            }
+
+            bool ShmLogRing::ConsumeWakeupRequest() noexcept
+            {
+                // Pairs with the fence in PrepareWait(): either the consumer
+                // sees the new head or the producer sees the request.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                return mHeader->Waiting.load(std::memory_order_relaxed) != 0U &&
+                       mHeader->Waiting.exchange(0U, std::memory_order_acq_rel) != 0U;
+            }
+
+            std::size_t ShmLogRing::Read(const Handler &handler, std::size_t budget)
+            {
+                // The producer is another process; every length it wrote is
+                // checked before the record is touched.
+                std::uint64_t _tail{mHeader->Tail.load(std::memory_order_relaxed)};
+                const std::uint64_t cHead{mHeader->Head.load(std::memory_order_acquire)};
+                if (cHead - _tail > mCapacity)
+                {
+                    mHeader->Tail.store(cHead, std::memory_order_release);
+                    return 0U;
+                }
+
+                std::size_t _count{0U};
+                while (_tail != cHead && _count < budget)
+                {
+                    const std::uint64_t cOffset{_tail & (mCapacity - 1U)};
+                    const std::uint64_t cContiguous{mCapacity - cOffset};
+                    const std::uint64_t cAvailable{cHead - _tail};
+                    if (cContiguous < sizeof(std::uint32_t))
+                    {
+                        _tail = cHead;
+                        break;
+                    }
+
+                    std::uint32_t _size;
+                    std::memcpy(&_size, mData + cOffset, sizeof(_size));
+                    if (_size == cWrapMarker)
+                    {
+                        if (cContiguous > cAvailable)
+                        {
+                            _tail = cHead;
+                            break;
+                        }
+                        _tail += cContiguous;
+                        continue;
+                    }
+
+                    const std::uint64_t cNeed{alignRecord(sizeof(std::uint32_t) + _size)};
+                    if (cNeed > cAvailable || cNeed > cContiguous)
+                    {
+                        _tail = cHead;
+                        break;
+                    }
+
+                    handler(mData + cOffset + sizeof(std::uint32_t), _size);
+                    _tail += cNeed;
+                    ++_count;
+                }
+
+                mHeader->Tail.store(_tail, std::memory_order_release);
+                return _count;
+            }
+
+            bool ShmLogRing::PrepareWait() noexcept
+            {
+                mHeader->Waiting.store(1U, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                return IsEmpty();
+            }
+
+            bool ShmLogRing::IsEmpty() const noexcept
+            {
+                return mHeader->Head.load(std::memory_order_acquire) ==
+                       mHeader->Tail.load(std::memory_order_relaxed);
+            }
+
+            std::uint64_t ShmLogRing::Records() const noexcept
+            {
+                return mHeader->Records.load(std::memory_order_relaxed);
+            }
+
+            std::uint64_t ShmLogRing::Dropped() const noexcept
+            {
+                return mHeader->Dropped.load(std::memory_order_relaxed);
+            }
+
+            // -----------------------------------------------------------------------
+            // ShmLogTransport (application side)
+            // -----------------------------------------------------------------------
+
+            const char *const ShmLogTransport::cDefaultSocketPath{"/run/autosar/dlt.sock"};
+            const std::size_t ShmLogTransport::cDefaultCapacity{1024U * 1024U};
+            const std::chrono::milliseconds ShmLogTransport::cReconnectPeriod{1000};
+            const std::chrono::milliseconds ShmLogTransport::cPeerCheckPeriod{10};
+            const std::chrono::milliseconds ShmLogTransport::cRegistrationTimeout{500};
+
+            ShmLogTransport::ShmLogTransport(
+                std::string appId,
+                std::string socketPath,
+                std::size_t capacity) : mAppId{std::move(appId)},
+                                        mSocketPath{std::move(socketPath)},
+                                        mCapacity{static_cast<std::size_t>(roundCapacity(capacity))},
+                                        mControlFd{-1},
+                                        mEventFd{-1},
+                                        mMapping{nullptr},
+                                        mState{State::kDisconnected}
+            {
+                // Only the constructor waits for the acknowledgement, so that
+                // the first messages of a process already take the ring.
+                auto _now = std::chrono::steady_clock::now();
+                if (!beginRegistration(_now))
+                {
+                    return;
+                }
+
+#if defined(__linux__)
+                while (mState == State::kRegistering)
+                {
+                    const auto cRemaining =
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            mRegistrationDeadline - _now);
+                    pollfd _pollFd{mControlFd, POLLIN, 0};
+                    ::poll(&_pollFd, 1U, static_cast<int>(std::max<std::int64_t>(0, cRemaining.count())));
+                    _now = std::chrono::steady_clock::now();
+                    pollRegistration(_now);
+                }
+#endif
+            }
+
+            ShmLogTransport::~ShmLogTransport() noexcept
+            {
+                // The daemon drains what is left once it sees the hang-up.
+                std::lock_guard<std::mutex> _lock(mMutex);
+                disconnect();
+            }
+
+            bool ShmLogTransport::beginRegistration(
+                std::chrono::steady_clock::time_point now)
+            {
+                mNextAttempt = now + cReconnectPeriod;
+#if defined(__linux__)
+                sockaddr_un _address;
+                if (!makeAddress(mSocketPath, _address))
+                {
+                    return false;
+                }
+
+                // Without a daemon this fails before any memory is set up. A
+                // Unix socket connects at once or fails (EAGAIN on a full
+                // backlog), so the non-blocking connect never stays pending.
+                mControlFd = ::socket(
+                    AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+                if (mControlFd < 0 ||
+                    ::connect(
+                        mControlFd,
+                        reinterpret_cast<const sockaddr *>(&_address),
+                        sizeof(_address)) != 0)
+                {
+                    disconnect();
+                    return false;
+                }
+
+                const std::size_t cMappingSize{ShmLogRing::cHeaderSize + mCapacity};
+                const std::string cName{"ara_log_" + mAppId};
+                int _memoryFd{::memfd_create(cName.c_str(), MFD_CLOEXEC | MFD_ALLOW_SEALING)};
+                if (_memoryFd < 0 ||
+                    ::ftruncate(_memoryFd, static_cast<off_t>(cMappingSize)) != 0 ||
+                    ::fcntl(_memoryFd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0)
+                {
+                    closeFd(_memoryFd);
+                    disconnect();
+                    return false;
+                }
+
+                void *_mapping{::mmap(
+                    nullptr, cMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, _memoryFd, 0)};
+                mEventFd = ::eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK);
+                if (_mapping == MAP_FAILED || mEventFd < 0)
+                {
+                    if (_mapping != MAP_FAILED)
+                    {
+                        ::munmap(_mapping, cMappingSize);
+                    }
+                    closeFd(_memoryFd);
+                    disconnect();
+                    return false;
+                }
+                mMapping = _mapping;
+                mRing.reset(new ShmLogRing(mMapping, mCapacity));
+                mRing->Initialize();
+
+                RegisterRequest _request;
+                std::memset(&_request, 0, sizeof(_request));
+                _request.Magic = cMagic;
+                _request.Version = cVersion;
+                _request.Capacity = mCapacity;
+                std::memcpy(
+                    _request.AppId, mAppId.data(), std::min<std::size_t>(mAppId.size(), 4U));
+
+                iovec _vector{&_request, sizeof(_request)};
+                union
+                {
+                    char Buffer[CMSG_SPACE(2U * sizeof(int))];
+                    cmsghdr Align;
+                } _control;
+                std::memset(&_control, 0, sizeof(_control));
+                msghdr _message;
+                std::memset(&_message, 0, sizeof(_message));
+                _message.msg_iov = &_vector;
+                _message.msg_iovlen = 1U;
+                _message.msg_control = _control.Buffer;
+                _message.msg_controllen = sizeof(_control.Buffer);
+                cmsghdr *_header{CMSG_FIRSTHDR(&_message)};
+                _header->cmsg_level = SOL_SOCKET;
+                _header->cmsg_type = SCM_RIGHTS;
+                _header->cmsg_len = CMSG_LEN(2U * sizeof(int));
+                const int cFds[2]{_memoryFd, mEventFd};
+                std::memcpy(CMSG_DATA(_header), cFds, sizeof(cFds));
+
+                const ssize_t cSent{::sendmsg(mControlFd, &_message, MSG_NOSIGNAL)};
+                // The daemon holds its own reference to the memory now.
+                closeFd(_memoryFd);
+                if (cSent != static_cast<ssize_t>(sizeof(_request)))
+                {
+                    disconnect();
+                    return false;
+                }
+
+                mState = State::kRegistering;
+                mRegistrationDeadline = now + cRegistrationTimeout;
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            void ShmLogTransport::pollRegistration(
+                std::chrono::steady_clock::time_point now)
+            {
+#if defined(__linux__)
+                std::uint8_t _ack{0U};
+                const ssize_t cReceived{
+                    ::recv(mControlFd, &_ack, sizeof(_ack), MSG_DONTWAIT)};
+                if (cReceived == 1 && _ack == cAck)
+                {
+                    mState = State::kRegistered;
+                    mNextPeerCheck = now + cPeerCheckPeriod;
+                    ++mStatistics.Registrations;
+                    return;
+                }
+
+                // A daemon that does not map the ring never acknowledges it.
+                const bool cPending{
+                    cReceived < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)};
+                if (!cPending || now >= mRegistrationDeadline)
+                {
+                    disconnect();
+                }
+#else
+                static_cast<void>(now);
+#endif
+            }
+
+            void ShmLogTransport::disconnect() noexcept
+            {
+#if defined(__linux__)
+                closeFd(mControlFd);
+                closeFd(mEventFd);
+                if (mMapping != nullptr)
+                {
+                    ::munmap(mMapping, ShmLogRing::cHeaderSize + mCapacity);
+                    mMapping = nullptr;
+                }
+#endif
+                mRing.reset();
+                mState = State::kDisconnected;
+            }
+
+            bool ShmLogTransport::isPeerGone() const noexcept
+            {
+#if defined(__linux__)
+                pollfd _pollFd{mControlFd, POLLIN, 0};
+                return ::poll(&_pollFd, 1U, 0) != 0 &&
+                       (_pollFd.revents & (POLLHUP | POLLERR | POLLNVAL)) != 0;
+#else
+                return true;
+#endif
+            }
+
+            bool ShmLogTransport::Send(const std::uint8_t *data, std::size_t size)
+            {
+                std::lock_guard<std::mutex> _lock(mMutex);
+
+                const auto cNow = std::chrono::steady_clock::now();
+                if (mState != State::kRegistered)
+                {
+                    // Never wait for the daemon here: the caller takes its
+                    // fallback until the acknowledgement has arrived.
+                    if (mState == State::kDisconnected && cNow >= mNextAttempt)
+                    {
+                        beginRegistration(cNow);
+                    }
+                    if (mState == State::kRegistering)
+                    {
+                        pollRegistration(cNow);
+                    }
+                    if (mState != State::kRegistered)
+                    {
+                        ++mStatistics.Unregistered;
+                        return false;
+                    }
+                }
+                else if (cNow >= mNextPeerCheck)
+                {
+                    // Notice a daemon that went away before the ring fills up.
+                    if (isPeerGone())
+                    {
+                        disconnect();
+                        mNextAttempt = cNow + cReconnectPeriod;
+                        ++mStatistics.Unregistered;
+                        return false;
+                    }
+                    mNextPeerCheck = cNow + cPeerCheckPeriod;
+                }
+
+                if (mRing->TryWrite(data, size))
+                {
+                    ++mStatistics.Sent;
+#if defined(__linux__)
+                    if (mRing->ConsumeWakeupRequest())
+                    {
+                        ::eventfd_write(mEventFd, 1U);
+                        ++mStatistics.Wakeups;
+                    }
+#endif
+                    return true;
+                }
+
+                // A full ring may also mean that the daemon went away.
+                if (isPeerGone())
+                {
+                    disconnect();
+                    mNextAttempt = cNow + cReconnectPeriod;
+                    ++mStatistics.Unregistered;
+                    return false;
+                }
+
+                ++mStatistics.Dropped;
+                return true;
+            }
+
+            bool ShmLogTransport::IsConnected() const
+            {
+                std::lock_guard<std::mutex> _lock(mMutex);
+                return mState == State::kRegistered;
+            }
+
+            ShmLogTransportStatistics ShmLogTransport::GetStatistics() const
+            {
+                std::lock_guard<std::mutex> _lock(mMutex);
+                return mStatistics;
+            }
+
+            // -----------------------------------------------------------------------
+            // ShmLogCollector (daemon side)
+            // -----------------------------------------------------------------------
+
+            ShmLogCollector::ShmLogCollector(std::string socketPath)
+                : mSocketPath{std::move(socketPath)},
+                  mListenFd{-1},
+                  mEpollFd{-1},
+                  mDepartedReceived{0U},
+                  mDepartedDropped{0U}
+            {
+#if defined(__linux__)
+                mEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+                sockaddr_un _address;
+                if (mEpollFd < 0 || !makeAddress(mSocketPath, _address))
+                {
+                    return;
+                }
+
+                mListenFd = ::socket(
+                    AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+                if (mListenFd < 0)
+                {
+                    return;
+                }
+
+                // A socket left behind by a previous daemon would fail the bind.
+                ::unlink(mSocketPath.c_str());
+                epoll_event _event;
+                std::memset(&_event, 0, sizeof(_event));
+                _event.events = EPOLLIN;
+                _event.data.fd = mListenFd;
+                if (::bind(
+                        mListenFd,
+                        reinterpret_cast<const sockaddr *>(&_address),
+                        sizeof(_address)) != 0 ||
+                    ::listen(mListenFd, 16) != 0 ||
+                    ::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mListenFd, &_event) != 0)
+                {
+                    closeFd(mListenFd);
+                }
+#endif
+            }
+
+            ShmLogCollector::~ShmLogCollector() noexcept
+            {
+                for (auto &client : mClients)
+                {
+                    release(*client);
+                }
+#if defined(__linux__)
+                if (mListenFd >= 0)
+                {
+                    closeFd(mListenFd);
+                    ::unlink(mSocketPath.c_str());
+                }
+                closeFd(mEpollFd);
+#endif
+            }
+
+            void ShmLogCollector::accept()
+            {
+#if defined(__linux__)
+                for (;;)
+                {
+                    const int cFd{::accept4(mListenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)};
+                    if (cFd < 0)
+                    {
+                        return;
+                    }
+
+                    epoll_event _event;
+                    std::memset(&_event, 0, sizeof(_event));
+                    _event.events = EPOLLIN | EPOLLRDHUP;
+                    _event.data.fd = cFd;
+                    if (::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, cFd, &_event) != 0)
+                    {
+                        ::close(cFd);
+                        continue;
+                    }
+
+                    std::unique_ptr<Client> _client{new Client()};
+                    _client->ControlFd = cFd;
+                    mClientsByFd[cFd] = _client.get();
+                    mClients.push_back(std::move(_client));
+                }
+#endif
+            }
+
+            void ShmLogCollector::registerClient(Client &client)
+            {
+#if defined(__linux__)
+                RegisterRequest _request;
+                iovec _vector{&_request, sizeof(_request)};
+                union
+                {
+                    char Buffer[CMSG_SPACE(2U * sizeof(int))];
+                    cmsghdr Align;
+                } _control;
+                msghdr _message;
+                std::memset(&_message, 0, sizeof(_message));
+                _message.msg_iov = &_vector;
+                _message.msg_iovlen = 1U;
+                _message.msg_control = _control.Buffer;
+                _message.msg_controllen = sizeof(_control.Buffer);
+
+                const ssize_t cReceived{::recvmsg(client.ControlFd, &_message, MSG_CMSG_CLOEXEC)};
+                if (cReceived < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                {
+                    return;
+                }
+
+                // Every descriptor that arrived is ours to close, also when
+                // the peer sent a number other than the expected two.
+                int _fds[2]{-1, -1};
+                bool _fdsValid{false};
+                std::size_t _cmsgCount{0U};
+                for (cmsghdr *_header = cReceived > 0 ? CMSG_FIRSTHDR(&_message) : nullptr;
+                     _header != nullptr;
+                     _header = CMSG_NXTHDR(&_message, _header))
+                {
+                    if (_header->cmsg_level != SOL_SOCKET ||
+                        _header->cmsg_type != SCM_RIGHTS ||
+                        _header->cmsg_len < CMSG_LEN(0U))
+                    {
+                        continue;
+                    }
+
+                    ++_cmsgCount;
+                    const std::size_t cCount{
+                        (_header->cmsg_len - CMSG_LEN(0U)) / sizeof(int)};
+                    if (cCount == 2U && _cmsgCount == 1U)
+                    {
+                        std::memcpy(_fds, CMSG_DATA(_header), sizeof(_fds));
+                        _fdsValid = true;
+                        continue;
+                    }
+
+                    _fdsValid = false;
+                    for (std::size_t i = 0U; i < cCount; ++i)
+                    {
+                        int _fd;
+                        std::memcpy(&_fd, CMSG_DATA(_header) + i * sizeof(int), sizeof(_fd));
+                        closeFd(_fd);
+                    }
+                }
+                if (!_fdsValid)
+                {
+                    closeFd(_fds[0]);
+                    closeFd(_fds[1]);
+                }
+                int &_memoryFd{_fds[0]};
+                int &_eventFd{_fds[1]};
+
+                // Only a memfd sealed against shrinking, with its seals
+                // locked, and of the announced size is mapped, so the
+                // application cannot shrink it under the daemon.
+                const int cSeals{_memoryFd >= 0 ? ::fcntl(_memoryFd, F_GET_SEALS) : -1};
+                struct stat _status;
+                const bool cValid{
+                    cReceived == static_cast<ssize_t>(sizeof(_request)) &&
+                    (_message.msg_flags & MSG_CTRUNC) == 0 &&
+                    _memoryFd >= 0 && _eventFd >= 0 &&
+                    _request.Magic == cMagic &&
+                    _request.Version == cVersion &&
+                    _request.Capacity >= cMinCapacity &&
+                    _request.Capacity <= cMaxCapacity &&
+                    (_request.Capacity & (_request.Capacity - 1U)) == 0U &&
+                    cSeals >= 0 &&
+                    (cSeals & F_SEAL_SHRINK) != 0 &&
+                    (cSeals & F_SEAL_SEAL) != 0 &&
+                    ::fstat(_memoryFd, &_status) == 0 &&
+                    static_cast<std::uint64_t>(_status.st_size) >=
+                        ShmLogRing::cHeaderSize + _request.Capacity};
+
+                void *_mapping{MAP_FAILED};
+                const std::size_t cMappingSize{
+                    cValid ? static_cast<std::size_t>(ShmLogRing::cHeaderSize + _request.Capacity) : 0U};
+                if (cValid)
+                {
+                    _mapping = ::mmap(
+                        nullptr, cMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, _memoryFd, 0);
+                }
+                closeFd(_memoryFd);
+
+                std::unique_ptr<ShmLogRing> _ring;
+                if (_mapping != MAP_FAILED)
+                {
+                    _ring.reset(new ShmLogRing(_mapping, _request.Capacity));
+                }
+
+                epoll_event _event;
+                std::memset(&_event, 0, sizeof(_event));
+                _event.events = EPOLLIN;
+                _event.data.fd = _eventFd;
+                if (!_ring || !_ring->IsValid() ||
+                    ::epoll_ctl(mEpollFd, EPOLL_CTL_ADD, _eventFd, &_event) != 0)
+                {
+                    if (_mapping != MAP_FAILED)
+                    {
+                        ::munmap(_mapping, cMappingSize);
+                    }
+                    closeFd(_eventFd);
+                    client.Closed = true;
+                    return;
+                }
+
+                client.Mapping = _mapping;
+                client.MappingSize = cMappingSize;
+                client.Ring = std::move(_ring);
+                client.EventFd = _eventFd;
+                mClientsByFd[_eventFd] = &client;
+
+                client.Statistics.AppId.assign(
+                    _request.AppId, ::strnlen(_request.AppId, sizeof(_request.AppId)));
+                ucred _credentials;
+                socklen_t _length{sizeof(_credentials)};
+                if (::getsockopt(
+                        client.ControlFd, SOL_SOCKET, SO_PEERCRED, &_credentials, &_length) == 0)
+                {
+                    client.Statistics.Pid = static_cast<std::int32_t>(_credentials.pid);
+                }
+
+                const std::uint8_t cAckByte{cAck};
+                ::send(client.ControlFd, &cAckByte, sizeof(cAckByte), MSG_NOSIGNAL | MSG_DONTWAIT);
+#else
+                client.Closed = true;
+#endif
+            }
+
+            void ShmLogCollector::release(Client &client) noexcept
+            {
+#if defined(__linux__)
+                mClientsByFd.erase(client.ControlFd);
+                closeFd(client.ControlFd);
+                if (client.EventFd >= 0)
+                {
+                    mClientsByFd.erase(client.EventFd);
+                    closeFd(client.EventFd);
+                }
+                client.Ring.reset();
+                if (client.Mapping != nullptr)
+                {
+                    ::munmap(client.Mapping, client.MappingSize);
+                    client.Mapping = nullptr;
+                }
+#endif
+            }
+
+            void ShmLogCollector::handleEvents()
+            {
+#if defined(__linux__)
+                epoll_event _events[32];
+                const int cCount{::epoll_wait(mEpollFd, _events, 32, 0)};
+                for (int i = 0; i < cCount; ++i)
+                {
+                    const int cFd{_events[i].data.fd};
+                    if (cFd == mListenFd)
+                    {
+                        accept();
+                        continue;
+                    }
+
+                    auto _iterator = mClientsByFd.find(cFd);
+                    if (_iterator == mClientsByFd.end())
+                    {
+                        continue;
+                    }
+                    Client &_client{*_iterator->second};
+
+                    if (cFd == _client.EventFd)
+                    {
+                        // Reset the level-triggered wake-up; Poll() drains.
+                        eventfd_t _value;
+                        ::eventfd_read(cFd, &_value);
+                    }
+                    else if (!_client.Ring && (_events[i].events & EPOLLIN) != 0)
+                    {
+                        registerClient(_client);
+                    }
+                    else if ((_events[i].events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0)
+                    {
+                        _client.Closed = true;
+                    }
+                    else
+                    {
+                        std::uint8_t _discard;
+                        if (::recv(cFd, &_discard, sizeof(_discard), MSG_DONTWAIT) == 0)
+                        {
+                            _client.Closed = true;
+                        }
+                    }
+                }
+#endif
+            }
+
+            std::size_t ShmLogCollector::Poll(const Handler &handler, std::size_t budget)
+            {
+                handleEvents();
+
+                std::size_t _total{0U};
+                for (auto &client : mClients)
+                {
+                    if (!client->Ring)
+                    {
+                        continue;
+                    }
+
+                    // A departed application's ring is drained to the end.
+                    const std::size_t cBudget{
+                        client->Closed ? std::numeric_limits<std::size_t>::max() : budget};
+                    const std::size_t cCount{client->Ring->Read(handler, cBudget)};
+                    client->Statistics.Received += cCount;
+                    client->Statistics.Dropped = client->Ring->Dropped();
+                    _total += cCount;
+                }
+
+                for (auto _iterator = mClients.begin(); _iterator != mClients.end();)
+                {
+                    if ((*_iterator)->Closed)
+                    {
+                        mDepartedReceived += (*_iterator)->Statistics.Received;
+                        mDepartedDropped += (*_iterator)->Statistics.Dropped;
+                        release(**_iterator);
+                        _iterator = mClients.erase(_iterator);
+                    }
+                    else
+                    {
+                        ++_iterator;
+                    }
+                }
+
+                return _total;
+            }
+
+            bool ShmLogCollector::PrepareWait() noexcept
+            {
+                for (auto &client : mClients)
+                {
+                    if (client->Ring && !client->Ring->PrepareWait())
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool ShmLogCollector::IsListening() const noexcept
+            {
+                return mListenFd >= 0;
+            }
+
+            int ShmLogCollector::Fd() const noexcept
+            {
+                return mEpollFd;
+            }
+
+            std::size_t ShmLogCollector::ClientCount() const noexcept
+            {
+                std::size_t _count{0U};
+                for (const auto &client : mClients)
+                {
+                    if (client->Ring)
+                    {
+                        ++_count;
+                    }
+                }
+                return _count;
+            }
+
+            std::vector<ShmLogAppStatistics> ShmLogCollector::GetAppStatistics() const
+            {
+                std::vector<ShmLogAppStatistics> _result;
+                for (const auto &client : mClients)
+                {
+                    if (client->Ring)
+                    {
+                        _result.push_back(client->Statistics);
+                    }
+                }
+                return _result;
+            }
+
+            std::uint64_t ShmLogCollector::TotalReceived() const noexcept
+            {
+                std::uint64_t _total{mDepartedReceived};
+                for (const auto &client : mClients)
+                {
+                    _total += client->Statistics.Received;
+                }
+                return _total;
+            }
+
+            std::uint64_t ShmLogCollector::TotalDropped() const noexcept
+            {
+                std::uint64_t _total{mDepartedDropped};
+                for (const auto &client : mClients)
+                {
+                    _total += client->Statistics.Dropped;
+                }
+                return _total;
+            }
+        }
+    }
+}
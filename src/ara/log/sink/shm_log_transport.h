@@ -0,0 +1,307 @@
+/// @file src/ara/log/sink/shm_log_transport.h
+/// @brief Shared-memory log transport between applications and the DLT daemon.
+/// @details Every application owns one memfd-backed byte ring. It registers
+///          the ring with the daemon over a Unix socket, passing the memfd
+///          and an eventfd as ancillary data. Producers copy complete DLT
+///          messages into the ring. The daemon drains every registered ring
+///          from one loop. A producer writes the eventfd only when the
+///          daemon has announced that it is about to sleep, so a busy
+///          stream needs no system call per message.
+///
+///          When no daemon accepts the registration, or when it goes away,
+///          ShmLogTransport::Send() returns false so that the caller can
+///          use its UDP path instead.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef SHM_LOG_TRANSPORT_H
+#define SHM_LOG_TRANSPORT_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ara
+{
+    namespace log
+    {
+        namespace sink
+        {
+            /// @brief Shared ring header at the start of the memfd mapping
+            /// @details Head and the producer counters are only written by the
+            ///          application, Tail and Waiting mostly by the daemon. The
+            ///          daemon never trusts Capacity; it uses the size it
+            ///          validated at registration.
+            struct ShmLogRingHeader
+            {
+                std::uint32_t Magic;
+                std::uint32_t Version;
+                std::uint64_t Capacity;
+                alignas(64) std::atomic<std::uint64_t> Head;
+                std::atomic<std::uint64_t> Records;
+                std::atomic<std::uint64_t> Dropped;
+                alignas(64) std::atomic<std::uint64_t> Tail;
+                std::atomic<std::uint32_t> Waiting;
+            };
+
+            /// @brief View over a mapped ring of length-prefixed records
+            /// @details Records are 8-byte aligned: a 32-bit length followed
+            ///          by the payload. A record never wraps; the space left
+            ///          at the end of the ring is skipped with a marker.
+            ///          TryWrite() needs one producer at a time and Read()
+            ///          one consumer at a time.
+            class ShmLogRing
+            {
+            public:
+                /// @brief Callback for one drained record
+                using Handler = std::function<void(const std::uint8_t *, std::size_t)>;
+
+                /// @brief Size of the ring header area (one page)
+                static const std::size_t cHeaderSize;
+
+            private:
+                ShmLogRingHeader *mHeader;
+                std::uint8_t *mData;
+                std::uint64_t mCapacity;
+
+            public:
+                /// @brief Constructor
+                /// @param mapping Start of the mapping, cHeaderSize + capacity bytes
+                /// @param capacity Data area size, a power of two
+                ShmLogRing(void *mapping, std::uint64_t capacity) noexcept;
+
+                /// @brief Initialize the header of a new ring
+                void Initialize() noexcept;
+
+                /// @brief Check the header written by the producer
+                bool IsValid() const noexcept;
+
+                /// @brief Copy a record into the ring
+                /// @param data Record bytes
+                /// @param size Record size
+                /// @returns False if the record was dropped for lack of space
+                bool TryWrite(const void *data, std::size_t size) noexcept;
+
+                /// @brief Whether the consumer asked for a wake-up, clearing the request
+                bool ConsumeWakeupRequest() noexcept;
+
+                /// @brief Hand the pending records to a handler
+                /// @param handler Called for each record; the bytes are only
+                ///        valid during the call
+                /// @param budget Most records to drain
+                /// @returns Number of records drained
+                std::size_t Read(const Handler &handler, std::size_t budget);
+
+                /// @brief Ask the producer for a wake-up before sleeping
+                /// @returns False if records arrived meanwhile and the
+                ///          consumer must not sleep
+                bool PrepareWait() noexcept;
+
+                /// @brief Whether the ring holds undrained records
+                bool IsEmpty() const noexcept;
+
+                /// @brief Records written by the producer
+                std::uint64_t Records() const noexcept;
+
+                /// @brief Records the producer dropped because the ring was full
+                std::uint64_t Dropped() const noexcept;
+            };
+
+            /// @brief Counters of the application side of the transport
+            struct ShmLogTransportStatistics
+            {
+                /// @brief Messages copied into the ring
+                std::uint64_t Sent{0U};
+                /// @brief Messages dropped because the ring was full
+                std::uint64_t Dropped{0U};
+                /// @brief eventfd wake-ups of the daemon
+                std::uint64_t Wakeups{0U};
+                /// @brief Successful registrations with the daemon
+                std::uint64_t Registrations{0U};
+                /// @brief Messages refused while no registration was complete
+                std::uint64_t Unregistered{0U};
+            };
+
+            /// @brief Application side: one shared-memory ring per process
+            /// @details The transport is thread-safe. While it is not
+            ///          registered it starts a new attempt at most once per
+            ///          reconnect period from Send(). The connect and the
+            ///          registration are non-blocking: Send() only checks for
+            ///          the daemon's acknowledgement and refuses the message
+            ///          until it has arrived, so no logging thread waits on a
+            ///          slow or absent daemon. While registered, Send() polls
+            ///          the control socket at most once per peer check period,
+            ///          so a daemon hang-up switches the caller to its
+            ///          fallback without waiting for the ring to fill up.
+            class ShmLogTransport
+            {
+            public:
+                /// @brief Unix socket the DLT daemon listens on by default
+                static const char *const cDefaultSocketPath;
+                /// @brief Default ring data size
+                static const std::size_t cDefaultCapacity;
+                /// @brief Least time between two registration attempts
+                static const std::chrono::milliseconds cReconnectPeriod;
+                /// @brief Least time between two checks for a daemon hang-up
+                static const std::chrono::milliseconds cPeerCheckPeriod;
+                /// @brief Longest wait for the daemon's acknowledgement
+                static const std::chrono::milliseconds cRegistrationTimeout;
+
+            private:
+                enum class State : std::uint8_t
+                {
+                    kDisconnected,
+                    kRegistering,
+                    kRegistered
+                };
+
+                std::string mAppId;
+                std::string mSocketPath;
+                std::size_t mCapacity;
+                mutable std::mutex mMutex;
+                int mControlFd;
+                int mEventFd;
+                void *mMapping;
+                std::unique_ptr<ShmLogRing> mRing;
+                State mState;
+                std::chrono::steady_clock::time_point mNextAttempt;
+                std::chrono::steady_clock::time_point mRegistrationDeadline;
+                std::chrono::steady_clock::time_point mNextPeerCheck;
+                ShmLogTransportStatistics mStatistics;
+
+                bool beginRegistration(std::chrono::steady_clock::time_point now);
+                void pollRegistration(std::chrono::steady_clock::time_point now);
+                void disconnect() noexcept;
+                bool isPeerGone() const noexcept;
+
+            public:
+                /// @brief Constructor, registers with the daemon if it is running
+                /// @details Waits at most cRegistrationTimeout for the
+                ///          acknowledgement of a daemon that accepted the
+                ///          connection; an absent daemon fails at once.
+                /// @param appId Application ID announced to the daemon
+                /// @param socketPath Daemon registration socket
+                /// @param capacity Ring data size, rounded up to a power of two
+                ShmLogTransport(
+                    std::string appId,
+                    std::string socketPath = cDefaultSocketPath,
+                    std::size_t capacity = cDefaultCapacity);
+
+                ~ShmLogTransport() noexcept;
+
+                ShmLogTransport(const ShmLogTransport &) = delete;
+                ShmLogTransport &operator=(const ShmLogTransport &) = delete;
+
+                /// @brief Hand a complete message to the daemon
+                /// @param data Message bytes
+                /// @param size Message size
+                /// @returns False if no daemon is registered and the caller
+                ///          should use its fallback; a message dropped on a
+                ///          full ring still returns true
+                bool Send(const std::uint8_t *data, std::size_t size);
+
+                /// @brief Whether the ring is registered with the daemon
+                bool IsConnected() const;
+
+                /// @brief Get a snapshot of the counters
+                ShmLogTransportStatistics GetStatistics() const;
+            };
+
+            /// @brief Counters of one application as seen by the daemon
+            struct ShmLogAppStatistics
+            {
+                /// @brief Application ID from the registration
+                std::string AppId;
+                /// @brief Process ID of the peer
+                std::int32_t Pid{0};
+                /// @brief Records drained from the ring
+                std::uint64_t Received{0U};
+                /// @brief Records the application dropped on a full ring
+                std::uint64_t Dropped{0U};
+            };
+
+            /// @brief Daemon side: accepts rings and drains them
+            /// @details Fd() is readable when a registration, a wake-up or a
+            ///          disconnect is pending, so the daemon can wait on it
+            ///          next to its UDP socket. The collector is not
+            ///          thread-safe.
+            class ShmLogCollector
+            {
+            public:
+                /// @brief Callback for one drained message
+                using Handler = ShmLogRing::Handler;
+
+            private:
+                struct Client
+                {
+                    ShmLogAppStatistics Statistics;
+                    int ControlFd{-1};
+                    int EventFd{-1};
+                    void *Mapping{nullptr};
+                    std::size_t MappingSize{0U};
+                    std::unique_ptr<ShmLogRing> Ring;
+                    bool Closed{false};
+                };
+
+                std::string mSocketPath;
+                int mListenFd;
+                int mEpollFd;
+                std::vector<std::unique_ptr<Client>> mClients;
+                std::unordered_map<int, Client *> mClientsByFd;
+                std::uint64_t mDepartedReceived;
+                std::uint64_t mDepartedDropped;
+
+                void accept();
+                void registerClient(Client &client);
+                void release(Client &client) noexcept;
+                void handleEvents();
+
+            public:
+                /// @brief Constructor, binds the registration socket
+                /// @param socketPath Unix socket path; a stale socket is replaced
+                explicit ShmLogCollector(std::string socketPath);
+
+                ~ShmLogCollector() noexcept;
+
+                ShmLogCollector(const ShmLogCollector &) = delete;
+                ShmLogCollector &operator=(const ShmLogCollector &) = delete;
+
+                /// @brief Whether the registration socket is listening
+                bool IsListening() const noexcept;
+
+                /// @brief File descriptor to wait on for readability
+                int Fd() const noexcept;
+
+                /// @brief Handle registrations and disconnects, then drain every ring
+                /// @param handler Called for each message
+                /// @param budget Most messages drained per ring
+                /// @returns Number of messages drained
+                std::size_t Poll(const Handler &handler, std::size_t budget = 256U);
+
+                /// @brief Ask every producer for a wake-up before sleeping on Fd()
+                /// @returns False if a ring has records and Poll() is due
+                bool PrepareWait() noexcept;
+
+                /// @brief Number of registered applications
+                std::size_t ClientCount() const noexcept;
+
+                /// @brief Per-application counters of the registered rings
+                std::vector<ShmLogAppStatistics> GetAppStatistics() const;
+
+                /// @brief Records received from all rings, including closed ones
+                std::uint64_t TotalReceived() const noexcept;
+
+                /// @brief Records dropped by all producers, including closed ones
+                std::uint64_t TotalDropped() const noexcept;
+            };
+        }
+    }
+}
+
+#endif
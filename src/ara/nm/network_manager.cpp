@@ -447,6 +447,30 @@ namespace ara
             return true;
         }
 
+        void NetworkManager::StartTicking(
+            std::chrono::milliseconds period,
+            core::TimerWheel &wheel)
+        {
+            StopTicking();
+            mTicker.reset(new core::PeriodicTimer{
+                wheel, period, [this]()
+                { Tick(MonotonicNowMs()); }});
+            mTicker->Start();
+        }
+
+        void NetworkManager::StopTicking() noexcept
+        {
+            mTicker.reset();
+        }
+
+        std::uint64_t NetworkManager::MonotonicNowMs() noexcept
+        {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+        }
+
         std::uint64_t NetworkManager::CurrentEpochMs() const noexcept
         {
             return mLastTickEpochMs;
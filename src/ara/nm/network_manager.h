@@ -6,8 +6,10 @@
 #ifndef NETWORK_MANAGER_H
 #define NETWORK_MANAGER_H
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -15,6 +17,7 @@
 
 #include "../core/instance_specifier.h"
 #include "../core/result.h"
+#include "../core/timer_wheel.h"
 #include "./nm_error_domain.h"
 
 namespace ara
@@ -90,6 +93,23 @@ namespace ara
             /// @param nowEpochMs  current time in milliseconds since epoch.
             void Tick(std::uint64_t nowEpochMs);
 
+            /// @brief Drive Tick() from a timer wheel instead of polling.
+            /// @param period Tick period.
+            /// @param wheel Wheel to schedule on; must outlive the ticking.
+            /// @note Ticks pass MonotonicNowMs(), so do not mix with manual
+            ///       Tick() calls on another time base.
+            void StartTicking(
+                std::chrono::milliseconds period,
+                core::TimerWheel &wheel = core::TimerWheel::Instance());
+
+            /// @brief Stop the ticking started by StartTicking().
+            /// @note No tick is in progress once this returns.
+            void StopTicking() noexcept;
+
+            /// @brief Monotonic time base used by StartTicking().
+            /// @returns Milliseconds of the steady clock.
+            static std::uint64_t MonotonicNowMs() noexcept;
+
             core::Result<NmChannelStatus> GetChannelStatus(
                 const std::string &channelName) const;
 
@@ -142,6 +162,8 @@ namespace ara
             std::unordered_map<std::string, ChannelRuntime> mChannels;
             NmStateChangeHandler mStateChangeHandler;
             std::uint64_t mLastTickEpochMs{0U};
+            // Declared last so that it stops before the channels go away
+            std::unique_ptr<core::PeriodicTimer> mTicker;
         };
     }
 }
@@ -131,6 +131,22 @@ namespace ara
             }
         }
 
+        void NmCoordinator::StartTicking(
+            std::chrono::milliseconds period,
+            core::TimerWheel &wheel)
+        {
+            StopTicking();
+            mTicker.reset(new core::PeriodicTimer{
+                wheel, period, [this]()
+                { Tick(NetworkManager::MonotonicNowMs()); }});
+            mTicker->Start();
+        }
+
+        void NmCoordinator::StopTicking() noexcept
+        {
+            mTicker.reset();
+        }
+
         void NmCoordinator::SetSleepReadyCallback(
             std::function<void()> callback)
         {
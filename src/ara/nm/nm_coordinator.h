@@ -5,8 +5,10 @@
 #ifndef NM_COORDINATOR_H
 #define NM_COORDINATOR_H
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include "../core/result.h"
 #include "./network_manager.h"
@@ -52,6 +54,18 @@ namespace ara
             /// @brief Tick the coordinator to evaluate sleep readiness.
             void Tick(std::uint64_t nowEpochMs);
 
+            /// @brief Drive Tick() from a timer wheel instead of polling.
+            /// @param period Tick period.
+            /// @param wheel Wheel to schedule on; must outlive the ticking.
+            /// @note Tick() also ticks the NetworkManager, which therefore
+            ///       must not tick on its own as well.
+            void StartTicking(
+                std::chrono::milliseconds period,
+                core::TimerWheel &wheel = core::TimerWheel::Instance());
+
+            /// @brief Stop the ticking started by StartTicking().
+            void StopTicking() noexcept;
+
             /// @brief Set callback invoked when coordinated sleep is ready.
             void SetSleepReadyCallback(std::function<void()> callback);
 
@@ -62,6 +76,7 @@ namespace ara
             bool mSleepRequested{false};
             bool mSleepReadyNotified{false};
             std::function<void()> mSleepReadyCallback;
+            std::unique_ptr<core::PeriodicTimer> mTicker;
         };
     }
 }
@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <thread>
 #include <vector>
@@ -24,6 +25,10 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include "./ara/com/helper/udp_batch.h"
+#include "./ara/log/sink/log_file_writer.h"
+#include "./ara/log/sink/shm_log_transport.h"
+
 namespace
 {
     std::atomic_bool gRunning{true};
@@ -186,41 +191,26 @@ namespace
         return ::socket(AF_INET, SOCK_DGRAM, 0);
     }
 
-    /// Rotate the DLT log file when it exceeds the given size.
-    void RotateLogFileIfNeeded(
-        const std::string &logFilePath,
-        std::size_t maxBytes,
-        std::size_t maxRotated)
+    /// Parse the log file sync policy: "none", "flush" or "rotate".
+    ara::log::sink::LogFileSyncPolicy GetEnvSyncPolicy(
+        const char *key,
+        ara::log::sink::LogFileSyncPolicy fallback)
     {
-        struct stat st {};
-        if (::stat(logFilePath.c_str(), &st) != 0)
+        const std::string text{GetEnvOrDefault(key, "")};
+        if (text == "none")
         {
-            return;
+            return ara::log::sink::LogFileSyncPolicy::kNone;
         }
-
-        if (static_cast<std::size_t>(st.st_size) < maxBytes)
+        if (text == "flush")
         {
-            return;
+            return ara::log::sink::LogFileSyncPolicy::kOnFlush;
         }
-
-        // Rotate: .dlt.N -> .dlt.N+1, delete oldest.
-        for (std::size_t i = maxRotated; i > 0U; --i)
+        if (text == "rotate")
         {
-            const std::string from{
-                logFilePath + "." + std::to_string(i - 1U)};
-            const std::string to{
-                logFilePath + "." + std::to_string(i)};
-
-            if (i == maxRotated)
-            {
-                ::remove(to.c_str());
-            }
-
-            ::rename(from.c_str(), to.c_str());
+            return ara::log::sink::LogFileSyncPolicy::kOnRotate;
         }
 
-        ::rename(logFilePath.c_str(),
-                 (logFilePath + ".0").c_str());
+        return fallback;
     }
 
     void WriteStatus(
@@ -229,7 +219,8 @@ namespace
         std::size_t bytesReceived,
         std::size_t messagesForwarded,
         std::size_t forwardErrors,
-        std::size_t fileWrites,
+        const ara::log::sink::LogFileWriterStatistics &fileStatistics,
+        const ara::log::sink::ShmLogCollector *collector,
         bool listening)
     {
         std::ofstream stream(statusFile);
@@ -243,7 +234,25 @@ namespace
         stream << "bytes_received=" << bytesReceived << "\n";
         stream << "messages_forwarded=" << messagesForwarded << "\n";
         stream << "forward_errors=" << forwardErrors << "\n";
-        stream << "file_writes=" << fileWrites << "\n";
+        stream << "file_writes=" << fileStatistics.Records << "\n";
+        stream << "file_syscalls=" << fileStatistics.Writes << "\n";
+        stream << "file_syncs=" << fileStatistics.Syncs << "\n";
+        stream << "file_rotations=" << fileStatistics.Rotations << "\n";
+        stream << "file_errors=" << fileStatistics.Errors << "\n";
+        if (collector != nullptr)
+        {
+            stream << "shm_listening=" << (collector->IsListening() ? "true" : "false") << "\n";
+            stream << "shm_apps=" << collector->ClientCount() << "\n";
+            stream << "shm_received=" << collector->TotalReceived() << "\n";
+            stream << "shm_dropped=" << collector->TotalDropped() << "\n";
+            for (const auto &app : collector->GetAppStatistics())
+            {
+                const std::string prefix{
+                    "shm_app." + app.AppId + "." + std::to_string(app.Pid)};
+                stream << prefix << ".received=" << app.Received << "\n";
+                stream << prefix << ".dropped=" << app.Dropped << "\n";
+            }
+        }
         stream << "updated_epoch_ms=" << NowEpochMs() << "\n";
     }
 }
@@ -277,6 +286,20 @@ int main()
             "/run/autosar/dlt_daemon.status")};
     const std::uint32_t statusPeriodMs{
         GetEnvU32("AUTOSAR_DLT_STATUS_PERIOD_MS", 2000U)};
+    const std::uint32_t statusMinIntervalMs{
+        GetEnvU32("AUTOSAR_DLT_STATUS_MIN_INTERVAL_MS", 250U)};
+    const std::uint32_t fileFlushDelayMs{
+        GetEnvU32("AUTOSAR_DLT_FILE_FLUSH_DELAY_MS", 100U)};
+    const ara::log::sink::LogFileSyncPolicy fileSyncPolicy{
+        GetEnvSyncPolicy(
+            "AUTOSAR_DLT_FILE_SYNC",
+            ara::log::sink::LogFileSyncPolicy::kOnRotate)};
+    const bool shmEnabled{
+        GetEnvBool("AUTOSAR_DLT_SHM_ENABLED", true)};
+    const std::string shmSocketPath{
+        GetEnvOrDefault(
+            "AUTOSAR_DLT_SHM_SOCKET",
+            ara::log::sink::ShmLogTransport::cDefaultSocketPath)};
 
     EnsureRunDirectory();
     EnsureDirForFile(logFilePath);
@@ -305,107 +328,157 @@ int main()
     std::size_t bytesReceived{0U};
     std::size_t messagesForwarded{0U};
     std::size_t forwardErrors{0U};
-    std::size_t fileWrites{0U};
     std::uint64_t lastStatusWriteMs{0U};
 
-    std::vector<std::uint8_t> recvBuffer(65536U);
+    // One open descriptor; datagrams are group-committed by the writer
+    // when its blocks fill up or the flush delay expires.
+    ara::log::sink::LogFileWriterOptions fileOptions;
+    fileOptions.MaxDelay = std::chrono::milliseconds{fileFlushDelayMs};
+    fileOptions.MaxFileSize = static_cast<std::size_t>(maxFileSizeKb) * 1024U;
+    fileOptions.MaxRotatedFiles = static_cast<std::size_t>(maxRotated);
+    fileOptions.SyncPolicy = fileSyncPolicy;
+    ara::log::sink::LogFileWriter logFile{logFilePath, fileOptions};
+
+    // Applications on this machine register shared-memory rings here;
+    // all of them are drained from this loop next to the UDP socket.
+    std::unique_ptr<ara::log::sink::ShmLogCollector> collector;
+    if (shmEnabled)
+    {
+        EnsureDirForFile(shmSocketPath);
+        collector.reset(new ara::log::sink::ShmLogCollector{shmSocketPath});
+    }
+
+    // Datagrams are read and forwarded in batches of cBatchSize per
+    // system call; a slot holds the largest possible UDP payload.
+    const std::size_t cBatchSize{32U};
+    const std::size_t cMaxDatagramSize{65536U};
+    std::unique_ptr<ara::com::helper::UdpBatchReceiver> receiver;
+    if (listenFd >= 0)
+    {
+        receiver.reset(new ara::com::helper::UdpBatchReceiver{
+            listenFd, cBatchSize, cMaxDatagramSize});
+    }
+    std::unique_ptr<ara::com::helper::UdpBatchSender> forwarder;
+    if (forwardFd >= 0 && forwardEnabled)
+    {
+        forwarder.reset(new ara::com::helper::UdpBatchSender{
+            forwardFd, forwardAddr, cBatchSize, cMaxDatagramSize});
+    }
+
+    // Every DLT message, from UDP or shared memory, takes the same path.
+    auto handleMessage = [&](const std::uint8_t *data, std::size_t size)
+    {
+        ++messagesReceived;
+        bytesReceived += size;
+
+        // Write raw DLT bytes to log file.
+        logFile.Write(data, size);
+
+        // Forward to remote if configured.
+        if (forwarder)
+        {
+            forwarder->Send(data, size);
+        }
+    };
 
     while (gRunning.load())
     {
         bool activity{false};
 
-        if (listenFd >= 0)
+        if (receiver)
         {
-            for (int batch = 0; batch < 64; ++batch)
+            // Up to two batches per iteration, as many as before.
+            for (int batch = 0; batch < 2; ++batch)
             {
-                const ssize_t received{
-                    ::recvfrom(listenFd, recvBuffer.data(),
-                               recvBuffer.size(), 0,
-                               nullptr, nullptr)};
-                if (received <= 0)
+                const std::size_t count{receiver->Receive()};
+                if (count == 0U)
                 {
                     break;
                 }
 
                 activity = true;
-                ++messagesReceived;
-                bytesReceived += static_cast<std::size_t>(received);
-
-                // Write raw DLT bytes to log file.
-                RotateLogFileIfNeeded(
-                    logFilePath,
-                    static_cast<std::size_t>(maxFileSizeKb) * 1024U,
-                    static_cast<std::size_t>(maxRotated));
-
-                std::ofstream logFile(
-                    logFilePath,
-                    std::ios::binary | std::ios::app);
-                if (logFile.is_open())
+                for (std::size_t i = 0U; i < count; ++i)
                 {
-                    logFile.write(
-                        reinterpret_cast<const char *>(recvBuffer.data()),
-                        received);
-                    ++fileWrites;
-                }
-
-                // Forward to remote if configured.
-                if (forwardFd >= 0 && forwardEnabled)
-                {
-                    const ssize_t sent{
-                        ::sendto(
-                            forwardFd,
-                            recvBuffer.data(),
-                            static_cast<std::size_t>(received),
-                            0,
-                            reinterpret_cast<const struct sockaddr *>(
-                                &forwardAddr),
-                            sizeof(forwardAddr))};
-
-                    if (sent > 0)
-                    {
-                        ++messagesForwarded;
-                    }
-                    else
-                    {
-                        ++forwardErrors;
-                    }
+                    handleMessage(receiver->Data(i), receiver->Size(i));
                 }
             }
         }
 
-        // Periodically write status.
+        if (collector && collector->Poll(handleMessage) > 0U)
+        {
+            activity = true;
+        }
+
+        if (activity && forwarder)
+        {
+            forwarder->Flush();
+            const auto statistics = forwarder->GetStatistics();
+            messagesForwarded = statistics.Datagrams;
+            forwardErrors = statistics.Dropped;
+        }
+
+        // Periodically write status; activity brings the update forward,
+        // but not more often than the minimum interval.
         const std::uint64_t nowMs{NowEpochMs()};
-        if (nowMs - lastStatusWriteMs >= statusPeriodMs || activity)
+        const std::uint64_t sinceStatusMs{nowMs - lastStatusWriteMs};
+        if (sinceStatusMs >= statusPeriodMs ||
+            (activity && sinceStatusMs >= statusMinIntervalMs))
         {
             WriteStatus(statusFile,
                         messagesReceived,
                         bytesReceived,
                         messagesForwarded,
                         forwardErrors,
-                        fileWrites,
+                        logFile.GetStatistics(),
+                        collector.get(),
                         listening);
             lastStatusWriteMs = nowMs;
         }
 
-        // Wait for data on the listen socket instead of busy-waiting.
-        if (!activity && listenFd >= 0)
+        // Wait for data on the listen socket or a ring wake-up instead of
+        // busy-waiting. The rings only send a wake-up once asked to.
+        if (!activity && (!collector || collector->PrepareWait()))
         {
-            struct pollfd pfd;
-            pfd.fd = listenFd;
-            pfd.events = POLLIN;
-            pfd.revents = 0;
-            ::poll(&pfd, 1, 50);
+            struct pollfd pfds[2];
+            nfds_t pfdCount{0U};
+            if (listenFd >= 0)
+            {
+                pfds[pfdCount].fd = listenFd;
+                pfds[pfdCount].events = POLLIN;
+                pfds[pfdCount].revents = 0;
+                ++pfdCount;
+            }
+            if (collector)
+            {
+                pfds[pfdCount].fd = collector->Fd();
+                pfds[pfdCount].events = POLLIN;
+                pfds[pfdCount].revents = 0;
+                ++pfdCount;
+            }
+            if (pfdCount > 0U)
+            {
+                ::poll(pfds, pfdCount, 50);
+            }
         }
     }
 
+    // Take what the applications queued before the stop request.
+    if (collector)
+    {
+        (void)collector->Poll(handleMessage);
+    }
+    logFile.Flush();
     WriteStatus(statusFile,
                 messagesReceived,
                 bytesReceived,
                 messagesForwarded,
                 forwardErrors,
-                fileWrites,
+                logFile.GetStatistics(),
+                collector.get(),
                 listening);
 
+    receiver.reset();
+    forwarder.reset();
     if (listenFd >= 0)
     {
         ::close(listenFd);
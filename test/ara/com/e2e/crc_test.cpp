@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "../../../../src/ara/com/e2e/crc.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace e2e
+        {
+            namespace
+            {
+                const char cCheckInput[]{"123456789"};
+                const std::size_t cCheckLength{9U};
+
+                const std::uint8_t *CheckData()
+                {
+                    return reinterpret_cast<const std::uint8_t *>(cCheckInput);
+                }
+
+                std::vector<std::uint8_t> MakePattern(std::size_t length)
+                {
+                    std::vector<std::uint8_t> _result(length);
+                    std::uint32_t _state{0x12345678U};
+                    for (auto &byte : _result)
+                    {
+                        _state = _state * 1103515245U + 12345U;
+                        byte = static_cast<std::uint8_t>(_state >> 16);
+                    }
+                    return _result;
+                }
+
+                /// @brief Every kernel must agree on every length and alignment.
+                template <typename TCrc, typename T>
+                void ExpectKernelsAgree(T seed)
+                {
+                    const std::vector<std::uint8_t> cData{MakePattern(1100U)};
+                    for (std::size_t _length = 0U; _length < 700U; _length += 7U)
+                    {
+                        for (std::size_t _offset = 0U; _offset < 4U; ++_offset)
+                        {
+                            const std::uint8_t *cBegin{cData.data() + _offset};
+                            const T cExpected{TCrc::UpdateBytewise(seed, cBegin, _length)};
+                            EXPECT_EQ(TCrc::UpdateSlicingBy8(seed, cBegin, _length), cExpected);
+                            EXPECT_EQ(TCrc::Update(seed, cBegin, _length), cExpected);
+                        }
+                    }
+                }
+            }
+
+            TEST(CrcTest, CheckValues)
+            {
+                EXPECT_EQ(
+                    static_cast<std::uint8_t>(~Crc8::Update(0xFFU, CheckData(), cCheckLength)),
+                    0x4BU);
+                EXPECT_EQ(
+                    static_cast<std::uint8_t>(~Crc8H2F::Update(0xFFU, CheckData(), cCheckLength)),
+                    0xDFU);
+                EXPECT_EQ(Crc16::Update(0xFFFFU, CheckData(), cCheckLength), 0x29B1U);
+                EXPECT_EQ(Crc16Arc::Update(0x0000U, CheckData(), cCheckLength), 0xBB3DU);
+                EXPECT_EQ(
+                    Crc32::Update(0xFFFFFFFFU, CheckData(), cCheckLength) ^ 0xFFFFFFFFU,
+                    0xCBF43926U);
+                EXPECT_EQ(
+                    Crc32P4::Update(0xFFFFFFFFU, CheckData(), cCheckLength) ^ 0xFFFFFFFFU,
+                    0x1697D06AU);
+                EXPECT_EQ(
+                    Crc64::Update(0xFFFFFFFFFFFFFFFFULL, CheckData(), cCheckLength) ^
+                        0xFFFFFFFFFFFFFFFFULL,
+                    0x995DC9BBDF1939FAULL);
+            }
+
+            TEST(CrcTest, UpdateIsIncremental)
+            {
+                const std::vector<std::uint8_t> cData{MakePattern(300U)};
+                const std::uint32_t cWhole{Crc32::Update(0xFFFFFFFFU, cData.data(), cData.size())};
+                std::uint32_t _split{Crc32::Update(0xFFFFFFFFU, cData.data(), 5U)};
+                _split = Crc32::Update(_split, cData.data() + 5U, cData.size() - 5U);
+                EXPECT_EQ(_split, cWhole);
+            }
+
+            TEST(CrcTest, KernelsAgree)
+            {
+                ExpectKernelsAgree<Crc8>(static_cast<std::uint8_t>(0xFFU));
+                ExpectKernelsAgree<Crc8H2F>(static_cast<std::uint8_t>(0xFFU));
+                ExpectKernelsAgree<Crc16>(static_cast<std::uint16_t>(0xFFFFU));
+                ExpectKernelsAgree<Crc16Arc>(static_cast<std::uint16_t>(0xFFFFU));
+                ExpectKernelsAgree<Crc32>(0xFFFFFFFFU);
+                ExpectKernelsAgree<Crc32P4>(0xFFFFFFFFU);
+                ExpectKernelsAgree<Crc64>(0x0123456789ABCDEFULL);
+            }
+        }
+    }
+}
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <thread>
 #include <vector>
 #include "../../../../src/ara/com/e2e/e2e_event.h"
+#include "../../../../src/ara/com/e2e/profile04.h"
 #include "../../../../src/ara/com/e2e/profile11.h"
 #include "../../../../src/ara/com/event.h"
 #include "../../../../src/ara/com/serialization.h"
@@ -100,6 +103,163 @@ namespace ara
                 EXPECT_NE(counter1, counter2);
             }
 
+            TEST_F(E2ESkeletonEventTest, ConcurrentSendsKeepFramesIntact)
+            {
+                auto event = CreateE2ESkeletonEvent();
+                event.Offer();
+
+                constexpr std::size_t cSendsPerThread{500U};
+                auto sender = [&event](std::uint32_t value)
+                {
+                    for (std::size_t i = 0U; i < cSendsPerThread; ++i)
+                    {
+                        event.Send(value);
+                    }
+                };
+                std::thread first(sender, 0x11111111U);
+                std::thread second(sender, 0x22222222U);
+                first.join();
+                second.join();
+
+                ASSERT_EQ(mMockBinding->SentPayloads.size(), 2U * cSendsPerThread);
+                for (const auto &frame : mMockBinding->SentPayloads)
+                {
+                    ASSERT_EQ(
+                        frame.size(),
+                        sizeof(std::uint32_t) + cProfile11HeaderSize);
+                    // Every frame carries exactly one sender's value.
+                    const std::uint8_t cFirst{frame[cProfile11HeaderSize]};
+                    EXPECT_TRUE(cFirst == 0x11U || cFirst == 0x22U);
+                    for (std::size_t i = cProfile11HeaderSize; i < frame.size(); ++i)
+                    {
+                        EXPECT_EQ(frame[i], cFirst);
+                    }
+
+                    Profile11 checker;
+                    EXPECT_NE(checker.Check(frame), CheckStatusType::kWrongCrc);
+                }
+            }
+
+            TEST_F(E2ESkeletonEventTest, AllocatedSendWritesHeaderIntoHeadroom)
+            {
+                auto event = CreateE2ESkeletonEvent();
+                event.Offer();
+
+                auto allocated = event.Allocate();
+                ASSERT_TRUE(allocated.HasValue());
+                auto sample = std::move(allocated).Value();
+                *sample = 0x12345678U;
+                event.Send(std::move(sample));
+
+                ASSERT_EQ(mMockBinding->SentPayloads.size(), 1U);
+                const auto &protectedPayload = mMockBinding->SentPayloads[0];
+                ASSERT_EQ(
+                    protectedPayload.size(),
+                    sizeof(std::uint32_t) + cProfile11HeaderSize);
+
+                std::uint32_t payloadValue{0U};
+                std::memcpy(
+                    &payloadValue,
+                    protectedPayload.data() + cProfile11HeaderSize,
+                    sizeof(payloadValue));
+                EXPECT_EQ(payloadValue, 0x12345678U);
+
+                Profile11 checker;
+                EXPECT_EQ(checker.Check(protectedPayload), CheckStatusType::kOk);
+            }
+
+            TEST_F(E2ESkeletonEventTest, UnsentAllocationIsReturnedToInnerBinding)
+            {
+                auto event = CreateE2ESkeletonEvent();
+                event.Offer();
+
+                {
+                    auto sample = event.Allocate();
+                    ASSERT_TRUE(sample.HasValue());
+                    // Dropped unsent: the deleter must free the inner buffer,
+                    // not the offset sample pointer.
+                }
+
+                EXPECT_TRUE(mMockBinding->SentPayloads.empty());
+            }
+
+            TEST_F(E2ESkeletonEventTest, AllocatedSampleIsAlignedBehindOddHeader)
+            {
+                struct Sample
+                {
+                    std::uint64_t Count;
+                    double Value;
+                };
+
+                // Profile04 prepends 6 bytes, which alone would misalign the sample.
+                Profile04 profile;
+                auto mock = std::unique_ptr<test::MockSkeletonEventBinding>(
+                    new test::MockSkeletonEventBinding());
+                test::MockSkeletonEventBinding *binding{mock.get()};
+                SkeletonEvent<Sample> event(
+                    std::unique_ptr<internal::SkeletonEventBinding>(
+                        new E2ESkeletonEventBindingDecorator(std::move(mock), profile)));
+                event.Offer();
+
+                auto allocated = event.Allocate();
+                ASSERT_TRUE(allocated.HasValue());
+                auto sample = std::move(allocated).Value();
+                EXPECT_EQ(
+                    reinterpret_cast<std::uintptr_t>(sample.Get()) % alignof(Sample),
+                    0U);
+                sample->Count = 0x0102030405060708U;
+                sample->Value = 2.5;
+                event.Send(std::move(sample));
+
+                ASSERT_EQ(binding->SentPayloads.size(), 1U);
+                const auto &frame = binding->SentPayloads[0];
+                ASSERT_EQ(frame.size(), profile.HeaderLength() + sizeof(Sample));
+
+                Sample received;
+                std::memcpy(&received, frame.data() + profile.HeaderLength(), sizeof(received));
+                EXPECT_EQ(received.Count, 0x0102030405060708U);
+                EXPECT_EQ(received.Value, 2.5);
+
+                Profile04 checker;
+                EXPECT_EQ(checker.Check(frame), CheckStatusType::kOk);
+            }
+
+            TEST_F(E2ESkeletonEventTest, AllocatedFrameStartsAtInnerBuffer)
+            {
+                // Profile11's 2-byte header keeps a 16-bit sample aligned, so
+                // the frame needs no padding and is published in place.
+                auto mock = std::unique_ptr<test::MockSkeletonEventBinding>(
+                    new test::MockSkeletonEventBinding());
+                test::MockSkeletonEventBinding *binding{mock.get()};
+                SkeletonEvent<std::uint16_t> event(
+                    std::unique_ptr<internal::SkeletonEventBinding>(
+                        new E2ESkeletonEventBindingDecorator(std::move(mock), mProfile)));
+                event.Offer();
+
+                auto allocated = event.Allocate();
+                ASSERT_TRUE(allocated.HasValue());
+                auto sample = std::move(allocated).Value();
+                ASSERT_EQ(binding->Allocations.size(), 1U);
+                EXPECT_EQ(
+                    reinterpret_cast<std::uint8_t *>(sample.Get()),
+                    static_cast<std::uint8_t *>(binding->Allocations[0]) +
+                        cProfile11HeaderSize);
+                *sample = 0x1234U;
+                event.Send(std::move(sample));
+
+                ASSERT_EQ(binding->FrameOffsets.size(), 1U);
+                EXPECT_EQ(binding->FrameOffsets[0], 0U);
+                ASSERT_EQ(binding->AllocatedSends.size(), 1U);
+                EXPECT_EQ(binding->AllocatedSends[0].first, binding->Allocations[0]);
+                EXPECT_EQ(
+                    binding->AllocatedSends[0].second,
+                    cProfile11HeaderSize + sizeof(std::uint16_t));
+
+                Profile11 checker;
+                ASSERT_EQ(binding->SentPayloads.size(), 1U);
+                EXPECT_EQ(checker.Check(binding->SentPayloads[0]), CheckStatusType::kOk);
+            }
+
             class E2EProxyEventTest : public ::testing::Test
             {
             protected:
@@ -155,6 +315,36 @@ namespace ara
                 EXPECT_EQ(receivedValue, expectedValue);
             }
 
+            TEST_F(E2EProxyEventTest, HeaderSizeDefaultsToProfile)
+            {
+                auto mock =
+                    std::unique_ptr<test::MockProxyEventBinding>(
+                        new test::MockProxyEventBinding());
+                auto *mockPtr = mock.get();
+                auto e2eBinding =
+                    std::unique_ptr<E2EProxyEventBindingDecorator>(
+                        new E2EProxyEventBindingDecorator(
+                            std::move(mock), mCheckProfile));
+                auto *e2ePtr = e2eBinding.get();
+
+                ProxyEvent<std::uint32_t> event(std::move(e2eBinding));
+                event.Subscribe(10);
+                mockPtr->InjectSample(MakeProtectedPayload(7U));
+
+                std::uint32_t receivedValue = 0U;
+                event.GetNewSamples(
+                    [&receivedValue](SamplePtr<std::uint32_t> sample)
+                    {
+                        receivedValue = *sample;
+                    });
+
+                EXPECT_EQ(receivedValue, 7U);
+                ASSERT_EQ(e2ePtr->GetLastSampleE2EStatuses().size(), 1U);
+                EXPECT_EQ(
+                    e2ePtr->GetLastSampleE2EStatuses()[0],
+                    E2ESampleStatus::kOk);
+            }
+
             TEST_F(E2EProxyEventTest, GetNewSamplesDropsCorruptedCrc)
             {
                 auto event = CreateE2EProxyEvent();
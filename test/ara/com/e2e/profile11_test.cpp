@@ -169,6 +169,41 @@ namespace ara
                 const CheckStatusType cLastActualResult{_profile.Check(cFirstProtectedData)};
                 EXPECT_EQ(cLastActualResult, cLastExpectedResult);
             }
+
+            TEST(Profile11Test, InPlaceProtectionMatchesCopyingProtection)
+            {
+                Profile11 _copyingProfile;
+                Profile11 _inPlaceProfile;
+
+                const std::vector<uint8_t> cUnprotectedData{0x12, 0x34, 0x56, 0x78};
+                std::vector<uint8_t> _protectedData;
+                ASSERT_TRUE(_copyingProfile.TryProtect(cUnprotectedData, _protectedData));
+
+                // Headroom for the header followed by the payload
+                std::vector<uint8_t> _buffer{0x00, 0x00, 0x12, 0x34, 0x56, 0x78};
+                ASSERT_EQ(_inPlaceProfile.HeaderLength(), 2U);
+                ASSERT_TRUE(_inPlaceProfile.TryProtectInPlace(_buffer.data(), _buffer.size()));
+                EXPECT_EQ(_buffer, _protectedData);
+            }
+
+            TEST(Profile11Test, InPlaceProtectionRequiresPayload)
+            {
+                Profile11 _profile;
+
+                uint8_t _headroomOnly[2]{0x00, 0x00};
+                EXPECT_FALSE(_profile.TryProtectInPlace(_headroomOnly, sizeof(_headroomOnly)));
+                EXPECT_FALSE(_profile.TryProtectInPlace(nullptr, 6));
+            }
+
+            TEST(Profile11Test, CheckOverRawBuffer)
+            {
+                Profile11 _profile;
+
+                const uint8_t cProtectedData[]{0x9f, 0xf1, 0x12, 0x34, 0x56, 0x78};
+
+                EXPECT_EQ(_profile.Check(cProtectedData, sizeof(cProtectedData)), CheckStatusType::kOk);
+                EXPECT_EQ(_profile.Check(cProtectedData, 2), CheckStatusType::kNoNewData);
+            }
         }
     }
 }
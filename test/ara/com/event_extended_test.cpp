@@ -50,6 +50,46 @@ namespace ara
                        SubscriptionState::kSubscribed);
         }
 
+        TEST(ProxyEventExtendedTest, QosProfileForwardedToBinding)
+        {
+            auto binding =
+                std::make_unique<test::MockProxyEventBinding>();
+            auto *raw = binding.get();
+            ProxyEvent<int> event{std::move(binding)};
+
+            auto qos = EventQosProfile::ReliableWithDeadline(
+                std::chrono::milliseconds{100}, 4U);
+            qos.MinSeparation = std::chrono::milliseconds{10};
+            event.Subscribe(10, qos);
+
+            ASSERT_TRUE(raw->HasQos);
+            EXPECT_EQ(raw->InstalledQos.Reliability, ReliabilityKind::kReliable);
+            EXPECT_EQ(raw->InstalledQos.HistoryDepth, 4U);
+            EXPECT_EQ(raw->InstalledQos.Deadline.count(), 100);
+            EXPECT_EQ(raw->InstalledQos.MinSeparation.count(), 10);
+        }
+
+        TEST(ProxyEventExtendedTest, DeadlineMissedHandlerForwarded)
+        {
+            auto binding =
+                std::make_unique<test::MockProxyEventBinding>();
+            auto *raw = binding.get();
+            ProxyEvent<int> event{std::move(binding)};
+
+            std::uint32_t missed{0U};
+            event.SetDeadlineMissedHandler(
+                [&missed](std::uint32_t totalCount)
+                {
+                    missed = totalCount;
+                });
+            ASSERT_TRUE(static_cast<bool>(raw->DeadlineHandler));
+            raw->DeadlineHandler(3U);
+            EXPECT_EQ(missed, 3U);
+
+            event.UnsetDeadlineMissedHandler();
+            EXPECT_FALSE(static_cast<bool>(raw->DeadlineHandler));
+        }
+
         TEST(ProxyEventExtendedTest, SizedReceiveHandler)
         {
             auto binding =
@@ -278,5 +318,91 @@ namespace ara
                 EXPECT_EQ(received[1], 6);
             }
         }
+
+        TEST(ProxyEventExtendedTest, DecimationSkipsDeserialization)
+        {
+            auto binding =
+                std::make_unique<test::MockProxyEventBinding>();
+            auto *raw = binding.get();
+            ProxyEvent<std::uint32_t> event{std::move(binding)};
+
+            event.Subscribe(100, FilterConfig::OneEveryN(2));
+
+            // Rejected samples are too short to deserialize; they must be
+            // dropped by the filter without raising a serialization error.
+            raw->InjectSample(std::vector<std::uint8_t>{0x01});
+            raw->InjectSample(Serializer<std::uint32_t>::Serialize(7U));
+
+            std::vector<std::uint32_t> received;
+            auto result = event.GetNewSamples(
+                [&received](SamplePtr<std::uint32_t> sample)
+                {
+                    received.push_back(*sample);
+                });
+
+            ASSERT_TRUE(result.HasValue());
+            ASSERT_EQ(received.size(), 1U);
+            EXPECT_EQ(received[0], 7U);
+        }
+
+        TEST(ProxyEventExtendedTest, ContentFilterApplied)
+        {
+            struct LidarStatus
+            {
+                std::uint32_t Sequence;
+                float Temperature;
+            };
+
+            auto binding =
+                std::make_unique<test::MockProxyEventBinding>();
+            auto *raw = binding.get();
+            ProxyEvent<LidarStatus> event{std::move(binding)};
+
+            event.Subscribe(
+                100,
+                FilterConfig::Content(
+                    4U, FilterFieldType::kFloat32, 50.0, 80.0));
+
+            raw->InjectSample(Serializer<LidarStatus>::Serialize({1U, 20.0F}));
+            raw->InjectSample(Serializer<LidarStatus>::Serialize({2U, 65.0F}));
+            raw->InjectSample(Serializer<LidarStatus>::Serialize({3U, 90.0F}));
+
+            std::vector<std::uint32_t> received;
+            auto result = event.GetNewSamples(
+                [&received](SamplePtr<LidarStatus> sample)
+                {
+                    received.push_back(sample->Sequence);
+                });
+
+            ASSERT_TRUE(result.HasValue());
+            ASSERT_EQ(received.size(), 1U);
+            EXPECT_EQ(received[0], 2U);
+        }
+
+        TEST(ProxyEventExtendedTest, BindingSideFilterIsNotReapplied)
+        {
+            auto binding =
+                std::make_unique<test::MockProxyEventBinding>();
+            auto *raw = binding.get();
+            raw->AcceptsSampleFilter = true;
+            ProxyEvent<int> event{std::move(binding)};
+
+            event.Subscribe(100, FilterConfig::OneEveryN(3));
+            EXPECT_EQ(raw->InstalledFilter.Type, FilterType::kOneEveryN);
+            EXPECT_EQ(raw->InstalledFilter.DecimationFactor, 3U);
+
+            raw->InjectSample(Serializer<int>::Serialize(1));
+            raw->InjectSample(Serializer<int>::Serialize(2));
+
+            std::size_t received{0U};
+            auto result = event.GetNewSamples(
+                [&received](SamplePtr<int>)
+                {
+                    ++received;
+                });
+
+            ASSERT_TRUE(result.HasValue());
+            EXPECT_EQ(received, 2U);
+        }
     }
 }
@@ -4,10 +4,35 @@
 #include "../../../src/ara/com/serialization.h"
 #include "./mock_event_binding.h"
 
+namespace
+{
+    /// @brief Trivially copyable type whose serializer rejects every payload.
+    struct RejectedSample
+    {
+        std::uint32_t Value;
+    };
+}
+
 namespace ara
 {
     namespace com
     {
+        template <>
+        struct Serializer<RejectedSample, void>
+        {
+            static std::vector<std::uint8_t> Serialize(const RejectedSample &)
+            {
+                return std::vector<std::uint8_t>(sizeof(RejectedSample), 0U);
+            }
+
+            static core::Result<RejectedSample> Deserialize(
+                const std::uint8_t *, std::size_t)
+            {
+                return core::Result<RejectedSample>::FromError(
+                    MakeErrorCode(ComErrc::kFieldValueIsNotValid));
+            }
+        };
+
         // ── ProxyEvent Tests ──────────────────────────────
 
         TEST(ProxyEventTest, SubscribeAndUnsubscribe)
@@ -151,6 +176,95 @@ namespace ara
             EXPECT_DOUBLE_EQ(received.Value, 3.14);
         }
 
+        TEST(ProxyEventTest, LoanedSampleIsNotCopied)
+        {
+            auto binding = std::make_unique<test::MockLoaningProxyEventBinding>();
+            auto *rawBinding = binding.get();
+            ProxyEvent<TestStruct> event{std::move(binding)};
+
+            event.Subscribe(5);
+            rawBinding->InjectChunk(
+                Serializer<TestStruct>::Serialize(TestStruct{7U, 1.5}));
+
+            SamplePtr<TestStruct> held;
+            auto result = event.GetNewSamples(
+                [&held](SamplePtr<TestStruct> sample)
+                {
+                    held = std::move(sample);
+                });
+
+            ASSERT_TRUE(result.HasValue());
+            EXPECT_EQ(result.Value(), 1U);
+            ASSERT_NE(held, nullptr);
+            EXPECT_EQ(static_cast<const void *>(held.Get()),
+                      static_cast<const void *>(rawBinding->ChunkData(0U)));
+            EXPECT_EQ(held->Id, 7U);
+            EXPECT_EQ(rawBinding->OutstandingLoans, 1);
+
+            held.Reset();
+            EXPECT_EQ(rawBinding->OutstandingLoans, 0);
+        }
+
+        TEST(ProxyEventTest, ShortLoanedSampleIsReturned)
+        {
+            auto binding = std::make_unique<test::MockLoaningProxyEventBinding>();
+            auto *rawBinding = binding.get();
+            ProxyEvent<std::uint64_t> event{std::move(binding)};
+
+            event.Subscribe(5);
+            rawBinding->InjectChunk(std::vector<std::uint8_t>{0x01, 0x02});
+
+            auto result = event.GetNewSamples([](SamplePtr<std::uint64_t>) {});
+
+            EXPECT_FALSE(result.HasValue());
+            EXPECT_EQ(rawBinding->OutstandingLoans, 0);
+        }
+
+        TEST(ProxyEventTest, MisalignedLoanedSampleIsCopied)
+        {
+            auto binding = std::make_unique<test::MockLoaningProxyEventBinding>();
+            auto *rawBinding = binding.get();
+            ProxyEvent<std::uint64_t> event{std::move(binding)};
+
+            event.Subscribe(5);
+            rawBinding->InjectChunkAt(
+                Serializer<std::uint64_t>::Serialize(0x0102030405060708U), 1U);
+
+            std::uint64_t received{0U};
+            auto result = event.GetNewSamples(
+                [&received](SamplePtr<std::uint64_t> sample)
+                {
+                    received = *sample;
+                });
+
+            ASSERT_TRUE(result.HasValue());
+            EXPECT_EQ(received, 0x0102030405060708U);
+            EXPECT_EQ(rawBinding->OutstandingLoans, 0);
+        }
+
+        TEST(ProxyEventTest, MisalignedLoanedSampleReportsDeserializationError)
+        {
+            auto binding = std::make_unique<test::MockLoaningProxyEventBinding>();
+            auto *rawBinding = binding.get();
+            ProxyEvent<RejectedSample> event{std::move(binding)};
+
+            event.Subscribe(5);
+            rawBinding->InjectChunkAt(
+                Serializer<RejectedSample>::Serialize(RejectedSample{1U}), 1U);
+
+            bool delivered{false};
+            auto result = event.GetNewSamples(
+                [&delivered](SamplePtr<RejectedSample>)
+                {
+                    delivered = true;
+                });
+
+            ASSERT_FALSE(result.HasValue());
+            EXPECT_EQ(result.Error(), MakeErrorCode(ComErrc::kSerializationError));
+            EXPECT_FALSE(delivered);
+            EXPECT_EQ(rawBinding->OutstandingLoans, 0);
+        }
+
         TEST(ProxyEventTest, GetFreeSampleCount)
         {
             auto binding = std::make_unique<test::MockProxyEventBinding>();
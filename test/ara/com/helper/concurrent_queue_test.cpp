@@ -1,4 +1,11 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <poll.h>
+#include <unistd.h>
+#endif
 #include "../../../../src/ara/com/helper/concurrent_queue.h"
 
 namespace ara
@@ -28,6 +35,240 @@ namespace ara
 
                 EXPECT_EQ(_expectedResult, _actualResult);
             }
+
+            TEST(ConcurrentQueueTest, BoundedCapacity)
+            {
+                ConcurrentQueue<int> _queue(3);
+                EXPECT_EQ(4U, _queue.Capacity());
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    EXPECT_TRUE(_queue.TryEnqueue(i));
+                }
+                EXPECT_FALSE(_queue.TryEnqueue(4));
+
+                int _element{-1};
+                EXPECT_TRUE(_queue.TryDequeue(_element));
+                EXPECT_EQ(0, _element);
+                EXPECT_TRUE(_queue.TryEnqueue(4));
+
+                for (int i = 1; i <= 4; ++i)
+                {
+                    EXPECT_TRUE(_queue.TryDequeue(_element));
+                    EXPECT_EQ(i, _element);
+                }
+                EXPECT_FALSE(_queue.TryDequeue(_element));
+            }
+
+            TEST(ConcurrentQueueTest, NoSpuriousDropsUnderContention)
+            {
+                const int cProducers{4};
+                const int cPerProducer{20000};
+                ConcurrentQueue<int> _queue(cProducers * cPerProducer);
+                std::atomic_int _failedEnqueues{0};
+                std::atomic_int _dequeued{0};
+                std::vector<std::atomic_bool> _seen(cProducers * cPerProducer);
+                for (auto &_flag : _seen)
+                {
+                    _flag = false;
+                }
+
+                std::vector<std::thread> _threads;
+                for (int p = 0; p < cProducers; ++p)
+                {
+                    _threads.emplace_back(
+                        [&, p]
+                        {
+                            for (int i = 0; i < cPerProducer; ++i)
+                            {
+                                // The ring never fills, so a failure would be spurious.
+                                if (!_queue.TryEnqueue(p * cPerProducer + i))
+                                {
+                                    ++_failedEnqueues;
+                                }
+                            }
+                        });
+                }
+                for (int c = 0; c < 4; ++c)
+                {
+                    _threads.emplace_back(
+                        [&]
+                        {
+                            int _element;
+                            while (_dequeued < cProducers * cPerProducer)
+                            {
+                                if (_queue.TryDequeue(_element))
+                                {
+                                    EXPECT_FALSE(_seen[_element].exchange(true));
+                                    ++_dequeued;
+                                }
+                                else if (_failedEnqueues > 0)
+                                {
+                                    break;
+                                }
+                            }
+                        });
+                }
+                for (auto &_thread : _threads)
+                {
+                    _thread.join();
+                }
+
+                EXPECT_EQ(0, _failedEnqueues.load());
+                EXPECT_EQ(cProducers * cPerProducer, _dequeued.load());
+                EXPECT_TRUE(_queue.Empty());
+            }
+
+            TEST(ConcurrentQueueTest, BlockingScenario)
+            {
+                const int cProducers{3};
+                const int cPerProducer{10000};
+                ConcurrentQueue<int> _queue(16);
+                std::vector<long long> _sums(cProducers, 0);
+
+                std::vector<std::thread> _threads;
+                for (int p = 0; p < cProducers; ++p)
+                {
+                    _threads.emplace_back(
+                        [&_queue, cPerProducer]
+                        {
+                            for (int i = 1; i <= cPerProducer; ++i)
+                            {
+                                EXPECT_TRUE(_queue.Enqueue(i));
+                            }
+                        });
+                }
+                for (int c = 0; c < cProducers; ++c)
+                {
+                    _threads.emplace_back(
+                        [&_queue, &_sums, c, cPerProducer]
+                        {
+                            int _element;
+                            for (int i = 0; i < cPerProducer; ++i)
+                            {
+                                EXPECT_TRUE(_queue.Dequeue(_element));
+                                _sums[c] += _element;
+                            }
+                        });
+                }
+                for (auto &_thread : _threads)
+                {
+                    _thread.join();
+                }
+
+                long long _total{0};
+                for (auto _sum : _sums)
+                {
+                    _total += _sum;
+                }
+                const long long cExpected{
+                    cProducers * static_cast<long long>(cPerProducer) * (cPerProducer + 1) / 2};
+                EXPECT_EQ(cExpected, _total);
+                EXPECT_TRUE(_queue.Empty());
+            }
+
+            TEST(ConcurrentQueueTest, TimedScenario)
+            {
+                const std::chrono::milliseconds cTimeout{20};
+                ConcurrentQueue<int> _queue(2);
+
+                int _element;
+                auto _start{std::chrono::steady_clock::now()};
+                EXPECT_FALSE(_queue.WaitDequeue(_element, cTimeout));
+                EXPECT_GE(std::chrono::steady_clock::now() - _start, cTimeout);
+
+                EXPECT_TRUE(_queue.WaitEnqueue(1, cTimeout));
+                EXPECT_TRUE(_queue.WaitEnqueue(2, cTimeout));
+                _start = std::chrono::steady_clock::now();
+                EXPECT_FALSE(_queue.WaitEnqueue(3, cTimeout));
+                EXPECT_GE(std::chrono::steady_clock::now() - _start, cTimeout);
+
+                std::thread _consumer(
+                    [&_queue]
+                    {
+                        int _consumed;
+                        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                        _queue.TryDequeue(_consumed);
+                    });
+                EXPECT_TRUE(_queue.WaitEnqueue(3, std::chrono::seconds(5)));
+                _consumer.join();
+            }
+
+            TEST(ConcurrentQueueTest, BurstWakesEveryParkedConsumer)
+            {
+                ConcurrentQueue<int> _queue;
+                std::atomic_int _dequeued{0};
+                std::vector<std::thread> _consumers;
+                for (int c = 0; c < 2; ++c)
+                {
+                    _consumers.emplace_back(
+                        [&_queue, &_dequeued]
+                        {
+                            int _element;
+                            if (_queue.WaitDequeue(_element, std::chrono::seconds(5)))
+                            {
+                                ++_dequeued;
+                            }
+                        });
+                }
+
+                // Only the first element of the burst finds the queue empty.
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                EXPECT_TRUE(_queue.TryEnqueue(1));
+                EXPECT_TRUE(_queue.TryEnqueue(2));
+
+                const auto cStart{std::chrono::steady_clock::now()};
+                for (auto &_consumer : _consumers)
+                {
+                    _consumer.join();
+                }
+                EXPECT_EQ(2, _dequeued.load());
+                EXPECT_LT(
+                    std::chrono::steady_clock::now() - cStart,
+                    std::chrono::seconds(1));
+            }
+
+            TEST(ConcurrentQueueTest, CloseReleasesWaiters)
+            {
+                ConcurrentQueue<int> _queue;
+                std::thread _consumer(
+                    [&_queue]
+                    {
+                        int _element;
+                        EXPECT_FALSE(_queue.Dequeue(_element));
+                    });
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                _queue.Close();
+                _consumer.join();
+
+                EXPECT_TRUE(_queue.IsClosed());
+                EXPECT_FALSE(_queue.Enqueue(1));
+            }
+
+#if defined(__linux__)
+            TEST(ConcurrentQueueTest, WakeupDescriptor)
+            {
+                ConcurrentQueue<int> _queue;
+                const int cDescriptor{_queue.WakeupDescriptor()};
+                ASSERT_GE(cDescriptor, 0);
+
+                pollfd _pollFd{cDescriptor, POLLIN, 0};
+                EXPECT_EQ(0, ::poll(&_pollFd, 1, 0));
+
+                std::thread _producer([&_queue] { _queue.TryEnqueue(7); });
+                EXPECT_EQ(1, ::poll(&_pollFd, 1, 5000));
+                _producer.join();
+
+                std::uint64_t _counter;
+                EXPECT_EQ(
+                    static_cast<ssize_t>(sizeof(_counter)),
+                    ::read(cDescriptor, &_counter, sizeof(_counter)));
+                int _element;
+                EXPECT_TRUE(_queue.TryDequeue(_element));
+                EXPECT_EQ(7, _element);
+            }
+#endif
         }
     }
-}
\ No newline at end of file
+}
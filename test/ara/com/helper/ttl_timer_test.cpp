@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include "../../../../src/ara/com/helper/ttl_timer.h"
 
 namespace ara
@@ -35,6 +39,61 @@ namespace ara
                 
                 EXPECT_TRUE(_timer.GetOffered());
             }
+
+            TEST(TtlTimerTest, ExpiresOnTimerWheel)
+            {
+                core::TimerWheel _wheel{std::chrono::milliseconds{10}, 64U};
+                TtlTimer _timer{_wheel};
+                std::mutex _mutex;
+                std::condition_variable _conditionVariable;
+                int _notifications{0};
+                _timer.Subscribe(
+                    [&]()
+                    {
+                        std::lock_guard<std::mutex> _lock(_mutex);
+                        ++_notifications;
+                        _conditionVariable.notify_one();
+                    });
+
+                _timer.SetOffered(1);
+                // A re-offer resets the countdown instead of expiring it.
+                std::this_thread::sleep_for(std::chrono::milliseconds{50});
+                _timer.SetOffered(1);
+                const auto _start = std::chrono::steady_clock::now();
+
+                std::unique_lock<std::mutex> _lock(_mutex);
+                EXPECT_EQ(_notifications, 2);
+                EXPECT_TRUE(_conditionVariable.wait_for(
+                    _lock, std::chrono::seconds{3}, [&_notifications]()
+                    { return _notifications == 3; }));
+                EXPECT_GE(std::chrono::steady_clock::now() - _start, std::chrono::milliseconds{900});
+                EXPECT_FALSE(_timer.GetOffered());
+                EXPECT_EQ(_wheel.PendingCount(), 0U);
+            }
+
+            TEST(TtlTimerTest, UnsubscribeAndDispose)
+            {
+                TtlTimer _timer;
+                int _notifications{0};
+                const TtlTimer::ListenerId cId{
+                    _timer.Subscribe([&_notifications]()
+                                     { ++_notifications; })};
+                EXPECT_NE(cId, 0U);
+
+                _timer.SetRequested(true);
+                EXPECT_EQ(_notifications, 1);
+
+                _timer.Unsubscribe(cId);
+                _timer.SetRequested(false);
+                EXPECT_EQ(_notifications, 1);
+
+                _timer.Subscribe([&_notifications]()
+                                 { ++_notifications; });
+                _timer.Dispose();
+                _timer.SetRequested(true);
+                EXPECT_EQ(_notifications, 1);
+                EXPECT_EQ(_timer.Subscribe([]() {}), 0U);
+            }
         }
     }
 }
\ No newline at end of file
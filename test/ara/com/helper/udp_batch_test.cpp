@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include "../../../../src/ara/com/helper/udp_batch.h"
+#include "../../../../src/ara/core/executor.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace helper
+        {
+            namespace
+            {
+                // Bound loopback socket on an ephemeral port.
+                int OpenLoopbackSocket(sockaddr_in &address)
+                {
+                    const int _socket{::socket(AF_INET, SOCK_DGRAM, 0)};
+                    address = sockaddr_in{};
+                    address.sin_family = AF_INET;
+                    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+                    socklen_t _size{sizeof(address)};
+                    ::bind(_socket, reinterpret_cast<sockaddr *>(&address), _size);
+                    ::getsockname(_socket, reinterpret_cast<sockaddr *>(&address), &_size);
+                    return _socket;
+                }
+
+                std::size_t ReceiveAll(UdpBatchReceiver &receiver, std::size_t expected)
+                {
+                    std::size_t _received{0U};
+                    const auto _timeout =
+                        std::chrono::steady_clock::now() + std::chrono::seconds{2};
+                    while (_received < expected &&
+                           std::chrono::steady_clock::now() < _timeout)
+                    {
+                        const std::size_t _count{receiver.Receive()};
+                        for (std::size_t i = 0U; i < _count; ++i)
+                        {
+                            EXPECT_EQ(receiver.Size(i), 1U + (_received + i) % 7U);
+                            EXPECT_EQ(receiver.Data(i)[0], static_cast<uint8_t>(_received + i));
+                        }
+                        _received += _count;
+                        if (_count == 0U)
+                        {
+                            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                        }
+                    }
+                    return _received;
+                }
+            }
+
+            TEST(UdpBatchTest, FlushesOnCountAndOnDemand)
+            {
+                sockaddr_in _address;
+                const int _receiving{OpenLoopbackSocket(_address)};
+                const int _sending{::socket(AF_INET, SOCK_DGRAM, 0)};
+                {
+                    UdpBatchSender _sender{_sending, _address, 4U};
+                    UdpBatchReceiver _receiver{_receiving, 8U};
+
+                    for (std::size_t i = 0U; i < 10U; ++i)
+                    {
+                        std::vector<uint8_t> _datagram(1U + i % 7U, static_cast<uint8_t>(i));
+                        _sender.Send(_datagram.data(), _datagram.size());
+                    }
+                    // Two full batches went out, two datagrams are staged.
+                    EXPECT_EQ(_sender.PendingCount(), 2U);
+                    _sender.Flush();
+                    EXPECT_EQ(_sender.PendingCount(), 0U);
+
+                    EXPECT_EQ(ReceiveAll(_receiver, 10U), 10U);
+                    const UdpBatchStatistics _statistics{_sender.GetStatistics()};
+                    EXPECT_EQ(_statistics.Datagrams, 10U);
+                    EXPECT_EQ(_statistics.Dropped, 0U);
+                    EXPECT_LE(_statistics.Syscalls, 3U);
+                    EXPECT_EQ(_receiver.Source(0).sin_addr.s_addr, htonl(INADDR_LOOPBACK));
+                }
+                ::close(_sending);
+                ::close(_receiving);
+            }
+
+            TEST(UdpBatchTest, FlushesOnDeadline)
+            {
+                sockaddr_in _address;
+                const int _receiving{OpenLoopbackSocket(_address)};
+                const int _sending{::socket(AF_INET, SOCK_DGRAM, 0)};
+                {
+                    UdpBatchSender _sender{
+                        _sending, _address, 16U,
+                        UdpBatchSender::cDefaultSlotSize,
+                        std::chrono::milliseconds{10}};
+                    UdpBatchReceiver _receiver{_receiving};
+
+                    const uint8_t cDatagram{0U};
+                    _sender.Send(&cDatagram, 1U);
+                    EXPECT_EQ(ReceiveAll(_receiver, 1U), 1U);
+                    EXPECT_EQ(_sender.PendingCount(), 0U);
+                }
+                ::close(_sending);
+                ::close(_receiving);
+            }
+
+            TEST(UdpBatchTest, IgnoresStaleDeadlineFlush)
+            {
+                sockaddr_in _address;
+                const int _receiving{OpenLoopbackSocket(_address)};
+                const int _sending{::socket(AF_INET, SOCK_DGRAM, 0)};
+                const std::chrono::milliseconds cMaxDelay{200};
+                {
+                    UdpBatchSender _sender{
+                        _sending, _address, 16U,
+                        UdpBatchSender::cDefaultSlotSize,
+                        cMaxDelay};
+
+                    // Occupy every worker of the executor that runs the timer
+                    // wheel callbacks, so an expired deadline stays queued.
+                    auto &_executor = dynamic_cast<core::ThreadPoolExecutor &>(
+                        core::GetDefaultExecutor());
+                    std::mutex _mutex;
+                    std::condition_variable _condition;
+                    std::size_t _blocked{0U};
+                    bool _released{false};
+                    for (std::size_t i = 0U; i < _executor.WorkerCount(); ++i)
+                    {
+                        _executor.Execute(
+                            [&]
+                            {
+                                std::unique_lock<std::mutex> _lock(_mutex);
+                                ++_blocked;
+                                _condition.notify_all();
+                                _condition.wait(_lock, [&] { return _released; });
+                            });
+                    }
+                    {
+                        std::unique_lock<std::mutex> _lock(_mutex);
+                        _condition.wait(
+                            _lock, [&] { return _blocked == _executor.WorkerCount(); });
+                    }
+
+                    const uint8_t cFirst{0U};
+                    _sender.Send(&cFirst, 1U);
+                    std::this_thread::sleep_for(cMaxDelay + std::chrono::milliseconds{50});
+                    // The first deadline already fired; its flush is queued.
+                    _sender.Flush();
+                    const uint8_t cSecond{1U};
+                    _sender.Send(&cSecond, 1U);
+
+                    {
+                        std::lock_guard<std::mutex> _lock(_mutex);
+                        _released = true;
+                    }
+                    _condition.notify_all();
+                    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+
+                    // The stale flush left the new batch to its own deadline.
+                    EXPECT_EQ(_sender.PendingCount(), 1U);
+                    std::this_thread::sleep_for(cMaxDelay + std::chrono::milliseconds{50});
+                    EXPECT_EQ(_sender.PendingCount(), 0U);
+                    EXPECT_EQ(_sender.GetStatistics().Datagrams, 2U);
+                }
+                ::close(_sending);
+                ::close(_receiving);
+            }
+
+            TEST(UdpBatchTest, OversizedDatagramKeepsOrder)
+            {
+                sockaddr_in _address;
+                const int _receiving{OpenLoopbackSocket(_address)};
+                const int _sending{::socket(AF_INET, SOCK_DGRAM, 0)};
+                {
+                    UdpBatchSender _sender{_sending, _address, 8U, 4U};
+                    UdpBatchReceiver _receiver{_receiving, 8U, 64U};
+
+                    const std::vector<uint8_t> cSmall(1U, 0U);
+                    _sender.Send(cSmall.data(), cSmall.size());
+                    // Larger than a slot: the staged datagram is sent first.
+                    std::vector<uint8_t> _oversized(32U, 1U);
+                    _sender.Send(_oversized.data(), _oversized.size());
+                    EXPECT_EQ(_sender.PendingCount(), 0U);
+
+                    std::size_t _received{0U};
+                    const auto _timeout =
+                        std::chrono::steady_clock::now() + std::chrono::seconds{2};
+                    std::vector<std::size_t> _sizes;
+                    while (_sizes.size() < 2U && std::chrono::steady_clock::now() < _timeout)
+                    {
+                        _received = _receiver.Receive();
+                        for (std::size_t i = 0U; i < _received; ++i)
+                        {
+                            _sizes.push_back(_receiver.Size(i));
+                        }
+                    }
+                    EXPECT_EQ(_sizes, (std::vector<std::size_t>{1U, 32U}));
+                }
+                ::close(_sending);
+                ::close(_receiving);
+            }
+
+            TEST(UdpBatchTest, DropsTruncatedDatagrams)
+            {
+                sockaddr_in _address;
+                const int _receiving{OpenLoopbackSocket(_address)};
+                const int _sending{::socket(AF_INET, SOCK_DGRAM, 0)};
+                {
+                    UdpBatchSender _sender{_sending, _address, 8U};
+                    UdpBatchReceiver _receiver{_receiving, 8U, 8U};
+
+                    const std::vector<uint8_t> cFirst(3U, 1U);
+                    const std::vector<uint8_t> cOversized(20U, 2U);
+                    const std::vector<uint8_t> cLast(8U, 3U);
+                    _sender.Send(cFirst.data(), cFirst.size());
+                    _sender.Send(cOversized.data(), cOversized.size());
+                    _sender.Send(cLast.data(), cLast.size());
+                    _sender.Flush();
+
+                    std::vector<std::size_t> _sizes;
+                    std::vector<uint8_t> _contents;
+                    const auto _timeout =
+                        std::chrono::steady_clock::now() + std::chrono::seconds{2};
+                    while (_sizes.size() + _receiver.GetStatistics().Truncated < 3U &&
+                           std::chrono::steady_clock::now() < _timeout)
+                    {
+                        const std::size_t _count{_receiver.Receive()};
+                        for (std::size_t i = 0U; i < _count; ++i)
+                        {
+                            _sizes.push_back(_receiver.Size(i));
+                            _contents.push_back(_receiver.Data(i)[0]);
+                        }
+                    }
+                    EXPECT_EQ(_sizes, (std::vector<std::size_t>{3U, 8U}));
+                    EXPECT_EQ(_contents, (std::vector<uint8_t>{1U, 3U}));
+                    EXPECT_EQ(_receiver.GetStatistics().Truncated, 1U);
+                    EXPECT_EQ(_receiver.GetStatistics().Datagrams, 2U);
+                }
+                ::close(_sending);
+                ::close(_receiving);
+            }
+        }
+    }
+}
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include "../../../../src/ara/com/internal/binding_reactor.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            namespace
+            {
+                bool WaitFor(const std::function<bool()> &condition)
+                {
+                    const auto timeout =
+                        std::chrono::steady_clock::now() + std::chrono::seconds{2};
+                    while (!condition())
+                    {
+                        if (std::chrono::steady_clock::now() >= timeout)
+                        {
+                            return false;
+                        }
+                        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                    }
+                    return true;
+                }
+            }
+
+            TEST(BindingReactorTest, WorkerCountIsAtLeastOne)
+            {
+                BindingReactor reactor{0U};
+                EXPECT_EQ(reactor.WorkerCount(), 1U);
+
+                BindingReactor pool{3U};
+                EXPECT_EQ(pool.WorkerCount(), 3U);
+            }
+
+            TEST(BindingReactorTest, PostRunsTaskOnWorker)
+            {
+                BindingReactor reactor;
+                std::atomic<bool> ran{false};
+                std::thread::id runner;
+                reactor.Post(
+                    [&]
+                    {
+                        runner = std::this_thread::get_id();
+                        ran.store(true);
+                    });
+
+                ASSERT_TRUE(WaitFor([&] { return ran.load(); }));
+                EXPECT_NE(runner, std::this_thread::get_id());
+            }
+
+            TEST(BindingReactorTest, NotificationsCoalesceWhileQueued)
+            {
+                BindingReactor reactor;
+                std::mutex gateMutex;
+                std::condition_variable gate;
+                bool open{false};
+
+                // Occupy the single worker so the notifications below queue up.
+                reactor.Post(
+                    [&]
+                    {
+                        std::unique_lock<std::mutex> lock(gateMutex);
+                        gate.wait(lock, [&] { return open; });
+                    });
+
+                std::atomic<int> runs{0};
+                auto source = reactor.Register([&] { runs.fetch_add(1); });
+                for (int i = 0; i < 10; ++i)
+                {
+                    source->Notify();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(gateMutex);
+                    open = true;
+                }
+                gate.notify_all();
+
+                ASSERT_TRUE(WaitFor([&] { return runs.load() == 1; }));
+                std::this_thread::sleep_for(std::chrono::milliseconds{20});
+                EXPECT_EQ(runs.load(), 1);
+                source->Close();
+            }
+
+            TEST(BindingReactorTest, NotifyDuringRunSchedulesAnotherRun)
+            {
+                BindingReactor reactor{4U};
+                std::atomic<int> runs{0};
+                std::atomic<int> concurrent{0};
+                std::atomic<bool> overlapped{false};
+                std::shared_ptr<BindingReactor::Source> source;
+                source = reactor.Register(
+                    [&]
+                    {
+                        if (concurrent.fetch_add(1) != 0)
+                        {
+                            overlapped.store(true);
+                        }
+                        if (runs.fetch_add(1) == 0)
+                        {
+                            // Arrives while running: must not be lost and
+                            // must not run in parallel on another worker.
+                            source->Notify();
+                            std::this_thread::sleep_for(
+                                std::chrono::milliseconds{10});
+                        }
+                        concurrent.fetch_sub(1);
+                    });
+
+                source->Notify();
+                ASSERT_TRUE(WaitFor([&] { return runs.load() == 2; }));
+                EXPECT_FALSE(overlapped.load());
+                source->Close();
+            }
+
+            TEST(BindingReactorTest, CloseWaitsForRunningHandler)
+            {
+                BindingReactor reactor;
+                std::atomic<bool> started{false};
+                std::atomic<bool> finished{false};
+                auto source = reactor.Register(
+                    [&]
+                    {
+                        started.store(true);
+                        std::this_thread::sleep_for(std::chrono::milliseconds{30});
+                        finished.store(true);
+                    });
+
+                source->Notify();
+                ASSERT_TRUE(WaitFor([&] { return started.load(); }));
+                source->Close();
+                EXPECT_TRUE(finished.load());
+            }
+
+            TEST(BindingReactorTest, ThrowingHandlerDoesNotBlockClose)
+            {
+                BindingReactor reactor;
+                std::atomic<int> runs{0};
+                auto source = reactor.Register(
+                    [&]
+                    {
+                        runs.fetch_add(1);
+                        throw std::runtime_error{"handler failure"};
+                    });
+
+                source->Notify();
+                ASSERT_TRUE(WaitFor([&] { return runs.load() == 1; }));
+
+                // The source is idle again and keeps being dispatched.
+                source->Notify();
+                ASSERT_TRUE(WaitFor([&] { return runs.load() == 2; }));
+                source->Close();
+            }
+
+            TEST(BindingReactorTest, ClosedSourceIsNotDispatched)
+            {
+                BindingReactor reactor;
+                std::atomic<int> runs{0};
+                auto source = reactor.Register([&] { runs.fetch_add(1); });
+                source->Close();
+                source->Notify();
+
+                std::atomic<bool> drained{false};
+                reactor.Post([&] { drained.store(true); });
+                ASSERT_TRUE(WaitFor([&] { return drained.load(); }));
+                EXPECT_EQ(runs.load(), 0);
+            }
+
+            TEST(BindingReactorTest, InstanceIsShared)
+            {
+                EXPECT_EQ(&BindingReactor::Instance(), &BindingReactor::Instance());
+                EXPECT_GE(BindingReactor::Instance().WorkerCount(), 1U);
+            }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../../../../src/ara/com/internal/event_qos_monitor.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            TEST(EventQosMonitorTest, DefaultAcceptsEverySample)
+            {
+                EventQosMonitor monitor;
+                monitor.Start();
+                const auto now = EventQosMonitor::Clock::now();
+                EXPECT_TRUE(monitor.OnSample(now));
+                EXPECT_TRUE(monitor.OnSample(now));
+                monitor.Stop();
+                EXPECT_EQ(monitor.GetDeadlineMissedCount(), 0U);
+            }
+
+            TEST(EventQosMonitorTest, MinSeparationDropsBurst)
+            {
+                EventQosProfile qos;
+                qos.MinSeparation = std::chrono::milliseconds{10};
+                EventQosMonitor monitor;
+                monitor.Configure(qos);
+                monitor.Start();
+
+                const auto start = EventQosMonitor::Clock::now();
+                EXPECT_TRUE(monitor.OnSample(start));
+                EXPECT_FALSE(monitor.OnSample(start + std::chrono::milliseconds{3}));
+                EXPECT_FALSE(monitor.OnSample(start + std::chrono::milliseconds{9}));
+                EXPECT_TRUE(monitor.OnSample(start + std::chrono::milliseconds{10}));
+                EXPECT_FALSE(monitor.OnSample(start + std::chrono::milliseconds{15}));
+                EXPECT_TRUE(monitor.OnSample(start + std::chrono::milliseconds{25}));
+            }
+
+            TEST(EventQosMonitorTest, QueueCapacityFollowsHistory)
+            {
+                EventQosProfile keepLast = EventQosProfile::Reliable(4U);
+                EXPECT_EQ(EventQosMonitor::QueueCapacity(10U, keepLast), 4U);
+                EXPECT_EQ(EventQosMonitor::QueueCapacity(2U, keepLast), 2U);
+
+                EventQosProfile keepAll;
+                keepAll.History = HistoryKind::kKeepAll;
+                EXPECT_EQ(EventQosMonitor::QueueCapacity(10U, keepAll), 10U);
+                EXPECT_EQ(EventQosMonitor::QueueCapacity(0U, keepAll), 1U);
+            }
+
+            TEST(EventQosMonitorTest, DeadlineMissReported)
+            {
+                EventQosProfile qos;
+                qos.Deadline = std::chrono::milliseconds{20};
+                EventQosMonitor monitor;
+                monitor.Configure(qos);
+
+                std::atomic<std::uint32_t> lastCount{0U};
+                monitor.SetDeadlineMissedHandler(
+                    [&lastCount](std::uint32_t totalCount)
+                    {
+                        lastCount.store(totalCount);
+                    });
+                monitor.Start();
+
+                const auto timeout =
+                    std::chrono::steady_clock::now() + std::chrono::seconds{2};
+                while (lastCount.load() < 2U &&
+                       std::chrono::steady_clock::now() < timeout)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+                }
+                monitor.Stop();
+
+                EXPECT_GE(lastCount.load(), 2U);
+                EXPECT_EQ(monitor.GetDeadlineMissedCount(), lastCount.load());
+            }
+
+            TEST(EventQosMonitorTest, ArrivalsKeepDeadline)
+            {
+                EventQosProfile qos;
+                qos.Deadline = std::chrono::milliseconds{200};
+                EventQosMonitor monitor;
+                monitor.Configure(qos);
+                monitor.Start();
+
+                for (int i = 0; i < 10; ++i)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+                    monitor.OnSample();
+                }
+                monitor.Stop();
+
+                EXPECT_EQ(monitor.GetDeadlineMissedCount(), 0U);
+            }
+        }
+    }
+}
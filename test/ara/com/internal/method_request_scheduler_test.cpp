@@ -0,0 +1,304 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../../../../src/ara/com/internal/method_request_scheduler.h"
+#include "../../../../src/ara/com/com_error_domain.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            namespace
+            {
+                bool WaitFor(const std::function<bool()> &condition)
+                {
+                    const auto timeout =
+                        std::chrono::steady_clock::now() + std::chrono::seconds{2};
+                    while (!condition())
+                    {
+                        if (std::chrono::steady_clock::now() >= timeout)
+                        {
+                            return false;
+                        }
+                        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                    }
+                    return true;
+                }
+
+                /// @brief Records every frame the scheduler transmits.
+                class Transport
+                {
+                private:
+                    std::mutex mMutex;
+                    std::vector<std::uint32_t> mSessions;
+                    std::vector<std::uint8_t> mTags;
+
+                public:
+                    std::atomic<bool> Accept{true};
+
+                    bool Send(
+                        std::uint32_t sessionId,
+                        const std::vector<std::uint8_t> &payload)
+                    {
+                        std::lock_guard<std::mutex> lock(mMutex);
+                        mSessions.push_back(sessionId);
+                        mTags.push_back(payload.empty() ? 0U : payload.front());
+                        return Accept.load();
+                    }
+
+                    std::size_t Count()
+                    {
+                        std::lock_guard<std::mutex> lock(mMutex);
+                        return mSessions.size();
+                    }
+
+                    std::uint32_t Session(std::size_t index)
+                    {
+                        std::lock_guard<std::mutex> lock(mMutex);
+                        return mSessions.at(index);
+                    }
+
+                    std::vector<std::uint8_t> Tags()
+                    {
+                        std::lock_guard<std::mutex> lock(mMutex);
+                        return mTags;
+                    }
+                };
+
+                struct Outcome
+                {
+                    std::atomic<int> Calls{0};
+                    std::atomic<bool> HasValue{false};
+                    std::atomic<int> ErrorValue{0};
+                };
+
+                MethodRequestScheduler::ResponseHandler Record(Outcome &outcome)
+                {
+                    return [&outcome](core::Result<std::vector<std::uint8_t>> result)
+                    {
+                        outcome.HasValue.store(result.HasValue());
+                        if (!result.HasValue())
+                        {
+                            outcome.ErrorValue.store(
+                                static_cast<int>(result.Error().Value()));
+                        }
+                        outcome.Calls.fetch_add(1);
+                    };
+                }
+
+                std::shared_ptr<MethodRequestScheduler> MakeScheduler(
+                    Transport &transport,
+                    TimerWheel &wheel,
+                    const MethodQosProfile &qos,
+                    std::uint32_t maxSessionId = UINT32_MAX)
+                {
+                    auto scheduler = std::make_shared<MethodRequestScheduler>(
+                        [&transport](std::uint32_t sessionId,
+                                     const std::vector<std::uint8_t> &payload)
+                        {
+                            return transport.Send(sessionId, payload);
+                        },
+                        maxSessionId,
+                        wheel);
+                    scheduler->SetQosProfile(qos);
+                    return scheduler;
+                }
+
+                core::Result<std::vector<std::uint8_t>> Reply()
+                {
+                    return core::Result<std::vector<std::uint8_t>>::FromValue(
+                        std::vector<std::uint8_t>{1U});
+                }
+            }
+
+            TEST(MethodRequestSchedulerTest, WindowQueuesOverflow)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                Transport transport;
+                MethodQosProfile qos;
+                qos.MaxConcurrentRequests = 2U;
+                auto scheduler = MakeScheduler(transport, wheel, qos);
+
+                Outcome outcomes[4];
+                for (auto &outcome : outcomes)
+                {
+                    scheduler->Submit({}, Record(outcome));
+                }
+                EXPECT_EQ(transport.Count(), 2U);
+                EXPECT_EQ(scheduler->ActiveCount(), 2U);
+                EXPECT_EQ(scheduler->QueuedCount(), 2U);
+
+                EXPECT_TRUE(scheduler->Complete(transport.Session(0U), Reply()));
+                EXPECT_EQ(outcomes[0].Calls.load(), 1);
+                EXPECT_TRUE(outcomes[0].HasValue.load());
+                EXPECT_EQ(transport.Count(), 3U);
+                EXPECT_EQ(scheduler->QueuedCount(), 1U);
+            }
+
+            TEST(MethodRequestSchedulerTest, CompleteCopiesPayloadForWaitingCall)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                Transport transport;
+                auto scheduler = MakeScheduler(transport, wheel, MethodQosProfile{});
+
+                std::vector<std::uint8_t> received;
+                scheduler->Submit(
+                    {},
+                    [&received](core::Result<std::vector<std::uint8_t>> result)
+                    {
+                        received = std::move(result).Value();
+                    });
+
+                const std::uint8_t cReply[]{7U, 8U, 9U};
+                EXPECT_FALSE(scheduler->Complete(
+                    transport.Session(0U) + 1U, core::Span<const std::uint8_t>(cReply)));
+                EXPECT_TRUE(scheduler->Complete(
+                    transport.Session(0U), core::Span<const std::uint8_t>(cReply)));
+                EXPECT_EQ(received, (std::vector<std::uint8_t>{7U, 8U, 9U}));
+                EXPECT_EQ(scheduler->ActiveCount(), 0U);
+            }
+
+            TEST(MethodRequestSchedulerTest, QueuedCallsLeaveByPriority)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                Transport transport;
+                MethodQosProfile qos;
+                qos.MaxConcurrentRequests = 1U;
+                auto scheduler = MakeScheduler(transport, wheel, qos);
+
+                Outcome outcome;
+                scheduler->Submit({0xA0U}, Record(outcome), 0U);
+                scheduler->Submit({0xB0U}, Record(outcome), 1U);
+                scheduler->Submit({0xC0U}, Record(outcome), 5U);
+                scheduler->Submit({0xC1U}, Record(outcome), 5U);
+
+                for (std::size_t i = 0U; i < 4U; ++i)
+                {
+                    ASSERT_EQ(transport.Count(), i + 1U);
+                    scheduler->Complete(transport.Session(i), Reply());
+                }
+
+                const std::vector<std::uint8_t> expected{0xA0U, 0xC0U, 0xC1U, 0xB0U};
+                EXPECT_EQ(transport.Tags(), expected);
+                EXPECT_EQ(outcome.Calls.load(), 4);
+            }
+
+            TEST(MethodRequestSchedulerTest, ResponseTimeoutFailsCall)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                Transport transport;
+                MethodQosProfile qos;
+                qos.ResponseTimeout = std::chrono::milliseconds{10};
+                auto scheduler = MakeScheduler(transport, wheel, qos);
+
+                Outcome outcome;
+                scheduler->Submit({}, Record(outcome));
+
+                ASSERT_TRUE(WaitFor([&] { return outcome.Calls.load() == 1; }));
+                EXPECT_FALSE(outcome.HasValue.load());
+                EXPECT_EQ(
+                    outcome.ErrorValue.load(),
+                    static_cast<int>(ComErrc::kCommunicationStackError));
+                EXPECT_EQ(scheduler->ActiveCount(), 0U);
+                EXPECT_FALSE(scheduler->Complete(transport.Session(0U), Reply()));
+            }
+
+            TEST(MethodRequestSchedulerTest, RetryResendsUnderNewSession)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                Transport transport;
+                MethodQosProfile qos;
+                qos.ResponseTimeout = std::chrono::milliseconds{10};
+                qos.AutoRetry = true;
+                qos.MaxRetries = 2U;
+                qos.RetryDelay = std::chrono::milliseconds{2};
+                auto scheduler = MakeScheduler(transport, wheel, qos);
+
+                Outcome outcome;
+                scheduler->Submit({}, Record(outcome));
+                ASSERT_TRUE(WaitFor([&] { return transport.Count() == 2U; }));
+                EXPECT_EQ(outcome.Calls.load(), 0);
+                EXPECT_EQ(scheduler->ActiveCount(), 1U);
+
+                // The reply to the first attempt arrives too late.
+                EXPECT_FALSE(scheduler->Complete(transport.Session(0U), Reply()));
+                EXPECT_TRUE(scheduler->Complete(transport.Session(1U), Reply()));
+                EXPECT_EQ(outcome.Calls.load(), 1);
+                EXPECT_TRUE(outcome.HasValue.load());
+            }
+
+            TEST(MethodRequestSchedulerTest, SendFailureExhaustsRetries)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                Transport transport;
+                transport.Accept.store(false);
+                MethodQosProfile qos;
+                qos.AutoRetry = true;
+                qos.MaxRetries = 2U;
+                qos.RetryDelay = std::chrono::milliseconds{1};
+                auto scheduler = MakeScheduler(transport, wheel, qos);
+
+                Outcome outcome;
+                scheduler->Submit({}, Record(outcome));
+
+                ASSERT_TRUE(WaitFor([&] { return outcome.Calls.load() == 1; }));
+                EXPECT_EQ(transport.Count(), 3U);
+                EXPECT_FALSE(outcome.HasValue.load());
+                EXPECT_EQ(scheduler->ActiveCount(), 0U);
+            }
+
+            TEST(MethodRequestSchedulerTest, SessionIdsWrapAndSkipInFlight)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                Transport transport;
+                auto scheduler = MakeScheduler(
+                    transport, wheel, MethodQosProfile{}, 3U);
+
+                Outcome outcome;
+                for (int i = 0; i < 3; ++i)
+                {
+                    scheduler->Submit({}, Record(outcome));
+                }
+                scheduler->Complete(2U, Reply());
+                scheduler->Submit({}, Record(outcome));
+
+                ASSERT_EQ(transport.Count(), 4U);
+                EXPECT_EQ(transport.Session(0U), 1U);
+                EXPECT_EQ(transport.Session(1U), 2U);
+                EXPECT_EQ(transport.Session(2U), 3U);
+                EXPECT_EQ(transport.Session(3U), 2U);
+            }
+
+            TEST(MethodRequestSchedulerTest, ShutdownFailsAllCalls)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                Transport transport;
+                MethodQosProfile qos;
+                qos.MaxConcurrentRequests = 1U;
+                auto scheduler = MakeScheduler(transport, wheel, qos);
+
+                Outcome outcome;
+                scheduler->Submit({}, Record(outcome));
+                scheduler->Submit({}, Record(outcome));
+                scheduler->Shutdown(MakeErrorCode(ComErrc::kServiceNotAvailable));
+
+                EXPECT_EQ(outcome.Calls.load(), 2);
+                EXPECT_EQ(
+                    outcome.ErrorValue.load(),
+                    static_cast<int>(ComErrc::kServiceNotAvailable));
+                EXPECT_EQ(wheel.PendingCount(), 0U);
+
+                scheduler->Submit({}, Record(outcome));
+                EXPECT_EQ(outcome.Calls.load(), 3);
+                EXPECT_EQ(transport.Count(), 1U);
+            }
+        }
+    }
+}
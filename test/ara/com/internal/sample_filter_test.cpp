@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "../../../../src/ara/com/internal/sample_filter.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            namespace
+            {
+                template <typename T>
+                std::vector<std::uint8_t> encode(std::size_t offset, T value)
+                {
+                    std::vector<std::uint8_t> payload(offset + sizeof(T), 0U);
+                    std::memcpy(payload.data() + offset, &value, sizeof(T));
+                    return payload;
+                }
+            }
+
+            TEST(SampleFilterTest, DefaultPassesEverything)
+            {
+                SampleFilter filter;
+                EXPECT_TRUE(filter.IsPassThrough());
+                EXPECT_TRUE(filter.Accept(nullptr, 0U));
+            }
+
+            TEST(SampleFilterTest, ValueFiltersAreNotEvaluatedOnBytes)
+            {
+                SampleFilter filter{FilterConfig::Threshold(100.0)};
+                EXPECT_TRUE(filter.IsPassThrough());
+
+                const auto payload = encode<std::uint32_t>(0U, 1U);
+                EXPECT_TRUE(filter.Accept(payload.data(), payload.size()));
+            }
+
+            TEST(SampleFilterTest, OneEveryN)
+            {
+                SampleFilter filter{FilterConfig::OneEveryN(3U)};
+                EXPECT_FALSE(filter.IsPassThrough());
+
+                std::vector<bool> decisions;
+                for (int i = 0; i < 6; ++i)
+                {
+                    decisions.push_back(filter.Accept(nullptr, 0U));
+                }
+
+                const std::vector<bool> expected{
+                    false, false, true, false, false, true};
+                EXPECT_EQ(decisions, expected);
+            }
+
+            TEST(SampleFilterTest, ConfigureRestartsDecimation)
+            {
+                SampleFilter filter{FilterConfig::OneEveryN(2U)};
+                EXPECT_FALSE(filter.Accept(nullptr, 0U));
+
+                filter.Configure(FilterConfig::OneEveryN(2U));
+                EXPECT_FALSE(filter.Accept(nullptr, 0U));
+                EXPECT_TRUE(filter.Accept(nullptr, 0U));
+            }
+
+            TEST(SampleFilterTest, ContentRangeOnUnsignedField)
+            {
+                SampleFilter filter{FilterConfig::Content(
+                    2U, FilterFieldType::kUInt16, 10.0, 20.0)};
+
+                const auto low = encode<std::uint16_t>(2U, 9U);
+                const auto inside = encode<std::uint16_t>(2U, 15U);
+                const auto high = encode<std::uint16_t>(2U, 21U);
+
+                EXPECT_FALSE(filter.Accept(low.data(), low.size()));
+                EXPECT_TRUE(filter.Accept(inside.data(), inside.size()));
+                EXPECT_FALSE(filter.Accept(high.data(), high.size()));
+            }
+
+            TEST(SampleFilterTest, ContentThresholdOnSignedField)
+            {
+                SampleFilter filter{FilterConfig::ContentThreshold(
+                    0U, FilterFieldType::kInt32, -5.0)};
+
+                const auto below = encode<std::int32_t>(0U, -6);
+                const auto above = encode<std::int32_t>(0U, 1000);
+
+                EXPECT_FALSE(filter.Accept(below.data(), below.size()));
+                EXPECT_TRUE(filter.Accept(above.data(), above.size()));
+            }
+
+            TEST(SampleFilterTest, ContentRejectsShortPayload)
+            {
+                SampleFilter filter{FilterConfig::Content(
+                    4U, FilterFieldType::kFloat64, 0.0, 1.0)};
+
+                const std::vector<std::uint8_t> shortPayload(8U, 0U);
+                EXPECT_FALSE(
+                    filter.Accept(shortPayload.data(), shortPayload.size()));
+                EXPECT_FALSE(filter.Accept(nullptr, 0U));
+            }
+
+            TEST(SampleFilterTest, ReadFieldDecodesFloat)
+            {
+                const auto payload = encode<float>(3U, 2.5F);
+                double value{0.0};
+                ASSERT_TRUE(SampleFilter::ReadField(
+                    payload.data(), payload.size(),
+                    3U, FilterFieldType::kFloat32, value));
+                EXPECT_DOUBLE_EQ(value, 2.5);
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "../../../../src/ara/com/internal/sample_pool.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            TEST(SamplePoolTest, EmplaceUsesPooledSlot)
+            {
+                auto pool = SamplePool<std::uint32_t>::Create(2U);
+                EXPECT_EQ(pool->Capacity(), 2U);
+
+                {
+                    SamplePtr<std::uint32_t> sample{pool->Emplace(42U)};
+                    ASSERT_NE(sample, nullptr);
+                    EXPECT_EQ(*sample, 42U);
+                    EXPECT_EQ(pool->FreeCount(), 1U);
+                }
+
+                EXPECT_EQ(pool->FreeCount(), 2U);
+            }
+
+            TEST(SamplePoolTest, ExhaustedPoolFallsBackToHeap)
+            {
+                auto pool = SamplePool<std::string>::Create(1U);
+
+                SamplePtr<std::string> first{pool->Emplace(std::string{"a"})};
+                SamplePtr<std::string> second{pool->Emplace(std::string{"b"})};
+
+                EXPECT_EQ(*first, "a");
+                EXPECT_EQ(*second, "b");
+                EXPECT_EQ(pool->FreeCount(), 0U);
+
+                first.Reset();
+                EXPECT_EQ(pool->FreeCount(), 1U);
+            }
+
+            TEST(SamplePoolTest, SlotsAreReused)
+            {
+                auto pool = SamplePool<std::vector<int>>::Create(1U);
+                const std::vector<int> *firstAddress{nullptr};
+
+                {
+                    SamplePtr<std::vector<int>> sample{
+                        pool->Emplace(std::vector<int>{1, 2, 3})};
+                    firstAddress = sample.Get();
+                }
+
+                SamplePtr<std::vector<int>> sample{
+                    pool->Emplace(std::vector<int>{4})};
+                EXPECT_EQ(sample.Get(), firstAddress);
+                EXPECT_EQ(sample->size(), 1U);
+            }
+
+            TEST(SamplePoolTest, SamplesOutliveOwner)
+            {
+                SamplePtr<std::string> sample;
+                {
+                    auto pool = SamplePool<std::string>::Create(4U);
+                    sample = pool->Emplace(std::string{"still valid"});
+                }
+
+                ASSERT_NE(sample, nullptr);
+                EXPECT_EQ(*sample, "still valid");
+            }
+        }
+    }
+}
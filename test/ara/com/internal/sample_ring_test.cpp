@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "../../../../src/ara/com/internal/sample_ring.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            namespace
+            {
+                std::vector<std::uint8_t> makePayload(std::uint8_t value)
+                {
+                    return std::vector<std::uint8_t>{value, value, value};
+                }
+
+                std::vector<std::uint8_t> drainFirstBytes(SampleRing &ring)
+                {
+                    std::vector<std::uint8_t> firstBytes;
+                    ring.Drain(
+                        [&firstBytes](const std::uint8_t *data, std::size_t size)
+                        {
+                            firstBytes.push_back(size > 0U ? data[0] : 0U);
+                        },
+                        ring.Capacity());
+                    return firstBytes;
+                }
+            }
+
+            TEST(SampleRingTest, PushBeforeResetIsRejected)
+            {
+                SampleRing ring;
+                const auto payload = makePayload(1U);
+                EXPECT_FALSE(ring.Push(payload.data(), payload.size()));
+                EXPECT_EQ(ring.Capacity(), 0U);
+                EXPECT_EQ(ring.Size(), 0U);
+            }
+
+            TEST(SampleRingTest, ResetClampsCapacity)
+            {
+                SampleRing ring;
+                ring.Reset(0U);
+                EXPECT_EQ(ring.Capacity(), 1U);
+                EXPECT_EQ(ring.FreeCount(), 1U);
+            }
+
+            TEST(SampleRingTest, DrainInFifoOrder)
+            {
+                SampleRing ring;
+                ring.Reset(4U);
+
+                for (std::uint8_t i = 1U; i <= 3U; ++i)
+                {
+                    const auto payload = makePayload(i);
+                    ASSERT_TRUE(ring.Push(payload.data(), payload.size()));
+                }
+                EXPECT_EQ(ring.Size(), 3U);
+                EXPECT_EQ(ring.FreeCount(), 1U);
+
+                const auto firstBytes = drainFirstBytes(ring);
+                const std::vector<std::uint8_t> expected{1U, 2U, 3U};
+                EXPECT_EQ(firstBytes, expected);
+                EXPECT_EQ(ring.Size(), 0U);
+            }
+
+            TEST(SampleRingTest, DrainHonorsMaxCount)
+            {
+                SampleRing ring;
+                ring.Reset(4U);
+
+                for (std::uint8_t i = 1U; i <= 4U; ++i)
+                {
+                    const auto payload = makePayload(i);
+                    ring.Push(payload.data(), payload.size());
+                }
+
+                std::size_t calls{0U};
+                const std::size_t consumed = ring.Drain(
+                    [&calls](const std::uint8_t *, std::size_t) { ++calls; },
+                    2U);
+
+                EXPECT_EQ(consumed, 2U);
+                EXPECT_EQ(calls, 2U);
+                EXPECT_EQ(ring.Size(), 2U);
+            }
+
+            TEST(SampleRingTest, DropOldestOverwritesHead)
+            {
+                SampleRing ring{QueueOverflowPolicy::kDropOldest};
+                ring.Reset(2U);
+
+                for (std::uint8_t i = 1U; i <= 4U; ++i)
+                {
+                    const auto payload = makePayload(i);
+                    EXPECT_TRUE(ring.Push(payload.data(), payload.size()));
+                }
+
+                EXPECT_EQ(ring.GetDroppedSampleCount(), 2U);
+                const std::vector<std::uint8_t> expected{3U, 4U};
+                EXPECT_EQ(drainFirstBytes(ring), expected);
+            }
+
+            TEST(SampleRingTest, RejectNewKeepsHead)
+            {
+                SampleRing ring{QueueOverflowPolicy::kRejectNew};
+                ring.Reset(2U);
+
+                for (std::uint8_t i = 1U; i <= 4U; ++i)
+                {
+                    const auto payload = makePayload(i);
+                    EXPECT_EQ(ring.Push(payload.data(), payload.size()), i <= 2U);
+                }
+
+                EXPECT_EQ(ring.GetDroppedSampleCount(), 2U);
+                EXPECT_EQ(ring.GetOverflowPolicy(),
+                          QueueOverflowPolicy::kRejectNew);
+                const std::vector<std::uint8_t> expected{1U, 2U};
+                EXPECT_EQ(drainFirstBytes(ring), expected);
+            }
+
+            TEST(SampleRingTest, SlotsAreReusedAcrossLaps)
+            {
+                SampleRing ring;
+                ring.Reset(2U, 64U);
+
+                std::vector<std::uint8_t> large(48U, 0xAAU);
+                for (int lap = 0; lap < 10; ++lap)
+                {
+                    ASSERT_TRUE(ring.Push(large.data(), large.size()));
+                    std::size_t receivedSize{0U};
+                    ring.Drain(
+                        [&receivedSize](const std::uint8_t *, std::size_t size)
+                        {
+                            receivedSize = size;
+                        },
+                        1U);
+                    EXPECT_EQ(receivedSize, large.size());
+                }
+                EXPECT_EQ(ring.Size(), 0U);
+            }
+
+            TEST(SampleRingTest, ClearDiscardsWithoutCountingDrops)
+            {
+                SampleRing ring;
+                ring.Reset(4U);
+                const auto payload = makePayload(7U);
+                ring.Push(payload.data(), payload.size());
+                ring.Push(payload.data(), payload.size());
+
+                ring.Clear();
+                EXPECT_EQ(ring.Size(), 0U);
+                EXPECT_EQ(ring.GetDroppedSampleCount(), 0U);
+                EXPECT_TRUE(ring.Push(payload.data(), payload.size()));
+            }
+
+            TEST(SampleRingTest, ConcurrentProducerConsumerKeepsOrder)
+            {
+                constexpr std::uint32_t cSampleCount{20000U};
+                SampleRing ring{QueueOverflowPolicy::kRejectNew};
+                ring.Reset(64U);
+
+                std::thread producer(
+                    [&ring]()
+                    {
+                        for (std::uint32_t i = 0U; i < cSampleCount;)
+                        {
+                            const auto *bytes =
+                                reinterpret_cast<const std::uint8_t *>(&i);
+                            if (ring.Push(bytes, sizeof(i)))
+                            {
+                                ++i;
+                            }
+                            else
+                            {
+                                std::this_thread::yield();
+                            }
+                        }
+                    });
+
+                std::uint32_t expected{0U};
+                bool ordered{true};
+                while (expected < cSampleCount)
+                {
+                    ring.Drain(
+                        [&expected, &ordered](
+                            const std::uint8_t *data, std::size_t size)
+                        {
+                            std::uint32_t value{0U};
+                            if (size == sizeof(value))
+                            {
+                                std::memcpy(&value, data, sizeof(value));
+                            }
+                            ordered = ordered && (value == expected);
+                            ++expected;
+                        },
+                        16U);
+                }
+
+                producer.join();
+                EXPECT_TRUE(ordered);
+                EXPECT_EQ(ring.Size(), 0U);
+            }
+
+            TEST(SampleRingTest, ResetWaitsForRunningDrain)
+            {
+                // Models Unsubscribe()/Subscribe() on the application thread
+                // while another thread keeps polling GetNewSamples().
+                SampleRing ring;
+                ring.Reset(4U);
+
+                std::atomic<bool> stop{false};
+                std::atomic<bool> intact{true};
+                std::thread poller(
+                    [&ring, &stop, &intact]()
+                    {
+                        while (!stop.load())
+                        {
+                            ring.Drain(
+                                [&intact](
+                                    const std::uint8_t *data, std::size_t size)
+                                {
+                                    // A Reset() under this batch would clear
+                                    // or reallocate the payload being read.
+                                    std::this_thread::yield();
+                                    const bool uniform{
+                                        size == 3U &&
+                                        data[1] == data[0] &&
+                                        data[2] == data[0]};
+                                    intact.store(intact.load() && uniform);
+                                },
+                                2U);
+                        }
+                    });
+
+                for (std::uint8_t lap = 0U; lap < 200U; ++lap)
+                {
+                    ring.Reset((lap % 2U == 0U) ? 4U : 8U);
+                    const auto payload = makePayload(lap);
+                    ring.Push(payload.data(), payload.size());
+                    ring.Push(payload.data(), payload.size());
+                    std::this_thread::yield();
+                }
+
+                stop.store(true);
+                poller.join();
+                EXPECT_TRUE(intact.load());
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include "../../../../src/ara/com/internal/timer_wheel.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace internal
+        {
+            namespace
+            {
+                bool WaitFor(const std::function<bool()> &condition)
+                {
+                    const auto timeout =
+                        std::chrono::steady_clock::now() + std::chrono::seconds{2};
+                    while (!condition())
+                    {
+                        if (std::chrono::steady_clock::now() >= timeout)
+                        {
+                            return false;
+                        }
+                        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                    }
+                    return true;
+                }
+            }
+
+            TEST(TimerWheelTest, FiresNotBeforeDelay)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                const auto start = std::chrono::steady_clock::now();
+                std::atomic<bool> fired{false};
+                std::chrono::steady_clock::time_point firedAt;
+                wheel.Schedule(
+                    std::chrono::milliseconds{20},
+                    [&]
+                    {
+                        firedAt = std::chrono::steady_clock::now();
+                        fired.store(true);
+                    });
+
+                ASSERT_TRUE(WaitFor([&] { return fired.load(); }));
+                EXPECT_GE(firedAt - start, std::chrono::milliseconds{20});
+                EXPECT_EQ(wheel.PendingCount(), 0U);
+            }
+
+            TEST(TimerWheelTest, CancelPreventsExpiry)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+                std::atomic<int> fired{0};
+                const auto cancelled = wheel.Schedule(
+                    std::chrono::milliseconds{10}, [&] { fired.fetch_add(10); });
+                wheel.Schedule(
+                    std::chrono::milliseconds{20}, [&] { fired.fetch_add(1); });
+
+                EXPECT_TRUE(wheel.Cancel(cancelled));
+                EXPECT_FALSE(wheel.Cancel(cancelled));
+                EXPECT_EQ(wheel.PendingCount(), 1U);
+
+                ASSERT_TRUE(WaitFor([&] { return fired.load() != 0; }));
+                EXPECT_EQ(fired.load(), 1);
+            }
+
+            TEST(TimerWheelTest, DelayBeyondOneRevolution)
+            {
+                // 4 slots of 1 ms: the timer has to survive several passes.
+                TimerWheel wheel{std::chrono::milliseconds{1}, 4U};
+                const auto start = std::chrono::steady_clock::now();
+                std::atomic<bool> fired{false};
+                std::chrono::steady_clock::time_point firedAt;
+                wheel.Schedule(
+                    std::chrono::milliseconds{15},
+                    [&]
+                    {
+                        firedAt = std::chrono::steady_clock::now();
+                        fired.store(true);
+                    });
+
+                ASSERT_TRUE(WaitFor([&] { return fired.load(); }));
+                EXPECT_GE(firedAt - start, std::chrono::milliseconds{15});
+            }
+
+            TEST(TimerWheelTest, ManyTimersShareOneThread)
+            {
+                TimerWheel wheel{std::chrono::milliseconds{1}, 16U};
+                std::atomic<int> fired{0};
+                for (int i = 0; i < 500; ++i)
+                {
+                    wheel.Schedule(
+                        std::chrono::milliseconds{1 + i % 30},
+                        [&] { fired.fetch_add(1); });
+                }
+
+                ASSERT_TRUE(WaitFor([&] { return fired.load() == 500; }));
+                EXPECT_EQ(wheel.PendingCount(), 0U);
+            }
+        }
+    }
+}
@@ -28,6 +28,17 @@ namespace ara
                 SubscriptionStateChangeHandler mStateChangeHandler;
 
             public:
+                /// @brief Whether SetSampleFilter() claims binding-side filtering.
+                bool AcceptsSampleFilter{false};
+                /// @brief Last filter passed to SetSampleFilter().
+                FilterConfig InstalledFilter{};
+                /// @brief Whether SetQosProfile() was called.
+                bool HasQos{false};
+                /// @brief Last profile passed to SetQosProfile().
+                EventQosProfile InstalledQos{};
+                /// @brief Handler passed to SetDeadlineMissedHandler().
+                DeadlineMissedHandler DeadlineHandler;
+
                 core::Result<void> Subscribe(std::size_t maxSampleCount) override
                 {
                     mMaxSampleCount = maxSampleCount;
@@ -75,6 +86,30 @@ namespace ara
                     return core::Result<std::size_t>::FromValue(count);
                 }
 
+                bool SetSampleFilter(const FilterConfig &filter) override
+                {
+                    InstalledFilter = filter;
+                    return AcceptsSampleFilter;
+                }
+
+                bool SetQosProfile(const EventQosProfile &qos) override
+                {
+                    InstalledQos = qos;
+                    HasQos = true;
+                    return true;
+                }
+
+                void SetDeadlineMissedHandler(
+                    DeadlineMissedHandler handler) override
+                {
+                    DeadlineHandler = std::move(handler);
+                }
+
+                void UnsetDeadlineMissedHandler() override
+                {
+                    DeadlineHandler = nullptr;
+                }
+
                 void SetReceiveHandler(std::function<void()> handler) override
                 {
                     mReceiveHandler = std::move(handler);
@@ -117,6 +152,74 @@ namespace ara
                 }
             };
 
+            /// @brief Mock proxy-side event binding that lends its own buffers,
+            ///        like a shared-memory transport does.
+            class MockLoaningProxyEventBinding : public MockProxyEventBinding
+            {
+            private:
+                std::deque<std::vector<std::uint8_t>> mChunks;
+                std::deque<std::size_t> mOffsets;
+                std::size_t mNextChunk{0U};
+
+                static void releaseLoan(void *context, const void *) noexcept
+                {
+                    --static_cast<MockLoaningProxyEventBinding *>(context)
+                          ->OutstandingLoans;
+                }
+
+            public:
+                int OutstandingLoans{0};
+
+                bool SupportsSampleLoans() const noexcept override
+                {
+                    return true;
+                }
+
+                core::Result<std::size_t> GetNewLoanedSamples(
+                    LoanedReceiveHandler handler,
+                    std::size_t maxNumberOfSamples) override
+                {
+                    if (GetSubscriptionState() != SubscriptionState::kSubscribed)
+                    {
+                        return core::Result<std::size_t>::FromError(
+                            MakeErrorCode(ComErrc::kServiceNotAvailable));
+                    }
+
+                    std::size_t count = 0U;
+                    while (mNextChunk < mChunks.size() && count < maxNumberOfSamples)
+                    {
+                        const std::size_t offset = mOffsets[mNextChunk];
+                        auto &chunk = mChunks[mNextChunk++];
+                        ++OutstandingLoans;
+                        handler(chunk.data() + offset, chunk.size() - offset,
+                                SampleReleaser{&releaseLoan, this});
+                        ++count;
+                    }
+                    return core::Result<std::size_t>::FromValue(count);
+                }
+
+                // ── Test helpers ──
+
+                void InjectChunk(std::vector<std::uint8_t> data)
+                {
+                    InjectChunkAt(std::move(data), 0U);
+                }
+
+                /// @brief Lend a chunk whose sample starts @p offset bytes in,
+                ///        e.g. to hand out a misaligned sample
+                void InjectChunkAt(std::vector<std::uint8_t> data, std::size_t offset)
+                {
+                    data.insert(data.begin(), offset, 0U);
+                    mChunks.push_back(std::move(data));
+                    mOffsets.push_back(offset);
+                }
+
+                const std::uint8_t *ChunkData(std::size_t index) const
+                {
+                    return mChunks[index].data();
+                }
+            };
+
             /// @brief Mock skeleton-side event binding for unit testing.
             class MockSkeletonEventBinding : public internal::SkeletonEventBinding
             {
@@ -126,6 +229,8 @@ namespace ara
             public:
                 std::vector<std::vector<std::uint8_t>> SentPayloads;
                 std::vector<std::pair<void *, std::size_t>> AllocatedSends;
+                std::vector<void *> Allocations;
+                std::vector<std::size_t> FrameOffsets;
 
                 core::Result<void> Offer() override
                 {
@@ -158,12 +263,22 @@ namespace ara
                         return core::Result<void *>::FromError(
                             MakeErrorCode(ComErrc::kSampleAllocationFailure));
                     }
+                    Allocations.push_back(ptr);
                     return core::Result<void *>::FromValue(ptr);
                 }
 
+                core::Result<void> SendAllocatedFrame(
+                    void *data, std::size_t offset, std::size_t size) override
+                {
+                    FrameOffsets.push_back(offset);
+                    return internal::SkeletonEventBinding::SendAllocatedFrame(
+                        data, offset, size);
+                }
+
                 core::Result<void> SendAllocated(
                     void *data, std::size_t size) override
                 {
+                    AllocatedSends.emplace_back(data, size);
                     if (!mOffered)
                     {
                         std::free(data);
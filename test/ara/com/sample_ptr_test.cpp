@@ -44,6 +44,77 @@ namespace ara
             EXPECT_DOUBLE_EQ(sample->Value, 3.14);
         }
 
+        namespace
+        {
+            struct ReleaseCounter
+            {
+                int Releases{0};
+                const void *LastSample{nullptr};
+            };
+
+            void countRelease(void *context, const void *sample) noexcept
+            {
+                auto *counter = static_cast<ReleaseCounter *>(context);
+                ++counter->Releases;
+                counter->LastSample = sample;
+            }
+        }
+
+        TEST(SamplePtrTest, CustomReleaserRunsOnce)
+        {
+            const int storage{5};
+            ReleaseCounter counter;
+            {
+                SamplePtr<int> a{&storage, SampleReleaser{&countRelease, &counter}};
+                SamplePtr<int> b{std::move(a)};
+                EXPECT_EQ(b.Get(), &storage);
+                EXPECT_EQ(*b, 5);
+            }
+
+            EXPECT_EQ(counter.Releases, 1);
+            EXPECT_EQ(counter.LastSample, &storage);
+        }
+
+        TEST(SamplePtrTest, ResetReleasesSample)
+        {
+            const int storage{6};
+            ReleaseCounter counter;
+            SamplePtr<int> sample{&storage, SampleReleaser{&countRelease, &counter}};
+
+            sample.Reset();
+            EXPECT_EQ(sample, nullptr);
+            EXPECT_EQ(counter.Releases, 1);
+
+            sample.Reset();
+            EXPECT_EQ(counter.Releases, 1);
+        }
+
+        TEST(SamplePtrTest, MoveAssignReleasesPrevious)
+        {
+            const int first{1};
+            const int second{2};
+            ReleaseCounter counter;
+            SamplePtr<int> a{&first, SampleReleaser{&countRelease, &counter}};
+            SamplePtr<int> b{&second, SampleReleaser{&countRelease, &counter}};
+
+            a = std::move(b);
+            EXPECT_EQ(counter.Releases, 1);
+            EXPECT_EQ(counter.LastSample, &first);
+            EXPECT_EQ(*a, 2);
+            EXPECT_EQ(b, nullptr);
+        }
+
+        TEST(SamplePtrTest, Swap)
+        {
+            SamplePtr<int> a{std::make_unique<const int>(1)};
+            SamplePtr<int> b;
+
+            a.Swap(b);
+            EXPECT_EQ(a, nullptr);
+            ASSERT_NE(b, nullptr);
+            EXPECT_EQ(*b, 1);
+        }
+
         TEST(SampleAllocateePtrTest, ConstructAndAccess)
         {
             auto raw = new int{55};
@@ -1,4 +1,7 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include "../../../../src/ara/com/secoc/freshness_sync_manager.h"
 
 namespace ara
@@ -270,6 +273,56 @@ namespace ara
                 std::vector<uint8_t> _bad = {0x01, 0x00, 0x00};
                 EXPECT_FALSE(_mgr.RestoreState(_bad).HasValue());
             }
+
+            TEST(FreshnessSyncManagerTest, ConcurrentVerifyAcceptsEachCounterOnce)
+            {
+                FreshnessSyncManager _mgr{"TestEcu"};
+                ReplayWindowConfig _wc;
+                _wc.ForwardTolerance = 1;
+                _wc.MaxAgeMs = 0;
+                _mgr.RegisterPdu(1, _wc);
+                _mgr.RegisterPdu(2, ReplayWindowConfig{});
+
+                // Sync responses for another PDU land while receivers race on the same counters.
+                std::atomic<bool> _done{false};
+                std::thread _sync([&_mgr, &_done]
+                {
+                    while (!_done.load())
+                    {
+                        FreshnessSyncResponse _response{
+                            2, 0, FreshnessSyncState::kSynchronized, "Peer"};
+                        (void)_mgr.ProcessSyncResponse(_response);
+                    }
+                });
+
+                std::atomic<int> _accepted{0};
+                std::vector<std::thread> _threads;
+                for (int t = 0; t < 4; ++t)
+                {
+                    _threads.emplace_back([&_mgr, &_accepted]
+                    {
+                        for (uint64_t _counter = 0; _counter < 500; ++_counter)
+                        {
+                            if (_mgr.VerifyFreshness(1, _counter) ==
+                                FreshnessVerifyResult::kAccepted)
+                            {
+                                _accepted.fetch_add(1);
+                            }
+                        }
+                    });
+                }
+                for (auto &_thread : _threads)
+                {
+                    _thread.join();
+                }
+                _done.store(true);
+                _sync.join();
+
+                EXPECT_GE(_accepted.load(), 1);
+                EXPECT_LE(_accepted.load(), 500);
+                EXPECT_EQ(_mgr.VerifyFreshness(1, 499),
+                          FreshnessVerifyResult::kRejectedTooOld);
+            }
         }
     }
 }
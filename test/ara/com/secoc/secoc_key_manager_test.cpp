@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
+#include <atomic>
 #include <cstdio>
+#include <thread>
+#include <vector>
 #include "../../../../src/ara/com/secoc/secoc_key_manager.h"
 
 namespace ara
@@ -201,6 +204,101 @@ namespace ara
 
                 std::remove(cPath.c_str());
             }
+
+            // --- FreshnessManager table tests ---
+
+            TEST(FreshnessManagerTest, FreshnessIntoCallerBuffer)
+            {
+                FreshnessManager _fm;
+                ASSERT_TRUE(_fm.RegisterPdu(0x01, {3, 0}));
+                for (int i = 0; i < 0x0203; ++i)
+                {
+                    (void)_fm.IncrementCounter(0x01);
+                }
+
+                uint8_t _buffer[4]{0xEE, 0xEE, 0xEE, 0xEE};
+                const auto _written{_fm.GetFreshnessValue(0x01, _buffer, sizeof(_buffer))};
+                ASSERT_TRUE(_written.HasValue());
+                EXPECT_EQ(_written.Value(), 3U);
+                EXPECT_EQ(_buffer[0], 0x03);
+                EXPECT_EQ(_buffer[1], 0x02);
+                EXPECT_EQ(_buffer[2], 0x00);
+                EXPECT_EQ(_buffer[3], 0xEE);
+
+                EXPECT_FALSE(_fm.GetFreshnessValue(0x01, _buffer, 2U).HasValue());
+                EXPECT_FALSE(_fm.GetFreshnessValue(0x02, _buffer, sizeof(_buffer)).HasValue());
+            }
+
+            TEST(FreshnessManagerTest, PdusAcrossPagesAreIndependent)
+            {
+                FreshnessManager _fm;
+                ASSERT_TRUE(_fm.RegisterPdu(0x0001, {4, 0}));
+                ASSERT_TRUE(_fm.RegisterPdu(0xFF01, {4, 0}));
+                EXPECT_FALSE(_fm.RegisterPdu(0xFF01, {4, 0}));
+
+                (void)_fm.IncrementCounter(0xFF01);
+                EXPECT_EQ(_fm.GetCounterValue(0x0001).Value(), 0U);
+                EXPECT_EQ(_fm.GetCounterValue(0xFF01).Value(), 1U);
+                EXPECT_FALSE(_fm.GetCounterValue(0x0002).HasValue());
+
+                _fm.UnregisterPdu(0xFF01);
+                EXPECT_FALSE(_fm.GetCounterValue(0xFF01).HasValue());
+                ASSERT_TRUE(_fm.RegisterPdu(0xFF01, {4, 0}));
+                EXPECT_EQ(_fm.GetCounterValue(0xFF01).Value(), 0U);
+            }
+
+            TEST(FreshnessManagerTest, ConcurrentIncrementsAreNotLost)
+            {
+                FreshnessManager _fm;
+                ASSERT_TRUE(_fm.RegisterPdu(0x01, {8, 0}));
+
+                std::vector<std::thread> _threads;
+                for (int t = 0; t < 4; ++t)
+                {
+                    _threads.emplace_back([&_fm]
+                    {
+                        for (int i = 0; i < 1000; ++i)
+                        {
+                            (void)_fm.IncrementCounter(0x01);
+                        }
+                    });
+                }
+                for (auto &_thread : _threads)
+                {
+                    _thread.join();
+                }
+                EXPECT_EQ(_fm.GetCounterValue(0x01).Value(), 4000U);
+            }
+
+            TEST(FreshnessManagerTest, ConcurrentVerifyAcceptsEachCounterOnce)
+            {
+                FreshnessManager _fm;
+                ASSERT_TRUE(_fm.RegisterPdu(0x01, {8, 0}));
+
+                // Every thread offers the same counters; each may win only once.
+                std::atomic<int> _accepted{0};
+                std::vector<std::thread> _threads;
+                for (int t = 0; t < 4; ++t)
+                {
+                    _threads.emplace_back([&_fm, &_accepted]
+                    {
+                        for (uint64_t _counter = 1; _counter <= 1000; ++_counter)
+                        {
+                            if (_fm.VerifyAndUpdate(0x01, _counter).HasValue())
+                            {
+                                _accepted.fetch_add(1);
+                            }
+                        }
+                    });
+                }
+                for (auto &_thread : _threads)
+                {
+                    _thread.join();
+                }
+                EXPECT_LE(_accepted.load(), 1000);
+                EXPECT_GE(_accepted.load(), 1);
+                EXPECT_EQ(_fm.GetCounterValue(0x01).Value(), 1000U);
+            }
         }
     }
 }
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <memory>
 #include "../../../../src/ara/com/secoc/secoc_pdu_collective.h"
 
 namespace ara
@@ -37,6 +38,138 @@ namespace ara
                           SecOcOverrideStatus::kSkipAll);
             }
 
+            namespace
+            {
+                const std::vector<std::uint8_t> cBatchKey(16U, 0x5AU);
+
+                SecOcPduConfig MakeBatchConfig(PduId dataId)
+                {
+                    SecOcPduConfig _config;
+                    _config.dataId = dataId;
+                    return _config;
+                }
+
+                /// @brief PDUs 0x100..0x103 sharing one freshness manager.
+                struct BatchEndpoint
+                {
+                    FreshnessManager Freshness;
+                    std::vector<std::unique_ptr<SecOcPdu>> Pdus;
+                    SecOcPduCollective Collective;
+
+                    BatchEndpoint()
+                    {
+                        for (PduId _id = 0x100U; _id < 0x104U; ++_id)
+                        {
+                            Pdus.emplace_back(new SecOcPdu(
+                                MakeBatchConfig(_id),
+                                std::unique_ptr<MacContext>(new HmacMacContext(cBatchKey)),
+                                &Freshness));
+                            Collective.AddPdu(_id, Pdus.back().get());
+                        }
+                    }
+                };
+
+                std::vector<std::uint8_t> Payload(std::size_t index)
+                {
+                    return std::vector<std::uint8_t>(
+                        8U, static_cast<std::uint8_t>(index));
+                }
+            }
+
+            TEST(SecOcPduCollectiveTest, ProtectBatchMatchesSequentialProtect)
+            {
+                const std::size_t cEntries{32U};
+                BatchEndpoint _reference;
+                BatchEndpoint _batched;
+                core::ThreadPoolExecutor _pool{4U, 16U};
+
+                std::vector<std::vector<std::uint8_t>> _payloads;
+                std::vector<std::vector<std::uint8_t>> _outputs;
+                std::vector<SecOcBatchEntry> _entries(cEntries);
+                for (std::size_t i = 0; i < cEntries; ++i)
+                {
+                    _payloads.push_back(Payload(i));
+                    _outputs.emplace_back(32U);
+                }
+                for (std::size_t i = 0; i < cEntries; ++i)
+                {
+                    _entries[i].pduId = static_cast<PduId>(0x100U + i % 4U);
+                    _entries[i].input = _payloads[i].data();
+                    _entries[i].inputLength = _payloads[i].size();
+                    _entries[i].output = _outputs[i].data();
+                    _entries[i].outputCapacity = _outputs[i].size();
+                }
+
+                EXPECT_EQ(_batched.Collective.ProtectBatch(_entries, &_pool), cEntries);
+
+                for (std::size_t i = 0; i < cEntries; ++i)
+                {
+                    auto _expected{_reference.Pdus[i % 4U]->Protect(_payloads[i])};
+                    ASSERT_TRUE(_expected.HasValue());
+                    ASSERT_EQ(_entries[i].error, 0U);
+                    EXPECT_EQ(
+                        std::vector<std::uint8_t>(
+                            _outputs[i].begin(),
+                            _outputs[i].begin() + _entries[i].outputLength),
+                        _expected.Value());
+                }
+            }
+
+            TEST(SecOcPduCollectiveTest, VerifyBatchReportsEachEntry)
+            {
+                BatchEndpoint _sender;
+                BatchEndpoint _receiver;
+                core::ThreadPoolExecutor _pool{2U, 8U};
+                for (PduId _id = 0x100U; _id < 0x104U; ++_id)
+                {
+                    // The receiver only accepts counters above its initial zero.
+                    (void)_sender.Freshness.IncrementCounter(_id);
+                }
+
+                std::vector<std::vector<std::uint8_t>> _secured;
+                for (std::size_t i = 0; i < 8U; ++i)
+                {
+                    auto _pdu{_sender.Pdus[i % 4U]->Protect(Payload(i))};
+                    ASSERT_TRUE(_pdu.HasValue());
+                    _secured.push_back(_pdu.Value());
+                }
+                _secured[5].back() ^= 0x01U;
+                const std::vector<std::uint8_t> _replay{_secured[0]};
+                _secured.push_back(_replay);
+
+                std::vector<SecOcBatchEntry> _entries(_secured.size());
+                for (std::size_t i = 0; i < _secured.size(); ++i)
+                {
+                    _entries[i].pduId = static_cast<PduId>(0x100U + i % 4U);
+                    _entries[i].input = _secured[i].data();
+                    _entries[i].inputLength = _secured[i].size();
+                }
+
+                std::vector<VerificationStatusIndication> _indications;
+                _receiver.Collective.SetVerificationStatusCallback(
+                    [&_indications](const VerificationStatusIndication &indication)
+                    {
+                        _indications.push_back(indication);
+                    });
+
+                EXPECT_EQ(_receiver.Collective.VerifyBatch(_entries, &_pool), 7U);
+
+                EXPECT_EQ(_entries[5].result, VerificationResult::kFail);
+                EXPECT_EQ(_entries[5].error,
+                          static_cast<core::ErrorDomain::CodeType>(
+                              SecOcErrc::kAuthenticationFailed));
+                EXPECT_EQ(_entries[8].result, VerificationResult::kFreshnessFailure);
+                EXPECT_EQ(_entries[2].result, VerificationResult::kPass);
+                EXPECT_EQ(_entries[2].outputLength, Payload(2).size());
+
+                ASSERT_EQ(_indications.size(), _entries.size());
+                for (std::size_t i = 0; i < _entries.size(); ++i)
+                {
+                    EXPECT_EQ(_indications[i].pduId, _entries[i].pduId);
+                    EXPECT_EQ(_indications[i].result, _entries[i].result);
+                }
+            }
+
         } // namespace secoc
     }     // namespace com
 } // namespace ara
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "../../../../src/ara/com/secoc/secoc_pdu.h"
+#include "../../../../src/ara/crypto/crypto_provider.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace secoc
+        {
+            namespace
+            {
+                const std::vector<uint8_t> cKey{
+                    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+                    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
+
+                std::vector<uint8_t> ComputeHmac(
+                    const std::vector<uint8_t> &key,
+                    const std::vector<uint8_t> &data)
+                {
+                    auto _mac{ara::crypto::ComputeHmac(data, key)};
+                    return _mac.HasValue() ? _mac.Value() : std::vector<uint8_t>{};
+                }
+
+                SecOcPduConfig MakeConfig()
+                {
+                    SecOcPduConfig _config;
+                    _config.dataId = 0x0123;
+                    _config.truncatedFreshnessLength = 2;
+                    _config.truncatedMacLength = 8;
+                    return _config;
+                }
+            }
+
+            TEST(SecOcPduTest, ProtectAndVerifyRoundTrip)
+            {
+                FreshnessManager _sender;
+                FreshnessManager _receiver;
+                SecOcPdu _tx{MakeConfig(), cKey, ComputeHmac, &_sender};
+                SecOcPdu _rx{MakeConfig(), cKey, ComputeHmac, &_receiver};
+                // The receiver only accepts counters above its initial zero.
+                (void)_sender.IncrementCounter(0x0123);
+
+                for (uint8_t i = 0; i < 3; ++i)
+                {
+                    const std::vector<uint8_t> _payload{0xAA, i, 0x55};
+                    auto _secured{_tx.Protect(_payload)};
+                    ASSERT_TRUE(_secured.HasValue());
+                    EXPECT_EQ(_secured.Value().size(), _tx.SecuredLength(_payload.size()));
+
+                    auto _verified{_rx.Verify(_secured.Value())};
+                    ASSERT_TRUE(_verified.HasValue());
+                    EXPECT_EQ(_verified.Value(), _payload);
+                }
+            }
+
+            TEST(SecOcPduTest, HmacContextMatchesMacFunction)
+            {
+                FreshnessManager _legacyManager;
+                FreshnessManager _contextManager;
+                SecOcPdu _legacy{MakeConfig(), cKey, ComputeHmac, &_legacyManager};
+                SecOcPdu _keyed{
+                    MakeConfig(),
+                    std::unique_ptr<MacContext>(new HmacMacContext(cKey)),
+                    &_contextManager};
+
+                // Several PDUs, so the re-used key schedule is exercised too.
+                for (uint8_t i = 0; i < 4; ++i)
+                {
+                    const std::vector<uint8_t> _payload(5U + i, i);
+                    auto _expected{_legacy.Protect(_payload)};
+                    ASSERT_TRUE(_expected.HasValue());
+
+                    std::vector<uint8_t> _secured(_keyed.SecuredLength(_payload.size()));
+                    auto _length{_keyed.ProtectInto(
+                        _payload.data(), _payload.size(), _secured.data(), _secured.size())};
+                    ASSERT_TRUE(_length.HasValue());
+                    EXPECT_EQ(_length.Value(), _secured.size());
+                    EXPECT_EQ(_secured, _expected.Value());
+                }
+            }
+
+            TEST(SecOcPduTest, ProtectIntoAcceptsAliasedPayload)
+            {
+                FreshnessManager _sender;
+                FreshnessManager _receiver;
+                SecOcPdu _tx{MakeConfig(), cKey, ComputeHmac, &_sender};
+                SecOcPdu _rx{MakeConfig(), cKey, ComputeHmac, &_receiver};
+                (void)_sender.IncrementCounter(0x0123);
+
+                const std::vector<uint8_t> _payload{1, 2, 3, 4};
+                std::vector<uint8_t> _buffer{_payload};
+                _buffer.resize(_tx.SecuredLength(_payload.size()));
+
+                auto _length{_tx.ProtectInto(
+                    _buffer.data(), _payload.size(), _buffer.data(), _buffer.size())};
+                ASSERT_TRUE(_length.HasValue());
+
+                auto _payloadLength{_rx.VerifyInPlace(_buffer.data(), _length.Value())};
+                ASSERT_TRUE(_payloadLength.HasValue());
+                EXPECT_EQ(
+                    std::vector<uint8_t>(_buffer.begin(), _buffer.begin() + 4), _payload);
+                EXPECT_EQ(_payloadLength.Value(), _payload.size());
+            }
+
+            TEST(SecOcPduTest, ProtectIntoRejectsShortBuffer)
+            {
+                FreshnessManager _manager;
+                SecOcPdu _tx{MakeConfig(), cKey, ComputeHmac, &_manager};
+
+                const std::vector<uint8_t> _payload{1, 2, 3};
+                std::vector<uint8_t> _secured(_tx.SecuredLength(_payload.size()) - 1U);
+                auto _length{_tx.ProtectInto(
+                    _payload.data(), _payload.size(), _secured.data(), _secured.size())};
+                ASSERT_FALSE(_length.HasValue());
+                EXPECT_EQ(_length.Error().Value(),
+                          static_cast<ara::core::ErrorDomain::CodeType>(
+                              SecOcErrc::kInvalidPayloadLength));
+                EXPECT_EQ(_manager.GetCounterValue(0x0123).Value(), 0U);
+            }
+
+            TEST(SecOcPduTest, ForgedPduDoesNotAdvanceFreshness)
+            {
+                FreshnessManager _sender;
+                FreshnessManager _receiver;
+                SecOcPdu _tx{MakeConfig(), cKey, ComputeHmac, &_sender};
+                SecOcPdu _rx{MakeConfig(), cKey, ComputeHmac, &_receiver};
+
+                (void)_sender.IncrementCounter(0x0123);
+                auto _secured{_tx.Protect({0x42})};
+                ASSERT_TRUE(_secured.HasValue());
+
+                // A forger claiming a far-ahead counter must not burn freshness values.
+                std::vector<uint8_t> _forged{_secured.Value()};
+                _forged[1] = 0xF0;
+                auto _rejected{_rx.Verify(_forged)};
+                ASSERT_FALSE(_rejected.HasValue());
+                EXPECT_EQ(_rejected.Error().Value(),
+                          static_cast<ara::core::ErrorDomain::CodeType>(
+                              SecOcErrc::kAuthenticationFailed));
+                EXPECT_EQ(_receiver.GetCounterValue(0x0123).Value(), 0U);
+
+                EXPECT_TRUE(_rx.Verify(_secured.Value()).HasValue());
+
+                auto _replayed{_rx.Verify(_secured.Value())};
+                ASSERT_FALSE(_replayed.HasValue());
+                EXPECT_EQ(_replayed.Error().Value(),
+                          static_cast<ara::core::ErrorDomain::CodeType>(
+                              SecOcErrc::kFreshnessCounterFailed));
+            }
+
+        } // namespace secoc
+    }     // namespace com
+} // namespace ara
@@ -1,10 +1,54 @@
 #include <gtest/gtest.h>
+#include <array>
+#include <cstring>
+#include <map>
 #include "../../../src/ara/com/serialization.h"
 
+namespace
+{
+    struct Point
+    {
+        float X;
+        float Y;
+        float Z;
+        float Intensity;
+    };
+
+    /// @brief Non-trivial type whose serializer only implements the vector API.
+    struct LegacyName
+    {
+        std::string Value;
+    };
+}
+
 namespace ara
 {
     namespace com
     {
+        template <>
+        struct Serializer<LegacyName, void>
+        {
+            static std::vector<std::uint8_t> Serialize(const LegacyName &value)
+            {
+                return Serializer<std::string>::Serialize(value.Value);
+            }
+
+            static core::Result<std::pair<LegacyName, std::size_t>> DeserializeAt(
+                const std::uint8_t *data,
+                std::size_t maxSize)
+            {
+                auto result = Serializer<std::string>::DeserializeAt(data, maxSize);
+                if (!result.HasValue())
+                {
+                    return core::Result<std::pair<LegacyName, std::size_t>>::FromError(
+                        result.Error());
+                }
+                return core::Result<std::pair<LegacyName, std::size_t>>::FromValue(
+                    std::make_pair(
+                        LegacyName{result.Value().first}, result.Value().second));
+            }
+        };
+
         TEST(SerializerTest, IntRoundTrip)
         {
             int original = 42;
@@ -122,5 +166,173 @@ namespace ara
             ASSERT_TRUE(result.HasValue());
             EXPECT_EQ(result.Value(), 0xAA);
         }
+
+        TEST(SerializerTest, NestedContainerRoundTrip)
+        {
+            std::map<std::string, std::vector<std::string>> original{
+                {"a", {"x", "yz"}},
+                {"bcd", {}}};
+            auto bytes =
+                Serializer<std::map<std::string, std::vector<std::string>>>::
+                    Serialize(original);
+
+            // count + ("a" + [2, "x", "yz"]) + ("bcd" + [0])
+            EXPECT_EQ(bytes.size(), 4U + (5U + 4U + 5U + 6U) + (7U + 4U));
+            EXPECT_EQ(SerializedSizeOf(original), bytes.size());
+
+            auto result =
+                Serializer<std::map<std::string, std::vector<std::string>>>::
+                    Deserialize(bytes.data(), bytes.size());
+            ASSERT_TRUE(result.HasValue());
+            EXPECT_EQ(result.Value(), original);
+        }
+
+        TEST(SerializerTest, TrivialSizeIsCompileTime)
+        {
+            static_assert(
+                Serializer<std::uint64_t>::SerializedSize(0U) == 8U,
+                "trivially copyable wire size must be a constant expression");
+            std::vector<std::int32_t> values{1, 2, 3};
+            EXPECT_EQ(SerializedSizeOf(values), 4U + 3U * sizeof(std::int32_t));
+        }
+
+        TEST(SerializerTest, SerializeIntoCallerBuffer)
+        {
+            std::vector<std::string> original{"hello", "world"};
+            std::array<std::uint8_t, 64U> buffer{};
+
+            auto written = SerializeInto(
+                original, core::Span<std::uint8_t>{buffer.data(), buffer.size()});
+            ASSERT_TRUE(written.HasValue());
+            EXPECT_EQ(written.Value(), SerializedSizeOf(original));
+
+            auto expected = Serializer<std::vector<std::string>>::Serialize(original);
+            ASSERT_EQ(expected.size(), written.Value());
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(), buffer.begin()));
+        }
+
+        TEST(SerializerTest, SerializeIntoTooSmallBuffer)
+        {
+            std::vector<std::string> original{"hello", "world"};
+            std::array<std::uint8_t, 10U> buffer{};
+
+            auto written = SerializeInto(
+                original, core::Span<std::uint8_t>{buffer.data(), buffer.size()});
+            ASSERT_FALSE(written.HasValue());
+            EXPECT_EQ(written.Error(), MakeErrorCode(ComErrc::kSerializationError));
+        }
+
+        TEST(SerializerTest, DeserializeFromCursor)
+        {
+            std::vector<std::uint8_t> payload(
+                SerializedSizeOf(std::string{"id"}) + sizeof(std::uint16_t));
+            SerializeCursor writer{payload.data(), payload.size()};
+            Serializer<std::string>::SerializeTo("id", writer);
+            Serializer<std::uint16_t>::SerializeTo(0x1234U, writer);
+            ASSERT_TRUE(writer.Ok());
+            EXPECT_EQ(writer.Remaining(), 0U);
+
+            DeserializeCursor reader{
+                core::Span<const std::uint8_t>{payload.data(), payload.size()}};
+            auto name = DeserializeFrom<std::string>(reader);
+            ASSERT_TRUE(name.HasValue());
+            EXPECT_EQ(name.Value(), "id");
+            auto id = DeserializeFrom<std::uint16_t>(reader);
+            ASSERT_TRUE(id.HasValue());
+            EXPECT_EQ(id.Value(), 0x1234U);
+            EXPECT_EQ(reader.Remaining(), 0U);
+
+            EXPECT_FALSE(DeserializeFrom<std::uint16_t>(reader).HasValue());
+            EXPECT_EQ(reader.Offset(), payload.size());
+        }
+
+        TEST(SerializerTest, VectorOnlySerializerStillNests)
+        {
+            std::vector<LegacyName> original{{"a"}, {"bc"}};
+            auto bytes = Serializer<std::vector<LegacyName>>::Serialize(original);
+            EXPECT_EQ(bytes.size(), 4U + 5U + 6U);
+
+            auto result = Serializer<std::vector<LegacyName>>::Deserialize(
+                bytes.data(), bytes.size());
+            ASSERT_TRUE(result.HasValue());
+            ASSERT_EQ(result.Value().size(), 2U);
+            EXPECT_EQ(result.Value()[1].Value, "bc");
+        }
+
+        TEST(SerializerTest, PodVectorBulkRoundTrip)
+        {
+            std::vector<Point> original(1000U);
+            for (std::size_t i = 0U; i < original.size(); ++i)
+            {
+                const float f = static_cast<float>(i);
+                original[i] = Point{f, -f, f * 2.0F, 0.5F};
+            }
+
+            auto bytes = Serializer<std::vector<Point>>::Serialize(original);
+            ASSERT_EQ(bytes.size(), 4U + original.size() * sizeof(Point));
+
+            std::uint32_t count;
+            std::memcpy(&count, bytes.data(), sizeof(count));
+            EXPECT_EQ(count, original.size());
+            EXPECT_EQ(std::memcmp(bytes.data() + 4U, original.data(),
+                                  original.size() * sizeof(Point)),
+                      0);
+
+            auto result = Serializer<std::vector<Point>>::DeserializeAt(
+                bytes.data(), bytes.size());
+            ASSERT_TRUE(result.HasValue());
+            EXPECT_EQ(result.Value().second, bytes.size());
+            ASSERT_EQ(result.Value().first.size(), original.size());
+            EXPECT_EQ(std::memcmp(result.Value().first.data(), original.data(),
+                                  original.size() * sizeof(Point)),
+                      0);
+        }
+
+        TEST(SerializerTest, PodVectorDeserializesFromUnalignedBytes)
+        {
+            const std::vector<double> original{1.5, -2.25, 1e300};
+            const auto bytes = Serializer<std::vector<double>>::Serialize(original);
+
+            // Shift the message so the elements start on every possible
+            // alignment relative to double.
+            for (std::size_t shift = 0U; shift < alignof(double); ++shift)
+            {
+                std::vector<std::uint8_t> shifted(shift, 0U);
+                shifted.insert(shifted.end(), bytes.begin(), bytes.end());
+                auto result = Serializer<std::vector<double>>::Deserialize(
+                    shifted.data() + shift, bytes.size());
+                ASSERT_TRUE(result.HasValue());
+                EXPECT_EQ(result.Value(), original);
+            }
+        }
+
+        TEST(SerializerTest, PodVectorRejectsCorruptCount)
+        {
+            std::vector<std::int32_t> original{1, 2, 3};
+            auto bytes = Serializer<std::vector<std::int32_t>>::Serialize(original);
+
+            bytes.pop_back();
+            EXPECT_FALSE(Serializer<std::vector<std::int32_t>>::Deserialize(
+                             bytes.data(), bytes.size())
+                             .HasValue());
+
+            const std::uint32_t hugeCount{0xFFFFFFFFU};
+            std::memcpy(bytes.data(), &hugeCount, sizeof(hugeCount));
+            EXPECT_FALSE(Serializer<std::vector<std::int32_t>>::Deserialize(
+                             bytes.data(), bytes.size())
+                             .HasValue());
+        }
+
+        TEST(SerializerTest, BoolVectorUsesElementPath)
+        {
+            std::vector<bool> original{true, false, true};
+            auto bytes = Serializer<std::vector<bool>>::Serialize(original);
+            EXPECT_EQ(bytes.size(), 4U + 3U * sizeof(bool));
+
+            auto result = Serializer<std::vector<bool>>::Deserialize(
+                bytes.data(), bytes.size());
+            ASSERT_TRUE(result.HasValue());
+            EXPECT_EQ(result.Value(), original);
+        }
     }
 }
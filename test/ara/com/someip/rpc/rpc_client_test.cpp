@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <stdexcept>
 #include "../../../../../src/ara/com/someip/rpc/rpc_client.h"
 
 namespace ara
@@ -23,6 +24,7 @@ namespace ara
                     static const uint8_t cProtocolVersion{1};
                     static const uint8_t cInterfaceVersion{1};
                     mutable uint16_t LastSessionId;
+                    std::vector<uint8_t> LastPayload;
 
                     RpcClientTest() : RpcClient(cProtocolVersion, cInterfaceVersion),
                                       LastSessionId{0}
@@ -38,6 +40,7 @@ namespace ara
                     void Send(const std::vector<uint8_t> &payload) override
                     {
                         // Short circuit the send
+                        LastPayload = payload;
                         InvokeHandler(payload);
                     }
 
@@ -60,7 +63,64 @@ namespace ara
                     Send(cServiceId, cMethodId, cClientId, cRpcPayload);
                     EXPECT_NE(cExpectedResult, LastSessionId);
                 }
+
+                TEST_F(RpcClientTest, ViewHandlerReadsResponseInPlace)
+                {
+                    const std::vector<uint8_t> cResponseBuffer{1, 2, 3};
+                    const uint8_t *_seenData{nullptr};
+                    SomeIpReturnCode _seenReturnCode{SomeIpReturnCode::eOK};
+
+                    SetViewHandler(
+                        cServiceId,
+                        cMethodId,
+                        [&](const SomeIpRpcMessageView &response)
+                        {
+                            _seenData = response.RpcPayload.data();
+                            _seenReturnCode = response.ReturnCode;
+                        });
+
+                    const SomeIpRpcMessageView cResponse{
+                        (static_cast<uint32_t>(cServiceId) << 16) | cMethodId,
+                        2,
+                        1,
+                        cProtocolVersion,
+                        cInterfaceVersion,
+                        SomeIpMessageType::Error,
+                        SomeIpReturnCode::eNotOk,
+                        core::Span<const uint8_t>(
+                            cResponseBuffer.data(), cResponseBuffer.size())};
+
+                    InvokeHandler(cResponse);
+                    EXPECT_EQ(cResponseBuffer.data(), _seenData);
+                    EXPECT_EQ(SomeIpReturnCode::eNotOk, _seenReturnCode);
+                }
+
+                TEST_F(RpcClientTest, ViewRequestKeepsMessageType)
+                {
+                    const std::vector<uint8_t> cRpcPayload{1, 2};
+                    SomeIpRpcMessageView _request{
+                        (static_cast<uint32_t>(cServiceId) << 16) | cMethodId,
+                        2,
+                        1,
+                        cProtocolVersion,
+                        cInterfaceVersion,
+                        SomeIpMessageType::RequestNoReturn,
+                        SomeIpReturnCode::eOK,
+                        core::Span<const uint8_t>(
+                            cRpcPayload.data(), cRpcPayload.size())};
+
+                    // The message type follows the 14-byte header prefix.
+                    const std::size_t cMessageTypeOffset{14U};
+                    SendRequest(_request);
+                    ASSERT_GT(LastPayload.size(), cMessageTypeOffset);
+                    EXPECT_EQ(
+                        static_cast<uint8_t>(SomeIpMessageType::RequestNoReturn),
+                        LastPayload[cMessageTypeOffset]);
+
+                    _request.MessageType = SomeIpMessageType::Notification;
+                    EXPECT_THROW(SendRequest(_request), std::invalid_argument);
+                }
             }
         }
     }
-}
\ No newline at end of file
+}
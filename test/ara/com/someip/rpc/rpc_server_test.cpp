@@ -240,6 +240,71 @@ namespace ara
                     EXPECT_EQ(cExpectedResult, _actualResult);
                 }
 
+                TEST_F(RpcServerTest, ViewHandlerReadsRequestInPlace)
+                {
+                    const uint16_t cViewMethodId{4};
+                    const std::vector<uint8_t> cRequestBuffer{1, 2, 3};
+                    const std::vector<uint8_t> cExpectedResponse{4, 5};
+                    const uint8_t *_seenData{nullptr};
+
+                    SetViewHandler(
+                        cServiceId,
+                        cViewMethodId,
+                        [&](const SomeIpRpcMessageView &request,
+                            std::vector<uint8_t> &rpcResponsePayload)
+                        {
+                            _seenData = request.RpcPayload.data();
+                            rpcResponsePayload = cExpectedResponse;
+                            return true;
+                        });
+
+                    const SomeIpRpcMessageView cRequest{
+                        GetMessageId(cServiceId, cViewMethodId),
+                        cClientId,
+                        cSessionId,
+                        cProtocolVersion,
+                        cInterfaceVersion,
+                        SomeIpMessageType::Request,
+                        SomeIpReturnCode::eOK,
+                        core::Span<const uint8_t>(
+                            cRequestBuffer.data(), cRequestBuffer.size())};
+
+                    SomeIpReturnCode _returnCode{SomeIpReturnCode::eNotOk};
+                    std::vector<uint8_t> _rpcResponsePayload;
+                    bool _handled{
+                        TryInvokeHandler(cRequest, _returnCode, _rpcResponsePayload)};
+                    EXPECT_TRUE(_handled);
+                    EXPECT_EQ(SomeIpReturnCode::eOK, _returnCode);
+                    EXPECT_EQ(cRequestBuffer.data(), _seenData);
+                    EXPECT_EQ(cExpectedResponse, _rpcResponsePayload);
+                }
+
+                TEST_F(RpcServerTest, UnsetHandlerHandle)
+                {
+                    const SomeIpReturnCode cExpectedResult{SomeIpReturnCode::eUnknownMethod};
+
+                    SetHandler(cServiceId, cTrueMethodId, nullptr);
+
+                    uint32_t _messageId{GetMessageId(cServiceId, cTrueMethodId)};
+                    SomeIpRpcMessage _request(
+                        _messageId,
+                        cClientId,
+                        cSessionId,
+                        cProtocolVersion,
+                        cInterfaceVersion,
+                        cRpcPayload);
+
+                    std::vector<uint8_t> _responsePayload;
+                    bool _handled{
+                        TryInvokeHandler(_request.Payload(), _responsePayload)};
+                    EXPECT_TRUE(_handled);
+
+                    SomeIpRpcMessage _response{
+                        SomeIpRpcMessage::Deserialize(_responsePayload)};
+                    SomeIpReturnCode _actualResult{_response.ReturnCode()};
+                    EXPECT_EQ(cExpectedResult, _actualResult);
+                }
+
                 TEST_F(RpcServerTest, NoHandle)
                 {
                     const std::vector<uint8_t> cRequestPayload;
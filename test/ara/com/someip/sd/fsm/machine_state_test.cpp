@@ -1,4 +1,10 @@
 #include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "../../../../../../src/ara/com/helper/finite_state_machine.h"
 #include "../../../../../../src/ara/com/someip/sd/fsm/notready_state.h"
 #include "../../../../../../src/ara/com/someip/sd/fsm/initial_wait_state.h"
 #include "../../../../../../src/ara/com/someip/sd/fsm/repetition_state.h"
@@ -7,6 +13,8 @@
 #include "../../../../../../src/ara/com/someip/sd/fsm/service_notseen_state.h"
 #include "../../../../../../src/ara/com/someip/sd/fsm/service_ready_state.h"
 #include "../../../../../../src/ara/com/someip/sd/fsm/service_seen_state.h"
+#include "../../../../../../src/ara/com/someip/sd/fsm/client_initial_wait_state.h"
+#include "../../../../../../src/ara/com/someip/sd/fsm/client_repetition_state.h"
 
 namespace ara
 {
@@ -73,7 +81,7 @@ namespace ara
                             helper::SdServerState::NotReady;
                         const int cRepetitionsMax = 2;
                         const int cRepetitionsBaseDelay = 100;
-                        uint32_t _counter = 0;
+                        std::atomic<uint32_t> _counter{0};
                         const auto cOnTimerExpired = [&_counter]()
                         {
                             ++_counter;
@@ -92,8 +100,15 @@ namespace ara
                         EXPECT_EQ(_actualState, cExpectedState);
 
                         EXPECT_NO_THROW(_machineState.Activate(cPreviousState));
-                        // Due to blocking invocation, the counter value should be equal to the maximum repetitions.
-                        EXPECT_EQ(_counter, cRepetitionsMax);
+                        // The repetitions run on the timer wheel, so wait for the phase to end.
+                        const auto cTimeout =
+                            std::chrono::steady_clock::now() + std::chrono::seconds(2);
+                        while (_counter.load() < cRepetitionsMax &&
+                               std::chrono::steady_clock::now() < cTimeout)
+                        {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                        }
+                        EXPECT_EQ(_counter.load(), cRepetitionsMax);
                         // Finish the test gracefully
                     }
 
@@ -167,6 +182,85 @@ namespace ara
 
                         EXPECT_EQ(_actualState, cExpectedState);
                     }
+
+                    namespace
+                    {
+                        struct ClientMachine
+                        {
+                            helper::TtlTimer Timer;
+                            std::condition_variable ConditionVariable;
+                            ServiceNotseenState NotSeen{&Timer, &ConditionVariable};
+                            ServiceSeenState Seen{&Timer, &ConditionVariable};
+                            ClientInitialWaitState InitialWait{&Timer, []() {}, 0, 0};
+                            ClientRepetitionState Repetition{&Timer, []() {}, 2, 10};
+                            ServiceReadyState Ready{&Timer, &ConditionVariable};
+                            StoppedState Stopped{&Timer, &ConditionVariable};
+                            helper::FiniteStateMachine<helper::SdClientState> Machine;
+
+                            void Start()
+                            {
+                                Machine.Initialize(
+                                    {&NotSeen, &Seen, &InitialWait, &Repetition, &Ready, &Stopped},
+                                    helper::SdClientState::ServiceNotSeen);
+                                Timer.SetRequested(true);
+                                NotSeen.RequestService();
+                            }
+                        };
+
+                        template <typename Predicate>
+                        bool waitUntil(Predicate predicate)
+                        {
+                            const auto cTimeout =
+                                std::chrono::steady_clock::now() + std::chrono::seconds(2);
+                            while (!predicate())
+                            {
+                                if (std::chrono::steady_clock::now() >= cTimeout)
+                                {
+                                    return false;
+                                }
+                                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                            }
+
+                            return true;
+                        }
+                    }
+
+                    TEST(MachineStateTest, ClientStatesDoNotBlockTimerWheel)
+                    {
+                        // More ready clients than the default executor has workers
+                        const std::size_t cClientCount{3U};
+                        std::vector<std::unique_ptr<ClientMachine>> _clients;
+                        for (std::size_t i = 0; i < cClientCount; ++i)
+                        {
+                            _clients.emplace_back(new ClientMachine());
+                            _clients.back()->Timer.SetOffered(60);
+                            _clients.back()->Start();
+                        }
+
+                        // The initial wait expires on the wheel and finds the offer.
+                        for (const auto &client : _clients)
+                        {
+                            EXPECT_TRUE(waitUntil(
+                                [&client]()
+                                { return client->Machine.GetState() == helper::SdClientState::ServiceReady; }));
+                        }
+
+                        // The ready clients must not hold any wheel worker.
+                        auto _fired = std::make_shared<std::atomic_bool>(false);
+                        core::TimerWheel::Instance().Schedule(
+                            std::chrono::milliseconds(10),
+                            [_fired]()
+                            { *_fired = true; });
+                        EXPECT_TRUE(waitUntil([_fired]()
+                                              { return _fired->load(); }));
+
+                        // A release is handled by the notification itself.
+                        for (const auto &client : _clients)
+                        {
+                            client->Timer.SetRequested(false);
+                            EXPECT_EQ(client->Machine.GetState(), helper::SdClientState::ServiceSeen);
+                        }
+                    }
                 }
             }
         }
@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+#include "../../../../../src/ara/com/someip/sd/sd_engine.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                namespace
+                {
+                    using Clock = SdEngine::Clock;
+                    using Messages = std::vector<std::vector<std::uint8_t>>;
+
+                    SdEngineTiming MakeTiming()
+                    {
+                        SdEngineTiming _result;
+                        _result.InitialDelay = std::chrono::milliseconds{10};
+                        _result.RepetitionBaseDelay = std::chrono::milliseconds{30};
+                        _result.RepetitionMax = 2U;
+                        _result.CyclicOfferDelay = std::chrono::milliseconds{100};
+                        return _result;
+                    }
+
+                    SdServiceOffer MakeOffer(std::uint16_t serviceId, std::uint32_t ttl = 3U)
+                    {
+                        SdServiceOffer _result;
+                        _result.ServiceId = serviceId;
+                        _result.InstanceId = 1U;
+                        _result.MajorVersion = 1U;
+                        _result.MinorVersion = 0U;
+                        _result.Ttl = ttl;
+                        _result.Endpoint.Address = helper::Ipv4Address(10, 0, 0, 1);
+                        _result.Endpoint.Port = 30501U;
+                        return _result;
+                    }
+
+                    SdEngine::Transmitter Capture(Messages &messages)
+                    {
+                        return [&messages](const std::vector<std::uint8_t> &message)
+                        {
+                            messages.push_back(message);
+                        };
+                    }
+
+                    std::chrono::milliseconds Ms(int value)
+                    {
+                        return std::chrono::milliseconds{value};
+                    }
+                }
+
+                TEST(SdEngineTest, OffersOfManyServicesShareOneMessage)
+                {
+                    const std::size_t cServiceCount{80U};
+                    Messages _sent;
+                    SdEngine _engine{Capture(_sent), SdNetworkConfig{}, MakeTiming()};
+                    const auto cStart = Clock::now();
+
+                    for (std::size_t i = 0U; i < cServiceCount; ++i)
+                    {
+                        ASSERT_TRUE(_engine.OfferService(
+                            MakeOffer(static_cast<std::uint16_t>(0x1000U + i)), cStart));
+                    }
+                    EXPECT_FALSE(_engine.OfferService(MakeOffer(0x1000U), cStart));
+
+                    _engine.Process(cStart + Ms(10));
+                    ASSERT_EQ(_sent.size(), 1U);
+
+                    SdPackedMessage _parsed;
+                    ASSERT_TRUE(_parsed.Parse(_sent.front()));
+                    EXPECT_EQ(_parsed.Entries().size(), cServiceCount);
+                    EXPECT_EQ(_parsed.Options().size(), 1U);
+
+                    const auto cStatistics = _engine.GetStatistics();
+                    EXPECT_EQ(cStatistics.MessagesSent, 1U);
+                    EXPECT_EQ(cStatistics.EntriesSent, cServiceCount);
+                }
+
+                TEST(SdEngineTest, EntryLimitSplitsMessages)
+                {
+                    SdNetworkConfig _config;
+                    _config.MaxEntriesPerMessage = 4U;
+                    Messages _sent;
+                    SdEngine _engine{Capture(_sent), _config, MakeTiming()};
+                    const auto cStart = Clock::now();
+
+                    for (std::uint16_t i = 0U; i < 10U; ++i)
+                    {
+                        _engine.OfferService(MakeOffer(0x2000U + i), cStart);
+                    }
+                    _engine.Process(cStart + Ms(10));
+
+                    ASSERT_EQ(_sent.size(), 3U);
+                    SdPackedMessage _first;
+                    SdPackedMessage _last;
+                    ASSERT_TRUE(_first.Parse(_sent.front()));
+                    ASSERT_TRUE(_last.Parse(_sent.back()));
+                    EXPECT_EQ(_first.Entries().size(), 4U);
+                    EXPECT_EQ(_last.Entries().size(), 2U);
+                    EXPECT_EQ(_last.SessionId(), _first.SessionId() + 2U);
+                }
+
+                TEST(SdEngineTest, OversizeEntryIsCounted)
+                {
+                    // Room for one entry, but not for its endpoint option.
+                    const std::size_t cMaxMessageSize{
+                        SdMessagePacker::cHeaderSize + SdMessagePacker::cEntrySize};
+                    Messages _sent;
+                    SdEngine _engine{
+                        Capture(_sent), SdNetworkConfig{}, MakeTiming(), cMaxMessageSize};
+                    const auto cStart = Clock::now();
+
+                    ASSERT_TRUE(_engine.OfferService(MakeOffer(0x3000U), cStart));
+                    _engine.Process(cStart + Ms(10));
+
+                    EXPECT_TRUE(_sent.empty());
+                    const auto cStatistics = _engine.GetStatistics();
+                    EXPECT_EQ(cStatistics.EntriesDropped, 1U);
+                    EXPECT_EQ(cStatistics.EntriesSent, 0U);
+                }
+
+                TEST(SdEngineTest, OffersFollowPhaseSchedule)
+                {
+                    Messages _sent;
+                    SdEngine _engine{Capture(_sent), SdNetworkConfig{}, MakeTiming()};
+                    const auto cStart = Clock::now();
+                    _engine.OfferService(MakeOffer(0x3000U), cStart);
+                    EXPECT_EQ(_engine.NextDeadline(), cStart + Ms(10));
+
+                    // Initial wait, then repetitions after 30 ms and 60 ms.
+                    _engine.Process(cStart + Ms(9));
+                    EXPECT_EQ(_sent.size(), 0U);
+                    _engine.Process(cStart + Ms(10));
+                    EXPECT_EQ(_sent.size(), 1U);
+                    _engine.Process(cStart + Ms(39));
+                    EXPECT_EQ(_sent.size(), 1U);
+                    _engine.Process(cStart + Ms(40));
+                    EXPECT_EQ(_sent.size(), 2U);
+                    _engine.Process(cStart + Ms(100));
+                    EXPECT_EQ(_sent.size(), 3U);
+
+                    // Main phase: one cyclic offer per cycle.
+                    EXPECT_EQ(_engine.NextDeadline(), cStart + Ms(200));
+                    _engine.Process(cStart + Ms(199));
+                    EXPECT_EQ(_sent.size(), 3U);
+                    _engine.Process(cStart + Ms(200));
+                    EXPECT_EQ(_sent.size(), 4U);
+
+                    // Stop offer goes out with the next pass.
+                    EXPECT_TRUE(_engine.StopOfferService(0x3000U, 1U));
+                    EXPECT_FALSE(_engine.StopOfferService(0x3000U, 1U));
+                    _engine.Process(cStart + Ms(201));
+                    ASSERT_EQ(_sent.size(), 5U);
+                    SdPackedMessage _parsed;
+                    ASSERT_TRUE(_parsed.Parse(_sent.back()));
+                    ASSERT_EQ(_parsed.Entries().size(), 1U);
+                    EXPECT_EQ(_parsed.Entries()[0].Ttl, 0U);
+                    EXPECT_EQ(_engine.NextDeadline(), Clock::time_point::max());
+                }
+
+                TEST(SdEngineTest, FindAnsweredWithMatchingOffersOnly)
+                {
+                    Messages _sent;
+                    SdEngine _engine{Capture(_sent), SdNetworkConfig{}, MakeTiming()};
+                    const auto cStart = Clock::now();
+                    for (std::uint16_t i = 0U; i < 100U; ++i)
+                    {
+                        _engine.OfferService(MakeOffer(0x4000U + i), cStart);
+                    }
+                    _engine.Process(cStart + Ms(10));
+                    _sent.clear();
+
+                    SdMessagePacker _peer;
+                    _peer.AddServiceEntry(
+                        entry::EntryType::Finding, 0x4005U,
+                        entry::Entry::cAnyInstanceId, entry::Entry::cAnyMajorVersion,
+                        3U, 0xffffffffU, nullptr);
+                    _peer.AddServiceEntry(
+                        entry::EntryType::Finding, 0x4007U, 1U, 2U, 3U, 0U, nullptr);
+                    _peer.AddServiceEntry(
+                        entry::EntryType::Finding, 0x4009U, 1U, 1U, 3U, 0U, nullptr);
+                    std::vector<std::uint8_t> _find;
+                    _peer.Finish(_find);
+
+                    ASSERT_TRUE(_engine.OnMessage(_find, cStart + Ms(11)));
+                    ASSERT_EQ(_sent.size(), 1U);
+
+                    // 0x4007 asked for a different major version.
+                    SdPackedMessage _answer;
+                    ASSERT_TRUE(_answer.Parse(_sent.front()));
+                    ASSERT_EQ(_answer.Entries().size(), 2U);
+                    EXPECT_EQ(_answer.Entries()[0].ServiceId, 0x4005U);
+                    EXPECT_EQ(_answer.Entries()[1].ServiceId, 0x4009U);
+                }
+
+                TEST(SdEngineTest, RemoteOffersTrackedUntilExpiry)
+                {
+                    Messages _fromPeer;
+                    SdEngine _peer{Capture(_fromPeer), SdNetworkConfig{}, MakeTiming()};
+                    SdEngine _engine{nullptr, SdNetworkConfig{}, MakeTiming()};
+                    const auto cStart = Clock::now();
+
+                    int _appeared{0};
+                    int _disappeared{0};
+                    _engine.SetAvailabilityHandler(
+                        [&](const SdRemoteService &, bool available)
+                        {
+                            ++(available ? _appeared : _disappeared);
+                        });
+
+                    _peer.OfferService(MakeOffer(0x5000U, 2U), cStart);
+                    _peer.OfferService(MakeOffer(0x5001U, 5U), cStart);
+                    _peer.Process(cStart + Ms(10));
+                    ASSERT_EQ(_fromPeer.size(), 1U);
+                    ASSERT_TRUE(_engine.OnMessage(_fromPeer.front(), cStart + Ms(10)));
+                    // A renewal does not announce the service again.
+                    ASSERT_TRUE(_engine.OnMessage(_fromPeer.front(), cStart + Ms(20)));
+
+                    EXPECT_EQ(_appeared, 2);
+                    EXPECT_EQ(_engine.RemoteServiceCount(), 2U);
+                    SdRemoteService _remote;
+                    ASSERT_TRUE(_engine.TryGetRemoteService(
+                        0x5000U, entry::Entry::cAnyInstanceId, _remote));
+                    EXPECT_TRUE(_remote.HasEndpoint);
+                    EXPECT_EQ(_remote.Endpoint.Port, 30501U);
+                    EXPECT_FALSE(_engine.TryGetRemoteService(0x5002U, 1U, _remote));
+
+                    _engine.Process(cStart + std::chrono::seconds{2} + Ms(20));
+                    EXPECT_EQ(_disappeared, 1);
+                    EXPECT_EQ(_engine.RemoteServiceCount(), 1U);
+                    EXPECT_FALSE(_engine.TryGetRemoteService(0x5000U, 1U, _remote));
+                    EXPECT_TRUE(_engine.TryGetRemoteService(0x5001U, 1U, _remote));
+                }
+
+                TEST(SdEngineTest, FindStopsWhenSeenAndResumesWhenLost)
+                {
+                    Messages _sent;
+                    SdEngine _engine{Capture(_sent), SdNetworkConfig{}, MakeTiming()};
+                    const auto cStart = Clock::now();
+
+                    SdServiceFind _find;
+                    _find.ServiceId = 0x6000U;
+                    ASSERT_TRUE(_engine.FindService(_find, cStart));
+                    EXPECT_FALSE(_engine.FindService(_find, cStart));
+                    _engine.Process(cStart + Ms(10));
+                    ASSERT_EQ(_sent.size(), 1U);
+
+                    SdMessagePacker _peer;
+                    const SdServiceOffer cOffer{MakeOffer(0x6000U)};
+                    _peer.AddServiceEntry(
+                        entry::EntryType::Offering, cOffer.ServiceId, cOffer.InstanceId,
+                        cOffer.MajorVersion, cOffer.Ttl, cOffer.MinorVersion, &cOffer.Endpoint);
+                    std::vector<std::uint8_t> _offer;
+                    _peer.Finish(_offer);
+                    ASSERT_TRUE(_engine.OnMessage(_offer, cStart + Ms(20)));
+
+                    // The repetition due at 40 ms is no longer needed.
+                    _engine.Process(cStart + Ms(40));
+                    EXPECT_EQ(_sent.size(), 1U);
+
+                    _peer.Reset(2U, true);
+                    _peer.AddServiceEntry(
+                        entry::EntryType::Offering, cOffer.ServiceId, cOffer.InstanceId,
+                        cOffer.MajorVersion, 0U, cOffer.MinorVersion, nullptr);
+                    std::vector<std::uint8_t> _stopOffer;
+                    _peer.Finish(_stopOffer);
+                    ASSERT_TRUE(_engine.OnMessage(_stopOffer, cStart + Ms(50)));
+                    EXPECT_EQ(_engine.RemoteServiceCount(), 0U);
+
+                    _engine.Process(cStart + Ms(50));
+                    ASSERT_EQ(_sent.size(), 2U);
+                    SdPackedMessage _parsed;
+                    ASSERT_TRUE(_parsed.Parse(_sent.back()));
+                    ASSERT_EQ(_parsed.Entries().size(), 1U);
+                    EXPECT_EQ(_parsed.Entries()[0].Type, entry::EntryType::Finding);
+                }
+
+                TEST(SdEngineTest, MalformedMessageIgnored)
+                {
+                    SdEngine _engine{nullptr};
+                    const std::vector<std::uint8_t> cGarbage(40U, 0xAAU);
+
+                    EXPECT_FALSE(_engine.OnMessage(cGarbage));
+                    const auto cStatistics = _engine.GetStatistics();
+                    EXPECT_EQ(cStatistics.MessagesReceived, 1U);
+                    EXPECT_EQ(cStatistics.MalformedMessages, 1U);
+                    EXPECT_EQ(_engine.RemoteServiceCount(), 0U);
+                }
+            }
+        }
+    }
+}
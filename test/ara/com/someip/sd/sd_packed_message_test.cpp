@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "../../../../../src/ara/com/someip/sd/sd_packed_message.h"
+#include "../../../../../src/ara/com/someip/sd/someip_sd_message.h"
+#include "../../../../../src/ara/com/entry/service_entry.h"
+#include "../../../../../src/ara/com/option/ipv4_endpoint_option.h"
+
+namespace ara
+{
+    namespace com
+    {
+        namespace someip
+        {
+            namespace sd
+            {
+                namespace
+                {
+                    SdEndpoint MakeEndpoint(std::uint8_t host, std::uint16_t port)
+                    {
+                        SdEndpoint _result;
+                        _result.Address = helper::Ipv4Address(192, 168, 0, host);
+                        _result.Protocol = option::Layer4ProtocolType::Udp;
+                        _result.Port = port;
+                        return _result;
+                    }
+                }
+
+                TEST(SdPackedMessageTest, PackerSharesEndpointOption)
+                {
+                    const SdEndpoint cFirst{MakeEndpoint(1, 30501)};
+                    const SdEndpoint cSecond{MakeEndpoint(2, 30502)};
+
+                    SdMessagePacker _packer;
+                    EXPECT_TRUE(_packer.AddServiceEntry(
+                        entry::EntryType::Offering, 0x1001, 1, 1, 3, 0, &cFirst));
+                    EXPECT_TRUE(_packer.AddServiceEntry(
+                        entry::EntryType::Offering, 0x1002, 1, 1, 3, 0, &cFirst));
+                    EXPECT_TRUE(_packer.AddServiceEntry(
+                        entry::EntryType::Offering, 0x1003, 1, 1, 3, 0, &cSecond));
+
+                    EXPECT_EQ(_packer.EntryCount(), 3U);
+                    EXPECT_EQ(_packer.OptionCount(), 2U);
+                    EXPECT_EQ(
+                        _packer.Size(),
+                        SdMessagePacker::cHeaderSize +
+                            3U * SdMessagePacker::cEntrySize + 4U +
+                            2U * SdMessagePacker::cEndpointOptionSize);
+
+                    std::vector<std::uint8_t> _message;
+                    _packer.Finish(_message);
+                    ASSERT_EQ(_message.size(), _packer.Size());
+
+                    SdPackedMessage _parsed;
+                    ASSERT_TRUE(_parsed.Parse(_message));
+                    ASSERT_EQ(_parsed.Entries().size(), 3U);
+                    EXPECT_EQ(_parsed.Options().size(), 2U);
+                    EXPECT_TRUE(_parsed.Rebooted());
+
+                    SdEndpoint _endpoint;
+                    ASSERT_TRUE(_parsed.TryGetEndpoint(_parsed.Entries()[1], _endpoint));
+                    EXPECT_EQ(_endpoint, cFirst);
+                    ASSERT_TRUE(_parsed.TryGetEndpoint(_parsed.Entries()[2], _endpoint));
+                    EXPECT_EQ(_endpoint, cSecond);
+                    EXPECT_EQ(_parsed.Entries()[2].ServiceId, 0x1003);
+                    EXPECT_EQ(_parsed.Entries()[2].Ttl, 3U);
+                }
+
+                TEST(SdPackedMessageTest, ParsesLegacySerializedMessage)
+                {
+                    const helper::Ipv4Address cAddress(10, 0, 0, 7);
+                    const uint16_t cPort = 40000;
+
+                    auto _entry = entry::ServiceEntry::CreateOfferServiceEntry(
+                        0x1234, 0x0002, 0x03, 0x00000004);
+                    _entry->AddFirstOption(
+                        option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                            false, cAddress, option::Layer4ProtocolType::Tcp, cPort));
+                    SomeIpSdMessage _legacy;
+                    _legacy.AddEntry(std::move(_entry));
+                    _legacy.AddEntry(entry::ServiceEntry::CreateFindServiceEntry(0x5678));
+
+                    SdPackedMessage _parsed;
+                    ASSERT_TRUE(_parsed.Parse(_legacy.Payload()));
+                    ASSERT_EQ(_parsed.Entries().size(), 2U);
+
+                    const SdEntryRecord &cOffer{_parsed.Entries()[0]};
+                    EXPECT_EQ(cOffer.Type, entry::EntryType::Offering);
+                    EXPECT_EQ(cOffer.ServiceId, 0x1234);
+                    EXPECT_EQ(cOffer.InstanceId, 0x0002);
+                    EXPECT_EQ(cOffer.MajorVersion, 0x03);
+                    EXPECT_EQ(cOffer.MinorVersion, 0x00000004U);
+
+                    SdEndpoint _endpoint;
+                    ASSERT_TRUE(_parsed.TryGetEndpoint(cOffer, _endpoint));
+                    EXPECT_EQ(_endpoint.Address, cAddress);
+                    EXPECT_EQ(_endpoint.Protocol, option::Layer4ProtocolType::Tcp);
+                    EXPECT_EQ(_endpoint.Port, cPort);
+
+                    const SdEntryRecord &cFind{_parsed.Entries()[1]};
+                    EXPECT_EQ(cFind.Type, entry::EntryType::Finding);
+                    const uint16_t cAnyInstanceId{entry::Entry::cAnyInstanceId};
+                    EXPECT_EQ(cFind.InstanceId, cAnyInstanceId);
+                    EXPECT_FALSE(_parsed.TryGetEndpoint(cFind, _endpoint));
+                }
+
+                TEST(SdPackedMessageTest, MalformedMessagesRejected)
+                {
+                    const SdEndpoint cEndpoint{MakeEndpoint(1, 30501)};
+                    SdMessagePacker _packer;
+                    _packer.AddServiceEntry(
+                        entry::EntryType::Offering, 0x1001, 1, 1, 3, 0, &cEndpoint);
+                    std::vector<std::uint8_t> _message;
+                    _packer.Finish(_message);
+
+                    SdPackedMessage _parsed;
+                    auto _truncated = _message;
+                    _truncated.resize(_truncated.size() - 2U);
+                    EXPECT_FALSE(_parsed.Parse(_truncated));
+                    EXPECT_TRUE(_parsed.Entries().empty());
+
+                    // Point the entry at an option that does not exist.
+                    auto _badIndex = _message;
+                    _badIndex[SdMessagePacker::cHeaderSize + 1U] = 5U;
+                    EXPECT_FALSE(_parsed.Parse(_badIndex));
+
+                    auto _notSd = _message;
+                    _notSd[3] = 0x01U;
+                    EXPECT_FALSE(_parsed.Parse(_notSd));
+
+                    EXPECT_TRUE(_parsed.Parse(_message));
+                    EXPECT_EQ(_parsed.Entries().size(), 1U);
+                }
+
+                TEST(SdPackedMessageTest, PackerHonoursLimits)
+                {
+                    const SdEndpoint cEndpoint{MakeEndpoint(1, 30501)};
+
+                    SdMessagePacker _byEntries{SdMessagePacker::cDefaultMaxMessageSize, 2U};
+                    EXPECT_TRUE(_byEntries.AddServiceEntry(
+                        entry::EntryType::Finding, 1, 1, 1, 3, 0, nullptr));
+                    EXPECT_TRUE(_byEntries.AddServiceEntry(
+                        entry::EntryType::Finding, 2, 1, 1, 3, 0, nullptr));
+                    EXPECT_FALSE(_byEntries.AddServiceEntry(
+                        entry::EntryType::Finding, 3, 1, 1, 3, 0, nullptr));
+
+                    const std::size_t cRoom{
+                        SdMessagePacker::cHeaderSize + 4U +
+                        SdMessagePacker::cEndpointOptionSize +
+                        2U * SdMessagePacker::cEntrySize};
+                    SdMessagePacker _bySize{cRoom};
+                    EXPECT_TRUE(_bySize.AddServiceEntry(
+                        entry::EntryType::Offering, 1, 1, 1, 3, 0, &cEndpoint));
+                    EXPECT_TRUE(_bySize.AddServiceEntry(
+                        entry::EntryType::Offering, 2, 1, 1, 3, 0, &cEndpoint));
+                    EXPECT_FALSE(_bySize.AddServiceEntry(
+                        entry::EntryType::Offering, 3, 1, 1, 3, 0, &cEndpoint));
+                    EXPECT_EQ(_bySize.Size(), cRoom);
+
+                    _bySize.Reset(7U, false);
+                    EXPECT_EQ(_bySize.EntryCount(), 0U);
+                    EXPECT_EQ(_bySize.OptionCount(), 0U);
+                }
+            }
+        }
+    }
+}
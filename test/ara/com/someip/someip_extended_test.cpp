@@ -247,6 +247,100 @@ namespace ara_com_someip_extended_test
         EXPECT_TRUE(key1 < key3);
     }
 
+    TEST(TpReassemblyManagerTest, DuplicateSegmentRejected)
+    {
+        TpReassemblyManager mgr;
+        TpStreamKey key{0x00010001, 0x0001};
+        std::vector<uint8_t> data(16, 0x11);
+
+        EXPECT_TRUE(mgr.FeedSegment(key, 0, true, data));
+        EXPECT_FALSE(mgr.FeedSegment(key, 0, true, data));
+        EXPECT_FALSE(mgr.HasSegmentAt(key, 16));
+        EXPECT_EQ(mgr.GetStatistics().DuplicateSegments, 1U);
+    }
+
+    TEST(TpReassemblyManagerTest, OversizedStreamDropped)
+    {
+        TpReassemblyLimits limits;
+        limits.MaxStreamBytes = 32U;
+        TpReassemblyManager mgr{std::chrono::seconds{5}, limits};
+        TpStreamKey key{0x00010001, 0x0001};
+        std::vector<uint8_t> data(16, 0x22);
+
+        EXPECT_TRUE(mgr.FeedSegment(key, 0, true, data));
+        EXPECT_FALSE(mgr.FeedSegment(key, 32, true, data));
+        EXPECT_EQ(mgr.ActiveStreamCount(), 0U);
+        EXPECT_EQ(mgr.GetStatistics().OversizedStreams, 1U);
+        EXPECT_EQ(mgr.GetStatistics().BufferedBytes, 0U);
+    }
+
+    TEST(TpReassemblyManagerTest, StreamLimitEvictsOldest)
+    {
+        TpReassemblyLimits limits;
+        limits.MaxStreams = 2U;
+        TpReassemblyManager mgr{std::chrono::seconds{5}, limits};
+        std::vector<uint8_t> data(16, 0x33);
+
+        // The oldest stream goes, whichever shard it lives in.
+        EXPECT_TRUE(mgr.FeedSegment({0x00010001, 0x0001}, 0, true, data));
+        EXPECT_TRUE(mgr.FeedSegment({0x00010001, 0x0002}, 0, true, data));
+        EXPECT_TRUE(mgr.FeedSegment({0x00010001, 0x0003}, 0, true, data));
+
+        EXPECT_EQ(mgr.ActiveStreamCount(), 2U);
+        EXPECT_FALSE(mgr.HasSegmentAt({0x00010001, 0x0001}, 0));
+        EXPECT_TRUE(mgr.HasSegmentAt({0x00010001, 0x0002}, 0));
+        EXPECT_TRUE(mgr.HasSegmentAt({0x00010001, 0x0003}, 0));
+        EXPECT_EQ(mgr.GetStatistics().EvictedStreams, 1U);
+        EXPECT_EQ(mgr.GetStatistics().RejectedStreams, 0U);
+    }
+
+    TEST(TpReassemblyManagerTest, StreamWithoutRoomIsRejected)
+    {
+        TpReassemblyLimits limits;
+        limits.MaxTotalBytes = 8U;
+        TpReassemblyManager mgr{std::chrono::seconds{5}, limits};
+        std::vector<uint8_t> data(16, 0x34);
+
+        EXPECT_FALSE(mgr.FeedSegment({0x00010001, 0x0001}, 0, true, data));
+        EXPECT_EQ(mgr.ActiveStreamCount(), 0U);
+        EXPECT_EQ(mgr.GetStatistics().EvictedStreams, 0U);
+        EXPECT_EQ(mgr.GetStatistics().RejectedStreams, 1U);
+        EXPECT_EQ(mgr.GetStatistics().BufferedBytes, 0U);
+    }
+
+    TEST(TpReassemblyManagerTest, BufferedBytesTracked)
+    {
+        TpReassemblyManager mgr;
+        TpStreamKey key{0x00010001, 0x0001};
+        std::vector<uint8_t> data(64, 0x44);
+
+        mgr.FeedSegment(key, 0, true, data);
+        EXPECT_GE(mgr.GetStatistics().BufferedBytes, 64U);
+
+        mgr.FeedSegment(key, 64, false, data, [](const TpStreamKey &, std::vector<uint8_t>) {});
+        const auto statistics = mgr.GetStatistics();
+        EXPECT_EQ(statistics.BufferedBytes, 0U);
+        EXPECT_EQ(statistics.CompletedStreams, 1U);
+    }
+
+    TEST(TpReassemblyManagerTest, CallbackMayFeedManager)
+    {
+        TpReassemblyManager mgr;
+        TpStreamKey key{0x00010001, 0x0001};
+        std::vector<uint8_t> data(16, 0x55);
+        bool nestedAccepted = false;
+
+        mgr.FeedSegment(
+            key, 0, false, data,
+            [&](const TpStreamKey &k, std::vector<uint8_t>)
+            {
+                nestedAccepted = mgr.FeedSegment(k, 0, true, data);
+            });
+
+        EXPECT_TRUE(nestedAccepted);
+        EXPECT_EQ(mgr.ActiveStreamCount(), 1U);
+    }
+
     // ── Session Handler Tests ─────────────────────────────────
 
     TEST(SessionHandlerTest, ActiveModeDefault)
@@ -186,6 +186,59 @@ namespace ara
                 auto reassembled = reassembler.Reassemble();
                 EXPECT_EQ(reassembled, original);
             }
+
+            TEST(TpSegmentationTest, SegmentViewsPointIntoPayload)
+            {
+                std::vector<uint8_t> payload(3000, 0xCD);
+                auto views = SegmentPayloadViews(payload.data(), payload.size(), 1392);
+
+                ASSERT_EQ(views.size(), 3U);
+                EXPECT_EQ(views[0].Data, payload.data());
+                EXPECT_EQ(views[1].Data, payload.data() + 1392);
+                EXPECT_EQ(views[1].Offset, 1392U);
+                EXPECT_TRUE(views[1].MoreSegments);
+                EXPECT_EQ(views[2].Length, 216U);
+                EXPECT_FALSE(views[2].MoreSegments);
+
+                EXPECT_THROW(
+                    SegmentPayloadViews(payload.data(), payload.size(), 100),
+                    std::invalid_argument);
+            }
+
+            TEST(TpReassemblerExtendedTest, OutOfOrderSegmentsLandInPlace)
+            {
+                std::vector<uint8_t> original(100);
+                for (std::size_t i = 0; i < original.size(); ++i)
+                {
+                    original[i] = static_cast<uint8_t>(i);
+                }
+                auto views = SegmentPayloadViews(original.data(), original.size(), 32);
+                ASSERT_EQ(views.size(), 4U);
+
+                TpReassembler reassembler;
+                for (auto it = views.rbegin(); it != views.rend(); ++it)
+                {
+                    EXPECT_FALSE(reassembler.IsComplete());
+                    ASSERT_TRUE(reassembler.AddSegment(
+                        it->Offset, it->MoreSegments, it->Data, it->Length));
+                }
+                EXPECT_TRUE(reassembler.HasSegmentAt(64));
+                EXPECT_FALSE(reassembler.HasSegmentAt(16));
+                ASSERT_TRUE(reassembler.IsComplete());
+
+                EXPECT_EQ(reassembler.TakePayload(), original);
+                EXPECT_EQ(reassembler.SegmentCount(), 0U);
+            }
+
+            TEST(TpReassemblerExtendedTest, PayloadLimitRejectsSegment)
+            {
+                TpReassembler reassembler(std::chrono::seconds{5}, 32U);
+                std::vector<uint8_t> seg(16, 0xAA);
+
+                EXPECT_TRUE(reassembler.AddSegment(16, true, seg.data(), seg.size()));
+                EXPECT_FALSE(reassembler.AddSegment(32, false, seg.data(), seg.size()));
+                EXPECT_EQ(reassembler.SegmentCount(), 1U);
+            }
         }
     }
 }
@@ -19,6 +19,7 @@ namespace ara
             EXPECT_EQ(static_cast<uint8_t>(FilterType::kThreshold), 1U);
             EXPECT_EQ(static_cast<uint8_t>(FilterType::kRange), 2U);
             EXPECT_EQ(static_cast<uint8_t>(FilterType::kOneEveryN), 3U);
+            EXPECT_EQ(static_cast<uint8_t>(FilterType::kContent), 4U);
         }
 
         TEST(FilterConfigTest, NoneFactory)
@@ -42,6 +43,27 @@ namespace ara
             EXPECT_DOUBLE_EQ(cfg.RangeHigh, 100.0);
         }
 
+        TEST(FilterConfigTest, ContentFactory)
+        {
+            auto cfg = FilterConfig::Content(
+                8U, FilterFieldType::kInt16, -10.0, 10.0);
+            EXPECT_EQ(cfg.Type, FilterType::kContent);
+            EXPECT_EQ(cfg.FieldOffset, 8U);
+            EXPECT_EQ(cfg.FieldType, FilterFieldType::kInt16);
+            EXPECT_DOUBLE_EQ(cfg.RangeLow, -10.0);
+            EXPECT_DOUBLE_EQ(cfg.RangeHigh, 10.0);
+        }
+
+        TEST(FilterConfigTest, ContentThresholdFactory)
+        {
+            auto cfg = FilterConfig::ContentThreshold(
+                0U, FilterFieldType::kUInt8, 3.0);
+            EXPECT_EQ(cfg.Type, FilterType::kContent);
+            EXPECT_DOUBLE_EQ(cfg.ThresholdValue, 3.0);
+            EXPECT_DOUBLE_EQ(cfg.RangeLow, 3.0);
+            EXPECT_GT(cfg.RangeHigh, 1.0e300);
+        }
+
         TEST(FilterConfigTest, OneEveryNFactory)
         {
             auto cfg = FilterConfig::OneEveryN(5);
@@ -100,6 +100,18 @@ namespace ara
                 EXPECT_EQ(ExpectedInactiveBindingCode(), _result.Error().Value());
                 EXPECT_FALSE(_sample.IsValid());
             }
+
+            TEST(IceoryxZeroCopyTest, DataCallbackWithoutBindingIsRejected)
+            {
+                ZeroCopySubscriber _subscriber{{"", "", ""}};
+                bool _called{false};
+
+                EXPECT_FALSE(_subscriber.SetDataCallback([&_called]
+                                                         { _called = true; }));
+                _subscriber.UnsetDataCallback();
+                EXPECT_FALSE(_subscriber.WaitForData(std::chrono::milliseconds{1}));
+                EXPECT_FALSE(_called);
+            }
         }
     }
 }
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "../../../src/ara/core/executor.h"
+
+namespace ara
+{
+    namespace core
+    {
+        TEST(ExecutorTest, InlineExecutorRunsInCaller)
+        {
+            InlineExecutor _executor;
+            std::thread::id _runner;
+            _executor.Execute([&_runner]() { _runner = std::this_thread::get_id(); });
+            EXPECT_EQ(std::this_thread::get_id(), _runner);
+        }
+
+        TEST(ExecutorTest, ThreadPoolClampsSizes)
+        {
+            ThreadPoolExecutor _executor{0U, 0U};
+            EXPECT_EQ(1U, _executor.WorkerCount());
+            EXPECT_EQ(1U, _executor.QueueCapacity());
+        }
+
+        TEST(ExecutorTest, ThreadPoolRunsQueuedTasksBeforeShutdown)
+        {
+            std::atomic<int> _runs{0};
+            {
+                ThreadPoolExecutor _executor{2U, 64U};
+                for (int i = 0; i < 32; ++i)
+                {
+                    _executor.Execute([&_runs]() { _runs.fetch_add(1); });
+                }
+            }
+            EXPECT_EQ(32, _runs.load());
+        }
+
+        TEST(ExecutorTest, ThreadPoolRunsInCallerWhenQueueIsFull)
+        {
+            ThreadPoolExecutor _executor{1U, 1U};
+            std::mutex _gateMutex;
+            std::condition_variable _gate;
+            bool _open{false};
+            std::atomic<bool> _blocking{false};
+
+            // Occupy the only worker, then fill the only queue slot.
+            _executor.Execute(
+                [&]()
+                {
+                    _blocking.store(true);
+                    std::unique_lock<std::mutex> _lock(_gateMutex);
+                    _gate.wait(_lock, [&]() { return _open; });
+                });
+            while (!_blocking.load())
+            {
+                std::this_thread::yield();
+            }
+            _executor.Execute([]() {});
+
+            std::thread::id _runner;
+            _executor.Execute([&_runner]() { _runner = std::this_thread::get_id(); });
+            EXPECT_EQ(std::this_thread::get_id(), _runner);
+
+            {
+                std::lock_guard<std::mutex> _lock(_gateMutex);
+                _open = true;
+            }
+            _gate.notify_all();
+        }
+
+        TEST(ExecutorTest, DefaultExecutorIsShared)
+        {
+            EXPECT_EQ(&GetDefaultExecutor(), &GetDefaultExecutor());
+        }
+    }
+}
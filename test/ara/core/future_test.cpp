@@ -1,8 +1,12 @@
 #include <gtest/gtest.h>
 #include <chrono>
+#include <future>
+#include <memory>
 #include <stdexcept>
+#include <thread>
 #include "../../../src/ara/core/future.h"
 #include "../../../src/ara/core/promise.h"
+#include "../../../src/ara/core/executor.h"
 
 namespace ara
 {
@@ -175,5 +179,135 @@ namespace ara
             EXPECT_TRUE(_result.HasValue());
             EXPECT_EQ(7, _result.Value());
         }
+
+        TEST(FutureTest, ThenRunsInFulfillingThread)
+        {
+            Promise<int> _promise;
+            std::thread::id _continuationThread;
+            auto _nextFuture = _promise.get_future().then(
+                [&_continuationThread](Future<int> readyFuture)
+                {
+                    _continuationThread = std::this_thread::get_id();
+                    return readyFuture.GetResult().Value() + 1;
+                });
+
+            std::thread::id _setterThread;
+            std::thread _setter(
+                [&_promise, &_setterThread]()
+                {
+                    _setterThread = std::this_thread::get_id();
+                    _promise.set_value(1);
+                });
+            _setter.join();
+
+            // Already ran inline, so no wait is needed.
+            EXPECT_TRUE(_nextFuture.is_ready());
+            EXPECT_EQ(_setterThread, _continuationThread);
+            EXPECT_EQ(2, _nextFuture.GetResult().Value());
+        }
+
+        TEST(FutureTest, ThenOnReadyFutureRunsImmediately)
+        {
+            Promise<int> _promise;
+            Future<int> _future = _promise.get_future();
+            _promise.set_value(5);
+
+            auto _nextFuture = _future.then(
+                [](Future<int> readyFuture)
+                {
+                    return readyFuture.GetResult().Value() * 3;
+                });
+
+            EXPECT_FALSE(_future.valid());
+            ASSERT_TRUE(_nextFuture.is_ready());
+            EXPECT_EQ(15, _nextFuture.GetResult().Value());
+        }
+
+        TEST(FutureTest, ThenOnExecutorRunsOnWorker)
+        {
+            ThreadPoolExecutor _executor{1U, 4U};
+            Promise<int> _promise;
+            std::thread::id _continuationThread;
+            auto _nextFuture = _promise.get_future().then(
+                _executor,
+                [&_continuationThread](Future<int> readyFuture)
+                {
+                    _continuationThread = std::this_thread::get_id();
+                    return readyFuture.GetResult().Value();
+                });
+
+            _promise.set_value(9);
+
+            EXPECT_EQ(9, _nextFuture.GetResult().Value());
+            EXPECT_NE(std::this_thread::get_id(), _continuationThread);
+        }
+
+        TEST(FutureTest, ChainedContinuations)
+        {
+            Promise<int> _promise;
+            auto _lastFuture =
+                _promise.get_future()
+                    .then([](Future<int> f) { return f.GetResult().Value() + 1; })
+                    .then(GetDefaultExecutor(),
+                          [](Future<int> f) { return f.GetResult().Value() * 10; })
+                    .then([](Future<int> f) { (void)f.GetResult(); });
+
+            _promise.set_value(1);
+
+            EXPECT_TRUE(_lastFuture.GetResult().HasValue());
+        }
+
+        TEST(FutureTest, MoveOnlyContinuation)
+        {
+            Promise<int> _promise;
+            std::unique_ptr<int> _offset{new int{4}};
+            auto _nextFuture = _promise.get_future().then(
+                [_offset = std::move(_offset)](Future<int> f)
+                {
+                    return f.GetResult().Value() + *_offset;
+                });
+
+            _promise.set_value(3);
+            EXPECT_EQ(7, _nextFuture.GetResult().Value());
+        }
+
+        TEST(FutureTest, ContinuationExceptionPropagates)
+        {
+            Promise<int> _promise;
+            auto _nextFuture = _promise.get_future().then(
+                [](Future<int>) -> int
+                {
+                    throw std::runtime_error("continuation failed");
+                });
+
+            _promise.set_value(0);
+            EXPECT_THROW(_nextFuture.GetResult(), std::runtime_error);
+        }
+
+        TEST(FutureTest, BrokenPromise)
+        {
+            Future<int> _future;
+            {
+                Promise<int> _promise;
+                _future = _promise.get_future();
+            }
+
+            ASSERT_TRUE(_future.is_ready());
+            EXPECT_THROW(_future.GetResult(), std::future_error);
+        }
+
+        TEST(PromiseTest, SecondValueIsRejected)
+        {
+            Promise<void> _promise;
+            _promise.set_value();
+            EXPECT_THROW(_promise.set_value(), std::future_error);
+        }
+
+        TEST(PromiseTest, FutureIsRetrievedOnce)
+        {
+            Promise<int> _promise;
+            Future<int> _future = _promise.get_future();
+            EXPECT_THROW(_promise.get_future(), std::future_error);
+        }
     }
 }
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../../../src/ara/core/timer_wheel.h"
+
+namespace ara
+{
+    namespace core
+    {
+        namespace
+        {
+            bool WaitFor(const std::function<bool()> &condition)
+            {
+                const auto _timeout =
+                    std::chrono::steady_clock::now() + std::chrono::seconds{2};
+                while (!condition())
+                {
+                    if (std::chrono::steady_clock::now() >= _timeout)
+                    {
+                        return false;
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                }
+                return true;
+            }
+
+            class CountingExecutor final : public Executor
+            {
+            public:
+                std::atomic<int> Count{0};
+
+                void Execute(std::function<void()> task) override
+                {
+                    Count.fetch_add(1);
+                    task();
+                }
+            };
+        }
+
+        TEST(CoreTimerWheelTest, CascadesThroughLevels)
+        {
+            // Two slots per level: a 40 ms delay starts on the top level and
+            // has to cascade down to level 0 before it fires.
+            TimerWheel _wheel{std::chrono::milliseconds{1}, 2U};
+            const auto _start = std::chrono::steady_clock::now();
+            std::mutex _mutex;
+            std::vector<int> _order;
+            std::chrono::steady_clock::time_point _lastAt;
+            for (int _delay : {40, 3, 9})
+            {
+                _wheel.Schedule(
+                    std::chrono::milliseconds{_delay},
+                    [&, _delay]
+                    {
+                        std::lock_guard<std::mutex> _lock(_mutex);
+                        _order.push_back(_delay);
+                        _lastAt = std::chrono::steady_clock::now();
+                    });
+            }
+
+            ASSERT_TRUE(WaitFor([&] { return _wheel.PendingCount() == 0U; }));
+            std::lock_guard<std::mutex> _lock(_mutex);
+            EXPECT_EQ(_order, (std::vector<int>{3, 9, 40}));
+            EXPECT_GE(_lastAt - _start, std::chrono::milliseconds{40});
+        }
+
+        TEST(CoreTimerWheelTest, EarlierTimerWakesSleepingThread)
+        {
+            TimerWheel _wheel{std::chrono::milliseconds{1}, 8U};
+            std::atomic<bool> _late{false};
+            std::atomic<bool> _early{false};
+            _wheel.Schedule(std::chrono::seconds{1}, [&] { _late.store(true); });
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+
+            const auto _start = std::chrono::steady_clock::now();
+            _wheel.Schedule(std::chrono::milliseconds{5}, [&] { _early.store(true); });
+            ASSERT_TRUE(WaitFor([&] { return _early.load(); }));
+            EXPECT_LT(std::chrono::steady_clock::now() - _start, std::chrono::milliseconds{500});
+            EXPECT_FALSE(_late.load());
+            EXPECT_EQ(_wheel.PendingCount(), 1U);
+        }
+
+        TEST(CoreTimerWheelTest, DispatchesThroughExecutor)
+        {
+            CountingExecutor _executor;
+            std::atomic<int> _fired{0};
+            {
+                TimerWheel _wheel{std::chrono::milliseconds{1}, 16U, &_executor};
+                for (int i = 0; i < 100; ++i)
+                {
+                    _wheel.Schedule(
+                        std::chrono::milliseconds{1 + i % 20},
+                        [&_fired] { _fired.fetch_add(1); });
+                }
+                ASSERT_TRUE(WaitFor([&] { return _fired.load() == 100; }));
+            }
+            EXPECT_EQ(_executor.Count.load(), 100);
+        }
+
+        TEST(CoreTimerWheelTest, CancelAfterCascade)
+        {
+            TimerWheel _wheel{std::chrono::milliseconds{1}, 4U};
+            std::atomic<bool> _fired{false};
+            const auto _id = _wheel.Schedule(
+                std::chrono::milliseconds{60}, [&] { _fired.store(true); });
+
+            // Let the timer move down at least one level first.
+            std::this_thread::sleep_for(std::chrono::milliseconds{30});
+            EXPECT_TRUE(_wheel.Cancel(_id));
+            EXPECT_EQ(_wheel.PendingCount(), 0U);
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+            EXPECT_FALSE(_fired.load());
+        }
+
+        TEST(CoreTimerWheelTest, PeriodicTimerStopsCleanly)
+        {
+            TimerWheel _wheel{std::chrono::milliseconds{1}, 16U};
+            std::atomic<int> _ticks{0};
+            PeriodicTimer _timer{
+                _wheel, std::chrono::milliseconds{2}, [&_ticks] { _ticks.fetch_add(1); }};
+            EXPECT_FALSE(_timer.IsRunning());
+
+            _timer.Start();
+            ASSERT_TRUE(WaitFor([&] { return _ticks.load() >= 3; }));
+            _timer.Stop();
+            EXPECT_FALSE(_timer.IsRunning());
+
+            const int _stoppedAt{_ticks.load()};
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+            EXPECT_EQ(_ticks.load(), _stoppedAt);
+            EXPECT_EQ(_wheel.PendingCount(), 0U);
+        }
+
+        TEST(CoreTimerWheelTest, DeadlineTimerIgnoresStaleExpiry)
+        {
+            struct Owner
+            {
+                std::mutex Mutex;
+                DeadlineTimer Deadline;
+                int Expiries{0};
+
+                explicit Owner(TimerWheel &wheel) : Deadline{wheel}
+                {
+                }
+            };
+
+            TimerWheel _wheel{std::chrono::milliseconds{1}, 16U};
+            std::shared_ptr<Owner> _owner{std::make_shared<Owner>(_wheel)};
+            const std::shared_ptr<std::mutex> cMutex(_owner, &_owner->Mutex);
+            Owner *const cOwner{_owner.get()};
+
+            {
+                // The first deadline expires while the owner holds its mutex,
+                // so Cancel() comes too late to take it off the wheel.
+                std::unique_lock<std::mutex> _lock(_owner->Mutex);
+                EXPECT_TRUE(_owner->Deadline.Arm(
+                    std::chrono::milliseconds{1}, cMutex, [cOwner] { ++cOwner->Expiries; }));
+                EXPECT_FALSE(_owner->Deadline.Arm(
+                    std::chrono::milliseconds{1}, cMutex, [cOwner] { ++cOwner->Expiries; }));
+                ASSERT_TRUE(WaitFor([&] { return _wheel.PendingCount() == 0U; }));
+                _owner->Deadline.Cancel();
+                EXPECT_FALSE(_owner->Deadline.IsArmed());
+                EXPECT_TRUE(_owner->Deadline.Arm(
+                    std::chrono::milliseconds{30}, cMutex, [cOwner] { cOwner->Expiries += 10; }));
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            {
+                std::lock_guard<std::mutex> _lock(_owner->Mutex);
+                EXPECT_EQ(_owner->Expiries, 0);
+                EXPECT_TRUE(_owner->Deadline.IsArmed());
+            }
+
+            ASSERT_TRUE(WaitFor(
+                [&]
+                {
+                    std::lock_guard<std::mutex> _lock(_owner->Mutex);
+                    return _owner->Expiries != 0;
+                }));
+            std::lock_guard<std::mutex> _lock(_owner->Mutex);
+            EXPECT_EQ(_owner->Expiries, 10);
+            EXPECT_FALSE(_owner->Deadline.IsArmed());
+        }
+    }
+}
@@ -3,6 +3,7 @@
 #include <string>
 #include <thread>
 #include <condition_variable>
+#include <vector>
 #include "../../../src/ara/log/sink/async_log_sink.h"
 #include "../../../src/ara/log/sink/console_log_sink.h"
 #include "../../../src/ara/log/log_stream.h"
@@ -31,6 +32,58 @@ namespace ara
                 mutable std::atomic<int> mCount{0};
             };
 
+            class RecordingSink : public LogSink
+            {
+            public:
+                RecordingSink() : LogSink{"REC", "RecordingSink"}
+                {
+                }
+
+                void Log(const LogStream &logStream) const override
+                {
+                    std::lock_guard<std::mutex> lock{mMutex};
+                    mStreams.push_back(logStream);
+                }
+
+                mutable std::mutex mMutex;
+                mutable std::vector<LogStream> mStreams;
+            };
+
+            class NonVerboseRecordingSink : public LogSink
+            {
+            public:
+                struct Record
+                {
+                    std::string ContextId;
+                    LogLevel Level;
+                    std::uint32_t MessageId;
+                };
+
+                NonVerboseRecordingSink() : LogSink{"NVR", "NonVerboseRecordingSink"}
+                {
+                }
+
+                void Log(const LogStream &logStream) const override
+                {
+                    std::lock_guard<std::mutex> lock{mMutex};
+                    mVerboseCount++;
+                    (void)logStream;
+                }
+
+                void LogNonVerbose(
+                    const Logger &logger,
+                    LogLevel logLevel,
+                    const LogStream &logStream) const override
+                {
+                    std::lock_guard<std::mutex> lock{mMutex};
+                    mRecords.push_back({logger.GetContextId(), logLevel, logStream.MessageId()});
+                }
+
+                mutable std::mutex mMutex;
+                mutable int mVerboseCount{0};
+                mutable std::vector<Record> mRecords;
+            };
+
             class BlockingSink : public LogSink
             {
             public:
@@ -169,6 +222,114 @@ namespace ara
                 EXPECT_TRUE(_flushReturned.load());
                 EXPECT_EQ(_inner.mCount.load(), 1);
             }
+
+            TEST(AsyncLogSinkTest, ForwardsBinaryRecords)
+            {
+                RecordingSink _inner;
+                AsyncLogSink _async{&_inner, "TST", "Test", 64U};
+
+                LogStream _stream;
+                _stream << "value=" << static_cast<uint16_t>(42U) << LogLevel::kWarn;
+                _async.Log(_stream);
+                _async.Flush();
+
+                ASSERT_EQ(1U, _inner.mStreams.size());
+                const LogStream &cForwarded{_inner.mStreams.front()};
+                EXPECT_EQ(3U, cForwarded.ArgumentCount());
+                EXPECT_EQ(_stream.ByteSize(), cForwarded.ByteSize());
+                EXPECT_EQ("value=42Warning", cForwarded.ToString());
+            }
+
+            TEST(AsyncLogSinkTest, ConcurrentProducersLoseNothing)
+            {
+                const int cProducers{4};
+                const int cEntriesPerProducer{500};
+                CountingSink _inner;
+                AsyncLogSink _async{
+                    &_inner, "TST", "Test",
+                    static_cast<std::size_t>(cProducers * cEntriesPerProducer)};
+
+                std::vector<std::thread> _producers;
+                for (int p = 0; p < cProducers; ++p)
+                {
+                    _producers.emplace_back([&_async, p, cEntriesPerProducer] {
+                        for (int i = 0; i < cEntriesPerProducer; ++i)
+                        {
+                            LogStream _stream;
+                            _stream << static_cast<int32_t>(p) << ":" << static_cast<int32_t>(i);
+                            _async.Log(_stream);
+                        }
+                    });
+                }
+                for (auto &producer : _producers)
+                {
+                    producer.join();
+                }
+                _async.Flush();
+
+                const AsyncLogSinkStatistics cStatistics{_async.GetStatistics()};
+                EXPECT_EQ(cProducers * cEntriesPerProducer, _inner.mCount.load());
+                EXPECT_EQ(0U, cStatistics.Dropped);
+                EXPECT_EQ(cStatistics.Enqueued, cStatistics.Written);
+                EXPECT_GT(cStatistics.Batches, 0U);
+                EXPECT_LE(cStatistics.Batches, cStatistics.Written);
+                EXPECT_GT(cStatistics.HighWatermark, 0U);
+            }
+
+            TEST(AsyncLogSinkTest, StatisticsCountDrops)
+            {
+                BlockingSink _inner;
+                AsyncLogSink _async{&_inner, "TST", "Test", 2U};
+
+                LogStream _stream;
+                _stream << "entry";
+                _async.Log(_stream);
+                _inner.WaitUntilEntered();
+
+                // The flush thread holds the first entry; two more fit.
+                for (int i = 0; i < 5; ++i)
+                {
+                    _async.Log(_stream);
+                }
+
+                AsyncLogSinkStatistics _statistics{_async.GetStatistics()};
+                EXPECT_EQ(3U, _statistics.Enqueued);
+                EXPECT_EQ(3U, _statistics.Dropped);
+                EXPECT_EQ(3U, _async.GetPendingCount());
+
+                _inner.Release();
+                _async.Flush();
+
+                _statistics = _async.GetStatistics();
+                EXPECT_EQ(3U, _statistics.Written);
+                EXPECT_EQ(0U, _async.GetPendingCount());
+            }
+
+            TEST(AsyncLogSinkTest, ForwardsNonVerboseEntries)
+            {
+                NonVerboseRecordingSink _inner;
+                const Logger cLogger = Logger::CreateLogger(
+                    "CTX1", "Context", LogLevel::kInfo, LogMessageMode::kNonVerbose);
+                {
+                    AsyncLogSink _async{&_inner, "TST", "Test"};
+
+                    LogStream _message;
+                    _message.WithMessage(0x1234U, "value={u8}") << static_cast<uint8_t>(7U);
+                    _async.LogNonVerbose(cLogger, LogLevel::kWarn, _message);
+
+                    LogStream _verbose;
+                    _verbose << "verbose";
+                    _async.Log(_verbose);
+                    _async.Flush();
+                }
+
+                std::lock_guard<std::mutex> lock{_inner.mMutex};
+                ASSERT_EQ(1U, _inner.mRecords.size());
+                EXPECT_EQ("CTX1", _inner.mRecords[0].ContextId);
+                EXPECT_EQ(LogLevel::kWarn, _inner.mRecords[0].Level);
+                EXPECT_EQ(0x1234U, _inner.mRecords[0].MessageId);
+                EXPECT_EQ(1, _inner.mVerboseCount);
+            }
         }
     }
 }
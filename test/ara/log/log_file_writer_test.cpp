@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../../src/ara/log/sink/file_log_sink.h"
+#include "../../../src/ara/log/sink/log_file_writer.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace sink
+        {
+            static const std::string cWriterTestFilePath{"/tmp/ara_log_test_writer.log"};
+
+            class LogFileWriterTest : public ::testing::Test
+            {
+            protected:
+                void SetUp() override
+                {
+                    removeFiles();
+                }
+
+                void TearDown() override
+                {
+                    removeFiles();
+                }
+
+                static void removeFiles()
+                {
+                    std::remove(cWriterTestFilePath.c_str());
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        std::remove((cWriterTestFilePath + "." + std::to_string(i)).c_str());
+                    }
+                }
+
+                static std::string readFile(const std::string &path)
+                {
+                    std::ifstream _stream(path, std::ios::binary);
+                    return std::string(
+                        std::istreambuf_iterator<char>(_stream),
+                        std::istreambuf_iterator<char>());
+                }
+            };
+
+            TEST_F(LogFileWriterTest, BuffersUntilFlush)
+            {
+                LogFileWriterOptions _options;
+                _options.MaxDelay = std::chrono::milliseconds::zero();
+                LogFileWriter _writer{cWriterTestFilePath, _options};
+                ASSERT_TRUE(_writer.IsOpen());
+
+                const std::string cRecord{"first record\n"};
+                _writer.Write(cRecord.data(), cRecord.size());
+                _writer.Write(cRecord.data(), cRecord.size());
+                EXPECT_TRUE(readFile(cWriterTestFilePath).empty());
+                EXPECT_EQ(2U * cRecord.size(), _writer.FileSize());
+
+                _writer.Flush();
+                EXPECT_EQ(cRecord + cRecord, readFile(cWriterTestFilePath));
+
+                const LogFileWriterStatistics cStatistics{_writer.GetStatistics()};
+                EXPECT_EQ(2U, cStatistics.Records);
+                EXPECT_EQ(2U * cRecord.size(), cStatistics.Bytes);
+                EXPECT_EQ(1U, cStatistics.Writes);
+                EXPECT_EQ(0U, cStatistics.Errors);
+            }
+
+            TEST_F(LogFileWriterTest, WritesFullBlocksInOneCall)
+            {
+                LogFileWriterOptions _options;
+                _options.BlockSize = 4096U;
+                _options.BlockCount = 2U;
+                _options.MaxDelay = std::chrono::milliseconds::zero();
+                LogFileWriter _writer{cWriterTestFilePath, _options};
+
+                // Records cross the block boundary and fill both blocks.
+                const std::vector<char> cRecord(1000U, 'x');
+                std::string _expected;
+                for (int i = 0; i < 9; ++i)
+                {
+                    _writer.Write(cRecord.data(), cRecord.size());
+                    _expected.append(cRecord.begin(), cRecord.end());
+                }
+
+                EXPECT_EQ(8000U, readFile(cWriterTestFilePath).size());
+                EXPECT_EQ(1U, _writer.GetStatistics().Writes);
+
+                _writer.Flush();
+                EXPECT_EQ(_expected, readFile(cWriterTestFilePath));
+            }
+
+            TEST_F(LogFileWriterTest, FlushesAfterMaxDelay)
+            {
+                LogFileWriterOptions _options;
+                _options.MaxDelay = std::chrono::milliseconds{20};
+                LogFileWriter _writer{cWriterTestFilePath, _options};
+
+                const std::string cRecord{"delayed\n"};
+                _writer.Write(cRecord.data(), cRecord.size());
+
+                const auto cDeadline =
+                    std::chrono::steady_clock::now() + std::chrono::seconds{2};
+                while (readFile(cWriterTestFilePath).empty() &&
+                       std::chrono::steady_clock::now() < cDeadline)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{5});
+                }
+                EXPECT_EQ(cRecord, readFile(cWriterTestFilePath));
+            }
+
+            TEST_F(LogFileWriterTest, RotatesOnTrackedSize)
+            {
+                LogFileWriterOptions _options;
+                _options.MaxDelay = std::chrono::milliseconds::zero();
+                _options.MaxFileSize = 25U;
+                _options.MaxRotatedFiles = 2U;
+                LogFileWriter _writer{cWriterTestFilePath, _options};
+
+                // Two 10-byte records fit a file, the third starts a new one.
+                const std::string cRecords[]{
+                    "record-00\n", "record-01\n", "record-02\n",
+                    "record-03\n", "record-04\n", "record-05\n"};
+                for (const std::string &record : cRecords)
+                {
+                    _writer.Write(record.data(), record.size());
+                }
+                _writer.Flush();
+
+                EXPECT_EQ("record-04\nrecord-05\n", readFile(cWriterTestFilePath));
+                EXPECT_EQ("record-02\nrecord-03\n", readFile(cWriterTestFilePath + ".0"));
+                EXPECT_EQ("record-00\nrecord-01\n", readFile(cWriterTestFilePath + ".1"));
+                EXPECT_TRUE(readFile(cWriterTestFilePath + ".2").empty());
+                EXPECT_EQ(2U, _writer.GetStatistics().Rotations);
+            }
+
+            TEST_F(LogFileWriterTest, AppendsToExistingFile)
+            {
+                {
+                    std::ofstream _stream(cWriterTestFilePath, std::ios::binary);
+                    _stream << "0123456789";
+                }
+
+                LogFileWriterOptions _options;
+                _options.MaxDelay = std::chrono::milliseconds::zero();
+                _options.MaxFileSize = 15U;
+                LogFileWriter _writer{cWriterTestFilePath, _options};
+                EXPECT_EQ(10U, _writer.FileSize());
+
+                const std::string cRecord{"abcdefgh"};
+                _writer.Write(cRecord.data(), cRecord.size());
+                _writer.Flush();
+
+                EXPECT_EQ("0123456789", readFile(cWriterTestFilePath + ".0"));
+                EXPECT_EQ(cRecord, readFile(cWriterTestFilePath));
+            }
+
+            TEST_F(LogFileWriterTest, SyncsOnFlushPolicy)
+            {
+                LogFileWriterOptions _options;
+                _options.MaxDelay = std::chrono::milliseconds::zero();
+                _options.SyncPolicy = LogFileSyncPolicy::kOnFlush;
+                LogFileWriter _writer{cWriterTestFilePath, _options};
+
+                const std::string cRecord{"synced\n"};
+                _writer.Write(cRecord.data(), cRecord.size());
+                _writer.Flush();
+                EXPECT_EQ(1U, _writer.GetStatistics().Syncs);
+            }
+
+            TEST_F(LogFileWriterTest, FileLogSinkWritesLines)
+            {
+                {
+                    FileLogSink _sink{"APP", "Test", cWriterTestFilePath};
+                    LogStream _stream;
+                    _stream << "value=" << 42;
+                    _sink.Log(_stream);
+                    _sink.Log(_stream);
+                }
+
+                const std::string cContent{readFile(cWriterTestFilePath)};
+                const std::size_t cFirstLine{cContent.find("APP Test value=42\n")};
+                ASSERT_NE(std::string::npos, cFirstLine);
+                EXPECT_NE(std::string::npos, cContent.find("APP Test value=42\n", cFirstLine + 1U));
+            }
+        }
+    }
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <cstring>
 #include "../../../src/ara/log/log_stream.h"
 
 namespace ara
@@ -55,5 +56,94 @@ namespace ara
 
             EXPECT_EQ(cExpectedResult, _actualResult);
         }
+
+        TEST(LogStreamTest, IntegerAndFloatFormatting)
+        {
+            LogStream _logStream;
+            _logStream << static_cast<int8_t>(-8) << " "
+                       << static_cast<int64_t>(-9000000000LL) << " "
+                       << static_cast<uint64_t>(18446744073709551615ULL) << " "
+                       << 1.5f << " " << 2.25;
+
+            const std::string cExpectedResult =
+                "-8 -9000000000 18446744073709551615 1.500000 2.250000";
+            std::string _actualResult = _logStream.ToString();
+
+            EXPECT_EQ(cExpectedResult, _actualResult);
+        }
+
+        TEST(LogStreamTest, TypedArguments)
+        {
+            const uint16_t cValue = 0x1234;
+            LogStream _logStream;
+            _logStream << "id" << cValue << LogLevel::kWarn;
+
+            EXPECT_EQ(3U, _logStream.ArgumentCount());
+
+            std::vector<LogArgumentType> _types;
+            uint16_t _value = 0;
+            _logStream.ForEachArgument(
+                [&_types, &_value](const LogArgument &argument)
+                {
+                    _types.push_back(argument.Type);
+                    if (argument.Type == LogArgumentType::kUInt16)
+                    {
+                        ASSERT_EQ(sizeof(_value), argument.Size);
+                        std::memcpy(&_value, argument.Data, sizeof(_value));
+                    }
+                });
+
+            const std::vector<LogArgumentType> cExpectedTypes{
+                LogArgumentType::kString,
+                LogArgumentType::kUInt16,
+                LogArgumentType::kLogLevel};
+            EXPECT_EQ(cExpectedTypes, _types);
+            EXPECT_EQ(cValue, _value);
+        }
+
+        TEST(LogStreamTest, OverflowBeyondInlineCapacity)
+        {
+            const std::string cLongString(LogStream::cInlineCapacity * 3U, 'x');
+            LogStream _logStream;
+            _logStream << "head:" << cLongString << static_cast<int32_t>(42);
+
+            EXPECT_GT(_logStream.ByteSize(), LogStream::cInlineCapacity);
+            EXPECT_EQ("head:" + cLongString + "42", _logStream.ToString());
+
+            LogStream _copy{_logStream};
+            EXPECT_EQ(_logStream.ToString(), _copy.ToString());
+
+            _logStream.Flush();
+            _logStream << "short";
+            EXPECT_EQ("short", _logStream.ToString());
+        }
+
+        TEST(LogStreamTest, LongStringLeavesRoomForTerminator)
+        {
+            // DLT stores a string with its terminator in a 16-bit length.
+            const std::string cLongString(0xFFFFU, 's');
+            LogStream _logStream;
+            _logStream << cLongString;
+
+            std::vector<std::size_t> _sizes;
+            _logStream.ForEachArgument(
+                [&_sizes](const LogArgument &argument)
+                {
+                    EXPECT_EQ(LogArgumentType::kString, argument.Type);
+                    _sizes.push_back(argument.Size);
+                });
+            EXPECT_EQ((std::vector<std::size_t>{0xFFFEU, 1U}), _sizes);
+            EXPECT_EQ(cLongString, _logStream.ToString());
+        }
+
+        TEST(LogStreamTest, SelfConcatenation)
+        {
+            LogStream _logStream;
+            _logStream << "ab";
+            _logStream << _logStream;
+
+            EXPECT_EQ("abab", _logStream.ToString());
+            EXPECT_EQ(2U, _logStream.ArgumentCount());
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "../../../src/ara/log/message_id.h"
+#include "../../../src/ara/log/sink/dlt_log_sink.h"
+#include "../../../src/ara/log/sink/log_sink.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace
+        {
+            class RecordingSink : public sink::LogSink
+            {
+            public:
+                mutable std::vector<std::string> Records;
+
+                RecordingSink() : LogSink("APP01", "")
+                {
+                }
+
+                void Log(const LogStream &logStream) const override
+                {
+                    Records.push_back(logStream.ToString());
+                }
+            };
+        }
+
+        TEST(MessageIdTest, HashMatchesCatalogGenerator)
+        {
+            // Same value as tools/log_catalog/generate_log_catalog.py computes.
+            const std::uint32_t cExpectedId{0xA0B61940U};
+            static_assert(
+                HashLogSite("speed={u32}", "some/dir/file.cpp", 42U) != 0U,
+                "The hash must be a constant expression.");
+
+            EXPECT_EQ(cExpectedId, HashLogSite("speed={u32}", "some/dir/file.cpp", 42U));
+            EXPECT_EQ(cExpectedId, HashLogSite("speed={u32}", "file.cpp", 42U));
+            EXPECT_NE(cExpectedId, HashLogSite("speed={u32}", "file.cpp", 43U));
+        }
+
+        TEST(MessageIdTest, MessageStream)
+        {
+            const std::uint32_t cLine{__LINE__ + 1U};
+            LogStream _logStream = ARA_LOG_MESSAGE("speed={u32} unit={str}");
+            _logStream << static_cast<uint32_t>(87U) << "km/h";
+
+            const std::uint32_t cExpectedId{
+                HashLogSite("speed={u32} unit={str}", __FILE__, cLine)};
+            EXPECT_EQ(cExpectedId, _logStream.MessageId());
+            EXPECT_EQ(3U, _logStream.ArgumentCount());
+            EXPECT_EQ("speed=87 unit=km/h", _logStream.ToString());
+        }
+
+        TEST(MessageIdTest, PlaceholderMismatch)
+        {
+            LogStream _missing = ARA_LOG_MESSAGE("a={u8} b={u8}");
+            _missing << static_cast<uint8_t>(1U);
+            EXPECT_EQ("a=1 b={u8}", _missing.ToString());
+
+            LogStream _extra = ARA_LOG_MESSAGE("a={u8};");
+            _extra << static_cast<uint8_t>(1U) << static_cast<uint8_t>(2U);
+            EXPECT_EQ("a=1;2", _extra.ToString());
+        }
+
+        TEST(MessageIdTest, ConcatenationKeepsMessage)
+        {
+            LogStream _message = ARA_LOG_MESSAGE("value={i32}");
+            _message << static_cast<int32_t>(-5);
+
+            LogStream _record;
+            _record << "prefix;" << _message;
+
+            EXPECT_EQ(_message.MessageId(), _record.MessageId());
+            EXPECT_EQ("prefix;value=-5", _record.ToString());
+
+            _record.Flush();
+            EXPECT_EQ(0U, _record.MessageId());
+        }
+
+        TEST(MessageIdTest, LoggerMessageMode)
+        {
+            Logger _logger =
+                Logger::CreateLogger("CTX01", "Test Context", LogLevel::kInfo);
+            EXPECT_EQ(LogMessageMode::kVerbose, _logger.GetMessageMode());
+
+            _logger.SetMessageMode(LogMessageMode::kNonVerbose);
+            EXPECT_EQ(LogMessageMode::kNonVerbose, _logger.GetMessageMode());
+        }
+
+        TEST(MessageIdTest, DefaultNonVerboseFallback)
+        {
+            const Logger cLogger = Logger::CreateLogger(
+                "CTX01", "Test Context", LogLevel::kInfo, LogMessageMode::kNonVerbose);
+            RecordingSink _sink;
+
+            LogStream _message = ARA_LOG_MESSAGE("count={u16}");
+            _message << static_cast<uint16_t>(3U);
+            _sink.LogNonVerbose(cLogger, LogLevel::kInfo, _message);
+
+            ASSERT_EQ(1U, _sink.Records.size());
+            EXPECT_EQ(
+                "Context ID:CTX01;Context Description:Test Context;Log Level:Info;count=3",
+                _sink.Records.front());
+        }
+
+        TEST(MessageIdTest, DltSinkSendsMismatchVerbose)
+        {
+            const int cSocket{::socket(AF_INET, SOCK_DGRAM, 0)};
+            sockaddr_in _address{};
+            _address.sin_family = AF_INET;
+            _address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t _size{sizeof(_address)};
+            ASSERT_EQ(0, ::bind(cSocket, reinterpret_cast<sockaddr *>(&_address), _size));
+            ::getsockname(cSocket, reinterpret_cast<sockaddr *>(&_address), &_size);
+
+            const Logger cLogger = Logger::CreateLogger(
+                "CTX01", "Test Context", LogLevel::kInfo, LogMessageMode::kNonVerbose);
+            {
+                sink::DltLogSink _sink{
+                    "APP01", "Test App", "ECU1", "127.0.0.1", ntohs(_address.sin_port)};
+
+                LogStream _matching = ARA_LOG_MESSAGE("count={u16}");
+                _matching << static_cast<uint16_t>(3U);
+                _sink.LogNonVerbose(cLogger, LogLevel::kWarn, _matching);
+
+                // A signed value for an unsigned placeholder
+                LogStream _mismatch = ARA_LOG_MESSAGE("count={u16}");
+                _mismatch << static_cast<int16_t>(-3);
+                _sink.LogNonVerbose(cLogger, LogLevel::kWarn, _mismatch);
+
+                // A placeholder without a value
+                LogStream _missing = ARA_LOG_MESSAGE("a={u8} b={u8}");
+                _missing << static_cast<uint8_t>(1U);
+                _sink.LogNonVerbose(cLogger, LogLevel::kWarn, _missing);
+            }
+
+            // MSIN follows the 16-byte storage and the 12-byte standard header.
+            const std::size_t cMsinOffset{28U};
+            std::vector<bool> _verbose;
+            std::uint8_t _buffer[256];
+            pollfd _pollFd{cSocket, POLLIN, 0};
+            while (_verbose.size() < 3U && ::poll(&_pollFd, 1U, 1000) == 1)
+            {
+                const ssize_t cReceived{::recv(cSocket, _buffer, sizeof(_buffer), 0)};
+                ASSERT_GT(cReceived, static_cast<ssize_t>(cMsinOffset));
+                _verbose.push_back((_buffer[cMsinOffset] & 0x01U) != 0U);
+                EXPECT_EQ(static_cast<std::uint8_t>(LogLevel::kWarn), _buffer[cMsinOffset] >> 4U);
+            }
+            ::close(cSocket);
+
+            EXPECT_EQ((std::vector<bool>{false, true, true}), _verbose);
+        }
+    }
+}
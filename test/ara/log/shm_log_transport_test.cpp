@@ -0,0 +1,308 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dirent.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "../../../src/ara/log/sink/shm_log_transport.h"
+
+namespace ara
+{
+    namespace log
+    {
+        namespace sink
+        {
+            static const std::string cShmTestSocketPath{"/tmp/ara_log_test_shm.sock"};
+
+            class ShmLogTransportTest : public ::testing::Test
+            {
+            protected:
+                std::vector<std::string> Messages;
+
+                void TearDown() override
+                {
+                    std::remove(cShmTestSocketPath.c_str());
+                }
+
+                ShmLogCollector::Handler recorder()
+                {
+                    return [this](const std::uint8_t *data, std::size_t size)
+                    {
+                        Messages.emplace_back(reinterpret_cast<const char *>(data), size);
+                    };
+                }
+
+                static bool send(ShmLogTransport &transport, const std::string &message)
+                {
+                    return transport.Send(
+                        reinterpret_cast<const std::uint8_t *>(message.data()), message.size());
+                }
+
+                static std::size_t openFdCount()
+                {
+                    std::size_t _count{0U};
+                    DIR *_directory{::opendir("/proc/self/fd")};
+                    if (_directory != nullptr)
+                    {
+                        while (::readdir(_directory) != nullptr)
+                        {
+                            ++_count;
+                        }
+                        ::closedir(_directory);
+                    }
+                    return _count;
+                }
+
+                // The daemon loop: register pending applications while the
+                // transport waits for its acknowledgement.
+                static std::unique_ptr<ShmLogTransport> connect(
+                    ShmLogCollector &collector,
+                    const std::string &appId,
+                    std::size_t capacity = ShmLogTransport::cDefaultCapacity)
+                {
+                    std::atomic_bool _done{false};
+                    std::thread _daemon{[&collector, &_done]
+                                        {
+                                            while (!_done)
+                                            {
+                                                collector.Poll([](const std::uint8_t *, std::size_t) {});
+                                                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                                            }
+                                        }};
+                    std::unique_ptr<ShmLogTransport> _transport{
+                        new ShmLogTransport(appId, cShmTestSocketPath, capacity)};
+                    _done = true;
+                    _daemon.join();
+                    return _transport;
+                }
+            };
+
+            TEST_F(ShmLogTransportTest, FallsBackWithoutDaemon)
+            {
+                std::remove(cShmTestSocketPath.c_str());
+                ShmLogTransport _transport{"APP", cShmTestSocketPath};
+
+                EXPECT_FALSE(_transport.IsConnected());
+                EXPECT_FALSE(send(_transport, "udp instead"));
+                EXPECT_EQ(0U, _transport.GetStatistics().Sent);
+                EXPECT_EQ(1U, _transport.GetStatistics().Unregistered);
+            }
+
+            TEST_F(ShmLogTransportTest, SendDoesNotWaitForRegistration)
+            {
+                std::remove(cShmTestSocketPath.c_str());
+                ShmLogTransport _transport{"LATE", cShmTestSocketPath};
+                ASSERT_FALSE(_transport.IsConnected());
+
+                // The daemon comes up but does not acknowledge yet.
+                ShmLogCollector _collector{cShmTestSocketPath};
+                ASSERT_TRUE(_collector.IsListening());
+                std::this_thread::sleep_for(
+                    ShmLogTransport::cReconnectPeriod + std::chrono::milliseconds{5});
+
+                const auto cStart = std::chrono::steady_clock::now();
+                EXPECT_FALSE(send(_transport, "udp instead"));
+                EXPECT_LT(
+                    std::chrono::steady_clock::now() - cStart,
+                    ShmLogTransport::cRegistrationTimeout / 5);
+                EXPECT_FALSE(_transport.IsConnected());
+
+                // The acknowledgement is picked up by a later Send().
+                bool _sent{false};
+                for (int i = 0; i < 100 && !_sent; ++i)
+                {
+                    _collector.Poll(recorder());
+                    _sent = send(_transport, "shm");
+                    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                }
+                EXPECT_TRUE(_sent);
+                EXPECT_TRUE(_transport.IsConnected());
+                EXPECT_EQ(1U, _transport.GetStatistics().Registrations);
+                EXPECT_LE(2U, _transport.GetStatistics().Unregistered);
+                _collector.Poll(recorder());
+                ASSERT_EQ(1U, Messages.size());
+                EXPECT_EQ("shm", Messages[0]);
+            }
+
+            TEST_F(ShmLogTransportTest, DeliversMessagesInOrder)
+            {
+                ShmLogCollector _collector{cShmTestSocketPath};
+                ASSERT_TRUE(_collector.IsListening());
+                auto _transport = connect(_collector, "APP");
+                ASSERT_TRUE(_transport->IsConnected());
+                EXPECT_EQ(1U, _collector.ClientCount());
+
+                const std::vector<std::string> cSent{"first", "second", std::string(3000U, 'x')};
+                for (const std::string &message : cSent)
+                {
+                    EXPECT_TRUE(send(*_transport, message));
+                }
+                EXPECT_EQ(3U, _collector.Poll(recorder()));
+                EXPECT_EQ(cSent, Messages);
+
+                const std::vector<ShmLogAppStatistics> cApps{_collector.GetAppStatistics()};
+                ASSERT_EQ(1U, cApps.size());
+                EXPECT_EQ("APP", cApps[0].AppId);
+                EXPECT_EQ(static_cast<std::int32_t>(::getpid()), cApps[0].Pid);
+                EXPECT_EQ(3U, cApps[0].Received);
+            }
+
+            TEST_F(ShmLogTransportTest, WrapsAroundTheRing)
+            {
+                ShmLogCollector _collector{cShmTestSocketPath};
+                auto _transport = connect(_collector, "WRAP", 4096U);
+                ASSERT_TRUE(_transport->IsConnected());
+
+                // 1000-byte records leave an unusable gap at the ring end.
+                std::size_t _sent{0U};
+                for (int round = 0; round < 10; ++round)
+                {
+                    for (int i = 0; i < 3; ++i)
+                    {
+                        const std::string cMessage(1000U, static_cast<char>('a' + _sent % 26U));
+                        EXPECT_TRUE(send(*_transport, cMessage));
+                        ++_sent;
+                    }
+                    _collector.Poll(recorder());
+                }
+
+                ASSERT_EQ(_sent, Messages.size());
+                for (std::size_t i = 0U; i < _sent; ++i)
+                {
+                    EXPECT_EQ(std::string(1000U, static_cast<char>('a' + i % 26U)), Messages[i]);
+                }
+                EXPECT_EQ(0U, _transport->GetStatistics().Dropped);
+            }
+
+            TEST_F(ShmLogTransportTest, CountsDropsPerApplication)
+            {
+                ShmLogCollector _collector{cShmTestSocketPath};
+                auto _transport = connect(_collector, "DROP", 4096U);
+                ASSERT_TRUE(_transport->IsConnected());
+
+                const std::string cMessage(1000U, 'd');
+                for (int i = 0; i < 10; ++i)
+                {
+                    EXPECT_TRUE(send(*_transport, cMessage));
+                }
+
+                EXPECT_EQ(4U, _collector.Poll(recorder()));
+                EXPECT_EQ(6U, _transport->GetStatistics().Dropped);
+                ASSERT_EQ(1U, _collector.GetAppStatistics().size());
+                EXPECT_EQ(6U, _collector.GetAppStatistics()[0].Dropped);
+                EXPECT_EQ(6U, _collector.TotalDropped());
+            }
+
+            TEST_F(ShmLogTransportTest, WakesSleepingCollector)
+            {
+                ShmLogCollector _collector{cShmTestSocketPath};
+                auto _transport = connect(_collector, "WAKE");
+                ASSERT_TRUE(_transport->IsConnected());
+
+                // Without a wake-up request, no eventfd write is needed.
+                EXPECT_TRUE(send(*_transport, "busy"));
+                EXPECT_EQ(1U, _collector.Poll(recorder()));
+                EXPECT_EQ(0U, _transport->GetStatistics().Wakeups);
+
+                ASSERT_TRUE(_collector.PrepareWait());
+                EXPECT_TRUE(send(*_transport, "wake"));
+                EXPECT_EQ(1U, _transport->GetStatistics().Wakeups);
+                EXPECT_FALSE(_collector.PrepareWait());
+
+                pollfd _pollFd{_collector.Fd(), POLLIN, 0};
+                EXPECT_EQ(1, ::poll(&_pollFd, 1U, 1000));
+                EXPECT_EQ(1U, _collector.Poll(recorder()));
+                EXPECT_EQ("wake", Messages.back());
+            }
+
+            TEST_F(ShmLogTransportTest, DrainsDepartedApplication)
+            {
+                ShmLogCollector _collector{cShmTestSocketPath};
+                auto _transport = connect(_collector, "GONE");
+                ASSERT_TRUE(_transport->IsConnected());
+
+                EXPECT_TRUE(send(*_transport, "last words"));
+                _transport.reset();
+
+                EXPECT_EQ(1U, _collector.Poll(recorder()));
+                EXPECT_EQ(0U, _collector.ClientCount());
+                EXPECT_EQ(1U, _collector.TotalReceived());
+                ASSERT_EQ(1U, Messages.size());
+                EXPECT_EQ("last words", Messages[0]);
+            }
+
+            TEST_F(ShmLogTransportTest, FallsBackWhenDaemonStops)
+            {
+                std::unique_ptr<ShmLogCollector> _collector{
+                    new ShmLogCollector(cShmTestSocketPath)};
+                auto _transport = connect(*_collector, "STOP", 4096U);
+                ASSERT_TRUE(_transport->IsConnected());
+                _collector.reset();
+
+                // The hang-up is noticed by the next peer check, long before
+                // the ring fills up.
+                std::this_thread::sleep_for(
+                    ShmLogTransport::cPeerCheckPeriod + std::chrono::milliseconds{5});
+                EXPECT_FALSE(send(*_transport, "udp instead"));
+                EXPECT_FALSE(_transport->IsConnected());
+                EXPECT_EQ(0U, _transport->GetStatistics().Sent);
+                EXPECT_EQ(0U, _transport->GetStatistics().Dropped);
+            }
+
+            TEST_F(ShmLogTransportTest, ClosesDescriptorsOfBadRegistration)
+            {
+                ShmLogCollector _collector{cShmTestSocketPath};
+                ASSERT_TRUE(_collector.IsListening());
+                const std::size_t cFdCount{openFdCount()};
+
+                const int cSocket{::socket(AF_UNIX, SOCK_SEQPACKET, 0)};
+                sockaddr_un _address{};
+                _address.sun_family = AF_UNIX;
+                cShmTestSocketPath.copy(_address.sun_path, sizeof(_address.sun_path) - 1U);
+                ASSERT_EQ(0, ::connect(cSocket, reinterpret_cast<sockaddr *>(&_address), sizeof(_address)));
+
+                // One descriptor instead of the memfd and the eventfd
+                int _eventFd{::eventfd(0U, EFD_CLOEXEC)};
+                char _byte{0};
+                iovec _vector{&_byte, sizeof(_byte)};
+                union
+                {
+                    char Buffer[CMSG_SPACE(sizeof(int))];
+                    cmsghdr Align;
+                } _control;
+                msghdr _message{};
+                _message.msg_iov = &_vector;
+                _message.msg_iovlen = 1U;
+                _message.msg_control = _control.Buffer;
+                _message.msg_controllen = sizeof(_control.Buffer);
+                cmsghdr *_header{CMSG_FIRSTHDR(&_message)};
+                _header->cmsg_level = SOL_SOCKET;
+                _header->cmsg_type = SCM_RIGHTS;
+                _header->cmsg_len = CMSG_LEN(sizeof(int));
+                std::memcpy(CMSG_DATA(_header), &_eventFd, sizeof(int));
+                ASSERT_EQ(1, ::sendmsg(cSocket, &_message, 0));
+                ::close(_eventFd);
+
+                for (int i = 0; i < 10; ++i)
+                {
+                    _collector.Poll(recorder());
+                    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                }
+                ::close(cSocket);
+                _collector.Poll(recorder());
+
+                EXPECT_EQ(0U, _collector.ClientCount());
+                EXPECT_EQ(cFdCount, openFdCount());
+            }
+        }
+    }
+}
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
 #include "../../../src/ara/nm/network_manager.h"
 
 namespace ara
@@ -85,5 +87,28 @@ namespace ara
             ASSERT_TRUE(status.HasValue());
             EXPECT_EQ(NmState::kNormalOperation, status.Value().State);
         }
+
+        TEST(NetworkManagerTest, StartTickingDrivesStateMachine)
+        {
+            core::TimerWheel wheel{std::chrono::milliseconds{1}, 64U};
+            NetworkManager nm;
+            ASSERT_TRUE(nm.AddChannel({"ch1", 5000U, 20U, 2000U, false}).HasValue());
+            ASSERT_TRUE(nm.NetworkRequest("ch1").HasValue());
+
+            nm.StartTicking(std::chrono::milliseconds{2}, wheel);
+            const auto deadline =
+                std::chrono::steady_clock::now() + std::chrono::seconds{2};
+            NmState state{NmState::kBusSleep};
+            while (state != NmState::kNormalOperation &&
+                   std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds{2});
+                state = nm.GetChannelStatus("ch1").Value().State;
+            }
+            nm.StopTicking();
+
+            EXPECT_EQ(NmState::kNormalOperation, state);
+            EXPECT_EQ(0U, wheel.PendingCount());
+        }
     }
 }
@@ -0,0 +1,177 @@
+/// @file test/benchmark/async_log_sink_benchmark.cpp
+/// @brief Benchmark of AsyncLogSink producers against the former mutex ring.
+/// @details Producers log a short message as fast as they can into a sink
+///          whose inner sink discards it. The former sink is reproduced
+///          below: ToString() on the caller, one mutex around a ring of
+///          strings, and a LogStream rebuilt from the string on the flush
+///          thread. The reported time is the producer-side cost per call.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ara/log/sink/async_log_sink.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    constexpr std::size_t cCallsPerProducer{200000U};
+    constexpr std::size_t cCapacity{4096U};
+
+    class NullSink : public ara::log::sink::LogSink
+    {
+    public:
+        NullSink() : LogSink{"NULL", ""}
+        {
+        }
+
+        void Log(const ara::log::LogStream &logStream) const override
+        {
+            ara::bench::DoNotOptimize(logStream);
+        }
+    };
+
+    /// @brief The sink as it was before: strings in a mutex-protected ring
+    class StringRingSink : public ara::log::sink::LogSink
+    {
+    private:
+        const ara::log::sink::LogSink *mInnerSink;
+        mutable std::vector<std::string> mBuffer;
+        mutable std::size_t mHead{0U};
+        mutable std::size_t mTail{0U};
+        mutable std::size_t mSize{0U};
+        mutable std::mutex mMutex;
+        mutable std::condition_variable mNotEmpty;
+        std::atomic<bool> mRunning{true};
+        std::thread mFlushThread;
+
+    public:
+        mutable std::atomic<std::uint64_t> Dropped{0U};
+
+        explicit StringRingSink(const ara::log::sink::LogSink *innerSink)
+            : LogSink{"RING", ""}, mInnerSink{innerSink}, mBuffer(cCapacity)
+        {
+            mFlushThread = std::thread{[this] { flushLoop(); }};
+        }
+
+        ~StringRingSink() override
+        {
+            mRunning = false;
+            mNotEmpty.notify_all();
+            mFlushThread.join();
+        }
+
+        void Log(const ara::log::LogStream &logStream) const override
+        {
+            const std::string message{logStream.ToString()};
+            {
+                std::unique_lock<std::mutex> lock{mMutex};
+                if (mSize == cCapacity)
+                {
+                    ++Dropped;
+                    mTail = (mTail + 1U) % cCapacity;
+                    --mSize;
+                }
+                mBuffer[mHead] = message;
+                mHead = (mHead + 1U) % cCapacity;
+                ++mSize;
+            }
+            mNotEmpty.notify_one();
+        }
+
+    private:
+        void flushLoop()
+        {
+            for (;;)
+            {
+                std::string message;
+                {
+                    std::unique_lock<std::mutex> lock{mMutex};
+                    mNotEmpty.wait(lock, [this] { return mSize > 0U || !mRunning; });
+                    if (mSize == 0U)
+                    {
+                        return;
+                    }
+                    message = std::move(mBuffer[mTail]);
+                    mTail = (mTail + 1U) % cCapacity;
+                    --mSize;
+                }
+                ara::log::LogStream wrapper;
+                wrapper << message;
+                mInnerSink->Log(wrapper);
+            }
+        }
+    };
+
+    double run(const ara::log::sink::LogSink &sink, std::size_t producers)
+    {
+        std::vector<std::thread> threads;
+        const auto cStart = std::chrono::steady_clock::now();
+        for (std::size_t p = 0U; p < producers; ++p)
+        {
+            threads.emplace_back(
+                [&sink]
+                {
+                    for (std::size_t i = 0U; i < cCallsPerProducer; ++i)
+                    {
+                        ara::log::LogStream _stream;
+                        _stream << "speed=" << static_cast<std::uint32_t>(i)
+                                << " temperature=" << 21.5;
+                        sink.Log(_stream);
+                    }
+                });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        const auto cElapsed = std::chrono::steady_clock::now() - cStart;
+
+        return static_cast<double>(
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(cElapsed).count()) /
+               static_cast<double>(producers * cCallsPerProducer);
+    }
+}
+
+int main()
+{
+    std::printf("%u hardware threads, %zu calls per producer\n",
+                std::thread::hardware_concurrency(), cCallsPerProducer);
+
+    NullSink inner;
+    const std::size_t cProducers[]{1U, 2U, 4U};
+    for (const std::size_t producers : cProducers)
+    {
+        char name[64];
+
+        std::uint64_t legacyDropped;
+        double legacyNs;
+        {
+            StringRingSink legacy{&inner};
+            legacyNs = run(legacy, producers);
+            legacyDropped = legacy.Dropped.load();
+        }
+        std::snprintf(name, sizeof(name), "mutex string ring %zuP", producers);
+        ara::bench::Report(name, legacyNs);
+        std::printf("  dropped: %llu\n", static_cast<unsigned long long>(legacyDropped));
+
+        ara::log::sink::AsyncLogSink async{&inner, "BNCH", "", cCapacity};
+        const double cAsyncNs{run(async, producers)};
+        async.Flush();
+        const ara::log::sink::AsyncLogSinkStatistics cStatistics{async.GetStatistics()};
+        std::snprintf(name, sizeof(name), "AsyncLogSink %zuP", producers);
+        ara::bench::Report(name, cAsyncNs);
+        std::printf("  dropped: %llu, batches: %llu, high watermark: %llu\n",
+                    static_cast<unsigned long long>(cStatistics.Dropped),
+                    static_cast<unsigned long long>(cStatistics.Batches),
+                    static_cast<unsigned long long>(cStatistics.HighWatermark));
+    }
+
+    return 0;
+}
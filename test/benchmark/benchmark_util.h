@@ -0,0 +1,76 @@
+/// @file test/benchmark/benchmark_util.h
+/// @brief Minimal timing harness shared by the micro-benchmarks.
+/// @details The benchmarks are plain executables (no framework dependency):
+///          each case is warmed up, timed over a fixed number of iterations
+///          with the steady clock, and reported as ns/op and, where a byte
+///          count is given, MB/s.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#ifndef ARA_BENCHMARK_UTIL_H
+#define ARA_BENCHMARK_UTIL_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace ara
+{
+    namespace bench
+    {
+        /// @brief Keep the compiler from optimizing a benchmark result away.
+        template <typename T>
+        inline void DoNotOptimize(const T &value)
+        {
+            asm volatile("" : : "g"(&value) : "memory");
+        }
+
+        /// @brief Run an operation repeatedly and return the mean time per call.
+        /// @param operation Callable under test
+        /// @param iterations Number of timed calls (after iterations / 10 warm-up calls)
+        /// @returns Nanoseconds per call
+        template <typename F>
+        double MeasureNsPerOp(F &&operation, std::size_t iterations)
+        {
+            for (std::size_t i = 0U; i < iterations / 10U + 1U; ++i)
+            {
+                operation();
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0U; i < iterations; ++i)
+            {
+                operation();
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            return static_cast<double>(
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           elapsed)
+                           .count()) /
+                   static_cast<double>(iterations);
+        }
+
+        /// @brief Print one result line.
+        /// @param name Case name
+        /// @param nsPerOp Mean time per operation
+        /// @param bytesPerOp Bytes processed per operation (0 = no throughput)
+        inline void Report(
+            const char *name, double nsPerOp, std::size_t bytesPerOp = 0U)
+        {
+            if (bytesPerOp > 0U && nsPerOp > 0.0)
+            {
+                const double mbPerSecond =
+                    static_cast<double>(bytesPerOp) * 1000.0 / nsPerOp;
+                std::printf("%-48s %14.1f ns/op %10.1f MB/s\n",
+                            name, nsPerOp, mbPerSecond);
+            }
+            else
+            {
+                std::printf("%-48s %14.1f ns/op\n", name, nsPerOp);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,154 @@
+/// @file test/benchmark/concurrent_queue_benchmark.cpp
+/// @brief Benchmark of the lock-free ConcurrentQueue against the former
+///        try_lock queue.
+/// @details Producers and consumers hammer one queue with the non-blocking
+///          calls and retry every failed attempt. For the former queue a
+///          failure under contention is a spurious drop that a caller such as
+///          DoipServer would not have retried; the ring only fails when it is
+///          really full or empty.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include "ara/com/helper/concurrent_queue.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    constexpr std::size_t cItemsPerProducer{200000U};
+
+    /// @brief The queue as it was before: a std::queue behind try_lock
+    template <typename T>
+    class TryLockQueue
+    {
+    private:
+        std::mutex mMutex;
+        std::queue<T> mQueue;
+
+    public:
+        bool TryEnqueue(T &&element)
+        {
+            std::unique_lock<std::mutex> _lock(mMutex, std::defer_lock);
+            if (!_lock.try_lock())
+            {
+                return false;
+            }
+            mQueue.emplace(std::move(element));
+            return true;
+        }
+
+        bool TryDequeue(T &element)
+        {
+            std::unique_lock<std::mutex> _lock(mMutex, std::defer_lock);
+            if (!_lock.try_lock() || mQueue.empty())
+            {
+                return false;
+            }
+            element = std::move(mQueue.front());
+            mQueue.pop();
+            return true;
+        }
+    };
+
+    struct Result
+    {
+        double NsPerItem;
+        std::uint64_t FailedEnqueues;
+    };
+
+    template <typename Queue>
+    Result run(Queue &queue, std::size_t producers, std::size_t consumers)
+    {
+        const std::size_t cTotal{producers * cItemsPerProducer};
+        std::atomic<std::uint64_t> failedEnqueues{0U};
+        std::atomic<std::size_t> consumed{0U};
+        std::vector<std::thread> threads;
+
+        const auto cStart = std::chrono::steady_clock::now();
+        for (std::size_t p = 0U; p < producers; ++p)
+        {
+            threads.emplace_back(
+                [&queue, &failedEnqueues]
+                {
+                    std::uint64_t failed{0U};
+                    for (std::size_t i = 0U; i < cItemsPerProducer; ++i)
+                    {
+                        std::uint64_t item{i};
+                        while (!queue.TryEnqueue(std::move(item)))
+                        {
+                            ++failed;
+                            std::this_thread::yield();
+                        }
+                    }
+                    failedEnqueues += failed;
+                });
+        }
+        for (std::size_t c = 0U; c < consumers; ++c)
+        {
+            threads.emplace_back(
+                [&queue, &consumed, cTotal]
+                {
+                    std::uint64_t item;
+                    while (consumed.load(std::memory_order_relaxed) < cTotal)
+                    {
+                        if (queue.TryDequeue(item))
+                        {
+                            ara::bench::DoNotOptimize(item);
+                            consumed.fetch_add(1U, std::memory_order_relaxed);
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+        }
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        const auto cElapsed = std::chrono::steady_clock::now() - cStart;
+
+        return Result{
+            static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(cElapsed).count()) /
+                static_cast<double>(cTotal),
+            failedEnqueues.load()};
+    }
+}
+
+int main()
+{
+    std::printf("%u hardware threads, %zu items per producer\n",
+                std::thread::hardware_concurrency(), cItemsPerProducer);
+
+    const std::size_t cConfigurations[][2]{{1U, 1U}, {2U, 2U}, {4U, 4U}};
+    for (const auto &configuration : cConfigurations)
+    {
+        char name[64];
+
+        TryLockQueue<std::uint64_t> legacy;
+        const Result cLegacy{run(legacy, configuration[0], configuration[1])};
+        std::snprintf(name, sizeof(name), "try_lock queue %zuP/%zuC",
+                      configuration[0], configuration[1]);
+        ara::bench::Report(name, cLegacy.NsPerItem);
+        std::printf("  failed enqueues (spurious): %llu\n",
+                    static_cast<unsigned long long>(cLegacy.FailedEnqueues));
+
+        ara::com::helper::ConcurrentQueue<std::uint64_t> ring(4096U);
+        const Result cRing{run(ring, configuration[0], configuration[1])};
+        std::snprintf(name, sizeof(name), "MPMC ring %zuP/%zuC",
+                      configuration[0], configuration[1]);
+        ara::bench::Report(name, cRing.NsPerItem);
+        std::printf("  failed enqueues (ring full): %llu\n",
+                    static_cast<unsigned long long>(cRing.FailedEnqueues));
+    }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/// @file test/benchmark/e2e_crc_benchmark.cpp
+/// @brief Benchmark for the E2E CRC engine.
+/// @details Compares the per-byte table loop every profile used to carry with
+///          the shared engine's bytewise, slicing-by-8 and dispatched
+///          (carry-less multiply / ARMv8 CRC32 where available) kernels.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "ara/com/e2e/crc.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    constexpr std::size_t cIterations{2000U};
+
+    /// @brief The lazily built 256-entry table loop of the former profiles.
+    std::uint32_t legacyCrc32(
+        const std::uint8_t *data, std::size_t length, std::uint32_t crc)
+    {
+        static std::array<std::uint32_t, 256U> sTable{};
+        static bool sInitialized{false};
+        if (!sInitialized)
+        {
+            for (std::uint32_t i = 0U; i < 256U; ++i)
+            {
+                std::uint32_t entry = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    entry = (entry & 1U) ? ((entry >> 1) ^ 0xC8DF352FU) : (entry >> 1);
+                }
+                sTable[i] = entry;
+            }
+            sInitialized = true;
+        }
+
+        for (std::size_t i = 0U; i < length; ++i)
+        {
+            crc = (crc >> 8) ^ sTable[(crc ^ data[i]) & 0xFFU];
+        }
+        return crc;
+    }
+
+    template <typename TCrc>
+    void runCase(const char *name, const std::vector<std::uint8_t> &payload)
+    {
+        const std::uint8_t *cData = payload.data();
+        const std::size_t cSize = payload.size();
+        char label[64];
+
+        std::snprintf(label, sizeof(label), "%-10s bytewise", name);
+        ara::bench::Report(
+            label,
+            ara::bench::MeasureNsPerOp(
+                [cData, cSize]()
+                {
+                    auto crc = TCrc::UpdateBytewise(0U, cData, cSize);
+                    ara::bench::DoNotOptimize(crc);
+                },
+                cIterations),
+            cSize);
+
+        std::snprintf(label, sizeof(label), "%-10s slicing-by-8", name);
+        ara::bench::Report(
+            label,
+            ara::bench::MeasureNsPerOp(
+                [cData, cSize]()
+                {
+                    auto crc = TCrc::UpdateSlicingBy8(0U, cData, cSize);
+                    ara::bench::DoNotOptimize(crc);
+                },
+                cIterations),
+            cSize);
+
+        std::snprintf(
+            label, sizeof(label), "%-10s dispatched%s",
+            name, TCrc::IsAccelerated() ? " (hw)" : "");
+        ara::bench::Report(
+            label,
+            ara::bench::MeasureNsPerOp(
+                [cData, cSize]()
+                {
+                    auto crc = TCrc::Update(0U, cData, cSize);
+                    ara::bench::DoNotOptimize(crc);
+                },
+                cIterations),
+            cSize);
+    }
+}
+
+int main()
+{
+    using namespace ara::com::e2e;
+
+    for (std::size_t size : {64U, 4096U, 65536U})
+    {
+        std::vector<std::uint8_t> payload(size);
+        for (std::size_t i = 0U; i < payload.size(); ++i)
+        {
+            payload[i] = static_cast<std::uint8_t>(i * 31U + 7U);
+        }
+
+        std::printf("\npayload %zu bytes\n", size);
+
+        const std::uint8_t *cData = payload.data();
+        ara::bench::Report(
+            "crc32p4    legacy table loop",
+            ara::bench::MeasureNsPerOp(
+                [cData, size]()
+                {
+                    auto crc = legacyCrc32(cData, size, 0xFFFFFFFFU);
+                    ara::bench::DoNotOptimize(crc);
+                },
+                cIterations),
+            size);
+
+        runCase<Crc8>("crc8", payload);
+        runCase<Crc16>("crc16", payload);
+        runCase<Crc32P4>("crc32p4", payload);
+        runCase<Crc64>("crc64", payload);
+    }
+
+    return 0;
+}
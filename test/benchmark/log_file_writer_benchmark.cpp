@@ -0,0 +1,64 @@
+/// @file test/benchmark/log_file_writer_benchmark.cpp
+/// @brief Benchmark of LogFileWriter against per-record file appends.
+/// @details Writes 100-byte records the way the DLT daemon and FileLogSink
+///          did before (stat() for rotation, then an std::ofstream opened in
+///          append mode per record) and through a LogFileWriter with its
+///          default blocks and a sync-free policy. The reported time is the
+///          caller-side cost per record; the writer's time includes its
+///          share of the group writes.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include "ara/log/sink/log_file_writer.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    constexpr std::size_t cIterations{100000U};
+    constexpr std::size_t cRecordSize{100U};
+    const char *const cPath{"/tmp/ara_log_file_writer_benchmark.log"};
+}
+
+int main()
+{
+    const std::vector<char> cRecord(cRecordSize, 'x');
+
+    std::remove(cPath);
+    const double cLegacyNs{ara::bench::MeasureNsPerOp(
+        [&cRecord]()
+        {
+            struct stat _status;
+            ara::bench::DoNotOptimize(::stat(cPath, &_status));
+            std::ofstream _stream(cPath, std::ios::binary | std::ios::app);
+            _stream.write(cRecord.data(), static_cast<std::streamsize>(cRecord.size()));
+        },
+        cIterations)};
+    ara::bench::Report("stat + ofstream per record", cLegacyNs, cRecordSize);
+
+    std::remove(cPath);
+    ara::log::sink::LogFileWriterStatistics _statistics;
+    double _writerNs;
+    {
+        ara::log::sink::LogFileWriter _writer{cPath};
+        _writerNs = ara::bench::MeasureNsPerOp(
+            [&_writer, &cRecord]()
+            {
+                _writer.Write(cRecord.data(), cRecord.size());
+            },
+            cIterations);
+        _writer.Flush();
+        _statistics = _writer.GetStatistics();
+    }
+    ara::bench::Report("LogFileWriter", _writerNs, cRecordSize);
+    std::printf("  records: %llu, writev calls: %llu\n",
+                static_cast<unsigned long long>(_statistics.Records),
+                static_cast<unsigned long long>(_statistics.Writes));
+
+    std::remove(cPath);
+    return 0;
+}
@@ -0,0 +1,147 @@
+/// @file test/benchmark/log_stream_benchmark.cpp
+/// @brief Benchmark of one log call through the typed LogStream against the
+///        former string-backed stream.
+/// @details A log call is modelled as LoggingFramework::Log does it: build
+///          the context prefix of Logger::WithLevel, append the user's
+///          stream, and hand the result to a sink. The former stream is
+///          reproduced below (std::string + std::to_string per argument,
+///          three temporary prefix strings, text formatting always). The
+///          typed stream is measured once with a sink that only walks the
+///          arguments, as the DLT sink does, and once with a sink that
+///          formats text.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "ara/log/logger.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    constexpr std::size_t cIterations{1000000U};
+
+    /// @brief The stream as it was before: one growing std::string
+    class StringLogStream
+    {
+    private:
+        std::string mLogs;
+
+    public:
+        StringLogStream &operator<<(const std::string &value)
+        {
+            mLogs += value;
+            return *this;
+        }
+
+        StringLogStream &operator<<(const char *value)
+        {
+            mLogs += std::string{value};
+            return *this;
+        }
+
+        StringLogStream &operator<<(std::uint32_t value)
+        {
+            mLogs += std::to_string(value);
+            return *this;
+        }
+
+        StringLogStream &operator<<(double value)
+        {
+            mLogs += std::to_string(value);
+            return *this;
+        }
+
+        StringLogStream &operator<<(const StringLogStream &value)
+        {
+            mLogs += value.mLogs;
+            return *this;
+        }
+
+        std::string ToString() const
+        {
+            return mLogs;
+        }
+    };
+
+    StringLogStream legacyWithLevel(
+        const std::string &contextId,
+        const std::string &contextDescription)
+    {
+        StringLogStream _result;
+        const std::string cContextId{"Context ID:"};
+        const std::string cContextDescription{"Context Description:"};
+        const std::string cLogLevel{"Log Level:"};
+        const std::string cSeperator{";"};
+
+        _result << cContextId << contextId << cSeperator;
+        _result << cContextDescription << contextDescription << cSeperator;
+        _result << cLogLevel << std::string{"Info"} << cSeperator;
+
+        return _result;
+    }
+}
+
+int main()
+{
+    const std::string cContextId{"CTX1"};
+    const std::string cContextDescription{"Benchmark context"};
+    const std::uint32_t cSpeed{87U};
+    const double cTemperature{21.5};
+
+    const double cLegacy{ara::bench::MeasureNsPerOp(
+        [&]
+        {
+            StringLogStream _message;
+            _message << "speed=" << cSpeed << " temperature=" << cTemperature;
+
+            StringLogStream _record{legacyWithLevel(cContextId, cContextDescription)};
+            _record << _message;
+            const std::string cText{_record.ToString()};
+            ara::bench::DoNotOptimize(cText);
+        },
+        cIterations)};
+    ara::bench::Report("string stream, text sink", cLegacy);
+
+    const ara::log::Logger cLogger{
+        ara::log::Logger::CreateLogger(
+            cContextId, cContextDescription, ara::log::LogLevel::kInfo)};
+
+    const double cBinary{ara::bench::MeasureNsPerOp(
+        [&]
+        {
+            ara::log::LogStream _message;
+            _message << "speed=" << cSpeed << " temperature=" << cTemperature;
+
+            ara::log::LogStream _record{cLogger.WithLevel(ara::log::LogLevel::kInfo)};
+            _record << _message;
+            std::size_t _bytes{0U};
+            _record.ForEachArgument(
+                [&_bytes](const ara::log::LogArgument &argument)
+                {
+                    _bytes += argument.Size;
+                });
+            ara::bench::DoNotOptimize(_bytes);
+        },
+        cIterations)};
+    ara::bench::Report("typed stream, binary sink", cBinary);
+
+    std::string _text;
+    const double cText{ara::bench::MeasureNsPerOp(
+        [&]
+        {
+            ara::log::LogStream _message;
+            _message << "speed=" << cSpeed << " temperature=" << cTemperature;
+
+            ara::log::LogStream _record{cLogger.WithLevel(ara::log::LogLevel::kInfo)};
+            _record << _message;
+            _text.clear();
+            _record.FormatTo(_text);
+            ara::bench::DoNotOptimize(_text);
+        },
+        cIterations)};
+    ara::bench::Report("typed stream, text sink (reused buffer)", cText);
+
+    return 0;
+}
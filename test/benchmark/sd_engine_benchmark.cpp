@@ -0,0 +1,116 @@
+/// @file test/benchmark/sd_engine_benchmark.cpp
+/// @brief Benchmark of per-service versus packed SOME/IP-SD offers.
+/// @details Compares one SomeIpSdMessage per offered service with one packed
+///          message for all of them (build cost and bytes on the wire), and
+///          SomeIpSdMessage::Deserialize with the flat SdPackedMessage parser
+///          on the same 80-entry message.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "ara/com/entry/service_entry.h"
+#include "ara/com/option/ipv4_endpoint_option.h"
+#include "ara/com/someip/sd/sd_packed_message.h"
+#include "ara/com/someip/sd/someip_sd_message.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    using namespace ara::com;
+    using someip::sd::SdEndpoint;
+    using someip::sd::SdMessagePacker;
+    using someip::sd::SdPackedMessage;
+    using someip::sd::SomeIpSdMessage;
+
+    constexpr std::uint16_t cServices{80U};
+    constexpr std::size_t cIterations{2000U};
+
+    const helper::Ipv4Address cAddress(10, 0, 0, 1);
+    const std::uint16_t cPort{30501U};
+
+    std::unique_ptr<entry::ServiceEntry> makeOffer(std::uint16_t serviceId)
+    {
+        auto offer = entry::ServiceEntry::CreateOfferServiceEntry(serviceId, 1U, 1U, 0U, 3U);
+        offer->AddFirstOption(
+            option::Ipv4EndpointOption::CreateUnitcastEndpoint(
+                false, cAddress, option::Layer4ProtocolType::Udp, cPort));
+        return offer;
+    }
+}
+
+int main()
+{
+    std::size_t legacyBytes{0U};
+    const double cLegacyBuild{ara::bench::MeasureNsPerOp(
+        [&legacyBytes]
+        {
+            legacyBytes = 0U;
+            for (std::uint16_t service = 0U; service < cServices; ++service)
+            {
+                SomeIpSdMessage message;
+                message.AddEntry(makeOffer(0x1000U + service));
+                auto payload = message.Payload();
+                legacyBytes += payload.size();
+                ara::bench::DoNotOptimize(payload);
+            }
+        },
+        cIterations)};
+
+    SdEndpoint endpoint;
+    endpoint.Address = cAddress;
+    endpoint.Port = cPort;
+    SdMessagePacker packer;
+    std::vector<std::uint8_t> packed;
+    const double cPackedBuild{ara::bench::MeasureNsPerOp(
+        [&]
+        {
+            packer.Reset(1U, true);
+            for (std::uint16_t service = 0U; service < cServices; ++service)
+            {
+                packer.AddServiceEntry(
+                    entry::EntryType::Offering, 0x1000U + service, 1U, 1U, 3U, 0U, &endpoint);
+            }
+            packer.Finish(packed);
+            ara::bench::DoNotOptimize(packed);
+        },
+        cIterations)};
+
+    std::printf("%u offers\n", static_cast<unsigned>(cServices));
+    ara::bench::Report("build: one message per service", cLegacyBuild);
+    ara::bench::Report("build: one packed message", cPackedBuild);
+    std::printf("wire: %zu bytes in %u messages vs %zu bytes in 1 message\n",
+                legacyBytes, static_cast<unsigned>(cServices), packed.size());
+
+    // The legacy parser reads options in entry order, so give every entry
+    // its own endpoint option for a like-for-like parse.
+    SomeIpSdMessage combined;
+    for (std::uint16_t service = 0U; service < cServices; ++service)
+    {
+        combined.AddEntry(makeOffer(0x1000U + service));
+    }
+    const std::vector<std::uint8_t> cMessage{combined.Payload()};
+
+    const double cLegacyParse{ara::bench::MeasureNsPerOp(
+        [&cMessage]
+        {
+            auto message = SomeIpSdMessage::Deserialize(cMessage);
+            ara::bench::DoNotOptimize(message);
+        },
+        cIterations)};
+
+    SdPackedMessage parsed;
+    const double cFlatParse{ara::bench::MeasureNsPerOp(
+        [&]
+        {
+            auto valid = parsed.Parse(cMessage);
+            ara::bench::DoNotOptimize(valid);
+        },
+        cIterations)};
+
+    ara::bench::Report("parse: SomeIpSdMessage::Deserialize", cLegacyParse, cMessage.size());
+    ara::bench::Report("parse: SdPackedMessage::Parse", cFlatParse, cMessage.size());
+
+    return 0;
+}
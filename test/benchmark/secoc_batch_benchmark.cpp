@@ -0,0 +1,136 @@
+/// @file test/benchmark/secoc_batch_benchmark.cpp
+/// @brief Benchmark for batched SecOC authentication.
+/// @details Protects one payload per PDU through the map-based ProtectAll()
+///          with a one-shot HMAC function, and through ProtectBatch() with
+///          pre-keyed HMAC contexts, both in the calling thread and sharded
+///          over a worker pool.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <vector>
+#include "ara/com/secoc/secoc_pdu_collective.h"
+#include "ara/core/executor.h"
+#include "ara/crypto/crypto_provider.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    using namespace ara::com::secoc;
+
+    constexpr std::size_t cIterations{2000U};
+    constexpr PduId cPduCount{16U};
+
+    const std::vector<std::uint8_t> cKey(16U, 0x5AU);
+
+    std::vector<std::uint8_t> computeHmac(
+        const std::vector<std::uint8_t> &key,
+        const std::vector<std::uint8_t> &data)
+    {
+        auto mac = ara::crypto::ComputeHmac(data, key);
+        return mac.HasValue() ? mac.Value() : std::vector<std::uint8_t>{};
+    }
+
+    /// @brief One collective over cPduCount PDUs with its own counters.
+    struct Endpoint
+    {
+        FreshnessManager Freshness;
+        std::vector<std::unique_ptr<SecOcPdu>> Pdus;
+        SecOcPduCollective Collective;
+
+        explicit Endpoint(bool keyedContexts)
+        {
+            for (PduId id = 0U; id < cPduCount; ++id)
+            {
+                SecOcPduConfig config;
+                config.dataId = id;
+                if (keyedContexts)
+                {
+                    Pdus.emplace_back(new SecOcPdu(
+                        config,
+                        std::unique_ptr<MacContext>(new HmacMacContext(cKey)),
+                        &Freshness));
+                }
+                else
+                {
+                    Pdus.emplace_back(
+                        new SecOcPdu(config, cKey, computeHmac, &Freshness));
+                }
+                Collective.AddPdu(id, Pdus.back().get());
+            }
+        }
+    };
+}
+
+int main()
+{
+    ara::core::ThreadPoolExecutor pool{4U, 64U};
+
+    for (std::size_t size : {8U, 64U, 1024U})
+    {
+        std::printf("\n%u PDUs, payload %zu bytes\n",
+                    static_cast<unsigned>(cPduCount), size);
+        const std::size_t cBatchBytes{size * cPduCount};
+
+        std::map<PduId, std::vector<std::uint8_t>> payloads;
+        for (PduId id = 0U; id < cPduCount; ++id)
+        {
+            payloads[id] = std::vector<std::uint8_t>(
+                size, static_cast<std::uint8_t>(id));
+        }
+
+        Endpoint legacy{false};
+        ara::bench::Report(
+            "ProtectAll (one-shot HMAC)",
+            ara::bench::MeasureNsPerOp(
+                [&legacy, &payloads]()
+                {
+                    auto secured = legacy.Collective.ProtectAll(payloads);
+                    ara::bench::DoNotOptimize(secured);
+                },
+                cIterations),
+            cBatchBytes);
+
+        std::vector<std::vector<std::uint8_t>> outputs;
+        std::vector<SecOcBatchEntry> entries(cPduCount);
+        for (PduId id = 0U; id < cPduCount; ++id)
+        {
+            outputs.emplace_back(size + 32U);
+            entries[id].pduId = id;
+            entries[id].input = payloads[id].data();
+            entries[id].inputLength = size;
+            entries[id].output = outputs[id].data();
+            entries[id].outputCapacity = outputs[id].size();
+        }
+
+        Endpoint inlineBatch{true};
+        ara::bench::Report(
+            "ProtectBatch (keyed, inline)",
+            ara::bench::MeasureNsPerOp(
+                [&inlineBatch, &entries]()
+                {
+                    auto protectedCount = inlineBatch.Collective.ProtectBatch(entries);
+                    ara::bench::DoNotOptimize(protectedCount);
+                },
+                cIterations),
+            cBatchBytes);
+
+        Endpoint pooledBatch{true};
+        ara::bench::Report(
+            "ProtectBatch (keyed, 4 workers)",
+            ara::bench::MeasureNsPerOp(
+                [&pooledBatch, &entries, &pool]()
+                {
+                    auto protectedCount =
+                        pooledBatch.Collective.ProtectBatch(entries, &pool);
+                    ara::bench::DoNotOptimize(protectedCount);
+                },
+                cIterations),
+            cBatchBytes);
+    }
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+/// @file test/benchmark/secoc_freshness_benchmark.cpp
+/// @brief Contention benchmark for the SecOC freshness manager.
+/// @details Eight threads run sender (read + increment) and receiver
+///          (verify-and-update) cycles, once against the single-mutex
+///          std::map design the manager used to have and once against the
+///          PDU-indexed atomic table, on distinct PDUs and on one shared PDU.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ara/com/secoc/freshness_manager.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    using ara::com::secoc::FreshnessManager;
+    using ara::com::secoc::FreshnessValue;
+    using ara::com::secoc::PduId;
+
+    constexpr std::size_t cThreads{8U};
+    constexpr std::size_t cOpsPerThread{20000U};
+    constexpr std::size_t cIterations{10U};
+
+    /// @brief The former design: one mutex, one map, vector freshness values.
+    class LegacyFreshnessManager
+    {
+    private:
+        mutable std::mutex mMutex;
+        std::map<PduId, std::uint64_t> mCounters;
+
+    public:
+        void RegisterPdu(PduId pduId)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mCounters[pduId] = 0U;
+        }
+
+        FreshnessValue GetFreshnessValue(PduId pduId) const
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            const std::uint64_t counter{mCounters.at(pduId)};
+            FreshnessValue value(4U);
+            for (std::size_t i = 0U; i < value.size(); ++i)
+            {
+                value[i] = static_cast<std::uint8_t>(counter >> (i * 8U));
+            }
+            return value;
+        }
+
+        void IncrementCounter(PduId pduId)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            ++mCounters[pduId];
+        }
+
+        bool VerifyAndUpdate(PduId pduId, std::uint64_t received)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            std::uint64_t &counter = mCounters[pduId];
+            if (received <= counter)
+            {
+                return false;
+            }
+            counter = received;
+            return true;
+        }
+    };
+
+    /// @brief Run @p work on cThreads threads and return ns per operation.
+    template <typename F>
+    double measureThreads(F work)
+    {
+        const double cNsPerRound{ara::bench::MeasureNsPerOp(
+            [&work]()
+            {
+                std::vector<std::thread> threads;
+                for (std::size_t t = 0U; t < cThreads; ++t)
+                {
+                    threads.emplace_back(work, static_cast<PduId>(t));
+                }
+                for (auto &thread : threads)
+                {
+                    thread.join();
+                }
+            },
+            cIterations)};
+        return cNsPerRound / static_cast<double>(cThreads * cOpsPerThread);
+    }
+
+    template <typename TManager, typename TSender, typename TReceiver>
+    void runCase(
+        const char *name, TManager &manager, bool sharedPdu,
+        TSender sender, TReceiver receiver)
+    {
+        char label[64];
+
+        std::snprintf(label, sizeof(label), "%-8s send   %s", name,
+                      sharedPdu ? "shared PDU" : "own PDU");
+        ara::bench::Report(
+            label,
+            measureThreads(
+                [&manager, &sender, sharedPdu](PduId thread)
+                {
+                    const PduId cPdu = sharedPdu ? 0U : thread;
+                    for (std::size_t i = 0U; i < cOpsPerThread; ++i)
+                    {
+                        sender(manager, cPdu);
+                    }
+                }));
+
+        std::snprintf(label, sizeof(label), "%-8s verify %s", name,
+                      sharedPdu ? "shared PDU" : "own PDU");
+        ara::bench::Report(
+            label,
+            measureThreads(
+                [&manager, &receiver, sharedPdu](PduId thread)
+                {
+                    const PduId cPdu = sharedPdu ? 0U : thread;
+                    for (std::size_t i = 1U; i <= cOpsPerThread; ++i)
+                    {
+                        receiver(manager, cPdu, static_cast<std::uint64_t>(i));
+                    }
+                }));
+    }
+}
+
+int main()
+{
+    LegacyFreshnessManager legacy;
+    FreshnessManager table;
+    for (PduId pdu = 0U; pdu < cThreads; ++pdu)
+    {
+        legacy.RegisterPdu(pdu);
+        table.RegisterPdu(pdu, {4U, 0U});
+    }
+
+    auto legacySend = [](LegacyFreshnessManager &manager, PduId pdu)
+    {
+        auto value = manager.GetFreshnessValue(pdu);
+        ara::bench::DoNotOptimize(value);
+        manager.IncrementCounter(pdu);
+    };
+    auto legacyVerify = [](LegacyFreshnessManager &manager, PduId pdu, std::uint64_t received)
+    {
+        auto accepted = manager.VerifyAndUpdate(pdu, received);
+        ara::bench::DoNotOptimize(accepted);
+    };
+    auto tableSend = [](FreshnessManager &manager, PduId pdu)
+    {
+        std::uint8_t value[8];
+        auto written = manager.GetFreshnessValue(pdu, value, sizeof(value));
+        ara::bench::DoNotOptimize(written);
+        ara::bench::DoNotOptimize(value);
+        auto incremented = manager.IncrementCounter(pdu);
+        ara::bench::DoNotOptimize(incremented);
+    };
+    auto tableVerify = [](FreshnessManager &manager, PduId pdu, std::uint64_t received)
+    {
+        auto accepted = manager.VerifyAndUpdate(pdu, received);
+        ara::bench::DoNotOptimize(accepted);
+    };
+
+    std::printf("%zu threads, %zu operations each\n", cThreads, cOpsPerThread);
+    for (bool sharedPdu : {false, true})
+    {
+        runCase("legacy", legacy, sharedPdu, legacySend, legacyVerify);
+        runCase("table", table, sharedPdu, tableSend, tableVerify);
+    }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+/// @file test/benchmark/serialization_benchmark.cpp
+/// @brief Benchmark for std::vector<trivially-copyable T> serialization.
+/// @details Encodes and decodes a 30k-point cloud through the bulk memcpy
+///          Serializer<std::vector<T>> and compares it with element-wise
+///          encoding (one temporary vector per element), which is what the
+///          generic container serializer does for non-trivial types.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "ara/com/serialization.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    struct Point
+    {
+        float X;
+        float Y;
+        float Z;
+        float Intensity;
+    };
+
+    constexpr std::size_t cPointCount{30000U};
+    constexpr std::size_t cIterations{200U};
+
+    std::vector<std::uint8_t> serializeElementWise(const std::vector<Point> &points)
+    {
+        std::vector<std::uint8_t> buffer(sizeof(std::uint32_t));
+        const std::uint32_t count = static_cast<std::uint32_t>(points.size());
+        std::memcpy(buffer.data(), &count, sizeof(count));
+        for (const auto &point : points)
+        {
+            auto bytes = ara::com::Serializer<Point>::Serialize(point);
+            buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+        }
+        return buffer;
+    }
+
+    std::vector<Point> deserializeElementWise(const std::vector<std::uint8_t> &bytes)
+    {
+        std::uint32_t count;
+        std::memcpy(&count, bytes.data(), sizeof(count));
+        std::size_t offset = sizeof(count);
+        std::vector<Point> points;
+        points.reserve(count);
+        for (std::uint32_t i = 0U; i < count; ++i)
+        {
+            auto element = ara::com::Serializer<Point>::DeserializeAt(
+                bytes.data() + offset, bytes.size() - offset);
+            offset += element.Value().second;
+            points.push_back(element.Value().first);
+        }
+        return points;
+    }
+}
+
+int main()
+{
+    using ara::com::Serializer;
+
+    std::vector<Point> cloud(cPointCount);
+    for (std::size_t i = 0U; i < cloud.size(); ++i)
+    {
+        const float f = static_cast<float>(i);
+        cloud[i] = Point{f, f * 0.5F, f * 0.25F, 1.0F};
+    }
+
+    const std::vector<std::uint8_t> wire =
+        Serializer<std::vector<Point>>::Serialize(cloud);
+    const std::size_t wireSize = wire.size();
+
+    std::printf("std::vector<Point>, %zu points, %zu bytes on the wire\n",
+                cPointCount, wireSize);
+
+    ara::bench::Report(
+        "serialize   element-wise",
+        ara::bench::MeasureNsPerOp(
+            [&cloud]()
+            {
+                auto bytes = serializeElementWise(cloud);
+                ara::bench::DoNotOptimize(bytes);
+            },
+            cIterations),
+        wireSize);
+
+    ara::bench::Report(
+        "serialize   bulk memcpy",
+        ara::bench::MeasureNsPerOp(
+            [&cloud]()
+            {
+                auto bytes = Serializer<std::vector<Point>>::Serialize(cloud);
+                ara::bench::DoNotOptimize(bytes);
+            },
+            cIterations),
+        wireSize);
+
+    std::vector<std::uint8_t> chunk(wireSize);
+    ara::bench::Report(
+        "serialize   bulk into caller buffer",
+        ara::bench::MeasureNsPerOp(
+            [&cloud, &chunk]()
+            {
+                auto written = ara::com::SerializeInto(
+                    cloud,
+                    ara::core::Span<std::uint8_t>{chunk.data(), chunk.size()});
+                ara::bench::DoNotOptimize(written);
+            },
+            cIterations),
+        wireSize);
+
+    ara::bench::Report(
+        "deserialize element-wise",
+        ara::bench::MeasureNsPerOp(
+            [&wire]()
+            {
+                auto points = deserializeElementWise(wire);
+                ara::bench::DoNotOptimize(points);
+            },
+            cIterations),
+        wireSize);
+
+    ara::bench::Report(
+        "deserialize bulk memcpy",
+        ara::bench::MeasureNsPerOp(
+            [&wire]()
+            {
+                auto points = Serializer<std::vector<Point>>::Deserialize(
+                    wire.data(), wire.size());
+                ara::bench::DoNotOptimize(points);
+            },
+            cIterations),
+        wireSize);
+
+    return 0;
+}
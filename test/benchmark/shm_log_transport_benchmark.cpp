@@ -0,0 +1,126 @@
+/// @file test/benchmark/shm_log_transport_benchmark.cpp
+/// @brief Benchmark of the shared-memory log transport against localhost UDP.
+/// @details A producer hands 64-byte messages to a collector thread, once
+///          with one sendto() per message to a UDP socket read with
+///          recvfrom(), and once through a ShmLogTransport ring drained by
+///          a ShmLogCollector. The reported time is the producer-side cost
+///          per message; the delivered count shows what the consumer got.
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "ara/log/sink/shm_log_transport.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    constexpr std::size_t cIterations{200000U};
+    constexpr std::size_t cMessageSize{64U};
+    const char *const cSocketPath{"/tmp/ara_log_shm_benchmark.sock"};
+}
+
+int main()
+{
+    const std::vector<std::uint8_t> cMessage(cMessageSize, 0x42U);
+
+    // --- Localhost UDP, one datagram per message ---
+    const int cReceiveFd{::socket(AF_INET, SOCK_DGRAM, 0)};
+    const int cSendFd{::socket(AF_INET, SOCK_DGRAM, 0)};
+    sockaddr_in _address;
+    std::memset(&_address, 0, sizeof(_address));
+    _address.sin_family = AF_INET;
+    _address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t _length{sizeof(_address)};
+    ::bind(cReceiveFd, reinterpret_cast<const sockaddr *>(&_address), sizeof(_address));
+    ::getsockname(cReceiveFd, reinterpret_cast<sockaddr *>(&_address), &_length);
+
+    std::atomic_bool _running{true};
+    std::atomic<std::uint64_t> _udpDelivered{0U};
+    std::thread _udpConsumer{[&]
+                             {
+                                 std::uint8_t _buffer[2048];
+                                 while (_running)
+                                 {
+                                     pollfd _pollFd{cReceiveFd, POLLIN, 0};
+                                     if (::poll(&_pollFd, 1U, 10) == 1 &&
+                                         ::recvfrom(cReceiveFd, _buffer, sizeof(_buffer), 0, nullptr, nullptr) > 0)
+                                     {
+                                         ++_udpDelivered;
+                                     }
+                                 }
+                             }};
+    const double cUdpNs{ara::bench::MeasureNsPerOp(
+        [&]()
+        {
+            ::sendto(cSendFd, cMessage.data(), cMessage.size(), 0,
+                     reinterpret_cast<const sockaddr *>(&_address), sizeof(_address));
+        },
+        cIterations)};
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    _running = false;
+    _udpConsumer.join();
+    ::close(cSendFd);
+    ::close(cReceiveFd);
+    ara::bench::Report("UDP sendto per message", cUdpNs, cMessageSize);
+    std::printf("  delivered: %llu of %zu\n",
+                static_cast<unsigned long long>(_udpDelivered.load()),
+                cIterations + cIterations / 10U + 1U);
+
+    // --- Shared-memory ring drained by a collector ---
+    ara::log::sink::ShmLogCollector _collector{cSocketPath};
+    _running = true;
+    std::atomic<std::uint64_t> _shmDelivered{0U};
+    std::thread _shmConsumer{[&]
+                             {
+                                 const auto cHandler =
+                                     [&_shmDelivered](const std::uint8_t *, std::size_t)
+                                 {
+                                     _shmDelivered.fetch_add(1U, std::memory_order_relaxed);
+                                 };
+                                 while (_running)
+                                 {
+                                     if (_collector.Poll(cHandler) == 0U && _collector.PrepareWait())
+                                     {
+                                         pollfd _pollFd{_collector.Fd(), POLLIN, 0};
+                                         ::poll(&_pollFd, 1U, 10);
+                                     }
+                                 }
+                                 _collector.Poll(cHandler);
+                             }};
+
+    ara::log::sink::ShmLogTransportStatistics _statistics;
+    double _shmNs;
+    {
+        ara::log::sink::ShmLogTransport _transport{"BNCH", cSocketPath};
+        if (!_transport.IsConnected())
+        {
+            std::printf("shared-memory registration failed\n");
+        }
+        _shmNs = ara::bench::MeasureNsPerOp(
+            [&]()
+            {
+                _transport.Send(cMessage.data(), cMessage.size());
+            },
+            cIterations);
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        _statistics = _transport.GetStatistics();
+    }
+    _running = false;
+    _shmConsumer.join();
+    ara::bench::Report("ShmLogTransport", _shmNs, cMessageSize);
+    std::printf("  delivered: %llu, dropped: %llu, wake-ups: %llu\n",
+                static_cast<unsigned long long>(_shmDelivered.load()),
+                static_cast<unsigned long long>(_statistics.Dropped),
+                static_cast<unsigned long long>(_statistics.Wakeups));
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+/// @file test/benchmark/udp_batch_benchmark.cpp
+/// @brief Loopback benchmark of per-datagram versus batched UDP I/O.
+/// @details Each operation sends a burst of datagrams over 127.0.0.1 and
+///          drains them on the receiving socket, once with one sendto() and
+///          recvfrom() per datagram and once through UdpBatchSender and
+///          UdpBatchReceiver. Reported are ns per burst, datagrams per second
+///          and system calls per datagram (send and receive side together).
+///
+///          This file is part of the Adaptive AUTOSAR educational implementation.
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include "ara/com/helper/udp_batch.h"
+#include "./benchmark_util.h"
+
+namespace
+{
+    using ara::com::helper::UdpBatchReceiver;
+    using ara::com::helper::UdpBatchSender;
+
+    constexpr std::size_t cBurst{64U};
+    constexpr std::size_t cDatagramSize{200U};
+    constexpr std::size_t cIterations{2000U};
+
+    int openReceiver(sockaddr_in &address)
+    {
+        const int socketFd{::socket(AF_INET, SOCK_DGRAM, 0)};
+        const int bufferSize{4 * 1024 * 1024};
+        ::setsockopt(socketFd, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize));
+        address = sockaddr_in{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t size{sizeof(address)};
+        ::bind(socketFd, reinterpret_cast<sockaddr *>(&address), size);
+        ::getsockname(socketFd, reinterpret_cast<sockaddr *>(&address), &size);
+        return socketFd;
+    }
+
+    void report(const char *name, double nsPerBurst, double syscallsPerDatagram)
+    {
+        ara::bench::Report(name, nsPerBurst, cBurst * cDatagramSize);
+        std::printf("  %.0f msgs/s, %.3f syscalls/msg\n",
+                    cBurst * 1e9 / nsPerBurst, syscallsPerDatagram);
+    }
+}
+
+int main()
+{
+    sockaddr_in address;
+    const int receiving{openReceiver(address)};
+    const int sending{::socket(AF_INET, SOCK_DGRAM, 0)};
+    const std::vector<std::uint8_t> cDatagram(cDatagramSize, 0x5AU);
+
+    std::size_t legacySyscalls{0U};
+    std::size_t legacyDatagrams{0U};
+    std::vector<std::uint8_t> buffer(1500U);
+    const double cLegacy{ara::bench::MeasureNsPerOp(
+        [&]
+        {
+            for (std::size_t i = 0U; i < cBurst; ++i)
+            {
+                ::sendto(sending, cDatagram.data(), cDatagram.size(), 0,
+                         reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+                ++legacySyscalls;
+            }
+            // Drain until the socket reports empty, as a poll loop would.
+            while (true)
+            {
+                ++legacySyscalls;
+                if (::recvfrom(receiving, buffer.data(), buffer.size(), MSG_DONTWAIT,
+                               nullptr, nullptr) <= 0)
+                {
+                    break;
+                }
+                ++legacyDatagrams;
+            }
+        },
+        cIterations)};
+
+    UdpBatchSender sender{sending, address};
+    UdpBatchReceiver receiver{receiving};
+    std::size_t batchedDatagrams{0U};
+    const double cBatched{ara::bench::MeasureNsPerOp(
+        [&]
+        {
+            for (std::size_t i = 0U; i < cBurst; ++i)
+            {
+                sender.Send(cDatagram.data(), cDatagram.size());
+            }
+            sender.Flush();
+            while (receiver.Receive() > 0U)
+            {
+                batchedDatagrams += receiver.Count();
+            }
+        },
+        cIterations)};
+
+    const double cLegacyPerDatagram{
+        static_cast<double>(legacySyscalls) / static_cast<double>(legacyDatagrams)};
+    const auto cSent = sender.GetStatistics();
+    const auto &cReceived = receiver.GetStatistics();
+    const double cBatchedPerDatagram{
+        static_cast<double>(cSent.Syscalls + cReceived.Syscalls) /
+        static_cast<double>(batchedDatagrams)};
+
+    std::printf("%zu datagrams of %zu bytes per burst over loopback\n", cBurst, cDatagramSize);
+    report("sendto/recvfrom per datagram", cLegacy, cLegacyPerDatagram);
+    report("sendmmsg/recvmmsg batches", cBatched, cBatchedPerDatagram);
+
+    ::close(sending);
+    ::close(receiving);
+    return 0;
+}
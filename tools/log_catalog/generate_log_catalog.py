@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""Generate the non-verbose DLT message catalog from C++ sources.
+
+This script scans C++ sources for ara::log non-verbose log sites:
+  - ARA_LOG_MESSAGE("format with {u32} typed {str} placeholders")
+
+For every site it computes the same message ID as ara::log::HashLogSite()
+(FNV-1a over format, file name and line) and writes a JSON catalog that a
+viewer uses to decode non-verbose DLT payloads: message ID (4 bytes LE)
+followed by the argument values in placeholder order.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import re
+import sys
+from pathlib import Path
+from typing import Dict, List, Tuple
+
+
+CPP_SUFFIXES = {".c", ".cc", ".cpp", ".cxx", ".h", ".hh", ".hpp", ".hxx"}
+
+RE_SITE = re.compile(r"\bARA_LOG_MESSAGE\s*\(")
+RE_LITERAL = re.compile(r"\s*\"((?:\\.|[^\"\\])*)\"")
+RE_PLACEHOLDER = re.compile(r"\{([^{}]*)\}")
+
+# Placeholder name -> (encoding, size in bytes or 0 for length-prefixed)
+ARGUMENT_TYPES: Dict[str, Tuple[str, int]] = {
+    "bool": ("bool", 1),
+    "i8": ("sint", 1),
+    "i16": ("sint", 2),
+    "i32": ("sint", 4),
+    "i64": ("sint", 8),
+    "u8": ("uint", 1),
+    "u16": ("uint", 2),
+    "u32": ("uint", 4),
+    "u64": ("uint", 8),
+    "f32": ("float", 4),
+    "f64": ("float", 8),
+    "str": ("string", 0),
+    "raw": ("raw", 0),
+    "level": ("uint", 1),
+}
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+
+
+def decode_cpp_string(value: str) -> bytes:
+    simple = {
+        "n": b"\n",
+        "t": b"\t",
+        "r": b"\r",
+        "0": b"\0",
+        "\\": b"\\",
+        "\"": b"\"",
+        "'": b"'",
+    }
+    result = bytearray()
+    index = 0
+    while index < len(value):
+        char = value[index]
+        if char != "\\":
+            result += char.encode("utf-8")
+            index += 1
+            continue
+
+        escape = value[index + 1]
+        if escape == "x":
+            match = re.match(r"[0-9a-fA-F]+", value[index + 2:])
+            if match is None:
+                raise ValueError(f"invalid hex escape in {value!r}")
+            result.append(int(match.group(0), 16) & 0xFF)
+            index += 2 + len(match.group(0))
+        elif escape in simple:
+            result += simple[escape]
+            index += 2
+        else:
+            raise ValueError(f"unsupported escape \\{escape} in {value!r}")
+    return bytes(result)
+
+
+def hash_log_site(format_bytes: bytes, file_name: str, line: int) -> int:
+    """Mirror of ara::log::HashLogSite()."""
+    value = FNV_OFFSET
+    for byte in format_bytes + b"\0" + file_name.encode("utf-8") + b"\0":
+        value = ((value ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    for byte in line.to_bytes(4, "little"):
+        value = ((value ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    return value if value != 0 else 1
+
+
+def parse_arguments(format_text: str, location: str) -> List[Dict[str, object]]:
+    arguments = []
+    for match in RE_PLACEHOLDER.finditer(format_text):
+        name = match.group(1)
+        if name not in ARGUMENT_TYPES:
+            raise ValueError(
+                f"{location}: unknown placeholder {{{name}}}, expected one of "
+                + ", ".join(sorted(ARGUMENT_TYPES)))
+        encoding, size = ARGUMENT_TYPES[name]
+        argument: Dict[str, object] = {"type": name, "encoding": encoding}
+        if size > 0:
+            argument["size"] = size
+        else:
+            argument["length_prefix"] = 2
+        arguments.append(argument)
+    return arguments
+
+
+def scan_file(path: Path, root: Path) -> List[Dict[str, object]]:
+    text = path.read_text(encoding="utf-8", errors="replace")
+    sites = []
+    for match in RE_SITE.finditer(text):
+        line_start = text.rfind("\n", 0, match.start()) + 1
+        if text[line_start:match.start()].lstrip().startswith(("//", "*")):
+            continue
+
+        # The macro definition itself takes a parameter, not a literal.
+        position = match.end()
+        literal_parts = []
+        literal = RE_LITERAL.match(text, position)
+        while literal is not None:
+            literal_parts.append(literal.group(1))
+            position = literal.end()
+            literal = RE_LITERAL.match(text, position)
+        if not literal_parts:
+            continue
+
+        # __LINE__ resolves to the line of the macro name.
+        line = text.count("\n", 0, match.start()) + 1
+        if "\n" in text[match.start():position]:
+            print(
+                f"warning: {path}:{line}: keep ARA_LOG_MESSAGE and its "
+                "format on one line",
+                file=sys.stderr)
+
+        format_bytes = b"".join(decode_cpp_string(part) for part in literal_parts)
+        format_text = format_bytes.decode("utf-8", errors="replace")
+        location = f"{path}:{line}"
+        message_id = hash_log_site(format_bytes, path.name, line)
+        try:
+            relative = path.resolve().relative_to(root.resolve()).as_posix()
+        except ValueError:
+            relative = path.as_posix()
+
+        sites.append({
+            "id": message_id,
+            "id_hex": f"0x{message_id:08X}",
+            "format": format_text,
+            "file": relative,
+            "line": line,
+            "arguments": parse_arguments(format_text, location),
+        })
+    return sites
+
+
+def iter_sources(inputs: List[Path]):
+    for entry in inputs:
+        if entry.is_file():
+            if entry.suffix in CPP_SUFFIXES:
+                yield entry
+            continue
+        for path in sorted(entry.rglob("*")):
+            if path.is_file() and path.suffix in CPP_SUFFIXES:
+                yield path
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(
+        description="Generate the non-verbose DLT message catalog.")
+    parser.add_argument(
+        "--input", action="append", required=True, type=Path,
+        help="Source file or directory to scan (repeatable)")
+    parser.add_argument(
+        "--root", type=Path, default=Path.cwd(),
+        help="Directory that catalog file paths are relative to")
+    parser.add_argument(
+        "--output", required=True, type=Path,
+        help="Catalog JSON output path")
+    args = parser.parse_args()
+
+    messages: Dict[int, Dict[str, object]] = {}
+    try:
+        for path in iter_sources(args.input):
+            for site in scan_file(path, args.root):
+                previous = messages.get(site["id"])
+                if previous is not None and previous != site:
+                    print(
+                        f"error: message ID {site['id_hex']} of "
+                        f"{site['file']}:{site['line']} collides with "
+                        f"{previous['file']}:{previous['line']}",
+                        file=sys.stderr)
+                    return 1
+                messages[site["id"]] = site
+    except ValueError as error:
+        print(f"error: {error}", file=sys.stderr)
+        return 1
+
+    catalog = {
+        "format": "ara-log-nonverbose-catalog",
+        "version": 1,
+        "byte_order": "little-endian",
+        "message_id_size": 4,
+        "messages": [messages[key] for key in sorted(messages)],
+    }
+
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    content = json.dumps(catalog, indent=2) + "\n"
+    if not args.output.exists() or args.output.read_text(encoding="utf-8") != content:
+        args.output.write_text(content, encoding="utf-8")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())